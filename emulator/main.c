@@ -24,6 +24,7 @@
 #include "vhci.h"
 #include "amp.h"
 #include "le.h"
+#include "storm.h"
 
 static void signal_callback(int signum, void *user_data)
 {
@@ -49,6 +50,8 @@ static void usage(void)
 		"\t-B                    Create BR/EDR only controller\n"
 		"\t-A                    Create AMP controller\n"
 		"\t-T[num]               Number of test AMP controllers\n"
+		"\t-F[num]               Advertising storm from num devices\n"
+		"\t-R<rate>              Advertising storm reports per second\n"
 		"\t-h, --help            Show help options\n");
 }
 
@@ -61,6 +64,8 @@ static const struct option main_options[] = {
 	{ "amp",     no_argument,       NULL, 'A' },
 	{ "letest",  optional_argument, NULL, 'U' },
 	{ "amptest", optional_argument, NULL, 'T' },
+	{ "storm",   optional_argument, NULL, 'F' },
+	{ "rate",    required_argument, NULL, 'R' },
 	{ "version", no_argument,	NULL, 'v' },
 	{ "help",    no_argument,	NULL, 'h' },
 	{ }
@@ -77,6 +82,8 @@ int main(int argc, char *argv[])
 	bool serial_enabled = false;
 	int letest_count = 0;
 	int amptest_count = 0;
+	int storm_devices = 0;
+	int storm_rate = 10000;
 	int vhci_count = 0;
 	enum vhci_type vhci_type = VHCI_TYPE_BREDRLE;
 	int i;
@@ -86,7 +93,7 @@ int main(int argc, char *argv[])
 	for (;;) {
 		int opt;
 
-		opt = getopt_long(argc, argv, "Ssl::LBAU::T::vh",
+		opt = getopt_long(argc, argv, "Ssl::LBAU::T::F::R:vh",
 						main_options, NULL);
 		if (opt < 0)
 			break;
@@ -125,6 +132,15 @@ int main(int argc, char *argv[])
 			else
 				amptest_count = 1;
 			break;
+		case 'F':
+			if (optarg)
+				storm_devices = atoi(optarg);
+			else
+				storm_devices = 1000;
+			break;
+		case 'R':
+			storm_rate = atoi(optarg);
+			break;
 		case 'v':
 			printf("%s\n", VERSION);
 			return EXIT_SUCCESS;
@@ -136,7 +152,7 @@ int main(int argc, char *argv[])
 		}
 	}
 
-	if (letest_count < 1 && amptest_count < 1 &&
+	if (letest_count < 1 && amptest_count < 1 && storm_devices < 1 &&
 			vhci_count < 1 && !server_enabled && !serial_enabled) {
 		fprintf(stderr, "No emulator specified\n");
 		return EXIT_FAILURE;
@@ -164,6 +180,16 @@ int main(int argc, char *argv[])
 		}
 	}
 
+	if (storm_devices > 0) {
+		struct bt_storm *storm;
+
+		storm = bt_storm_new(storm_devices, storm_rate);
+		if (!storm) {
+			fprintf(stderr, "Failed to create advertising storm\n");
+			return EXIT_FAILURE;
+		}
+	}
+
 	for (i = 0; i < vhci_count; i++) {
 		struct vhci *vhci;
 
@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "src/shared/util.h"
+#include "src/shared/mainloop.h"
+
+#include "phy.h"
+#include "storm.h"
+
+/*
+ * Advertising storm: floods the emulated PHY with ADV_IND packets from a
+ * large set of random static addresses so that LE test controllers created
+ * with -U report them to the host as fast as it can take them.
+ */
+
+#define STORM_TICK_MSEC		10
+
+struct bt_storm {
+	volatile int ref_count;
+	struct bt_phy *phy;
+	unsigned int devices;
+	unsigned int rate;
+	uint64_t total;
+	unsigned int next;
+	unsigned int counter;
+	unsigned int sent;
+	int tick_id;
+	int stats_id;
+	struct timespec start;
+	struct timespec last;
+};
+
+static double elapsed_sec(const struct timespec *from,
+						const struct timespec *to)
+{
+	return (to->tv_sec - from->tv_sec) +
+				(to->tv_nsec - from->tv_nsec) / 1e9;
+}
+
+static void send_adv(struct bt_storm *storm)
+{
+	struct bt_phy_pkt_adv pkt;
+	uint8_t data[31];
+	uint8_t len = 0;
+	char name[17];
+	int name_len;
+	unsigned int idx = storm->next++ % storm->devices;
+	uint8_t chan;
+
+	memset(&pkt, 0, sizeof(pkt));
+	pkt.pdu_type = 0x00;
+	pkt.tx_addr_type = 0x01;
+	put_le32(idx, pkt.tx_addr);
+	pkt.tx_addr[4] = 0x5e;
+	pkt.tx_addr[5] = 0xc0;
+
+	/* Flags */
+	data[len++] = 0x02;
+	data[len++] = 0x01;
+	data[len++] = 0x06;
+
+	/* Shortened local name */
+	name_len = snprintf(name, sizeof(name), "storm-%u", idx);
+	data[len++] = name_len + 1;
+	data[len++] = 0x08;
+	memcpy(data + len, name, name_len);
+	len += name_len;
+
+	/* Manufacturer data with a changing counter */
+	data[len++] = 0x07;
+	data[len++] = 0xff;
+	put_le16(0x05f1, data + len);
+	put_le32(storm->counter++, data + len + 2);
+	len += 6;
+
+	pkt.adv_data_len = len;
+
+	/* Send on every channel so the scanner sees it in any window */
+	for (chan = 37; chan <= 39; chan++) {
+		pkt.chan_idx = chan;
+		bt_phy_send_vector(storm->phy, BT_PHY_PKT_ADV,
+					&pkt, sizeof(pkt), data, len, NULL, 0);
+	}
+
+	storm->sent++;
+	storm->total++;
+}
+
+static void tick_callback(int id, void *user_data)
+{
+	struct bt_storm *storm = user_data;
+	struct timespec now;
+	uint64_t due;
+
+	/* Catch up with the configured rate since the start */
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	due = elapsed_sec(&storm->start, &now) * storm->rate;
+
+	while (storm->total < due)
+		send_adv(storm);
+
+	if (mainloop_modify_timeout(id, STORM_TICK_MSEC) < 0) {
+		fprintf(stderr, "Setting storm timeout failed\n");
+		mainloop_remove_timeout(id);
+		storm->tick_id = -1;
+	}
+}
+
+static void stats_callback(int id, void *user_data)
+{
+	struct bt_storm *storm = user_data;
+	struct timespec now;
+	double elapsed;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	elapsed = elapsed_sec(&storm->last, &now);
+	if (elapsed > 0)
+		printf("Storm: %u devices, %.0f reports/sec\n",
+					storm->devices, storm->sent / elapsed);
+
+	storm->sent = 0;
+	storm->last = now;
+
+	if (mainloop_modify_timeout(id, 1000) < 0) {
+		mainloop_remove_timeout(id);
+		storm->stats_id = -1;
+	}
+}
+
+struct bt_storm *bt_storm_new(unsigned int devices, unsigned int rate)
+{
+	struct bt_storm *storm;
+
+	if (!devices || !rate)
+		return NULL;
+
+	storm = calloc(1, sizeof(*storm));
+	if (!storm)
+		return NULL;
+
+	storm->devices = devices;
+	storm->rate = rate;
+
+	storm->phy = bt_phy_new();
+	if (!storm->phy) {
+		free(storm);
+		return NULL;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &storm->start);
+	storm->last = storm->start;
+
+	storm->tick_id = mainloop_add_timeout(STORM_TICK_MSEC, tick_callback,
+								storm, NULL);
+	storm->stats_id = mainloop_add_timeout(1000, stats_callback,
+								storm, NULL);
+
+	return bt_storm_ref(storm);
+}
+
+struct bt_storm *bt_storm_ref(struct bt_storm *storm)
+{
+	if (!storm)
+		return NULL;
+
+	__sync_fetch_and_add(&storm->ref_count, 1);
+
+	return storm;
+}
+
+void bt_storm_unref(struct bt_storm *storm)
+{
+	if (!storm)
+		return;
+
+	if (__sync_sub_and_fetch(&storm->ref_count, 1))
+		return;
+
+	if (storm->tick_id > 0)
+		mainloop_remove_timeout(storm->tick_id);
+
+	if (storm->stats_id > 0)
+		mainloop_remove_timeout(storm->stats_id);
+
+	bt_phy_unref(storm->phy);
+
+	free(storm);
+}
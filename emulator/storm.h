@@ -0,0 +1,18 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#include <stdbool.h>
+
+struct bt_storm;
+
+struct bt_storm *bt_storm_new(unsigned int devices, unsigned int rate);
+
+struct bt_storm *bt_storm_ref(struct bt_storm *storm);
+void bt_storm_unref(struct bt_storm *storm);
@@ -34,6 +34,18 @@ struct mesh_app_key {
 	uint8_t new_key_aid;
 };
 
+#define AID_BUCKETS	(KEY_AID_MASK + 1)
+
+struct aid_bucket {
+	struct l_queue *keys;
+	uint32_t misses;
+};
+
+/* App keys of a network bucketed by AID, so RX only tries candidate keys */
+struct appkey_index {
+	struct aid_bucket buckets[AID_BUCKETS];
+};
+
 static bool match_key_index(const void *a, const void *b)
 {
 	const struct mesh_app_key *key = a;
@@ -50,6 +62,107 @@ static bool match_bound_key(const void *a, const void *b)
 	return key->net_idx == idx;
 }
 
+static void index_insert(struct appkey_index *index, uint8_t key_aid,
+						struct mesh_app_key *key)
+{
+	struct aid_bucket *bucket = &index->buckets[key_aid & KEY_AID_MASK];
+
+	if (!bucket->keys)
+		bucket->keys = l_queue_new();
+
+	l_queue_push_tail(bucket->keys, key);
+
+	if (l_queue_length(bucket->keys) > 1)
+		l_debug("AID %2.2x shared by %u app keys", key_aid & KEY_AID_MASK,
+					l_queue_length(bucket->keys));
+}
+
+static void index_delete(struct appkey_index *index, uint8_t key_aid,
+						struct mesh_app_key *key)
+{
+	struct aid_bucket *bucket = &index->buckets[key_aid & KEY_AID_MASK];
+
+	l_queue_remove(bucket->keys, key);
+
+	if (l_queue_isempty(bucket->keys)) {
+		l_queue_destroy(bucket->keys, NULL);
+		bucket->keys = NULL;
+	}
+}
+
+static void index_add_key(struct mesh_net *net, struct mesh_app_key *key)
+{
+	struct appkey_index *index = mesh_net_get_app_index(net);
+
+	if (!index)
+		return;
+
+	index_insert(index, key->key_aid, key);
+
+	if (key->new_key_aid != NET_NID_INVALID &&
+					key->new_key_aid != key->key_aid)
+		index_insert(index, key->new_key_aid, key);
+}
+
+static void index_remove_key(struct mesh_net *net, struct mesh_app_key *key)
+{
+	struct appkey_index *index = mesh_net_get_app_index(net);
+
+	if (!index)
+		return;
+
+	index_delete(index, key->key_aid, key);
+
+	if (key->new_key_aid != NET_NID_INVALID &&
+					key->new_key_aid != key->key_aid)
+		index_delete(index, key->new_key_aid, key);
+}
+
+struct appkey_index *appkey_index_new(void)
+{
+	return l_new(struct appkey_index, 1);
+}
+
+void appkey_index_free(struct appkey_index *index)
+{
+	int i;
+
+	if (!index)
+		return;
+
+	for (i = 0; i < AID_BUCKETS; i++) {
+		struct aid_bucket *bucket = &index->buckets[i];
+
+		if (bucket->misses || l_queue_length(bucket->keys) > 1)
+			l_debug("AID %2.2x: %u keys, %u misses", i,
+					l_queue_length(bucket->keys),
+					bucket->misses);
+
+		l_queue_destroy(bucket->keys, NULL);
+	}
+
+	l_free(index);
+}
+
+const struct l_queue_entry *appkey_aid_keys(struct mesh_net *net,
+							uint8_t key_aid)
+{
+	struct appkey_index *index = mesh_net_get_app_index(net);
+
+	if (!index)
+		return NULL;
+
+	return l_queue_get_entries(index->buckets[key_aid & KEY_AID_MASK].keys);
+}
+
+void appkey_aid_miss(struct mesh_net *net, uint8_t key_aid)
+{
+	struct appkey_index *index = mesh_net_get_app_index(net);
+
+	if (index)
+		index->buckets[key_aid & KEY_AID_MASK].misses++;
+}
+
 static struct mesh_app_key *app_key_new(void)
 {
 	struct mesh_app_key *key = l_new(struct mesh_app_key, 1);
@@ -117,6 +230,7 @@ bool appkey_key_init(struct mesh_net *net, uint16_t net_idx, uint16_t app_idx,
 		return false;
 
 	l_queue_push_tail(app_keys, key);
+	index_add_key(net, key);
 
 	return true;
 }
@@ -238,8 +352,14 @@ int appkey_key_update(struct mesh_net *net, uint16_t net_idx, uint16_t app_idx,
 	if (memcmp(new_key, key->new_key, 16) == 0)
 		return MESH_STATUS_SUCCESS;
 
-	if (!set_key(key, app_idx, new_key, true))
+	index_remove_key(net, key);
+
+	if (!set_key(key, app_idx, new_key, true)) {
+		index_add_key(net, key);
 		return MESH_STATUS_INSUFF_RESOURCES;
+	}
+
+	index_add_key(net, key);
 
 	node = mesh_net_node_get(net);
 
@@ -293,6 +413,7 @@ int appkey_key_add(struct mesh_net *net, uint16_t net_idx, uint16_t app_idx,
 	key->net_idx = net_idx;
 	key->app_idx = app_idx;
 	l_queue_push_tail(app_keys, key);
+	index_add_key(net, key);
 
 	return MESH_STATUS_SUCCESS;
 }
@@ -321,6 +442,7 @@ int appkey_key_delete(struct mesh_net *net, uint16_t net_idx,
 	node_app_key_delete(node, net_idx, app_idx);
 
 	l_queue_remove(app_keys, key);
+	index_remove_key(net, key);
 	appkey_key_free(key);
 
 	if (!mesh_config_app_key_del(node_config_get(node), net_idx, app_idx))
@@ -345,6 +467,7 @@ void appkey_delete_bound_keys(struct mesh_net *net, uint16_t net_idx)
 					L_UINT_TO_PTR(net_idx));
 
 	while (key) {
+		index_remove_key(net, key);
 		node_app_key_delete(node, net_idx, key->app_idx);
 		mesh_config_app_key_del(node_config_get(node), net_idx,
 								key->app_idx);
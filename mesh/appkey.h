@@ -12,6 +12,13 @@
 #define MAX_APP_KEYS	32
 
 struct mesh_app_key;
+struct appkey_index;
+
+struct appkey_index *appkey_index_new(void);
+void appkey_index_free(struct appkey_index *index);
+const struct l_queue_entry *appkey_aid_keys(struct mesh_net *net,
+							uint8_t key_aid);
+void appkey_aid_miss(struct mesh_net *net, uint8_t key_aid);
 
 bool appkey_key_init(struct mesh_net *net, uint16_t net_idx, uint16_t app_idx,
 				uint8_t *key_value, uint8_t *new_key_value);
@@ -17,6 +17,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <ftw.h>
+#include <inttypes.h>
 #include <libgen.h>
 #include <limits.h>
 #include <stdio.h>
@@ -37,15 +38,31 @@
 #define MIN_SEQ_CACHE_VALUE	(2 * 32)
 #define MIN_SEQ_CACHE_TIME	(5 * 60)
 
+/*
+ * Node file writes are deferred and coalesced: each request postpones the
+ * write by SAVE_DELAY_MS, but never past SAVE_MAX_LATENCY_MS after the
+ * first pending request.
+ */
+#define SAVE_DELAY_MS		100
+#define SAVE_MAX_LATENCY_MS	1000
+
+/* Journaled updates before the node file gets rewritten anyway */
+#define JOURNAL_MAX_RECORDS	256
+
 #define CHECK_KEY_IDX_RANGE(x) ((x) <= 4095)
 
 struct mesh_config {
 	json_object *jnode;
 	char *node_dir_path;
+	char *journal_path;
 	uint8_t uuid[16];
 	uint32_t write_seq;
 	struct timeval write_time;
-	struct l_queue *idles;
+	struct l_timeout *save_timeout;
+	uint64_t save_deadline;
+	struct l_queue *save_reqs;
+	int journal_fd;
+	unsigned int journal_records;
 };
 
 struct write_info {
@@ -57,11 +74,13 @@ struct write_info {
 static const char *cfgnode_name = "/node.json";
 static const char *bak_ext = ".bak";
 static const char *tmp_ext = ".tmp";
+static const char *journal_ext = ".journal";
+
+static int json_flags = JSON_C_TO_STRING_PRETTY;
 
-static bool save_config(json_object *jnode, const char *fname)
+static bool save_config(const char *str, const char *fname)
 {
 	FILE *outfile;
-	const char *str;
 	bool result = false;
 
 	outfile = fopen(fname, "w");
@@ -70,8 +89,6 @@ static bool save_config(json_object *jnode, const char *fname)
 		return false;
 	}
 
-	str = json_object_to_json_string_ext(jnode, JSON_C_TO_STRING_PRETTY);
-
 	if (fwrite(str, sizeof(char), strlen(str), outfile) < strlen(str))
 		l_warn("Incomplete write of mesh configuration");
 	else
@@ -82,6 +99,11 @@ static bool save_config(json_object *jnode, const char *fname)
 	return result;
 }
 
+static bool save_node(struct mesh_config *cfg)
+{
+	return mesh_config_save(cfg, false, NULL, NULL);
+}
+
 static bool get_int(json_object *jobj, const char *keyword, int *value)
 {
 	json_object *jvalue;
@@ -585,6 +607,166 @@ static bool write_int(json_object *jobj, const char *desc, int val)
 	return true;
 }
 
+/*
+ * Small top level updates are appended to a journal next to the node file
+ * instead of rewriting it. The journal starts with a header naming the node
+ * file contents it applies to, so a journal left behind by a crash in the
+ * middle of a full write is recognized as stale and discarded.
+ */
+static uint64_t config_hash(const char *str, size_t len)
+{
+	uint64_t hash = 0xcbf29ce484222325ull;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		hash ^= (uint8_t) str[i];
+		hash *= 0x100000001b3ull;
+	}
+
+	return hash;
+}
+
+static int journal_header(char *hdr, size_t size, const char *str,
+								size_t len)
+{
+	return snprintf(hdr, size, "{\"base\":\"%zx-%16.16" PRIx64 "\"}\n",
+						len, config_hash(str, len));
+}
+
+static void journal_close(struct mesh_config *cfg)
+{
+	if (cfg->journal_fd >= 0)
+		close(cfg->journal_fd);
+
+	cfg->journal_fd = -1;
+	cfg->journal_records = 0;
+}
+
+static bool journal_reset(struct mesh_config *cfg, const char *str)
+{
+	char *fname_tmp;
+	char hdr[64];
+	int fd, len;
+
+	journal_close(cfg);
+
+	if (!cfg->journal_path)
+		return false;
+
+	len = journal_header(hdr, sizeof(hdr), str, strlen(str));
+
+	fname_tmp = l_strdup_printf("%s%s", cfg->journal_path, tmp_ext);
+
+	fd = open(fname_tmp, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND,
+							S_IRUSR | S_IWUSR);
+	if (fd < 0)
+		goto fail;
+
+	if (write(fd, hdr, len) != len || fdatasync(fd) < 0 ||
+				rename(fname_tmp, cfg->journal_path) < 0) {
+		close(fd);
+		goto fail;
+	}
+
+	l_free(fname_tmp);
+	cfg->journal_fd = fd;
+
+	return true;
+
+fail:
+	remove(fname_tmp);
+	l_free(fname_tmp);
+
+	/* Without a journal every update rewrites the node file */
+	l_warn("Failed to reset configuration journal");
+
+	return false;
+}
+
+/* Records the top level values already updated in jnode */
+static bool journal_append(struct mesh_config *cfg, const char *rec, int len)
+{
+	if (cfg->journal_fd < 0 || cfg->journal_records >= JOURNAL_MAX_RECORDS)
+		return save_node(cfg);
+
+	if (write(cfg->journal_fd, rec, len) != len ||
+					fdatasync(cfg->journal_fd) < 0) {
+		/* A torn record ends replay, drop the journal */
+		journal_close(cfg);
+		remove(cfg->journal_path);
+
+		return save_node(cfg);
+	}
+
+	cfg->journal_records++;
+	gettimeofday(&cfg->write_time, NULL);
+
+	return true;
+}
+
+static bool journal_write_int(struct mesh_config *cfg, const char *desc,
+								int val)
+{
+	char rec[64];
+	int len;
+
+	if (!write_int(cfg->jnode, desc, val))
+		return false;
+
+	len = snprintf(rec, sizeof(rec), "{\"%s\":%d}\n", desc, val);
+
+	return journal_append(cfg, rec, len);
+}
+
+/* Applies a journal that matches the node file contents in str */
+static void journal_replay(json_object *jnode, const char *fname,
+						const char *str, size_t len)
+{
+	char *journal, *line, *next;
+	char hdr[64];
+	size_t sz;
+	int hdr_len, records = 0;
+
+	journal = l_file_get_contents(fname, &sz);
+	if (!journal)
+		return;
+
+	hdr_len = journal_header(hdr, sizeof(hdr), str, len);
+
+	if (sz < (size_t) hdr_len || memcmp(journal, hdr, hdr_len)) {
+		l_info("Discarding stale configuration journal %s", fname);
+		goto done;
+	}
+
+	/* A torn last record has no line feed and is ignored */
+	for (line = journal + hdr_len; (next = memchr(line, '\n',
+				journal + sz - line)); line = next + 1) {
+		json_object *jrec;
+
+		*next = '\0';
+
+		jrec = json_tokener_parse(line);
+		if (!jrec || !json_object_is_type(jrec, json_type_object)) {
+			json_object_put(jrec);
+			break;
+		}
+
+		json_object_object_foreach(jrec, key, val) {
+			json_object_object_del(jnode, key);
+			json_object_object_add(jnode, key, json_object_get(val));
+		}
+
+		json_object_put(jrec);
+		records++;
+	}
+
+	if (records)
+		l_debug("Applied %d journaled updates from %s", records, fname);
+
+done:
+	l_free(journal);
+}
+
 bool mesh_config_net_key_add(struct mesh_config *cfg, uint16_t idx,
 							const uint8_t key[16])
 {
@@ -626,7 +808,7 @@ bool mesh_config_net_key_add(struct mesh_config *cfg, uint16_t idx,
 
 	json_object_array_add(jarray, jentry);
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 
 fail:
 	if (jentry)
@@ -668,7 +850,7 @@ bool mesh_config_net_key_update(struct mesh_config *cfg, uint16_t idx,
 	json_object_object_add(jentry, "keyRefresh",
 				json_object_new_int(KEY_REFRESH_PHASE_ONE));
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_net_key_del(struct mesh_config *cfg, uint16_t idx)
@@ -688,7 +870,7 @@ bool mesh_config_net_key_del(struct mesh_config *cfg, uint16_t idx)
 	if (!json_object_array_length(jarray))
 		json_object_object_del(jnode, "netKeys");
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_write_device_key(struct mesh_config *cfg, uint8_t *key)
@@ -696,7 +878,7 @@ bool mesh_config_write_device_key(struct mesh_config *cfg, uint8_t *key)
 	if (!cfg || !add_key_value(cfg->jnode, "deviceKey", key))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_write_token(struct mesh_config *cfg, uint8_t *token)
@@ -704,7 +886,7 @@ bool mesh_config_write_token(struct mesh_config *cfg, uint8_t *token)
 	if (!cfg || !add_u64_value(cfg->jnode, "token", token))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_app_key_add(struct mesh_config *cfg, uint16_t net_idx,
@@ -747,7 +929,7 @@ bool mesh_config_app_key_add(struct mesh_config *cfg, uint16_t net_idx,
 
 	json_object_array_add(jarray, jentry);
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 
 fail:
 
@@ -789,7 +971,7 @@ bool mesh_config_app_key_update(struct mesh_config *cfg, uint16_t app_idx,
 	if (!add_key_value(jentry, "key", key))
 		return false;
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_app_key_del(struct mesh_config *cfg, uint16_t net_idx,
@@ -810,7 +992,7 @@ bool mesh_config_app_key_del(struct mesh_config *cfg, uint16_t net_idx,
 	if (!json_object_array_length(jarray))
 		json_object_object_del(jnode, "appKeys");
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_model_binding_add(struct mesh_config *cfg, uint16_t ele_addr,
@@ -855,7 +1037,7 @@ bool mesh_config_model_binding_add(struct mesh_config *cfg, uint16_t ele_addr,
 
 	json_object_array_add(jarray, jstring);
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_model_binding_del(struct mesh_config *cfg, uint16_t ele_addr,
@@ -889,7 +1071,7 @@ bool mesh_config_model_binding_del(struct mesh_config *cfg, uint16_t ele_addr,
 	if (!json_object_array_length(jarray))
 		json_object_object_del(jmodel, "bind");
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 static void free_model(void *data)
@@ -1475,7 +1657,7 @@ bool mesh_config_write_mode(struct mesh_config *cfg, const char *keyword,
 	if (!cfg || !write_mode(cfg->jnode, keyword, value))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 static bool write_relay_mode(json_object *jobj, uint8_t mode,
@@ -1511,7 +1693,7 @@ bool mesh_config_write_unicast(struct mesh_config *cfg, uint16_t unicast)
 	if (!cfg || !write_uint16_hex(cfg->jnode, "unicastAddress", unicast))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_write_relay_mode(struct mesh_config *cfg, uint8_t mode,
@@ -1521,7 +1703,7 @@ bool mesh_config_write_relay_mode(struct mesh_config *cfg, uint8_t mode,
 	if (!cfg || !write_relay_mode(cfg->jnode, mode, count, interval))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_write_net_transmit(struct mesh_config *cfg, uint8_t cnt,
@@ -1547,7 +1729,7 @@ bool mesh_config_write_net_transmit(struct mesh_config *cfg, uint8_t cnt,
 	json_object_object_del(jnode, "retransmit");
 	json_object_object_add(jnode, "retransmit", jrtx);
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 
 fail:
 	json_object_put(jrtx);
@@ -1560,6 +1742,8 @@ bool mesh_config_write_iv_index(struct mesh_config *cfg, uint32_t idx,
 {
 	json_object *jnode;
 	int tmp = update ? 1 : 0;
+	char rec[64];
+	int len;
 
 	if (!cfg)
 		return false;
@@ -1572,7 +1756,11 @@ bool mesh_config_write_iv_index(struct mesh_config *cfg, uint32_t idx,
 	if (!write_int(jnode, "IVupdate", tmp))
 		return false;
 
-	return save_config(jnode, cfg->node_dir_path);
+	/* Both values in one record, so they are replayed together */
+	len = snprintf(rec, sizeof(rec), "{\"IVindex\":%d,\"IVupdate\":%d}\n",
+							(int) idx, tmp);
+
+	return journal_append(cfg, rec, len);
 }
 
 static void add_model(void *a, void *b)
@@ -1699,8 +1887,9 @@ static struct mesh_config *create_config(const char *cfg_path,
 	cfg->jnode = jnode;
 	memcpy(cfg->uuid, uuid, 16);
 	cfg->node_dir_path = l_strdup(cfg_path);
+	cfg->journal_path = l_strdup_printf("%s%s", cfg_path, journal_ext);
+	cfg->journal_fd = -1;
 	cfg->write_seq = node->seq_number;
-	cfg->idles = l_queue_new();
 	gettimeofday(&cfg->write_time, NULL);
 
 	return cfg;
@@ -1802,7 +1991,7 @@ bool mesh_config_net_key_set_phase(struct mesh_config *cfg, uint16_t idx,
 		finish_key_refresh(jnode, idx);
 	}
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_model_pub_add(struct mesh_config *cfg, uint16_t ele_addr,
@@ -1865,7 +2054,7 @@ bool mesh_config_model_pub_add(struct mesh_config *cfg, uint16_t ele_addr,
 	json_object_object_add(jpub, "retransmit", jrtx);
 	json_object_object_add(jmodel, "publish", jpub);
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 
 fail:
 	json_object_put(jpub);
@@ -1898,7 +2087,7 @@ bool mesh_config_model_pub_del(struct mesh_config *cfg, uint16_t addr,
 								"publish"))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 static void del_page(json_object *jarray, uint8_t page)
@@ -1958,7 +2147,7 @@ bool mesh_config_comp_page_add(struct mesh_config *cfg, uint8_t page,
 	json_object_array_add(jarray, jstring);
 	l_free(buf);
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_comp_page_mv(struct mesh_config *cfg, uint8_t old, uint8_t nw)
@@ -2056,7 +2245,7 @@ bool mesh_config_model_sub_add(struct mesh_config *cfg, uint16_t ele_addr,
 
 	json_object_array_add(jarray, jstring);
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_model_sub_del(struct mesh_config *cfg, uint16_t ele_addr,
@@ -2096,7 +2285,7 @@ bool mesh_config_model_sub_del(struct mesh_config *cfg, uint16_t ele_addr,
 	if (!json_object_array_length(jarray))
 		json_object_object_del(jmodel, "subscribe");
 
-	return save_config(jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_model_sub_del_all(struct mesh_config *cfg, uint16_t addr,
@@ -2106,7 +2295,7 @@ bool mesh_config_model_sub_del_all(struct mesh_config *cfg, uint16_t addr,
 								"subscribe"))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_model_pub_enable(struct mesh_config *cfg, uint16_t ele_addr,
@@ -2135,7 +2324,7 @@ bool mesh_config_model_pub_enable(struct mesh_config *cfg, uint16_t ele_addr,
 	if (!enable)
 		json_object_object_del(jmodel, "publish");
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_model_sub_enable(struct mesh_config *cfg, uint16_t ele_addr,
@@ -2164,7 +2353,7 @@ bool mesh_config_model_sub_enable(struct mesh_config *cfg, uint16_t ele_addr,
 	if (!enable)
 		json_object_object_del(jmodel, "subscribe");
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_write_seq_number(struct mesh_config *cfg, uint32_t seq,
@@ -2206,15 +2395,18 @@ bool mesh_config_write_seq_number(struct mesh_config *cfg, uint32_t seq,
 		elapsed_ms = elapsed.tv_sec * 1000 + elapsed.tv_usec / 1000;
 
 		/*
-		 * If time since last write is zero, this means that
-		 * idle_save_config is already pending, so we don't need to do
-		 * anything.
+		 * The new value is appended to the journal right away, or,
+		 * without a journal, the node file write is coalesced and
+		 * happens SAVE_DELAY_MS to SAVE_MAX_LATENCY_MS later. In both
+		 * cases write_time is set when the value reaches the disk, so
+		 * a zero interval only means no rate can be estimated yet.
+		 * Fall back to the minimum overcommit below in that case.
 		 */
-		if (!elapsed_ms)
-			return true;
-
-		cached = seq + (seq - cfg->write_seq) *
+		if (elapsed_ms)
+			cached = seq + (seq - cfg->write_seq) *
 					1000 * MIN_SEQ_CACHE_TIME / elapsed_ms;
+		else
+			cached = seq;
 
 		if (cached < seq + MIN_SEQ_CACHE_VALUE)
 			cached = seq + MIN_SEQ_CACHE_VALUE;
@@ -2234,10 +2426,7 @@ bool mesh_config_write_seq_number(struct mesh_config *cfg, uint32_t seq,
 
 		l_debug("Seq Cache: %d -> %d", seq, cached);
 
-		if (!write_int(cfg->jnode, "sequenceNumber", cached))
-		    return false;
-
-		return mesh_config_save(cfg, false, NULL, NULL);
+		return journal_write_int(cfg, "sequenceNumber", cached);
 	}
 
 	return true;
@@ -2245,10 +2434,10 @@ bool mesh_config_write_seq_number(struct mesh_config *cfg, uint32_t seq,
 
 bool mesh_config_write_ttl(struct mesh_config *cfg, uint8_t ttl)
 {
-	if (!cfg || !write_int(cfg->jnode, "defaultTTL", ttl))
+	if (!cfg)
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return journal_write_int(cfg, "defaultTTL", ttl);
 }
 
 bool mesh_config_update_company_id(struct mesh_config *cfg, uint16_t cid)
@@ -2256,7 +2445,7 @@ bool mesh_config_update_company_id(struct mesh_config *cfg, uint16_t cid)
 	if (!cfg || !write_uint16_hex(cfg->jnode, "cid", cid))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_update_product_id(struct mesh_config *cfg, uint16_t pid)
@@ -2264,7 +2453,7 @@ bool mesh_config_update_product_id(struct mesh_config *cfg, uint16_t pid)
 	if (!cfg || !write_uint16_hex(cfg->jnode, "pid", pid))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_update_version_id(struct mesh_config *cfg, uint16_t vid)
@@ -2272,7 +2461,7 @@ bool mesh_config_update_version_id(struct mesh_config *cfg, uint16_t vid)
 	if (!cfg || !write_uint16_hex(cfg->jnode, "vid", vid))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
 bool mesh_config_update_crpl(struct mesh_config *cfg, uint16_t crpl)
@@ -2280,10 +2469,11 @@ bool mesh_config_update_crpl(struct mesh_config *cfg, uint16_t crpl)
 	if (!cfg || !write_uint16_hex(cfg->jnode, "crpl", crpl))
 		return false;
 
-	return save_config(cfg->jnode, cfg->node_dir_path);
+	return save_node(cfg);
 }
 
-static bool load_node(const char *fname, const uint8_t uuid[16],
+static bool load_node(const char *fname, const char *jname,
+				const uint8_t uuid[16],
 				mesh_config_node_func_t cb, void *user_data)
 {
 	int fd;
@@ -2326,6 +2516,8 @@ static bool load_node(const char *fname, const uint8_t uuid[16],
 	if (!jnode)
 		goto done;
 
+	journal_replay(jnode, jname, str, st.st_size);
+
 	memset(&node, 0, sizeof(node));
 
 	node.elements = l_queue_new();
@@ -2341,14 +2533,15 @@ static bool load_node(const char *fname, const uint8_t uuid[16],
 		cfg->jnode = jnode;
 		memcpy(cfg->uuid, uuid, 16);
 		cfg->node_dir_path = l_strdup(fname);
+		cfg->journal_path = l_strdup(jname);
+		cfg->journal_fd = -1;
 		cfg->write_seq = node.seq_number;
-		cfg->idles = l_queue_new();
 		gettimeofday(&cfg->write_time, NULL);
 
 		result = cb(&node, uuid, cfg, user_data);
 
 		if (!result) {
-			l_free(cfg->idles);
+			l_free(cfg->journal_path);
 			l_free(cfg->node_dir_path);
 			l_free(cfg);
 		}
@@ -2372,42 +2565,37 @@ done:
 	return result;
 }
 
-static void release_idle(void *data)
+static void save_complete(void *data, void *user_data)
 {
-	struct l_idle *idle = data;
+	struct write_info *info = data;
+	bool result = L_PTR_TO_UINT(user_data);
 
-	l_idle_remove(idle);
-}
-
-void mesh_config_release(struct mesh_config *cfg)
-{
-	if (!cfg)
-		return;
-
-	l_queue_destroy(cfg->idles, release_idle);
+	if (info->cb)
+		info->cb(info->user_data, result);
 
-	l_free(cfg->node_dir_path);
-	json_object_put(cfg->jnode);
-	l_free(cfg);
+	l_free(info);
 }
 
-static void idle_save_config(struct l_idle *idle, void *user_data)
+static bool write_node(struct mesh_config *cfg)
 {
-	struct write_info *info = user_data;
 	char *fname_tmp, *fname_bak, *fname_cfg;
+	const char *str;
 	bool result = false;
 
-	fname_cfg = info->cfg->node_dir_path;
+	str = json_object_to_json_string_ext(cfg->jnode, json_flags);
+
+	fname_cfg = cfg->node_dir_path;
 	fname_tmp = l_strdup_printf("%s%s", fname_cfg, tmp_ext);
 	fname_bak = l_strdup_printf("%s%s", fname_cfg, bak_ext);
 	remove(fname_tmp);
 
-	result = save_config(info->cfg->jnode, fname_tmp);
+	result = save_config(str, fname_tmp);
 
 	if (result) {
 		remove(fname_bak);
 
-		if (rename(fname_cfg, fname_bak) < 0 ||
+		/* A newly created node has no previous version */
+		if ((rename(fname_cfg, fname_bak) < 0 && errno != ENOENT) ||
 					rename(fname_tmp, fname_cfg) < 0)
 			result = false;
 	}
@@ -2417,24 +2605,67 @@ static void idle_save_config(struct l_idle *idle, void *user_data)
 	l_free(fname_tmp);
 	l_free(fname_bak);
 
-	gettimeofday(&info->cfg->write_time, NULL);
+	/* Journaled values are part of the new node file */
+	if (result)
+		journal_reset(cfg, str);
 
-	if (info->cb)
-		info->cb(info->user_data, result);
+	gettimeofday(&cfg->write_time, NULL);
 
-	if (idle) {
-		l_queue_remove(info->cfg->idles, idle);
-		l_idle_remove(idle);
-	}
+	return result;
+}
 
-	l_free(info);
+static void save_flush(struct mesh_config *cfg)
+{
+	struct l_queue *reqs = cfg->save_reqs;
+	bool result;
+
+	l_timeout_remove(cfg->save_timeout);
+	cfg->save_timeout = NULL;
+	cfg->save_reqs = NULL;
+
+	result = write_node(cfg);
+
+	l_queue_foreach(reqs, save_complete, L_UINT_TO_PTR(result));
+	l_queue_destroy(reqs, NULL);
+}
+
+static void save_timeout(struct l_timeout *timeout, void *user_data)
+{
+	save_flush(user_data);
+}
 
+static void save_cancel(struct mesh_config *cfg)
+{
+	l_timeout_remove(cfg->save_timeout);
+	cfg->save_timeout = NULL;
+
+	l_queue_foreach(cfg->save_reqs, save_complete, L_UINT_TO_PTR(false));
+	l_queue_destroy(cfg->save_reqs, NULL);
+	cfg->save_reqs = NULL;
+}
+
+void mesh_config_release(struct mesh_config *cfg)
+{
+	if (!cfg)
+		return;
+
+	/* Don't lose coalesced updates */
+	if (cfg->save_timeout)
+		save_flush(cfg);
+
+	journal_close(cfg);
+
+	l_free(cfg->journal_path);
+	l_free(cfg->node_dir_path);
+	json_object_put(cfg->jnode);
+	l_free(cfg);
 }
 
 bool mesh_config_save(struct mesh_config *cfg, bool no_wait,
 				mesh_config_status_func_t cb, void *user_data)
 {
 	struct write_info *info;
+	uint64_t now, delay;
 
 	if (!cfg)
 		return false;
@@ -2444,18 +2675,40 @@ bool mesh_config_save(struct mesh_config *cfg, bool no_wait,
 	info->cb = cb;
 	info->user_data = user_data;
 
+	if (!cfg->save_reqs)
+		cfg->save_reqs = l_queue_new();
+
+	l_queue_push_tail(cfg->save_reqs, info);
+
+	/* Also completes any pending request */
 	if (no_wait) {
-		idle_save_config(NULL, info);
-	} else {
-		struct l_idle *idle;
+		save_flush(cfg);
+		return true;
+	}
+
+	now = l_time_now() / 1000;
 
-		idle = l_idle_create(idle_save_config, info, NULL);
-		l_queue_push_tail(cfg->idles, idle);
+	if (!cfg->save_timeout) {
+		cfg->save_deadline = now + SAVE_MAX_LATENCY_MS;
+		cfg->save_timeout = l_timeout_create_ms(SAVE_DELAY_MS,
+						save_timeout, cfg, NULL);
+		return true;
 	}
 
+	delay = cfg->save_deadline > now ? cfg->save_deadline - now : 1;
+	if (delay > SAVE_DELAY_MS)
+		delay = SAVE_DELAY_MS;
+
+	l_timeout_modify_ms(cfg->save_timeout, delay);
+
 	return true;
 }
 
+void mesh_config_set_compact(bool compact)
+{
+	json_flags = compact ? JSON_C_TO_STRING_PLAIN : JSON_C_TO_STRING_PRETTY;
+}
+
 bool mesh_config_load_nodes(const char *cfgdir_name, mesh_config_node_func_t cb,
 								void *user_data)
 {
@@ -2473,7 +2726,7 @@ bool mesh_config_load_nodes(const char *cfgdir_name, mesh_config_node_func_t cb,
 	}
 
 	while ((entry = readdir(cfgdir)) != NULL) {
-		char *dirname, *fname, *bak;
+		char *dirname, *fname, *bak, *jname;
 		uint8_t uuid[16];
 		size_t node_len;
 
@@ -2491,13 +2744,14 @@ bool mesh_config_load_nodes(const char *cfgdir_name, mesh_config_node_func_t cb,
 
 		dirname = l_strdup_printf("%s/%s", cfgdir_name, entry->d_name);
 		fname = l_strdup_printf("%s%s", dirname, cfgnode_name);
+		jname = l_strdup_printf("%s%s", fname, journal_ext);
 
-		if (!load_node(fname, uuid, cb, user_data)) {
+		if (!load_node(fname, jname, uuid, cb, user_data)) {
 
 			/* Fall-back to Backup version */
 			bak = l_strdup_printf("%s%s", fname, bak_ext);
 
-			if (load_node(bak, uuid, cb, user_data)) {
+			if (load_node(bak, jname, uuid, cb, user_data)) {
 				remove(fname);
 				rename(bak, fname);
 			}
@@ -2505,6 +2759,7 @@ bool mesh_config_load_nodes(const char *cfgdir_name, mesh_config_node_func_t cb,
 			l_free(bak);
 		}
 
+		l_free(jname);
 		l_free(fname);
 		l_free(dirname);
 	}
@@ -2522,6 +2777,10 @@ void mesh_config_destroy_nvm(struct mesh_config *cfg)
 	if (!cfg)
 		return;
 
+	/* Nothing pending may be written once the node is gone */
+	save_cancel(cfg);
+	journal_close(cfg);
+
 	node_dir = dirname(cfg->node_dir_path);
 	l_debug("Delete node config %s", node_dir);
 
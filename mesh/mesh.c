@@ -25,6 +25,7 @@
 #include "mesh/error.h"
 #include "mesh/agent.h"
 #include "mesh/mesh.h"
+#include "mesh/mesh-config.h"
 #include "mesh/mesh-defs.h"
 
 /*
@@ -56,6 +57,9 @@ struct bt_mesh {
 	uint16_t crpl;
 	uint16_t algorithms;
 	uint16_t req_index;
+	uint16_t msg_cache_sz;
+	uint16_t rx_cache_sz;
+	bool rpl_journal;
 	uint8_t friend_queue_sz;
 	uint8_t max_filters;
 	bool initialized;
@@ -84,6 +88,8 @@ static struct bt_mesh mesh = {
 	.proxy_support = false,
 	.crpl = DEFAULT_CRPL,
 	.friend_queue_sz = DEFAULT_FRIEND_QUEUE_SZ,
+	.msg_cache_sz = MSG_CACHE_SIZE,
+	.rx_cache_sz = FAST_CACHE_SIZE,
 	.initialized = false
 };
 
@@ -203,11 +209,27 @@ uint8_t mesh_get_friend_queue_size(void)
 	return mesh.friend_queue_sz;
 }
 
+uint16_t mesh_get_msg_cache_size(void)
+{
+	return mesh.msg_cache_sz;
+}
+
+uint16_t mesh_get_rx_cache_size(void)
+{
+	return mesh.rx_cache_sz;
+}
+
+bool mesh_rpl_journal_enabled(void)
+{
+	return mesh.rpl_journal;
+}
+
 static void parse_settings(const char *mesh_conf_fname)
 {
 	struct l_settings *settings;
 	char *str;
 	uint32_t value;
+	bool compact;
 
 	settings = l_settings_new();
 	if (!l_settings_load_from_file(settings, mesh_conf_fname))
@@ -242,6 +264,24 @@ static void parse_settings(const char *mesh_conf_fname)
 								&& value < 127)
 		mesh.friend_queue_sz = value;
 
+	if (l_settings_get_uint(settings, "General", "MsgCacheSize", &value)
+					&& value >= 1 && value <= 4096)
+		mesh.msg_cache_sz = value;
+
+	if (l_settings_get_uint(settings, "General", "RxCacheSize", &value)
+					&& value >= 1 && value <= 4096)
+		mesh.rx_cache_sz = value;
+
+	str = l_settings_get_string(settings, "General", "RPLStorage");
+	if (str) {
+		if (!strcasecmp(str, "journal"))
+			mesh.rpl_journal = true;
+		l_free(str);
+	}
+
+	if (l_settings_get_bool(settings, "General", "CompactConfig", &compact))
+		mesh_config_set_compact(compact);
+
 	if (l_settings_get_uint(settings, "General", "ProvTimeout", &value))
 		mesh.prov_timeout = value;
 
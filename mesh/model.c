@@ -391,13 +391,10 @@ static int app_packet_decrypt(struct mesh_net *net, const uint8_t *data,
 				uint8_t key_aid, uint32_t seq,
 				uint32_t iv_idx, uint8_t *out)
 {
-	struct l_queue *app_keys = mesh_net_get_app_keys(net);
 	const struct l_queue_entry *entry;
 
-	if (!app_keys)
-		return -1;
-
-	for (entry = l_queue_get_entries(app_keys); entry;
+	/* Only keys whose current or updated AID matches are candidates */
+	for (entry = appkey_aid_keys(net, key_aid); entry;
 							entry = entry->next) {
 		const uint8_t *old_key = NULL, *new_key = NULL;
 		uint8_t old_key_aid, new_key_aid;
@@ -422,6 +419,7 @@ static int app_packet_decrypt(struct mesh_net *net, const uint8_t *data,
 			}
 
 			print_packet("Failed App Key", old_key, 16);
+			appkey_aid_miss(net, key_aid);
 		}
 
 		if (new_key && new_key_aid == key_aid) {
@@ -435,6 +433,7 @@ static int app_packet_decrypt(struct mesh_net *net, const uint8_t *data,
 			}
 
 			print_packet("Failed App Key", new_key, 16);
+			appkey_aid_miss(net, key_aid);
 		}
 	}
 
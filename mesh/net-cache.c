@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+
+#include <ell/ell.h>
+
+#include "mesh/net-cache.h"
+
+struct cache_entry {
+	uint64_t key;
+	uint32_t tag;
+	/* Neighbours in the ring, index size is the ring head */
+	uint32_t prev;
+	uint32_t next;
+	bool used;
+};
+
+struct net_cache {
+	/* size entries followed by the ring head */
+	struct cache_entry *ring;
+	/* Index into ring + 1, zero marks a free slot */
+	uint32_t *table;
+	unsigned int size;
+	unsigned int mask;
+	bool lru;
+};
+
+static void ring_unlink(struct net_cache *cache, uint32_t i)
+{
+	struct cache_entry *entry = &cache->ring[i];
+
+	cache->ring[entry->prev].next = entry->next;
+	cache->ring[entry->next].prev = entry->prev;
+}
+
+/* Newest entries are kept right after the head */
+static void ring_push_front(struct net_cache *cache, uint32_t i)
+{
+	struct cache_entry *head = &cache->ring[cache->size];
+	struct cache_entry *entry = &cache->ring[i];
+
+	entry->prev = cache->size;
+	entry->next = head->next;
+	cache->ring[head->next].prev = i;
+	head->next = i;
+}
+
+static void ring_init(struct net_cache *cache)
+{
+	uint32_t i;
+
+	memset(cache->ring, 0, (cache->size + 1) * sizeof(*cache->ring));
+
+	cache->ring[cache->size].prev = cache->size;
+	cache->ring[cache->size].next = cache->size;
+
+	for (i = 0; i < cache->size; i++)
+		ring_push_front(cache, i);
+}
+
+static unsigned int cache_hash(const struct net_cache *cache, uint64_t key,
+								uint32_t tag)
+{
+	uint64_t h = (key ^ ((uint64_t) tag << 29)) * 0x9e3779b97f4a7c15ull;
+
+	return (h >> 32) & cache->mask;
+}
+
+static int cache_find(const struct net_cache *cache, uint64_t key,
+								uint32_t tag)
+{
+	unsigned int i = cache_hash(cache, key, tag);
+
+	/* The table is never more than half full, so this terminates */
+	while (cache->table[i]) {
+		const struct cache_entry *entry;
+
+		entry = &cache->ring[cache->table[i] - 1];
+		if (entry->key == key && entry->tag == tag)
+			return i;
+
+		i = (i + 1) & cache->mask;
+	}
+
+	return -1;
+}
+
+/* Backward shift deletion, keeps probe sequences intact without tombstones */
+static void cache_table_remove(struct net_cache *cache, unsigned int i)
+{
+	unsigned int j = i;
+
+	while (true) {
+		const struct cache_entry *entry;
+		unsigned int home;
+
+		cache->table[i] = 0;
+
+		do {
+			j = (j + 1) & cache->mask;
+
+			if (!cache->table[j])
+				return;
+
+			entry = &cache->ring[cache->table[j] - 1];
+			home = cache_hash(cache, entry->key, entry->tag);
+
+			/* Stay put if home lies cyclically within (i, j] */
+		} while (i <= j ? (i < home && home <= j) :
+						(i < home || home <= j));
+
+		cache->table[i] = cache->table[j];
+		i = j;
+	}
+}
+
+struct net_cache *net_cache_new(unsigned int size, bool lru)
+{
+	struct net_cache *cache;
+	unsigned int table_size = 4;
+
+	if (!size)
+		return NULL;
+
+	while (table_size < size * 2)
+		table_size <<= 1;
+
+	cache = l_new(struct net_cache, 1);
+	cache->ring = l_new(struct cache_entry, size + 1);
+	cache->table = l_new(uint32_t, table_size);
+	cache->size = size;
+	cache->mask = table_size - 1;
+	cache->lru = lru;
+
+	ring_init(cache);
+
+	return cache;
+}
+
+void net_cache_free(struct net_cache *cache)
+{
+	if (!cache)
+		return;
+
+	l_free(cache->table);
+	l_free(cache->ring);
+	l_free(cache);
+}
+
+void net_cache_clear(struct net_cache *cache)
+{
+	if (!cache)
+		return;
+
+	ring_init(cache);
+	memset(cache->table, 0, (cache->mask + 1) * sizeof(*cache->table));
+}
+
+unsigned int net_cache_get_size(const struct net_cache *cache)
+{
+	return cache ? cache->size : 0;
+}
+
+bool net_cache_check_add(struct net_cache *cache, uint64_t key, uint32_t tag)
+{
+	struct cache_entry *entry;
+	uint32_t victim;
+	unsigned int i;
+	int found;
+
+	found = cache_find(cache, key, tag);
+	if (found >= 0) {
+		if (!cache->lru)
+			return true;
+
+		i = cache->table[found] - 1;
+		ring_unlink(cache, i);
+		ring_push_front(cache, i);
+		return true;
+	}
+
+	/* Reuse the oldest entry, unused ones sort last */
+	victim = cache->ring[cache->size].prev;
+	entry = &cache->ring[victim];
+
+	if (entry->used)
+		cache_table_remove(cache,
+				cache_find(cache, entry->key, entry->tag));
+
+	entry->key = key;
+	entry->tag = tag;
+	entry->used = true;
+
+	ring_unlink(cache, victim);
+	ring_push_front(cache, victim);
+
+	i = cache_hash(cache, key, tag);
+	while (cache->table[i])
+		i = (i + 1) & cache->mask;
+
+	cache->table[i] = victim + 1;
+
+	return false;
+}
@@ -0,0 +1,31 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+/*
+ * Fixed capacity set of (key, tag) pairs used to suppress duplicate network
+ * PDUs. Lookups go through an open addressing hash table and the oldest
+ * entry is recycled through an index linked ring, so nothing is allocated
+ * once the cache has been created. With lru set, a hit makes an entry the
+ * newest again, otherwise entries are evicted in insertion order.
+ */
+
+struct net_cache;
+
+struct net_cache *net_cache_new(unsigned int size, bool lru);
+void net_cache_free(struct net_cache *cache);
+void net_cache_clear(struct net_cache *cache);
+unsigned int net_cache_get_size(const struct net_cache *cache);
+
+/*
+ * Returns true if (key, tag) is already cached, marking it as most recently
+ * used for an LRU cache. Otherwise adds it, evicting the oldest entry if the
+ * cache is full, and returns false.
+ */
+bool net_cache_check_add(struct net_cache *cache, uint64_t key, uint32_t tag);
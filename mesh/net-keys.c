@@ -28,6 +28,9 @@
 #define BEACON_INTERVAL_MIN	10
 #define BEACON_INTERVAL_MAX	600
 
+#define NID_BUCKETS		128
+#define DECRYPT_CACHE_SIZE	8
+
 struct net_beacon {
 	struct l_timeout *timeout;
 	uint32_t ts;
@@ -52,16 +55,66 @@ struct net_key {
 	uint8_t network[8];
 };
 
+struct decrypt_cache {
+	uint8_t pkt[29];
+	uint8_t plain[29];
+	size_t len;
+	size_t plainlen;
+	uint32_t id;
+	uint32_t iv_index;
+};
+
 static struct l_queue *keys = NULL;
 static uint32_t last_master_id = 0;
 
-/* To avoid re-decrypting same packet for multiple nodes, cache and check */
-static uint8_t cache_pkt[29];
-static uint8_t cache_plain[29];
-static size_t cache_len;
-static size_t cache_plainlen;
-static uint32_t cache_id;
-static uint32_t cache_iv_index;
+/* Keys bucketed by NID, so only candidate keys are tried on decryption */
+static struct l_queue *nid_keys[NID_BUCKETS];
+
+/*
+ * To avoid re-decrypting same packet for multiple nodes, cache and check.
+ * Packets that failed to decrypt are cached too (with id 0), since every
+ * local node asks for the same advertisement.
+ */
+static struct decrypt_cache cache[DECRYPT_CACHE_SIZE];
+static unsigned int cache_next;
+
+static struct net_key_decrypt_stats decrypt_stats;
+
+static void decrypt_cache_flush(void)
+{
+	memset(cache, 0, sizeof(cache));
+	cache_next = 0;
+}
+
+static void nid_key_add(struct net_key *key)
+{
+	struct l_queue **bucket = &nid_keys[key->nid & 0x7f];
+
+	if (!*bucket)
+		*bucket = l_queue_new();
+
+	/* Friendship credentials are tried first */
+	if (key->friend_key)
+		l_queue_push_head(*bucket, key);
+	else
+		l_queue_push_tail(*bucket, key);
+
+	decrypt_cache_flush();
+}
+
+static void nid_key_remove(struct net_key *key)
+{
+	struct l_queue **bucket = &nid_keys[key->nid & 0x7f];
+
+	l_queue_remove(*bucket, key);
+
+	if (l_queue_isempty(*bucket)) {
+		l_queue_destroy(*bucket, NULL);
+		*bucket = NULL;
+	}
+
+	decrypt_cache_flush();
+}
 
 static bool match_master(const void *a, const void *b)
 {
@@ -119,6 +172,7 @@ uint32_t net_key_add(const uint8_t master[16])
 
 	key->id = ++last_master_id;
 	l_queue_push_tail(keys, key);
+	nid_key_add(key);
 	return key->id;
 
 fail:
@@ -157,6 +211,7 @@ uint32_t net_key_frnd_add(uint32_t master_id, uint16_t lpn, uint16_t frnd,
 	frnd_key->ref_cnt++;
 	frnd_key->id = ++last_master_id;
 	l_queue_push_head(keys, frnd_key);
+	nid_key_add(frnd_key);
 
 	return frnd_key->id;
 }
@@ -169,6 +224,7 @@ void net_key_unref(uint32_t id)
 		if (--key->ref_cnt == 0) {
 			l_timeout_remove(key->snb.timeout);
 			l_queue_remove(keys, key);
+			nid_key_remove(key);
 			l_free(key);
 		}
 	}
@@ -196,54 +252,97 @@ bool net_key_retrieve(uint32_t id, uint8_t *master)
 	return false;
 }
 
-static void decrypt_net_pkt(void *a, void *b)
+static bool decrypt_net_pkt(const struct net_key *key,
+						struct decrypt_cache *entry)
 {
-	const struct net_key *key = a;
 	bool result;
 
-	if (cache_id || !key->ref_cnt || (cache_pkt[0] & 0x7f) != key->nid)
-		return;
+	decrypt_stats.attempts++;
 
-	result = mesh_crypto_packet_decode(cache_pkt, cache_len, false,
-						cache_plain, cache_iv_index,
+	result = mesh_crypto_packet_decode(entry->pkt, entry->len, false,
+						entry->plain, entry->iv_index,
 						key->encrypt, key->privacy);
 
 	if (result) {
-		cache_id = key->id;
-		if (cache_plain[1] & 0x80)
-			cache_plainlen = cache_len - 8;
+		entry->id = key->id;
+		if (entry->plain[1] & 0x80)
+			entry->plainlen = entry->len - 8;
 		else
-			cache_plainlen = cache_len - 4;
+			entry->plainlen = entry->len - 4;
 	}
+
+	return result;
+}
+
+static struct decrypt_cache *decrypt_cache_find(const uint8_t *pkt,
+								size_t len)
+{
+	unsigned int i;
+
+	for (i = 0; i < DECRYPT_CACHE_SIZE; i++) {
+		struct decrypt_cache *entry = &cache[i];
+
+		if (entry->len == len && !memcmp(pkt, entry->pkt, len))
+			return entry;
+	}
+
+	return NULL;
 }
 
 uint32_t net_key_decrypt(uint32_t iv_index, const uint8_t *pkt, size_t len,
 					uint8_t **plain, size_t *plain_len)
 {
-	/* If we already successfully decrypted this packet, use cached data */
-	if (cache_id && cache_len == len && !memcmp(pkt, cache_pkt, len)) {
+	const struct l_queue_entry *key_entry;
+	struct decrypt_cache *entry;
+
+	if (!len || len > sizeof(entry->pkt))
+		return 0;
+
+	decrypt_stats.packets++;
+
+	/* If we already tried this packet, use cached data */
+	entry = decrypt_cache_find(pkt, len);
+	if (entry && (entry->id || entry->iv_index == iv_index)) {
+		decrypt_stats.cache_hits++;
+
 		/* IV Index must match what was used to decrypt */
-		if (cache_iv_index != iv_index)
+		if (entry->iv_index != iv_index)
 			return 0;
 
 		goto done;
 	}
 
-	cache_id = 0;
-	memcpy(cache_pkt, pkt, len);
-	cache_len = len;
-	cache_iv_index = iv_index;
+	if (!entry) {
+		entry = &cache[cache_next];
+		cache_next = (cache_next + 1) % DECRYPT_CACHE_SIZE;
+	}
 
-	/* Try all network keys known to us */
-	l_queue_foreach(keys, decrypt_net_pkt, NULL);
+	entry->id = 0;
+	memcpy(entry->pkt, pkt, len);
+	entry->len = len;
+	entry->iv_index = iv_index;
+
+	/* Try the network keys known to us with a matching NID */
+	for (key_entry = l_queue_get_entries(nid_keys[pkt[0] & 0x7f]);
+				key_entry; key_entry = key_entry->next) {
+		if (decrypt_net_pkt(key_entry->data, entry)) {
+			decrypt_stats.decrypted++;
+			break;
+		}
+	}
 
 done:
-	if (cache_id) {
-		*plain = cache_plain;
-		*plain_len = cache_plainlen;
+	if (entry->id) {
+		*plain = entry->plain;
+		*plain_len = entry->plainlen;
 	}
 
-	return cache_id;
+	return entry->id;
+}
+
+void net_key_get_decrypt_stats(struct net_key_decrypt_stats *stats)
+{
+	*stats = decrypt_stats;
 }
 
 bool net_key_encrypt(uint32_t id, uint32_t iv_index, uint8_t *pkt, size_t len)
@@ -517,6 +616,21 @@ void net_key_beacon_disable(uint32_t id)
 
 void net_key_cleanup(void)
 {
+	unsigned int i;
+
+	l_debug("Decrypt: %u packets, %u cached, %u keys tried, %u decrypted",
+					decrypt_stats.packets,
+					decrypt_stats.cache_hits,
+					decrypt_stats.attempts,
+					decrypt_stats.decrypted);
+
+	for (i = 0; i < NID_BUCKETS; i++) {
+		l_queue_destroy(nid_keys[i], NULL);
+		nid_keys[i] = NULL;
+	}
+
+	decrypt_cache_flush();
+
 	l_queue_destroy(keys, l_free);
 	keys = NULL;
 }
@@ -12,6 +12,13 @@
 #define KEY_REFRESH		0x01
 #define IV_INDEX_UPDATE		0x02
 
+struct net_key_decrypt_stats {
+	uint32_t packets;	/* Calls to net_key_decrypt() */
+	uint32_t cache_hits;	/* Answered from the decrypt cache */
+	uint32_t attempts;	/* Decryptions tried with an NID match */
+	uint32_t decrypted;	/* Packets decrypted by one of the keys */
+};
+
 void net_key_cleanup(void);
 bool net_key_confirm(uint32_t id, const uint8_t master[16]);
 bool net_key_retrieve(uint32_t id, uint8_t *master);
@@ -22,6 +29,7 @@ void net_key_unref(uint32_t id);
 uint32_t net_key_decrypt(uint32_t iv_index, const uint8_t *pkt, size_t len,
 					uint8_t **plain, size_t *plain_len);
 bool net_key_encrypt(uint32_t id, uint32_t iv_index, uint8_t *pkt, size_t len);
+void net_key_get_decrypt_stats(struct net_key_decrypt_stats *stats);
 uint32_t net_key_network_id(const uint8_t network[8]);
 bool net_key_snb_check(uint32_t id, uint32_t iv_index, bool kr, bool ivu,
 								uint64_t cmac);
@@ -19,11 +19,13 @@
 #include <ell/ell.h>
 
 #include "mesh/mesh-defs.h"
+#include "mesh/mesh.h"
 #include "mesh/util.h"
 #include "mesh/crypto.h"
 #include "mesh/net-keys.h"
 #include "mesh/node.h"
 #include "mesh/net.h"
+#include "mesh/net-cache.h"
 #include "mesh/mesh-io.h"
 #include "mesh/friend.h"
 #include "mesh/mesh-config.h"
@@ -52,8 +54,6 @@
 
 #define SAR_KEY(src, seq0)	((((uint32_t)(seq0)) << 16) | (src))
 
-#define FAST_CACHE_SIZE 8
-
 enum _relay_advice {
 	RELAY_NONE,		/* Relay not enabled in node */
 	RELAY_ALLOWED,		/* Relay enabled, msg not to node's unicast */
@@ -95,6 +95,7 @@ struct mesh_net {
 	struct mesh_node *node;
 	struct mesh_prov *prov;
 	struct l_queue *app_keys;
+	struct appkey_index *app_index;
 	unsigned int pkt_id;
 	unsigned int bea_id;
 	unsigned int beacon_id;
@@ -131,7 +132,7 @@ struct mesh_net {
 	uint16_t features;
 
 	struct l_queue *subnets;
-	struct l_queue *msg_cache;
+	struct net_cache *msg_cache;
 	struct l_queue *replay_cache;
 	struct l_queue *sar_in;
 	struct l_queue *sar_out;
@@ -142,12 +143,6 @@ struct mesh_net {
 	struct l_queue *destinations;
 };
 
-struct mesh_msg {
-	uint16_t src;
-	uint32_t seq;
-	uint32_t mic;
-};
-
 struct mesh_sar {
 	unsigned int id;
 	struct l_timeout *seg_timeout;
@@ -217,7 +212,8 @@ struct net_beacon_data {
 	bool processed;
 };
 
-static struct l_queue *fast_cache;
+/* Hashes of recently received raw PDUs, evicted in arrival order */
+static struct net_cache *fast_cache;
 static struct l_queue *nets;
 
 static void net_rx(void *net_ptr, void *user_data);
@@ -617,20 +613,21 @@ struct mesh_net *mesh_net_new(struct mesh_node *node)
 	net->tx_interval = DEFAULT_TRANSMIT_INTERVAL;
 
 	net->subnets = l_queue_new();
-	net->msg_cache = l_queue_new();
+	net->msg_cache = net_cache_new(mesh_get_msg_cache_size(), true);
 	net->sar_in = l_queue_new();
 	net->sar_out = l_queue_new();
 	net->sar_queue = l_queue_new();
 	net->frnd_msgs = l_queue_new();
 	net->destinations = l_queue_new();
 	net->app_keys = l_queue_new();
+	net->app_index = appkey_index_new();
 	net->replay_cache = l_queue_new();
 
 	if (!nets)
 		nets = l_queue_new();
 
 	if (!fast_cache)
-		fast_cache = l_queue_new();
+		fast_cache = net_cache_new(mesh_get_rx_cache_size(), false);
 
 	return net;
 }
@@ -643,7 +640,7 @@ void mesh_net_free(void *user_data)
 		return;
 
 	l_queue_destroy(net->subnets, subnet_free);
-	l_queue_destroy(net->msg_cache, l_free);
+	net_cache_free(net->msg_cache);
 	l_queue_destroy(net->replay_cache, l_free);
 	l_queue_destroy(net->sar_in, mesh_sar_free);
 	l_queue_destroy(net->sar_out, mesh_sar_free);
@@ -652,6 +649,7 @@ void mesh_net_free(void *user_data)
 	l_queue_destroy(net->friends, mesh_friend_free);
 	l_queue_destroy(net->negotiations, mesh_friend_free);
 	l_queue_destroy(net->destinations, l_free);
+	appkey_index_free(net->app_index);
 	l_queue_destroy(net->app_keys, appkey_key_free);
 
 	l_free(net);
@@ -659,7 +657,7 @@ void mesh_net_free(void *user_data)
 
 void mesh_net_cleanup(void)
 {
-	l_queue_destroy(fast_cache, l_free);
+	net_cache_free(fast_cache);
 	fast_cache = NULL;
 	l_queue_destroy(nets, mesh_net_free);
 	nets = NULL;
@@ -1004,51 +1002,19 @@ void mesh_net_set_frnd_seq(struct mesh_net *net, bool seq)
 	net->friend_seq = seq;
 }
 
-static bool match_cache(const void *a, const void *b)
-{
-	const struct mesh_msg *msg = a;
-	const struct mesh_msg *tst = b;
-
-	if (msg->seq != tst->seq || msg->mic != tst->mic ||
-					msg->src != tst->src)
-		return false;
-
-	return true;
-}
-
 static bool msg_in_cache(struct mesh_net *net, uint16_t src, uint32_t seq,
 								uint32_t mic)
 {
-	struct mesh_msg *msg;
-	struct mesh_msg tst = {
-		.src = src,
-		.seq = seq,
-		.mic = mic,
-	};
+	uint64_t key = ((uint64_t) src << 32) | seq;
 
-	msg = l_queue_remove_if(net->msg_cache, match_cache, &tst);
-
-	if (msg) {
+	if (net_cache_check_add(net->msg_cache, key, mic)) {
 		l_debug("Supressing duplicate %4.4x + %6.6x + %8.8x",
 							src, seq, mic);
-		l_queue_push_head(net->msg_cache, msg);
 		return true;
 	}
 
-	msg = l_new(struct mesh_msg, 1);
-	*msg = tst;
-	l_queue_push_head(net->msg_cache, msg);
 	l_debug("Add %4.4x + %6.6x + %8.8x", src, seq, mic);
 
-	if (l_queue_length(net->msg_cache) > MSG_CACHE_SIZE) {
-		msg = l_queue_peek_tail(net->msg_cache);
-		/* Remove Tail (oldest msg in cache) */
-		l_debug("Remove %4.4x + %6.6x + %8.8x",
-						msg->src, msg->seq, msg->mic);
-		if (l_queue_remove(net->msg_cache, msg))
-			l_free(msg);
-	}
-
 	return false;
 }
 
@@ -2161,31 +2127,9 @@ static bool ctl_received(struct mesh_net *net, uint16_t key_id,
 	return true;
 }
 
-static bool find_fast_hash(const void *a, const void *b)
-{
-	const uint64_t *entry = a;
-	const uint64_t *test = b;
-
-	return *entry == *test;
-}
-
 static bool check_fast_cache(uint64_t hash)
 {
-	void *found = l_queue_find(fast_cache, find_fast_hash, &hash);
-	uint64_t *new_hash;
-
-	if (found)
-		return false;
-
-	if (l_queue_length(fast_cache) >= FAST_CACHE_SIZE)
-		new_hash = l_queue_pop_head(fast_cache);
-	else
-		new_hash = l_malloc(sizeof(hash));
-
-	*new_hash = hash;
-	l_queue_push_tail(fast_cache, new_hash);
-
-	return true;
+	return !net_cache_check_add(fast_cache, hash, 0);
 }
 
 static bool match_by_dst(const void *a, const void *b)
@@ -2512,7 +2456,7 @@ static void iv_upd_to(struct l_timeout *upd_timeout, void *user_data)
 							net->iv_index, false);
 		l_queue_foreach(net->subnets, refresh_beacon, net);
 		queue_friend_update(net);
-		l_queue_clear(net->msg_cache, l_free);
+		net_cache_clear(net->msg_cache);
 		break;
 
 	case IV_UPD_INIT:
@@ -2868,7 +2812,8 @@ bool mesh_net_attach(struct mesh_net *net, struct mesh_io *io)
 			nets = l_queue_new();
 
 		if (!fast_cache)
-			fast_cache = l_queue_new();
+			fast_cache = net_cache_new(mesh_get_rx_cache_size(),
+									false);
 
 		mesh_io_register_recv_cb(io, snb, sizeof(snb),
 							beacon_recv, NULL);
@@ -2918,7 +2863,7 @@ bool mesh_net_iv_index_update(struct mesh_net *net)
 		return false;
 
 	l_debug("iv_upd_state = IV_UPD_UPDATING");
-	l_queue_clear(net->msg_cache, l_free);
+	net_cache_clear(net->msg_cache);
 
 	if (!mesh_config_write_iv_index(node_config_get(net->node),
 						net->iv_index + 1, true))
@@ -3456,6 +3401,17 @@ struct l_queue *mesh_net_get_app_keys(struct mesh_net *net)
 	return net->app_keys;
 }
 
+struct appkey_index *mesh_net_get_app_index(struct mesh_net *net)
+{
+	if (!net)
+		return NULL;
+
+	if (!net->app_index)
+		net->app_index = appkey_index_new();
+
+	return net->app_index;
+}
+
 bool mesh_net_have_key(struct mesh_net *net, uint16_t idx)
 {
 	if (!net)
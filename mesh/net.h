@@ -14,6 +14,7 @@
 
 struct mesh_io;
 struct mesh_node;
+struct appkey_index;
 
 #define DEV_ID	0
 
@@ -77,6 +78,7 @@ struct mesh_node;
 
 
 #define MSG_CACHE_SIZE		70
+#define FAST_CACHE_SIZE		8
 #define REPLAY_CACHE_SIZE	10
 
 /* Proxy Configuration Opcodes */
@@ -282,6 +284,7 @@ bool mesh_net_get_key(struct mesh_net *net, bool new_key, uint16_t idx,
 bool mesh_net_attach(struct mesh_net *net, struct mesh_io *io);
 struct mesh_io *mesh_net_detach(struct mesh_net *net);
 struct l_queue *mesh_net_get_app_keys(struct mesh_net *net);
+struct appkey_index *mesh_net_get_app_index(struct mesh_net *net);
 
 void mesh_net_transport_send(struct mesh_net *net, uint32_t key_id,
 				uint16_t net_idx, uint32_t iv_index,
@@ -0,0 +1,448 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+
+#include <ell/ell.h>
+
+#include "mesh/mesh-defs.h"
+#include "mesh/rpl-journal.h"
+
+/*
+ * File layout: an 8 octet header ("MRPL", version, 3 reserved octets)
+ * followed by 8 octet records: src (LE16), seq (LE32) and a check value
+ * (LE16). A seq of SEQ_DELETED marks the removal of src.
+ */
+#define JOURNAL_MAGIC		"MRPL"
+#define JOURNAL_VERSION		1
+#define HDR_LEN			8
+#define REC_LEN			8
+
+#define SEQ_DELETED		0xffffffff
+#define SRC_MAX			VIRTUAL_ADDRESS_LOW
+
+/* Records appended between two flushes to stable storage */
+#define SYNC_BATCH		32
+
+/* Never compact logs with fewer records than this */
+#define COMPACT_MIN		1024
+
+/* Records handled per read or write call */
+#define IO_RECORDS		512
+
+struct rpl_journal {
+	char *path;
+	int fd;
+	unsigned int records;
+	unsigned int pending;
+	unsigned int compact_at;
+};
+
+static uint16_t record_check(const uint8_t *rec)
+{
+	uint16_t sum1 = 0, sum2 = 0;
+	int i;
+
+	/* Fletcher-16, offset so that zero filled records never pass */
+	for (i = 0; i < REC_LEN - 2; i++) {
+		sum1 = (sum1 + rec[i]) % 255;
+		sum2 = (sum2 + sum1) % 255;
+	}
+
+	return ((sum2 << 8) | sum1) ^ 0x5250;
+}
+
+static void record_build(uint8_t *rec, uint16_t src, uint32_t seq)
+{
+	l_put_le16(src, rec);
+	l_put_le32(seq, rec + 2);
+	l_put_le16(record_check(rec), rec + 6);
+}
+
+static bool record_parse(const uint8_t *rec, uint16_t *src, uint32_t *seq)
+{
+	if (l_get_le16(rec + 6) != record_check(rec))
+		return false;
+
+	*src = l_get_le16(rec);
+	*seq = l_get_le32(rec + 2);
+
+	if (!IS_UNICAST(*src))
+		return false;
+
+	return *seq <= SEQ_MASK || *seq == SEQ_DELETED;
+}
+
+static bool write_all(int fd, const uint8_t *buf, size_t len)
+{
+	while (len) {
+		ssize_t n = write(fd, buf, len);
+
+		if (n <= 0)
+			return false;
+
+		buf += n;
+		len -= n;
+	}
+
+	return true;
+}
+
+static bool write_header(int fd)
+{
+	uint8_t hdr[HDR_LEN] = { 0 };
+
+	memcpy(hdr, JOURNAL_MAGIC, 4);
+	hdr[4] = JOURNAL_VERSION;
+
+	return write_all(fd, hdr, sizeof(hdr));
+}
+
+static bool sync_dir(const char *path)
+{
+	char dir_path[PATH_MAX];
+	const char *sep = strrchr(path, '/');
+	bool result;
+	int fd;
+
+	if (!sep)
+		return false;
+
+	snprintf(dir_path, sizeof(dir_path), "%.*s", (int) (sep - path),
+									path);
+
+	fd = open(dir_path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd < 0)
+		return false;
+
+	result = !fsync(fd);
+	close(fd);
+
+	return result;
+}
+
+/*
+ * Reads every valid record into seqs, indexed by source address, and drops
+ * whatever follows the last valid record: a write torn by a crash or power
+ * loss can only ever damage the tail of the log.
+ */
+static bool journal_replay(struct rpl_journal *journal, uint32_t *seqs)
+{
+	uint8_t buf[IO_RECORDS * REC_LEN];
+	struct stat st;
+	off_t off, end;
+
+	journal->records = 0;
+	memset(seqs, 0xff, SRC_MAX * sizeof(*seqs));
+
+	if (fstat(journal->fd, &st) < 0)
+		return false;
+
+	if (st.st_size < HDR_LEN ||
+			pread(journal->fd, buf, HDR_LEN, 0) != HDR_LEN ||
+			memcmp(buf, JOURNAL_MAGIC, 4) ||
+			buf[4] != JOURNAL_VERSION) {
+		if (st.st_size)
+			l_warn("Discarding malformed RPL journal %s",
+								journal->path);
+
+		if (ftruncate(journal->fd, 0) < 0 ||
+						!write_header(journal->fd))
+			return false;
+
+		return !fdatasync(journal->fd);
+	}
+
+	end = off = HDR_LEN;
+
+	while (end == off && off < st.st_size) {
+		ssize_t len = pread(journal->fd, buf, sizeof(buf), off);
+		ssize_t i;
+
+		if (len <= 0)
+			break;
+
+		for (i = 0; i + REC_LEN <= len; i += REC_LEN) {
+			uint16_t src;
+			uint32_t seq;
+
+			if (!record_parse(buf + i, &src, &seq))
+				break;
+
+			seqs[src] = seq;
+			journal->records++;
+			end += REC_LEN;
+		}
+
+		off += len;
+	}
+
+	if (end < st.st_size) {
+		l_warn("Dropping %zu trailing octets of RPL journal %s",
+				(size_t) (st.st_size - end), journal->path);
+
+		if (ftruncate(journal->fd, end) < 0 ||
+						fdatasync(journal->fd) < 0)
+			return false;
+	}
+
+	return true;
+}
+
+static unsigned int count_live(const uint32_t *seqs)
+{
+	unsigned int i, live = 0;
+
+	for (i = 0; i < SRC_MAX; i++)
+		if (seqs[i] != SEQ_DELETED)
+			live++;
+
+	return live;
+}
+
+static void set_compact_at(struct rpl_journal *journal, unsigned int live)
+{
+	journal->compact_at = live * 2;
+
+	if (journal->compact_at < COMPACT_MIN)
+		journal->compact_at = COMPACT_MIN;
+}
+
+/*
+ * The compacted log is written beside the journal and renamed over it once
+ * flushed, so a crash at any point leaves one complete journal behind.
+ */
+static bool journal_rewrite(struct rpl_journal *journal, const uint32_t *seqs)
+{
+	uint8_t buf[IO_RECORDS * REC_LEN];
+	char tmp_path[PATH_MAX];
+	unsigned int i, n = 0, live = 0;
+	int fd;
+
+	if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", journal->path) >=
+							(int) sizeof(tmp_path))
+		return false;
+
+	fd = open(tmp_path, O_RDWR | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC,
+							S_IRUSR | S_IWUSR);
+	if (fd < 0)
+		return false;
+
+	if (!write_header(fd))
+		goto fail;
+
+	for (i = 0; i < SRC_MAX; i++) {
+		if (seqs[i] == SEQ_DELETED)
+			continue;
+
+		record_build(buf + n * REC_LEN, i, seqs[i]);
+		live++;
+
+		if (++n == IO_RECORDS) {
+			if (!write_all(fd, buf, n * REC_LEN))
+				goto fail;
+
+			n = 0;
+		}
+	}
+
+	if (n && !write_all(fd, buf, n * REC_LEN))
+		goto fail;
+
+	if (fdatasync(fd) < 0 || rename(tmp_path, journal->path) < 0)
+		goto fail;
+
+	sync_dir(journal->path);
+
+	close(journal->fd);
+	journal->fd = fd;
+	journal->records = live;
+	journal->pending = 0;
+	set_compact_at(journal, live);
+
+	return true;
+
+fail:
+	close(fd);
+	unlink(tmp_path);
+
+	return false;
+}
+
+struct rpl_journal *rpl_journal_open(const char *path,
+					rpl_journal_entry_func_t func,
+					void *user_data)
+{
+	struct rpl_journal *journal;
+	char tmp_path[PATH_MAX];
+	uint32_t *seqs;
+	unsigned int i, live;
+
+	if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path) >=
+							(int) sizeof(tmp_path))
+		return NULL;
+
+	/* Left over by an interrupted compaction, the journal is intact */
+	unlink(tmp_path);
+
+	journal = l_new(struct rpl_journal, 1);
+	journal->path = l_strdup(path);
+	journal->fd = open(path, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC,
+							S_IRUSR | S_IWUSR);
+	if (journal->fd < 0)
+		goto fail;
+
+	seqs = l_new(uint32_t, SRC_MAX);
+
+	if (!journal_replay(journal, seqs)) {
+		l_free(seqs);
+		goto fail;
+	}
+
+	live = count_live(seqs);
+	set_compact_at(journal, live);
+
+	if (journal->records >= journal->compact_at)
+		journal_rewrite(journal, seqs);
+
+	for (i = 0; func && i < SRC_MAX; i++) {
+		if (seqs[i] != SEQ_DELETED)
+			func(i, seqs[i], user_data);
+	}
+
+	l_free(seqs);
+
+	return journal;
+
+fail:
+	l_error("Failed to open RPL journal %s", path);
+
+	if (journal->fd >= 0)
+		close(journal->fd);
+
+	l_free(journal->path);
+	l_free(journal);
+
+	return NULL;
+}
+
+void rpl_journal_close(struct rpl_journal *journal)
+{
+	if (!journal)
+		return;
+
+	rpl_journal_sync(journal);
+	close(journal->fd);
+	l_free(journal->path);
+	l_free(journal);
+}
+
+static bool journal_append(struct rpl_journal *journal, uint16_t src,
+								uint32_t seq)
+{
+	uint8_t rec[REC_LEN];
+
+	if (!journal || !IS_UNICAST(src))
+		return false;
+
+	record_build(rec, src, seq);
+
+	if (!write_all(journal->fd, rec, sizeof(rec))) {
+		/* Never leave a partial record in front of later ones */
+		if (ftruncate(journal->fd, HDR_LEN +
+				(off_t) journal->records * REC_LEN) < 0)
+			l_error("Failed to repair RPL journal %s",
+								journal->path);
+
+		return false;
+	}
+
+	journal->records++;
+
+	if (++journal->pending >= SYNC_BATCH)
+		rpl_journal_sync(journal);
+
+	if (journal->records >= journal->compact_at)
+		rpl_journal_compact(journal);
+
+	return true;
+}
+
+bool rpl_journal_put(struct rpl_journal *journal, uint16_t src, uint32_t seq)
+{
+	if (seq > SEQ_MASK)
+		return false;
+
+	return journal_append(journal, src, seq);
+}
+
+bool rpl_journal_del(struct rpl_journal *journal, uint16_t src)
+{
+	return journal_append(journal, src, SEQ_DELETED);
+}
+
+unsigned int rpl_journal_pending(const struct rpl_journal *journal)
+{
+	return journal ? journal->pending : 0;
+}
+
+bool rpl_journal_sync(struct rpl_journal *journal)
+{
+	if (!journal)
+		return false;
+
+	if (!journal->pending)
+		return true;
+
+	if (fdatasync(journal->fd) < 0)
+		return false;
+
+	journal->pending = 0;
+
+	return true;
+}
+
+bool rpl_journal_compact(struct rpl_journal *journal)
+{
+	uint32_t *seqs;
+	bool result;
+
+	if (!journal)
+		return false;
+
+	seqs = l_new(uint32_t, SRC_MAX);
+
+	result = journal_replay(journal, seqs) &&
+					journal_rewrite(journal, seqs);
+
+	l_free(seqs);
+
+	/* Retry only once the log has grown again */
+	if (!result)
+		set_compact_at(journal, journal->records);
+
+	return result;
+}
+
+unsigned int rpl_journal_records(const struct rpl_journal *journal)
+{
+	return journal ? journal->records : 0;
+}
@@ -0,0 +1,41 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+/*
+ * Append-only log of replay protection entries for a single IV index.
+ * Every accepted message appends one fixed size record, a torn or corrupt
+ * tail left by a crash is dropped when the journal is opened, and the log
+ * is periodically rewritten to hold one record per source address.
+ */
+
+struct rpl_journal;
+
+typedef void (*rpl_journal_entry_func_t)(uint16_t src, uint32_t seq,
+							void *user_data);
+
+/*
+ * Opens or creates the journal at path, calling func (if not NULL) once for
+ * every source address with a live entry, in ascending address order.
+ */
+struct rpl_journal *rpl_journal_open(const char *path,
+					rpl_journal_entry_func_t func,
+					void *user_data);
+void rpl_journal_close(struct rpl_journal *journal);
+
+bool rpl_journal_put(struct rpl_journal *journal, uint16_t src, uint32_t seq);
+bool rpl_journal_del(struct rpl_journal *journal, uint16_t src);
+
+/* Number of appended records not yet flushed to stable storage */
+unsigned int rpl_journal_pending(const struct rpl_journal *journal);
+bool rpl_journal_sync(struct rpl_journal *journal);
+bool rpl_journal_compact(struct rpl_journal *journal);
+
+/* Records in the journal file, including superseded ones */
+unsigned int rpl_journal_records(const struct rpl_journal *journal);
@@ -25,15 +25,155 @@
 
 #include "mesh/mesh-defs.h"
 
+#include "mesh/mesh.h"
 #include "mesh/node.h"
 #include "mesh/net.h"
 #include "mesh/util.h"
+#include "mesh/rpl-journal.h"
 #include "mesh/rpl.h"
 
+#define JOURNAL_SUFFIX		".journal"
+#define JOURNAL_SYNC_DELAY	1
+
 const char *rpl_dir = "/rpl";
 
-bool rpl_put_entry(struct mesh_node *node, uint16_t src, uint32_t iv_index,
-								uint32_t seq)
+/* Open journal of a node, one per IV index */
+struct node_journal {
+	struct mesh_node *node;
+	uint32_t iv_index;
+	struct rpl_journal *journal;
+};
+
+struct journal_load {
+	struct l_queue *rpl_list;
+	struct mesh_rpl **slots;
+	uint32_t iv_index;
+};
+
+static struct l_queue *journals;
+static struct l_timeout *sync_timeout;
+
+static bool parse_journal_name(const char *name, uint32_t *iv_index)
+{
+	if (strlen(name) != 8 + strlen(JOURNAL_SUFFIX) ||
+					strcmp(name + 8, JOURNAL_SUFFIX))
+		return false;
+
+	return sscanf(name, "%08x", iv_index) == 1;
+}
+
+static void sync_journals(struct l_timeout *timeout, void *user_data)
+{
+	const struct l_queue_entry *entry;
+
+	for (entry = l_queue_get_entries(journals); entry;
+							entry = entry->next) {
+		struct node_journal *nj = entry->data;
+
+		rpl_journal_sync(nj->journal);
+	}
+
+	l_timeout_remove(sync_timeout);
+	sync_timeout = NULL;
+}
+
+static void journal_close(void *data)
+{
+	struct node_journal *nj = data;
+
+	rpl_journal_close(nj->journal);
+	l_free(nj);
+}
+
+static struct node_journal *journal_find(struct mesh_node *node,
+							uint32_t iv_index)
+{
+	const struct l_queue_entry *entry;
+
+	for (entry = l_queue_get_entries(journals); entry;
+							entry = entry->next) {
+		struct node_journal *nj = entry->data;
+
+		if (nj->node == node && nj->iv_index == iv_index)
+			return nj;
+	}
+
+	return NULL;
+}
+
+static bool journal_path(struct mesh_node *node, uint32_t iv_index,
+								char *path)
+{
+	const char *node_path = node_get_storage_dir(node);
+
+	if (!node_path || strlen(node_path) + strlen(rpl_dir) + 24 >= PATH_MAX)
+		return false;
+
+	snprintf(path, PATH_MAX, "%s%s/%8.8x%s", node_path, rpl_dir,
+						iv_index, JOURNAL_SUFFIX);
+	return true;
+}
+
+static struct node_journal *journal_open(struct mesh_node *node,
+					uint32_t iv_index,
+					rpl_journal_entry_func_t func,
+					void *user_data)
+{
+	struct rpl_journal *journal;
+	struct node_journal *nj;
+	char path[PATH_MAX];
+
+	if (!journal_path(node, iv_index, path))
+		return NULL;
+
+	journal = rpl_journal_open(path, func, user_data);
+	if (!journal)
+		return NULL;
+
+	if (!journals)
+		journals = l_queue_new();
+
+	nj = l_new(struct node_journal, 1);
+	nj->node = node;
+	nj->iv_index = iv_index;
+	nj->journal = journal;
+	l_queue_push_tail(journals, nj);
+
+	return nj;
+}
+
+static void journal_schedule_sync(struct node_journal *nj)
+{
+	/* Full batches are flushed by the journal itself */
+	if (sync_timeout || !rpl_journal_pending(nj->journal))
+		return;
+
+	sync_timeout = l_timeout_create(JOURNAL_SYNC_DELAY, sync_journals,
+								NULL, NULL);
+}
+
+static bool journal_put_entry(struct mesh_node *node, uint16_t src,
+					uint32_t iv_index, uint32_t seq)
+{
+	struct node_journal *nj;
+
+	if (!IS_UNICAST(src))
+		return false;
+
+	nj = journal_find(node, iv_index);
+	if (!nj)
+		nj = journal_open(node, iv_index, NULL, NULL);
+
+	if (!nj || !rpl_journal_put(nj->journal, src, seq))
+		return false;
+
+	journal_schedule_sync(nj);
+
+	return true;
+}
+
+static bool file_put_entry(struct mesh_node *node, uint16_t src,
+					uint32_t iv_index, uint32_t seq)
 {
 	const char *node_path;
 	char src_file[PATH_MAX];
@@ -84,8 +224,18 @@ bool rpl_put_entry(struct mesh_node *node, uint16_t src, uint32_t iv_index,
 	return result;
 }
 
+bool rpl_put_entry(struct mesh_node *node, uint16_t src, uint32_t iv_index,
+								uint32_t seq)
+{
+	if (mesh_rpl_journal_enabled())
+		return journal_put_entry(node, src, iv_index, seq);
+
+	return file_put_entry(node, src, iv_index, seq);
+}
+
 void rpl_del_entry(struct mesh_node *node, uint16_t src)
 {
+	const struct l_queue_entry *q;
 	const char *node_path;
 	char rpl_path[PATH_MAX];
 	struct dirent *entry;
@@ -115,6 +265,17 @@ void rpl_del_entry(struct mesh_node *node, uint16_t src)
 	}
 
 	closedir(dir);
+
+	/*
+	 * Journals of the node are all open while they are in use, and
+	 * converted to files by rpl_get_list() otherwise.
+	 */
+	for (q = l_queue_get_entries(journals); q; q = q->next) {
+		struct node_journal *nj = q->data;
+
+		if (nj->node == node && rpl_journal_del(nj->journal, src))
+			journal_schedule_sync(nj);
+	}
 }
 
 static bool match_src(const void *a, const void *b)
@@ -188,6 +349,101 @@ static void get_entries(const char *iv_path, struct l_queue *rpl_list)
 	closedir(dir);
 }
 
+static void journal_load_entry(uint16_t src, uint32_t seq, void *user_data)
+{
+	struct journal_load *load = user_data;
+	struct mesh_rpl *rpl = load->slots[src];
+
+	if (!rpl) {
+		rpl = l_new(struct mesh_rpl, 1);
+		rpl->src = src;
+		load->slots[src] = rpl;
+		l_queue_push_head(load->rpl_list, rpl);
+	} else if (rpl->iv_index > load->iv_index ||
+			(rpl->iv_index == load->iv_index && rpl->seq >= seq))
+		return;
+
+	rpl->iv_index = load->iv_index;
+	rpl->seq = seq;
+}
+
+static void get_journal_entries(struct mesh_node *node, DIR *dir,
+						struct l_queue *rpl_list)
+{
+	const struct l_queue_entry *q;
+	struct dirent *entry;
+	struct journal_load load = { .rpl_list = rpl_list };
+	struct l_queue *stale = NULL;
+
+	/* Source address to entry map, avoids a list search per record */
+	load.slots = l_new(struct mesh_rpl *, VIRTUAL_ADDRESS_LOW);
+
+	for (q = l_queue_get_entries(rpl_list); q; q = q->next) {
+		struct mesh_rpl *rpl = q->data;
+
+		load.slots[rpl->src] = rpl;
+	}
+
+	while ((entry = readdir(dir)) != NULL) {
+		struct node_journal *nj;
+
+		if (entry->d_type != DT_REG ||
+				!parse_journal_name(entry->d_name,
+							&load.iv_index))
+			continue;
+
+		nj = journal_find(node, load.iv_index);
+		if (nj) {
+			l_queue_remove(journals, nj);
+			journal_close(nj);
+		}
+
+		nj = journal_open(node, load.iv_index, journal_load_entry,
+									&load);
+
+		/* Journals are only kept open while configured */
+		if (nj && !mesh_rpl_journal_enabled()) {
+			l_queue_remove(journals, nj);
+			journal_close(nj);
+
+			if (!stale)
+				stale = l_queue_new();
+
+			l_queue_push_tail(stale, L_UINT_TO_PTR(load.iv_index));
+		}
+	}
+
+	l_free(load.slots);
+
+	if (!stale)
+		return;
+
+	/*
+	 * Carry journals left over from the other storage format into per
+	 * source files, so that nothing has to open them again later.
+	 */
+	for (q = l_queue_get_entries(rpl_list); q; q = q->next) {
+		struct mesh_rpl *rpl = q->data;
+
+		if (!IS_UNICAST(rpl->src))
+			continue;
+
+		if (!file_put_entry(node, rpl->src, rpl->iv_index, rpl->seq)) {
+			l_queue_destroy(stale, NULL);
+			return;
+		}
+	}
+
+	for (q = l_queue_get_entries(stale); q; q = q->next) {
+		char path[PATH_MAX];
+
+		if (journal_path(node, L_PTR_TO_UINT(q->data), path))
+			remove(path);
+	}
+
+	l_queue_destroy(stale, NULL);
+}
+
 bool rpl_get_list(struct mesh_node *node, struct l_queue *rpl_list)
 {
 	const char *node_path;
@@ -226,12 +482,34 @@ bool rpl_get_list(struct mesh_node *node, struct l_queue *rpl_list)
 		}
 	}
 
+	/* Journal records take precedence over per source files */
+	rewinddir(dir);
+	get_journal_entries(node, dir, rpl_list);
+
 	l_free(rpl_path);
 	closedir(dir);
 
 	return true;
 }
 
+static void journal_close_stale(struct mesh_node *node, uint32_t cur)
+{
+	const struct l_queue_entry *entry = l_queue_get_entries(journals);
+
+	while (entry) {
+		struct node_journal *nj = entry->data;
+
+		entry = entry->next;
+
+		if (nj->node != node || nj->iv_index == cur ||
+						nj->iv_index == cur - 1)
+			continue;
+
+		l_queue_remove(journals, nj);
+		journal_close(nj);
+	}
+}
+
 void rpl_update(struct mesh_node *node, uint32_t cur)
 {
 	uint32_t old = cur - 1;
@@ -255,6 +533,8 @@ void rpl_update(struct mesh_node *node, uint32_t cur)
 	if (!dir)
 		return;
 
+	journal_close_stale(node, cur);
+
 	/* Cleanup any stale or malformed trees */
 	while ((entry = readdir(dir)) != NULL) {
 		if (entry->d_type == DT_DIR && entry->d_name[0] != '.') {
@@ -272,6 +552,22 @@ void rpl_update(struct mesh_node *node, uint32_t cur)
 					node_path, rpl_dir, entry->d_name);
 				del_path(path);
 			}
+		} else if (entry->d_type == DT_REG) {
+			uint32_t val;
+
+			/* Delete journals, or their leftovers, of old IVs */
+			if (strlen(entry->d_name) < 8 + strlen(JOURNAL_SUFFIX) ||
+					sscanf(entry->d_name, "%08x", &val) != 1 ||
+					strncmp(entry->d_name + 8,
+						JOURNAL_SUFFIX,
+						strlen(JOURNAL_SUFFIX)))
+				continue;
+
+			if (val != cur && val != old) {
+				snprintf(path, PATH_MAX, "%s%s/%s",
+					node_path, rpl_dir, entry->d_name);
+				remove(path);
+			}
 		}
 	}
 
@@ -289,3 +585,27 @@ bool rpl_init(const char *node_path)
 	mkdir(path, 0755);
 	return true;
 }
+
+void rpl_close(struct mesh_node *node)
+{
+	const struct l_queue_entry *entry = l_queue_get_entries(journals);
+
+	while (entry) {
+		struct node_journal *nj = entry->data;
+
+		entry = entry->next;
+
+		if (nj->node != node)
+			continue;
+
+		l_queue_remove(journals, nj);
+		journal_close(nj);
+	}
+
+	if (l_queue_isempty(journals)) {
+		l_queue_destroy(journals, NULL);
+		journals = NULL;
+		l_timeout_remove(sync_timeout);
+		sync_timeout = NULL;
+	}
+}
@@ -13,8 +13,14 @@
 #include <config.h>
 #endif
 
+#define _GNU_SOURCE
 #include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
 
 #include "lib/bluetooth.h"
 
@@ -22,9 +28,65 @@
 #include "src/shared/queue.h"
 #include "src/shared/btsnoop.h"
 #include "monitor/bt.h"
+#include "latency.h"
 #include "analyze.h"
 
+/* Upper bound for worker threads, each one maps or buffers the trace */
+#define MAX_JOBS		64
+
+/* Traces smaller than this per worker are not worth splitting */
+#define MIN_SHARD_SIZE		(4 * 1024 * 1024)
+
+#define CONN_ACL		0x00
+#define CONN_SCO		0x01
+#define CONN_ISO		0x02
+
+#define DIR_TX			0
+#define DIR_RX			1
+
+struct hci_cmd {
+	uint16_t opcode;
+	unsigned long num_sent;
+	struct latency latency;
+
+	/* Last command that is still waiting for its response */
+	bool pending;
+	struct timeval pending_tv;
+
+	/* First response of a shard that arrived before any command, its
+	 * command is pending at the end of the previous shard.
+	 */
+	bool orphan;
+	struct timeval orphan_tv;
+};
+
+struct l2cap_chan {
+	uint16_t cid;
+	unsigned long frames[2];
+	unsigned long long bytes[2];
+};
+
+struct hci_conn {
+	uint16_t handle;
+	uint8_t type;
+	unsigned long packets[2];
+	unsigned long long bytes[2];
+	struct timeval first_tv;
+	struct timeval last_tv;
+	struct queue *chan_list;
+
+	/* Channel of the last ACL start fragment in each direction */
+	bool cid_valid[2];
+	uint16_t cid[2];
+
+	/* Continuation fragments of a shard seen before any start fragment */
+	unsigned long long lead_bytes[2];
+};
+
+struct shard;
+
 struct hci_dev {
+	struct shard *shard;
 	uint16_t index;
 	uint8_t type;
 	uint8_t bdaddr[6];
@@ -34,51 +96,94 @@ struct hci_dev {
 	unsigned long num_evt;
 	unsigned long num_acl;
 	unsigned long num_sco;
+	unsigned long num_iso;
 	unsigned long vendor_diag;
 	unsigned long system_note;
 	unsigned long user_log;
 	unsigned long unknown;
 	uint16_t manufacturer;
+	bool added;
+	bool removed;
+	struct latency latency;
+	struct queue *cmd_list;
+	struct queue *conn_list;
 };
 
-static struct queue *dev_list;
+/* Statistics of a contiguous range of packets of the trace */
+struct shard {
+	const char *path;
+	struct btsnoop *btsnoop;
+	off_t start;
+	off_t end;
+	struct queue *dev_list;
+	struct queue *msg_list;
+	unsigned long num_packets;
+	bool failed;
+	bool threaded;
+	pthread_t thread;
+};
+
+/* Output of a worker, printed by the main thread in trace order */
+struct shard_msg {
+	FILE *fp;
+	char *str;
+};
 
-static void dev_destroy(void *data)
+static void shard_printf(struct shard *shard, FILE *fp,
+					const char *format, ...)
+					__attribute__((format(printf, 3, 4)));
+
+static void shard_printf(struct shard *shard, FILE *fp,
+					const char *format, ...)
 {
-	struct hci_dev *dev = data;
-	const char *str;
+	struct shard_msg *msg;
+	va_list ap;
+	int len;
 
-	switch (dev->type) {
-	case 0x00:
-		str = "BR/EDR";
-		break;
-	case 0x01:
-		str = "AMP";
-		break;
-	default:
-		str = "unknown";
-		break;
+	msg = new0(struct shard_msg, 1);
+	msg->fp = fp;
+
+	va_start(ap, format);
+	len = vasprintf(&msg->str, format, ap);
+	va_end(ap);
+
+	if (len < 0) {
+		free(msg);
+		return;
 	}
 
-	printf("Found %s controller with index %u\n", str, dev->index);
-	printf("  BD_ADDR %2.2X:%2.2X:%2.2X:%2.2X:%2.2X:%2.2X",
-			dev->bdaddr[5], dev->bdaddr[4], dev->bdaddr[3],
-			dev->bdaddr[2], dev->bdaddr[1], dev->bdaddr[0]);
-	if (dev->manufacturer != 0xffff)
-		printf(" (%s)", bt_compidtostr(dev->manufacturer));
-	printf("\n");
+	queue_push_tail(shard->msg_list, msg);
+}
 
+static void shard_msg_free(void *data)
+{
+	struct shard_msg *msg = data;
 
-	printf("  %lu commands\n", dev->num_cmd);
-	printf("  %lu events\n", dev->num_evt);
-	printf("  %lu ACL packets\n", dev->num_acl);
-	printf("  %lu SCO packets\n", dev->num_sco);
-	printf("  %lu vendor diagnostics\n", dev->vendor_diag);
-	printf("  %lu system notes\n", dev->system_note);
-	printf("  %lu user logs\n", dev->user_log);
-	printf("  %lu unknown opcodes\n", dev->unknown);
-	printf("\n");
+	free(msg->str);
+	free(msg);
+}
+
+static void shard_msg_print(void *data, void *user_data)
+{
+	struct shard_msg *msg = data;
+
+	fputs(msg->str, msg->fp);
+}
 
+static void conn_free(void *data)
+{
+	struct hci_conn *conn = data;
+
+	queue_destroy(conn->chan_list, free);
+	free(conn);
+}
+
+static void dev_free(void *data)
+{
+	struct hci_dev *dev = data;
+
+	queue_destroy(dev->cmd_list, free);
+	queue_destroy(dev->conn_list, conn_free);
 	free(dev);
 }
 
@@ -90,6 +195,8 @@ static struct hci_dev *dev_alloc(uint16_t index)
 
 	dev->index = index;
 	dev->manufacturer = 0xffff;
+	dev->cmd_list = queue_new();
+	dev->conn_list = queue_new();
 
 	return dev;
 }
@@ -99,67 +206,174 @@ static bool dev_match_index(const void *a, const void *b)
 	const struct hci_dev *dev = a;
 	uint16_t index = PTR_TO_UINT(b);
 
-	return dev->index == index;
+	return dev->index == index && !dev->removed;
 }
 
-static struct hci_dev *dev_lookup(uint16_t index)
+static struct hci_dev *dev_lookup(struct shard *shard, uint16_t index)
 {
 	struct hci_dev *dev;
 
-	dev = queue_find(dev_list, dev_match_index, UINT_TO_PTR(index));
+	dev = queue_find(shard->dev_list, dev_match_index, UINT_TO_PTR(index));
 	if (!dev) {
-		fprintf(stderr, "Creating new device for unknown index\n");
-
 		dev = dev_alloc(index);
+		dev->shard = shard;
 
-		queue_push_tail(dev_list, dev);
+		queue_push_tail(shard->dev_list, dev);
 	}
 
 	return dev;
 }
 
-static void new_index(struct timeval *tv, uint16_t index,
+static bool cmd_match_opcode(const void *a, const void *b)
+{
+	const struct hci_cmd *cmd = a;
+	uint16_t opcode = PTR_TO_UINT(b);
+
+	return cmd->opcode == opcode;
+}
+
+static struct hci_cmd *cmd_lookup(struct hci_dev *dev, uint16_t opcode)
+{
+	struct hci_cmd *cmd;
+
+	cmd = queue_find(dev->cmd_list, cmd_match_opcode,
+						UINT_TO_PTR(opcode));
+	if (!cmd) {
+		cmd = new0(struct hci_cmd, 1);
+		cmd->opcode = opcode;
+
+		queue_push_tail(dev->cmd_list, cmd);
+	}
+
+	return cmd;
+}
+
+static bool conn_match_handle(const void *a, const void *b)
+{
+	const struct hci_conn *conn = a;
+	uint32_t key = PTR_TO_UINT(b);
+
+	return conn->handle == (key & 0x0fff) && conn->type == (key >> 16);
+}
+
+static struct hci_conn *conn_lookup(struct hci_dev *dev, uint16_t handle,
+								uint8_t type)
+{
+	struct hci_conn *conn;
+
+	conn = queue_find(dev->conn_list, conn_match_handle,
+					UINT_TO_PTR(type << 16 | handle));
+	if (!conn) {
+		conn = new0(struct hci_conn, 1);
+		conn->handle = handle;
+		conn->type = type;
+		conn->chan_list = queue_new();
+
+		queue_push_tail(dev->conn_list, conn);
+	}
+
+	return conn;
+}
+
+static bool chan_match_cid(const void *a, const void *b)
+{
+	const struct l2cap_chan *chan = a;
+	uint16_t cid = PTR_TO_UINT(b);
+
+	return chan->cid == cid;
+}
+
+static struct l2cap_chan *chan_lookup(struct hci_conn *conn, uint16_t cid)
+{
+	struct l2cap_chan *chan;
+
+	chan = queue_find(conn->chan_list, chan_match_cid, UINT_TO_PTR(cid));
+	if (!chan) {
+		chan = new0(struct l2cap_chan, 1);
+		chan->cid = cid;
+
+		queue_push_tail(conn->chan_list, chan);
+	}
+
+	return chan;
+}
+
+static void cmd_response(struct hci_dev *dev, struct timeval *tv,
+							uint16_t opcode)
+{
+	struct hci_cmd *cmd;
+	unsigned long long usec;
+
+	/* Command credit updates carry no command */
+	if (!opcode)
+		return;
+
+	cmd = cmd_lookup(dev, opcode);
+
+	if (!cmd->pending) {
+		if (!cmd->num_sent && !cmd->orphan) {
+			cmd->orphan = true;
+			cmd->orphan_tv = *tv;
+		}
+		return;
+	}
+
+	usec = latency_usec(&cmd->pending_tv, tv);
+
+	latency_add(&cmd->latency, usec);
+	latency_add(&dev->latency, usec);
+
+	cmd->pending = false;
+}
+
+static void new_index(struct shard *shard, struct timeval *tv, uint16_t index,
 					const void *data, uint16_t size)
 {
 	const struct btsnoop_opcode_new_index *ni = data;
 	struct hci_dev *dev;
 
+	if (size < sizeof(*ni))
+		return;
+
 	dev = dev_alloc(index);
 
+	dev->shard = shard;
 	dev->type = ni->type;
 	memcpy(dev->bdaddr, ni->bdaddr, 6);
+	dev->time_added = *tv;
+	dev->added = true;
 
-	queue_push_tail(dev_list, dev);
+	queue_push_tail(shard->dev_list, dev);
 }
 
-static void del_index(struct timeval *tv, uint16_t index,
+static void del_index(struct shard *shard, struct timeval *tv, uint16_t index,
 					const void *data, uint16_t size)
 {
 	struct hci_dev *dev;
 
-	dev = queue_remove_if(dev_list, dev_match_index, UINT_TO_PTR(index));
-	if (!dev) {
-		fprintf(stderr, "Remove for an unexisting device\n");
-		return;
-	}
+	/* Devices are only dropped when merging the shards */
+	dev = dev_lookup(shard, index);
 
-	dev_destroy(dev);
+	dev->time_removed = *tv;
+	dev->removed = true;
 }
 
-static void command_pkt(struct timeval *tv, uint16_t index,
+static void command_pkt(struct hci_dev *dev, struct timeval *tv,
 					const void *data, uint16_t size)
 {
 	const struct bt_hci_cmd_hdr *hdr = data;
-	struct hci_dev *dev;
+	struct hci_cmd *cmd;
 
-	data += sizeof(*hdr);
-	size -= sizeof(*hdr);
+	dev->num_cmd++;
 
-	dev = dev_lookup(index);
-	if (!dev)
+	if (size < sizeof(*hdr))
 		return;
 
-	dev->num_cmd++;
+	cmd = cmd_lookup(dev, le16_to_cpu(hdr->opcode));
+
+	cmd->num_sent++;
+	cmd->pending = true;
+	cmd->pending_tv = *tv;
 }
 
 static void rsp_read_bd_addr(struct hci_dev *dev, struct timeval *tv,
@@ -167,7 +381,12 @@ static void rsp_read_bd_addr(struct hci_dev *dev, struct timeval *tv,
 {
 	const struct bt_hci_rsp_read_bd_addr *rsp = data;
 
-	printf("Read BD Addr event with status 0x%2.2x\n", rsp->status);
+	if (size < sizeof(*rsp))
+		return;
+
+	shard_printf(dev->shard, stdout,
+			"Read BD Addr event with status 0x%2.2x\n",
+			rsp->status);
 
 	if (rsp->status)
 		return;
@@ -181,11 +400,16 @@ static void evt_cmd_complete(struct hci_dev *dev, struct timeval *tv,
 	const struct bt_hci_evt_cmd_complete *evt = data;
 	uint16_t opcode;
 
+	if (size < sizeof(*evt))
+		return;
+
 	data += sizeof(*evt);
 	size -= sizeof(*evt);
 
 	opcode = le16_to_cpu(evt->opcode);
 
+	cmd_response(dev, tv, opcode);
+
 	switch (opcode) {
 	case BT_HCI_CMD_READ_BD_ADDR:
 		rsp_read_bd_addr(dev, tv, data, size);
@@ -193,131 +417,696 @@ static void evt_cmd_complete(struct hci_dev *dev, struct timeval *tv,
 	}
 }
 
-static void event_pkt(struct timeval *tv, uint16_t index,
+static void evt_cmd_status(struct hci_dev *dev, struct timeval *tv,
+					const void *data, uint16_t size)
+{
+	const struct bt_hci_evt_cmd_status *evt = data;
+
+	if (size < sizeof(*evt))
+		return;
+
+	cmd_response(dev, tv, le16_to_cpu(evt->opcode));
+}
+
+static void event_pkt(struct hci_dev *dev, struct timeval *tv,
 					const void *data, uint16_t size)
 {
 	const struct bt_hci_evt_hdr *hdr = data;
-	struct hci_dev *dev;
 
-	data += sizeof(*hdr);
-	size -= sizeof(*hdr);
+	dev->num_evt++;
 
-	dev = dev_lookup(index);
-	if (!dev)
+	if (size < sizeof(*hdr))
 		return;
 
-	dev->num_evt++;
+	data += sizeof(*hdr);
+	size -= sizeof(*hdr);
 
 	switch (hdr->evt) {
 	case BT_HCI_EVT_CMD_COMPLETE:
 		evt_cmd_complete(dev, tv, data, size);
 		break;
+	case BT_HCI_EVT_CMD_STATUS:
+		evt_cmd_status(dev, tv, data, size);
+		break;
 	}
 }
 
-static void acl_pkt(struct timeval *tv, uint16_t index,
+static struct hci_conn *conn_data(struct hci_dev *dev, struct timeval *tv,
+					uint16_t handle, uint8_t type,
+					int dir, uint16_t len)
+{
+	struct hci_conn *conn;
+
+	conn = conn_lookup(dev, handle & 0x0fff, type);
+
+	if (!conn->packets[DIR_TX] && !conn->packets[DIR_RX])
+		conn->first_tv = *tv;
+
+	conn->last_tv = *tv;
+	conn->packets[dir]++;
+	conn->bytes[dir] += len;
+
+	return conn;
+}
+
+static void acl_pkt(struct hci_dev *dev, struct timeval *tv, int dir,
 					const void *data, uint16_t size)
 {
 	const struct bt_hci_acl_hdr *hdr = data;
-	struct hci_dev *dev;
+	struct hci_conn *conn;
+	struct l2cap_chan *chan;
+	uint16_t handle;
+
+	dev->num_acl++;
+
+	if (size < sizeof(*hdr))
+		return;
 
 	data += sizeof(*hdr);
 	size -= sizeof(*hdr);
 
-	dev = dev_lookup(index);
-	if (!dev)
+	handle = le16_to_cpu(hdr->handle);
+	conn = conn_data(dev, tv, handle, CONN_ACL, dir, size);
+
+	/* Continuation fragments belong to the last started L2CAP frame */
+	if ((handle >> 12 & 0x03) == 0x01) {
+		if (!conn->cid_valid[dir]) {
+			conn->lead_bytes[dir] += size;
+			return;
+		}
+
+		chan = chan_lookup(conn, conn->cid[dir]);
+		chan->bytes[dir] += size;
 		return;
+	}
 
-	dev->num_acl++;
+	if (size < 4)
+		return;
+
+	conn->cid[dir] = get_le16(data + 2);
+	conn->cid_valid[dir] = true;
+
+	chan = chan_lookup(conn, conn->cid[dir]);
+	chan->frames[dir]++;
+	chan->bytes[dir] += size;
 }
 
-static void sco_pkt(struct timeval *tv, uint16_t index,
+static void sco_pkt(struct hci_dev *dev, struct timeval *tv, int dir,
 					const void *data, uint16_t size)
 {
 	const struct bt_hci_sco_hdr *hdr = data;
-	struct hci_dev *dev;
 
-	data += sizeof(*hdr);
-	size -= sizeof(*hdr);
+	dev->num_sco++;
 
-	dev = dev_lookup(index);
-	if (!dev)
+	if (size < sizeof(*hdr))
 		return;
 
-	dev->num_sco++;
+	conn_data(dev, tv, le16_to_cpu(hdr->handle), CONN_SCO, dir,
+						size - sizeof(*hdr));
 }
 
-static void info_index(struct timeval *tv, uint16_t index,
+static void iso_pkt(struct hci_dev *dev, struct timeval *tv, int dir,
 					const void *data, uint16_t size)
 {
-	const struct btsnoop_opcode_index_info *hdr = data;
-	struct hci_dev *dev;
+	const struct bt_hci_iso_hdr *hdr = data;
 
-	data += sizeof(*hdr);
-	size -= sizeof(*hdr);
+	dev->num_iso++;
 
-	dev = dev_lookup(index);
-	if (!dev)
+	if (size < sizeof(*hdr))
 		return;
 
-	dev->manufacturer = hdr->manufacturer;
+	conn_data(dev, tv, le16_to_cpu(hdr->handle), CONN_ISO, dir,
+						size - sizeof(*hdr));
 }
 
-static void vendor_diag(struct timeval *tv, uint16_t index,
+static void info_index(struct hci_dev *dev, struct timeval *tv,
 					const void *data, uint16_t size)
 {
-	struct hci_dev *dev;
+	const struct btsnoop_opcode_index_info *hdr = data;
 
-	dev = dev_lookup(index);
-	if (!dev)
+	if (size < sizeof(*hdr))
 		return;
 
-	dev->vendor_diag++;
+	dev->manufacturer = hdr->manufacturer;
 }
 
-static void system_note(struct timeval *tv, uint16_t index,
+static void analyze_packet(struct shard *shard, struct timeval *tv,
+					uint16_t index, uint16_t opcode,
 					const void *data, uint16_t size)
 {
 	struct hci_dev *dev;
 
-	dev = dev_lookup(index);
-	if (!dev)
+	switch (opcode) {
+	case BTSNOOP_OPCODE_NEW_INDEX:
+		new_index(shard, tv, index, data, size);
+		return;
+	case BTSNOOP_OPCODE_DEL_INDEX:
+		del_index(shard, tv, index, data, size);
+		return;
+	case BTSNOOP_OPCODE_OPEN_INDEX:
+	case BTSNOOP_OPCODE_CLOSE_INDEX:
 		return;
+	}
+
+	dev = dev_lookup(shard, index);
 
-	dev->system_note++;
+	switch (opcode) {
+	case BTSNOOP_OPCODE_COMMAND_PKT:
+		command_pkt(dev, tv, data, size);
+		break;
+	case BTSNOOP_OPCODE_EVENT_PKT:
+		event_pkt(dev, tv, data, size);
+		break;
+	case BTSNOOP_OPCODE_ACL_TX_PKT:
+		acl_pkt(dev, tv, DIR_TX, data, size);
+		break;
+	case BTSNOOP_OPCODE_ACL_RX_PKT:
+		acl_pkt(dev, tv, DIR_RX, data, size);
+		break;
+	case BTSNOOP_OPCODE_SCO_TX_PKT:
+		sco_pkt(dev, tv, DIR_TX, data, size);
+		break;
+	case BTSNOOP_OPCODE_SCO_RX_PKT:
+		sco_pkt(dev, tv, DIR_RX, data, size);
+		break;
+	case BTSNOOP_OPCODE_ISO_TX_PKT:
+		iso_pkt(dev, tv, DIR_TX, data, size);
+		break;
+	case BTSNOOP_OPCODE_ISO_RX_PKT:
+		iso_pkt(dev, tv, DIR_RX, data, size);
+		break;
+	case BTSNOOP_OPCODE_INDEX_INFO:
+		info_index(dev, tv, data, size);
+		break;
+	case BTSNOOP_OPCODE_VENDOR_DIAG:
+		dev->vendor_diag++;
+		break;
+	case BTSNOOP_OPCODE_SYSTEM_NOTE:
+		dev->system_note++;
+		break;
+	case BTSNOOP_OPCODE_USER_LOGGING:
+		dev->user_log++;
+		break;
+	default:
+		shard_printf(shard, stderr, "Unknown opcode %u\n", opcode);
+		dev->unknown++;
+		break;
+	}
 }
 
-static void user_log(struct timeval *tv, uint16_t index,
-					const void *data, uint16_t size)
+static void *analyze_shard(void *user_data)
 {
-	struct hci_dev *dev;
+	struct shard *shard = user_data;
+	struct btsnoop *btsnoop;
+
+	/* Each worker needs its own read position */
+	if (shard->btsnoop)
+		btsnoop = btsnoop_ref(shard->btsnoop);
+	else
+		btsnoop = btsnoop_open(shard->path, BTSNOOP_FLAG_PKLG_SUPPORT |
+							BTSNOOP_FLAG_MMAP);
+
+	if (!btsnoop || (shard->start >= 0 &&
+				!btsnoop_seek(btsnoop, shard->start))) {
+		shard->failed = true;
+		goto done;
+	}
+
+	while (shard->end < 0 || btsnoop_tell(btsnoop) < shard->end) {
+		const void *data;
+		struct timeval tv;
+		uint16_t index, opcode, pktlen;
+
+		if (!btsnoop_next_hci(btsnoop, &tv, &index, &opcode,
+							&data, &pktlen))
+			break;
+
+		analyze_packet(shard, &tv, index, opcode, data, pktlen);
+
+		shard->num_packets++;
+	}
+
+done:
+	btsnoop_unref(btsnoop);
+
+	return NULL;
+}
+
+/*
+ * Packets can only be told apart by walking the record headers, so the
+ * shard boundaries are found with one pass over the headers before the
+ * workers start.
+ */
+static unsigned int split_trace(struct btsnoop *btsnoop, off_t size,
+					unsigned int jobs, off_t *starts)
+{
+	off_t target = size / jobs;
+	unsigned int count = 1;
+
+	starts[0] = btsnoop_tell(btsnoop);
+
+	while (count < jobs) {
+		const void *data;
+		struct timeval tv;
+		uint16_t index, opcode, pktlen;
+		off_t off = btsnoop_tell(btsnoop);
+
+		if (off >= target * count)
+			starts[count++] = off;
+
+		if (!btsnoop_next_hci(btsnoop, &tv, &index, &opcode,
+							&data, &pktlen))
+			break;
+	}
+
+	return count;
+}
+
+static void conn_merge(struct hci_dev *dev, struct hci_conn *src)
+{
+	struct hci_conn *conn;
+	const struct queue_entry *entry;
+	int dir;
+
+	conn = conn_lookup(dev, src->handle, src->type);
+
+	if (!conn->packets[DIR_TX] && !conn->packets[DIR_RX])
+		conn->first_tv = src->first_tv;
+
+	conn->last_tv = src->last_tv;
+
+	for (dir = DIR_TX; dir <= DIR_RX; dir++) {
+		conn->packets[dir] += src->packets[dir];
+		conn->bytes[dir] += src->bytes[dir];
+
+		if (src->lead_bytes[dir]) {
+			struct l2cap_chan *chan;
+
+			if (conn->cid_valid[dir]) {
+				chan = chan_lookup(conn, conn->cid[dir]);
+				chan->bytes[dir] += src->lead_bytes[dir];
+			} else {
+				conn->lead_bytes[dir] += src->lead_bytes[dir];
+			}
+		}
+
+		if (src->cid_valid[dir]) {
+			conn->cid[dir] = src->cid[dir];
+			conn->cid_valid[dir] = true;
+		}
+	}
+
+	for (entry = queue_get_entries(src->chan_list); entry;
+							entry = entry->next) {
+		struct l2cap_chan *src_chan = entry->data;
+		struct l2cap_chan *chan;
+
+		chan = chan_lookup(conn, src_chan->cid);
+
+		for (dir = DIR_TX; dir <= DIR_RX; dir++) {
+			chan->frames[dir] += src_chan->frames[dir];
+			chan->bytes[dir] += src_chan->bytes[dir];
+		}
+	}
+}
+
+static void cmd_merge(struct hci_dev *dev, struct hci_cmd *src)
+{
+	struct hci_cmd *cmd;
+
+	cmd = cmd_lookup(dev, src->opcode);
+
+	/* Pair the command left pending by the previous shards */
+	if (src->orphan && cmd->pending) {
+		unsigned long long usec;
+
+		usec = latency_usec(&cmd->pending_tv, &src->orphan_tv);
+
+		latency_add(&cmd->latency, usec);
+		latency_add(&dev->latency, usec);
+
+		cmd->pending = false;
+	}
+
+	cmd->num_sent += src->num_sent;
+	latency_merge(&cmd->latency, &src->latency);
+
+	if (src->num_sent) {
+		cmd->pending = src->pending;
+		cmd->pending_tv = src->pending_tv;
+	}
+}
+
+static void dev_merge(struct hci_dev *dev, struct hci_dev *src)
+{
+	const struct queue_entry *entry;
+	static const uint8_t bdaddr_any[6];
+
+	if (memcmp(src->bdaddr, bdaddr_any, 6))
+		memcpy(dev->bdaddr, src->bdaddr, 6);
+
+	if (src->manufacturer != 0xffff)
+		dev->manufacturer = src->manufacturer;
+
+	if (src->removed) {
+		dev->time_removed = src->time_removed;
+		dev->removed = true;
+	}
+
+	dev->num_cmd += src->num_cmd;
+	dev->num_evt += src->num_evt;
+	dev->num_acl += src->num_acl;
+	dev->num_sco += src->num_sco;
+	dev->num_iso += src->num_iso;
+	dev->vendor_diag += src->vendor_diag;
+	dev->system_note += src->system_note;
+	dev->user_log += src->user_log;
+	dev->unknown += src->unknown;
+
+	latency_merge(&dev->latency, &src->latency);
+
+	for (entry = queue_get_entries(src->cmd_list); entry;
+							entry = entry->next)
+		cmd_merge(dev, entry->data);
+
+	for (entry = queue_get_entries(src->conn_list); entry;
+							entry = entry->next)
+		conn_merge(dev, entry->data);
+}
+
+static bool dev_is_idle(const struct hci_dev *dev)
+{
+	return !dev->num_cmd && !dev->num_evt && !dev->num_acl &&
+			!dev->num_sco && !dev->num_iso && !dev->vendor_diag &&
+			!dev->system_note && !dev->user_log && !dev->unknown &&
+			dev->manufacturer == 0xffff;
+}
+
+/* Shards have to be merged in trace order */
+static void shard_merge(struct queue *dev_list, struct shard *shard)
+{
+	struct hci_dev *src;
+
+	queue_foreach(shard->msg_list, shard_msg_print, NULL);
+	queue_destroy(shard->msg_list, shard_msg_free);
+	shard->msg_list = NULL;
+
+	while ((src = queue_pop_head(shard->dev_list))) {
+		struct hci_dev *dev = NULL;
+
+		if (!src->added) {
+			dev = queue_find(dev_list, dev_match_index,
+						UINT_TO_PTR(src->index));
+			if (!dev && src->removed && dev_is_idle(src)) {
+				fprintf(stderr, "Remove for an unexisting "
+								"device\n");
+				dev_free(src);
+				continue;
+			}
+
+			if (!dev)
+				fprintf(stderr, "Creating new device for "
+							"unknown index\n");
+		}
+
+		if (!dev) {
+			dev = dev_alloc(src->index);
+			dev->type = src->type;
+			dev->time_added = src->time_added;
+
+			queue_push_tail(dev_list, dev);
+		}
+
+		dev_merge(dev, src);
+		dev_free(src);
+	}
+
+	queue_destroy(shard->dev_list, NULL);
+	shard->dev_list = NULL;
+}
+
+static const char *dev_type_str(uint8_t type)
+{
+	switch (type) {
+	case 0x00:
+		return "BR/EDR";
+	case 0x01:
+		return "AMP";
+	default:
+		return "unknown";
+	}
+}
+
+static const char *conn_type_str(uint8_t type)
+{
+	switch (type) {
+	case CONN_ACL:
+		return "ACL";
+	case CONN_SCO:
+		return "SCO";
+	case CONN_ISO:
+		return "ISO";
+	default:
+		return "unknown";
+	}
+}
+
+static unsigned long long rate_bps(unsigned long long bytes,
+						unsigned long long usec)
+{
+	if (!usec)
+		return 0;
+
+	return bytes * 8 * 1000000 / usec;
+}
+
+static void print_conn(void *data, void *user_data)
+{
+	struct hci_conn *conn = data;
+	unsigned long long usec;
+	const struct queue_entry *entry;
+
+	usec = latency_usec(&conn->first_tv, &conn->last_tv);
+
+	printf("  %s handle %u (%llu.%03llu s)\n", conn_type_str(conn->type),
+				conn->handle, usec / 1000000,
+				usec / 1000 % 1000);
+	printf("    TX %lu packets, %llu bytes, %llu bit/s\n",
+				conn->packets[DIR_TX], conn->bytes[DIR_TX],
+				rate_bps(conn->bytes[DIR_TX], usec));
+	printf("    RX %lu packets, %llu bytes, %llu bit/s\n",
+				conn->packets[DIR_RX], conn->bytes[DIR_RX],
+				rate_bps(conn->bytes[DIR_RX], usec));
+
+	for (entry = queue_get_entries(conn->chan_list); entry;
+							entry = entry->next) {
+		struct l2cap_chan *chan = entry->data;
+
+		printf("    L2CAP CID 0x%4.4x: TX %lu frames %llu bytes, "
+				"RX %lu frames %llu bytes\n", chan->cid,
+				chan->frames[DIR_TX], chan->bytes[DIR_TX],
+				chan->frames[DIR_RX], chan->bytes[DIR_RX]);
+	}
+}
+
+static void print_cmd(void *data, void *user_data)
+{
+	struct hci_cmd *cmd = data;
 
-	dev = dev_lookup(index);
-	if (!dev)
+	if (!cmd->latency.count)
 		return;
 
-	dev->user_log++;
+	printf("    0x%4.4x: %lu sent, min %llu us, avg %llu us, "
+				"max %llu us\n", cmd->opcode, cmd->num_sent,
+				cmd->latency.min, latency_avg(&cmd->latency),
+				cmd->latency.max);
 }
 
-static void unknown_opcode(struct timeval *tv, uint16_t index,
-					const void *data, uint16_t size)
+static void print_dev(void *data, void *user_data)
 {
-	struct hci_dev *dev;
+	struct hci_dev *dev = data;
+
+	printf("Found %s controller with index %u\n", dev_type_str(dev->type),
+								dev->index);
+	printf("  BD_ADDR %2.2X:%2.2X:%2.2X:%2.2X:%2.2X:%2.2X",
+			dev->bdaddr[5], dev->bdaddr[4], dev->bdaddr[3],
+			dev->bdaddr[2], dev->bdaddr[1], dev->bdaddr[0]);
+	if (dev->manufacturer != 0xffff)
+		printf(" (%s)", bt_compidtostr(dev->manufacturer));
+	printf("\n");
+
+
+	printf("  %lu commands\n", dev->num_cmd);
+	printf("  %lu events\n", dev->num_evt);
+	printf("  %lu ACL packets\n", dev->num_acl);
+	printf("  %lu SCO packets\n", dev->num_sco);
+	printf("  %lu ISO packets\n", dev->num_iso);
+	printf("  %lu vendor diagnostics\n", dev->vendor_diag);
+	printf("  %lu system notes\n", dev->system_note);
+	printf("  %lu user logs\n", dev->user_log);
+	printf("  %lu unknown opcodes\n", dev->unknown);
+
+	latency_print("  ", "Command latency", &dev->latency);
+
+	if (dev->latency.count) {
+		printf("  Commands:\n");
+		queue_foreach(dev->cmd_list, print_cmd, NULL);
+	}
+
+	queue_foreach(dev->conn_list, print_conn, NULL);
+
+	printf("\n");
+}
+
+static void json_latency(FILE *fp, const struct latency *latency)
+{
+	unsigned int i;
+	bool first = true;
+
+	fprintf(fp, "{\"count\":%lu,\"min_us\":%llu,\"avg_us\":%llu,"
+			"\"max_us\":%llu,\"histogram\":[", latency->count,
+			latency->min, latency_avg(latency), latency->max);
+
+	for (i = 0; i < LATENCY_BUCKETS; i++) {
+		if (!latency->buckets[i])
+			continue;
+
+		fprintf(fp, "%s{\"min_us\":%lu,\"max_us\":%lu,\"count\":%lu}",
+					first ? "" : ",", latency_bucket_min(i),
+					latency_bucket_max(i), latency->buckets[i]);
+		first = false;
+	}
+
+	fprintf(fp, "]}");
+}
+
+static void json_conn(FILE *fp, struct hci_conn *conn)
+{
+	const struct queue_entry *entry;
+	unsigned long long usec;
+
+	usec = latency_usec(&conn->first_tv, &conn->last_tv);
+
+	fprintf(fp, "{\"handle\":%u,\"type\":\"%s\",\"duration_us\":%llu,"
+			"\"tx_packets\":%lu,\"tx_bytes\":%llu,\"tx_bps\":%llu,"
+			"\"rx_packets\":%lu,\"rx_bytes\":%llu,\"rx_bps\":%llu,"
+			"\"channels\":[", conn->handle,
+			conn_type_str(conn->type), usec,
+			conn->packets[DIR_TX], conn->bytes[DIR_TX],
+			rate_bps(conn->bytes[DIR_TX], usec),
+			conn->packets[DIR_RX], conn->bytes[DIR_RX],
+			rate_bps(conn->bytes[DIR_RX], usec));
+
+	for (entry = queue_get_entries(conn->chan_list); entry;
+							entry = entry->next) {
+		struct l2cap_chan *chan = entry->data;
+
+		fprintf(fp, "{\"cid\":%u,\"tx_frames\":%lu,\"tx_bytes\":%llu,"
+				"\"rx_frames\":%lu,\"rx_bytes\":%llu}%s",
+				chan->cid, chan->frames[DIR_TX],
+				chan->bytes[DIR_TX], chan->frames[DIR_RX],
+				chan->bytes[DIR_RX], entry->next ? "," : "");
+	}
+
+	fprintf(fp, "]}");
+}
+
+static void json_dev(FILE *fp, struct hci_dev *dev)
+{
+	const struct queue_entry *entry;
+	bool first = true;
+
+	fprintf(fp, "{\"index\":%u,\"type\":\"%s\","
+			"\"address\":\"%2.2X:%2.2X:%2.2X:%2.2X:%2.2X:%2.2X\",",
+			dev->index, dev_type_str(dev->type),
+			dev->bdaddr[5], dev->bdaddr[4], dev->bdaddr[3],
+			dev->bdaddr[2], dev->bdaddr[1], dev->bdaddr[0]);
+
+	if (dev->manufacturer != 0xffff)
+		fprintf(fp, "\"manufacturer\":%u,", dev->manufacturer);
+
+	fprintf(fp, "\"commands\":%lu,\"events\":%lu,\"acl_packets\":%lu,"
+			"\"sco_packets\":%lu,\"iso_packets\":%lu,"
+			"\"vendor_diagnostics\":%lu,\"system_notes\":%lu,"
+			"\"user_logs\":%lu,\"unknown_opcodes\":%lu,"
+			"\"command_latency\":", dev->num_cmd, dev->num_evt,
+			dev->num_acl, dev->num_sco, dev->num_iso,
+			dev->vendor_diag, dev->system_note, dev->user_log,
+			dev->unknown);
+
+	json_latency(fp, &dev->latency);
+
+	fprintf(fp, ",\"opcodes\":[");
+
+	for (entry = queue_get_entries(dev->cmd_list); entry;
+							entry = entry->next) {
+		struct hci_cmd *cmd = entry->data;
+
+		fprintf(fp, "%s{\"opcode\":%u,\"sent\":%lu,\"latency\":",
+					first ? "" : ",", cmd->opcode,
+					cmd->num_sent);
+		json_latency(fp, &cmd->latency);
+		fprintf(fp, "}");
+		first = false;
+	}
+
+	fprintf(fp, "],\"connections\":[");
 
-	dev = dev_lookup(index);
-	if (!dev)
+	for (entry = queue_get_entries(dev->conn_list); entry;
+							entry = entry->next) {
+		json_conn(fp, entry->data);
+
+		if (entry->next)
+			fprintf(fp, ",");
+	}
+
+	fprintf(fp, "]}");
+}
+
+static void write_json(const char *path, struct queue *dev_list,
+						unsigned long num_packets)
+{
+	const struct queue_entry *entry;
+	FILE *fp;
+
+	if (!strcmp(path, "-"))
+		fp = stdout;
+	else
+		fp = fopen(path, "we");
+
+	if (!fp) {
+		perror("Failed to open JSON output");
 		return;
+	}
+
+	fprintf(fp, "{\"packets\":%lu,\"controllers\":[", num_packets);
+
+	for (entry = queue_get_entries(dev_list); entry; entry = entry->next) {
+		json_dev(fp, entry->data);
+
+		if (entry->next)
+			fprintf(fp, ",");
+	}
+
+	fprintf(fp, "]}\n");
 
-	dev->unknown++;
+	if (fp != stdout)
+		fclose(fp);
 }
 
-void analyze_trace(const char *path)
+void analyze_trace(const char *path, unsigned int jobs, const char *json_path)
 {
 	struct btsnoop *btsnoop_file;
+	struct shard shards[MAX_JOBS];
+	off_t starts[MAX_JOBS];
+	struct queue *dev_list;
 	unsigned long num_packets = 0;
+	unsigned int i, num_shards;
 	uint32_t format;
+	struct stat st;
 
-	btsnoop_file = btsnoop_open(path, BTSNOOP_FLAG_PKLG_SUPPORT);
+	btsnoop_file = btsnoop_open(path, BTSNOOP_FLAG_PKLG_SUPPORT |
+							BTSNOOP_FLAG_MMAP);
 	if (!btsnoop_file)
 		return;
 
@@ -333,65 +1122,75 @@ void analyze_trace(const char *path)
 		goto done;
 	}
 
-	dev_list = queue_new();
+	if (!jobs) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
 
-	while (1) {
-		unsigned char buf[BTSNOOP_MAX_PACKET_SIZE];
-		struct timeval tv;
-		uint16_t index, opcode, pktlen;
+		jobs = cpus > 0 ? cpus : 1;
+	}
 
-		if (!btsnoop_read_hci(btsnoop_file, &tv, &index, &opcode,
-								buf, &pktlen))
-			break;
+	if (jobs > MAX_JOBS)
+		jobs = MAX_JOBS;
 
-		switch (opcode) {
-		case BTSNOOP_OPCODE_NEW_INDEX:
-			new_index(&tv, index, buf, pktlen);
-			break;
-		case BTSNOOP_OPCODE_DEL_INDEX:
-			del_index(&tv, index, buf, pktlen);
-			break;
-		case BTSNOOP_OPCODE_COMMAND_PKT:
-			command_pkt(&tv, index, buf, pktlen);
-			break;
-		case BTSNOOP_OPCODE_EVENT_PKT:
-			event_pkt(&tv, index, buf, pktlen);
-			break;
-		case BTSNOOP_OPCODE_ACL_TX_PKT:
-		case BTSNOOP_OPCODE_ACL_RX_PKT:
-			acl_pkt(&tv, index, buf, pktlen);
-			break;
-		case BTSNOOP_OPCODE_SCO_TX_PKT:
-		case BTSNOOP_OPCODE_SCO_RX_PKT:
-			sco_pkt(&tv, index, buf, pktlen);
-			break;
-		case BTSNOOP_OPCODE_OPEN_INDEX:
-		case BTSNOOP_OPCODE_CLOSE_INDEX:
-			break;
-		case BTSNOOP_OPCODE_INDEX_INFO:
-			info_index(&tv, index, buf, pktlen);
-			break;
-		case BTSNOOP_OPCODE_VENDOR_DIAG:
-			vendor_diag(&tv, index, buf, pktlen);
-			break;
-		case BTSNOOP_OPCODE_SYSTEM_NOTE:
-			system_note(&tv, index, buf, pktlen);
-			break;
-		case BTSNOOP_OPCODE_USER_LOGGING:
-			user_log(&tv, index, buf, pktlen);
-			break;
-		default:
-			fprintf(stderr, "Unknown opcode %u\n", opcode);
-			unknown_opcode(&tv, index, buf, pktlen);
-			break;
-		}
+	if (stat(path, &st) < 0 || !S_ISREG(st.st_mode))
+		jobs = 1;
+	else if (st.st_size / jobs < MIN_SHARD_SIZE)
+		jobs = st.st_size / MIN_SHARD_SIZE + 1;
+
+	memset(shards, 0, sizeof(shards));
+
+	if (jobs > 1) {
+		num_shards = split_trace(btsnoop_file, st.st_size, jobs,
+								starts);
+	} else {
+		/* Also works for traces that can not be read twice */
+		num_shards = 1;
+		starts[0] = -1;
+	}
+
+	for (i = 0; i < num_shards; i++) {
+		shards[i].path = path;
+		shards[i].start = starts[i];
+		shards[i].end = i + 1 < num_shards ? starts[i + 1] : -1;
+		shards[i].dev_list = queue_new();
+		shards[i].msg_list = queue_new();
+	}
+
+	shards[0].btsnoop = btsnoop_file;
+
+	/* The first shard is analyzed by the calling thread */
+	for (i = 1; i < num_shards; i++) {
+		if (!pthread_create(&shards[i].thread, NULL, analyze_shard,
+								&shards[i]))
+			shards[i].threaded = true;
+	}
+
+	for (i = 0; i < num_shards; i++) {
+		if (!shards[i].threaded)
+			analyze_shard(&shards[i]);
+	}
 
-		num_packets++;
+	dev_list = queue_new();
+
+	for (i = 0; i < num_shards; i++) {
+		if (shards[i].threaded)
+			pthread_join(shards[i].thread, NULL);
+
+		if (shards[i].failed)
+			fprintf(stderr, "Failed to analyze trace at offset "
+					"%lld\n", (long long) shards[i].start);
+
+		num_packets += shards[i].num_packets;
+		shard_merge(dev_list, &shards[i]);
 	}
 
 	printf("Trace contains %lu packets\n\n", num_packets);
 
-	queue_destroy(dev_list, dev_destroy);
+	queue_foreach(dev_list, print_dev, NULL);
+
+	if (json_path)
+		write_json(json_path, dev_list, num_packets);
+
+	queue_destroy(dev_list, dev_free);
 
 done:
 	btsnoop_unref(btsnoop_file);
@@ -9,4 +9,8 @@
  *
  */
 
-void analyze_trace(const char *path);
+/*
+ * Analyzes the trace using up to jobs threads (0 for one per CPU) and, if
+ * json_path is set, also writes the results there as JSON ("-" for stdout).
+ */
+void analyze_trace(const char *path, unsigned int jobs, const char *json_path);
@@ -1481,7 +1481,8 @@ void control_reader(const char *path, bool pager)
 	uint32_t format;
 	struct timeval tv;
 
-	btsnoop_file = btsnoop_open(path, BTSNOOP_FLAG_PKLG_SUPPORT);
+	btsnoop_file = btsnoop_open(path, BTSNOOP_FLAG_PKLG_SUPPORT |
+							BTSNOOP_FLAG_MMAP);
 	if (!btsnoop_file)
 		return;
 
@@ -24,7 +24,7 @@
 static const uint8_t empty_key[16] = { 0x00, };
 static const uint8_t empty_addr[6] = { 0x00, };
 
-static struct bt_crypto *crypto;
+static struct bt_crypto_rpa_resolver *resolver;
 
 struct irk_data {
 	uint8_t key[16];
@@ -36,14 +36,14 @@ static struct queue *irk_list;
 
 void keys_setup(void)
 {
-	crypto = bt_crypto_new();
+	resolver = bt_crypto_rpa_resolver_new();
 
 	irk_list = queue_new();
 }
 
 void keys_cleanup(void)
 {
-	bt_crypto_unref(crypto);
+	bt_crypto_rpa_resolver_free(resolver);
 
 	queue_destroy(irk_list, free);
 }
@@ -55,14 +55,19 @@ void keys_update_identity_key(const uint8_t key[16])
 	irk = queue_peek_tail(irk_list);
 	if (irk && !memcmp(irk->key, empty_key, 16)) {
 		memcpy(irk->key, key, 16);
+		bt_crypto_rpa_resolver_add(resolver, irk->key, irk);
 		return;
 	}
 
 	irk = new0(struct irk_data, 1);
 	if (irk) {
 		memcpy(irk->key, key, 16);
-		if (!queue_push_tail(irk_list, irk))
+		if (!queue_push_tail(irk_list, irk)) {
 			free(irk);
+			return;
+		}
+
+		bt_crypto_rpa_resolver_add(resolver, irk->key, irk);
 	}
 }
 
@@ -86,23 +91,12 @@ void keys_update_identity_addr(const uint8_t addr[6], uint8_t addr_type)
 	}
 }
 
-static bool match_resolve_irk(const void *data, const void *match_data)
-{
-	const struct irk_data *irk = data;
-	const uint8_t *addr = match_data;
-	uint8_t local_hash[3];
-
-	bt_crypto_ah(crypto, irk->key, addr + 3, local_hash);
-
-	return !memcmp(addr, local_hash, 3);
-}
-
 bool keys_resolve_identity(const uint8_t addr[6], uint8_t ident[6],
 							uint8_t *ident_type)
 {
 	struct irk_data *irk;
 
-	irk = queue_find(irk_list, match_resolve_irk, addr);
+	irk = bt_crypto_rpa_resolve(resolver, addr);
 
 	if (irk) {
 		memcpy(ident, irk->addr, 6);
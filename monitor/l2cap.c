@@ -2316,15 +2316,27 @@ static void att_error_response(const struct l2cap_frame *frame)
 static void att_exchange_mtu_req(const struct l2cap_frame *frame)
 {
 	const struct bt_l2cap_att_exchange_mtu_req *pdu = frame->data;
+	struct packet_conn_data *conn;
 
 	print_field("Client RX MTU: %d", le16_to_cpu(pdu->mtu));
+
+	conn = packet_get_conn_data(frame->index, frame->handle);
+	if (conn)
+		conn->mtu_req = le16_to_cpu(pdu->mtu);
 }
 
 static void att_exchange_mtu_rsp(const struct l2cap_frame *frame)
 {
 	const struct bt_l2cap_att_exchange_mtu_rsp *pdu = frame->data;
+	struct packet_conn_data *conn;
+	uint16_t mtu = le16_to_cpu(pdu->mtu);
+
+	print_field("Server RX MTU: %d", mtu);
 
-	print_field("Server RX MTU: %d", le16_to_cpu(pdu->mtu));
+	/* Both sides use the smaller of the two from now on */
+	conn = packet_get_conn_data(frame->index, frame->handle);
+	if (conn && conn->mtu_req)
+		conn->mtu = conn->mtu_req < mtu ? conn->mtu_req : mtu;
 }
 
 static void att_find_info_req(const struct l2cap_frame *frame)
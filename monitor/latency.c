@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+
+#include "latency.h"
+
+unsigned long long latency_usec(const struct timeval *start,
+					const struct timeval *end)
+{
+	struct timeval diff;
+
+	if (timercmp(end, start, <))
+		return 0;
+
+	timersub(end, start, &diff);
+
+	return (unsigned long long) diff.tv_sec * 1000000 + diff.tv_usec;
+}
+
+void latency_add(struct latency *latency, unsigned long long usec)
+{
+	unsigned int bucket = 0;
+
+	while (bucket < LATENCY_BUCKETS - 1 && (usec >> (bucket + 1)))
+		bucket++;
+
+	if (!latency->count || usec < latency->min)
+		latency->min = usec;
+
+	if (usec > latency->max)
+		latency->max = usec;
+
+	latency->count++;
+	latency->total += usec;
+	latency->buckets[bucket]++;
+}
+
+void latency_merge(struct latency *dst, const struct latency *src)
+{
+	unsigned int i;
+
+	if (!src->count)
+		return;
+
+	if (!dst->count || src->min < dst->min)
+		dst->min = src->min;
+
+	if (src->max > dst->max)
+		dst->max = src->max;
+
+	dst->count += src->count;
+	dst->total += src->total;
+
+	for (i = 0; i < LATENCY_BUCKETS; i++)
+		dst->buckets[i] += src->buckets[i];
+}
+
+unsigned long long latency_avg(const struct latency *latency)
+{
+	return latency->count ? latency->total / latency->count : 0;
+}
+
+unsigned long latency_bucket_min(unsigned int bucket)
+{
+	return bucket ? 1ul << bucket : 0;
+}
+
+unsigned long latency_bucket_max(unsigned int bucket)
+{
+	return (2ul << bucket) - 1;
+}
+
+void latency_print(const char *indent, const char *label,
+					const struct latency *latency)
+{
+	unsigned int i;
+
+	if (!latency->count)
+		return;
+
+	printf("%s%s: %lu responses, min %llu us, avg %llu us, max %llu us\n",
+			indent, label, latency->count, latency->min,
+			latency_avg(latency), latency->max);
+
+	for (i = 0; i < LATENCY_BUCKETS; i++) {
+		if (!latency->buckets[i])
+			continue;
+
+		printf("%s  %8lu - %8lu us: %lu\n", indent,
+				latency_bucket_min(i), latency_bucket_max(i),
+				latency->buckets[i]);
+	}
+}
@@ -0,0 +1,35 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#include <stdint.h>
+#include <sys/time.h>
+
+/* Bucket n counts latencies from 2^n to 2^(n+1) - 1 microseconds */
+#define LATENCY_BUCKETS		24
+
+struct latency {
+	unsigned long count;
+	unsigned long long total;
+	unsigned long long min;
+	unsigned long long max;
+	unsigned long buckets[LATENCY_BUCKETS];
+};
+
+unsigned long long latency_usec(const struct timeval *start,
+					const struct timeval *end);
+void latency_add(struct latency *latency, unsigned long long usec);
+void latency_merge(struct latency *dst, const struct latency *src);
+
+unsigned long long latency_avg(const struct latency *latency);
+unsigned long latency_bucket_min(unsigned int bucket);
+unsigned long latency_bucket_max(unsigned int bucket);
+
+void latency_print(const char *indent, const char *label,
+					const struct latency *latency);
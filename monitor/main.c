@@ -19,7 +19,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <getopt.h>
+#include <unistd.h>
 #include <sys/un.h>
+#include <sys/signalfd.h>
 
 #include "src/shared/mainloop.h"
 #include "src/shared/tty.h"
@@ -30,6 +32,7 @@
 #include "analyze.h"
 #include "ellisys.h"
 #include "control.h"
+#include "stats.h"
 
 static void signal_callback(int signum, void *user_data)
 {
@@ -41,6 +44,45 @@ static void signal_callback(int signum, void *user_data)
 	}
 }
 
+static void stats_signal_callback(int fd, uint32_t events, void *user_data)
+{
+	struct signalfd_siginfo si;
+
+	if (events & (EPOLLERR | EPOLLHUP)) {
+		mainloop_remove_fd(fd);
+		return;
+	}
+
+	if (read(fd, &si, sizeof(si)) != sizeof(si))
+		return;
+
+	stats_report();
+}
+
+/*
+ * SIGUSR1 is only taken over in statistics mode, everywhere else it keeps
+ * its default action.
+ */
+static void stats_signal_setup(void)
+{
+	sigset_t mask;
+	int fd;
+
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGUSR1);
+
+	if (sigprocmask(SIG_BLOCK, &mask, NULL) < 0)
+		return;
+
+	fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+	if (fd < 0)
+		return;
+
+	if (mainloop_add_fd(fd, EPOLLIN, stats_signal_callback,
+							NULL, NULL) < 0)
+		close(fd);
+}
+
 static void usage(void)
 {
 	printf("btmon - Bluetooth monitor\n"
@@ -50,6 +92,12 @@ static void usage(void)
 		"\t-r, --read <file>      Read traces in btsnoop format\n"
 		"\t-w, --write <file>     Save traces in btsnoop format\n"
 		"\t-a, --analyze <file>   Analyze traces in btsnoop format\n"
+		"\t-j, --jobs <num>       Analyze using num threads\n"
+		"\t                       (default one per CPU)\n"
+		"\t-O, --json <file>      Write analysis results as JSON\n"
+		"\t-z, --stats <sec>      Show controller statistics instead\n"
+		"\t                       of packets every sec seconds\n"
+		"\t                       (0 for only on SIGUSR1)\n"
 		"\t-s, --server <socket>  Start monitor server socket\n"
 		"\t-p, --priority <level> Show only priority or lower\n"
 		"\t-i, --index <num>      Show only specified controller\n"
@@ -74,6 +122,9 @@ static const struct option main_options[] = {
 	{ "read",      required_argument, NULL, 'r' },
 	{ "write",     required_argument, NULL, 'w' },
 	{ "analyze",   required_argument, NULL, 'a' },
+	{ "jobs",      required_argument, NULL, 'j' },
+	{ "json",      required_argument, NULL, 'O' },
+	{ "stats",     required_argument, NULL, 'z' },
 	{ "server",    required_argument, NULL, 's' },
 	{ "priority",  required_argument, NULL, 'p' },
 	{ "index",     required_argument, NULL, 'i' },
@@ -102,6 +153,8 @@ int main(int argc, char *argv[])
 	const char *reader_path = NULL;
 	const char *writer_path = NULL;
 	const char *analyze_path = NULL;
+	const char *json_path = NULL;
+	unsigned int analyze_jobs = 0;
 	const char *ellisys_server = NULL;
 	const char *tty = NULL;
 	unsigned int tty_speed = B115200;
@@ -109,6 +162,7 @@ int main(int argc, char *argv[])
 	const char *str;
 	char *jlink = NULL;
 	char *rtt = NULL;
+	bool stats = false;
 	int exit_status;
 
 	mainloop_init();
@@ -119,7 +173,7 @@ int main(int argc, char *argv[])
 		int opt;
 		struct sockaddr_un addr;
 
-		opt = getopt_long(argc, argv, "r:w:a:s:p:i:d:B:V:MtTSAE:PJ:R:vh",
+		opt = getopt_long(argc, argv, "r:w:a:j:O:z:s:p:i:d:B:V:MtTSAE:PJ:R:vh",
 							main_options, NULL);
 		if (opt < 0)
 			break;
@@ -134,6 +188,17 @@ int main(int argc, char *argv[])
 		case 'a':
 			analyze_path = optarg;
 			break;
+		case 'j':
+			analyze_jobs = atoi(optarg);
+			break;
+		case 'O':
+			json_path = optarg;
+			break;
+		case 'z':
+			stats_enable(atoi(optarg));
+			stats = true;
+			use_pager = false;
+			break;
 		case 's':
 			if (strlen(optarg) > sizeof(addr.sun_path) - 1) {
 				fprintf(stderr, "Socket name too long\n");
@@ -232,7 +297,7 @@ int main(int argc, char *argv[])
 	packet_set_filter(filter_mask);
 
 	if (analyze_path) {
-		analyze_trace(analyze_path);
+		analyze_trace(analyze_path, analyze_jobs, json_path);
 		return EXIT_SUCCESS;
 	}
 
@@ -241,6 +306,7 @@ int main(int argc, char *argv[])
 			ellisys_enable(ellisys_server, ellisys_port);
 
 		control_reader(reader_path, use_pager);
+		stats_report();
 		return EXIT_SUCCESS;
 	}
 
@@ -261,8 +327,14 @@ int main(int argc, char *argv[])
 	if (jlink && control_rtt(jlink, rtt) < 0)
 		return EXIT_FAILURE;
 
+	if (stats)
+		stats_signal_setup();
+
 	exit_status = mainloop_run_with_signal(signal_callback, NULL);
 
+	stats_report();
+	stats_disable();
+
 	keys_cleanup();
 
 	return exit_status;
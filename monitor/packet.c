@@ -32,6 +32,7 @@
 #include "lib/hci_lib.h"
 
 #include "src/shared/util.h"
+#include "src/shared/queue.h"
 #include "src/shared/btsnoop.h"
 #include "display.h"
 #include "bt.h"
@@ -44,6 +45,7 @@
 #include "intel.h"
 #include "broadcom.h"
 #include "packet.h"
+#include "stats.h"
 
 #define COLOR_CHANNEL_LABEL		COLOR_WHITE
 #define COLOR_FRAME_LABEL		COLOR_WHITE
@@ -105,112 +107,70 @@ static uint16_t fallback_manufacturer = UNKNOWN_MANUFACTURER;
 #define CTRL_USER 0x0001
 #define CTRL_MGMT 0x0002
 
-#define MAX_CTRL 64
-
 struct ctrl_data {
-	bool used;
 	uint32_t cookie;
 	uint16_t format;
 	char name[20];
 };
 
-static struct ctrl_data ctrl_list[MAX_CTRL];
+static struct queue *ctrl_list;
 
-static void assign_ctrl(uint32_t cookie, uint16_t format, const char *name)
+static bool ctrl_match_cookie(const void *a, const void *b)
 {
-	int i;
+	const struct ctrl_data *ctrl = a;
 
-	for (i = 0; i < MAX_CTRL; i++) {
-		if (!ctrl_list[i].used) {
-			ctrl_list[i].used = true;
-			ctrl_list[i].cookie = cookie;
-			ctrl_list[i].format = format;
-			if (name) {
-				strncpy(ctrl_list[i].name, name, 19);
-				ctrl_list[i].name[19] = '\0';
-			} else
-				strcpy(ctrl_list[i].name, "null");
-			break;
-		}
-	}
+	return ctrl->cookie == PTR_TO_UINT(b);
 }
 
-static void release_ctrl(uint32_t cookie, uint16_t *format, char *name)
+static void assign_ctrl(uint32_t cookie, uint16_t format, const char *name)
 {
-	int i;
-
-	if (format)
-		*format = 0xffff;
+	struct ctrl_data *ctrl;
 
-	for (i = 0; i < MAX_CTRL; i++) {
-		if (ctrl_list[i].used && ctrl_list[i].cookie == cookie) {
-			ctrl_list[i].used = false;
-			if (format)
-				*format = ctrl_list[i].format;
-			if (name)
-				strncpy(name, ctrl_list[i].name, 20);
-			break;
-		}
-	}
-}
+	if (!ctrl_list)
+		ctrl_list = queue_new();
 
-static uint16_t get_format(uint32_t cookie)
-{
-	int i;
+	ctrl = new0(struct ctrl_data, 1);
+	ctrl->cookie = cookie;
+	ctrl->format = format;
 
-	for (i = 0; i < MAX_CTRL; i++) {
-		if (ctrl_list[i].used && ctrl_list[i].cookie == cookie)
-			return ctrl_list[i].format;
-	}
+	if (name) {
+		strncpy(ctrl->name, name, 19);
+		ctrl->name[19] = '\0';
+	} else
+		strcpy(ctrl->name, "null");
 
-	return 0xffff;
+	queue_push_tail(ctrl_list, ctrl);
 }
 
-#define MAX_CONN 16
-
-struct conn_data {
-	uint16_t handle;
-	uint8_t  type;
-};
-
-static struct conn_data conn_list[MAX_CONN];
-
-static void assign_handle(uint16_t handle, uint8_t type)
+static void release_ctrl(uint32_t cookie, uint16_t *format, char *name)
 {
-	int i;
+	struct ctrl_data *ctrl;
 
-	for (i = 0; i < MAX_CONN; i++) {
-		if (conn_list[i].handle == 0x0000) {
-			conn_list[i].handle = handle;
-			conn_list[i].type = type;
-			break;
-		}
-	}
-}
+	if (format)
+		*format = 0xffff;
 
-static void release_handle(uint16_t handle)
-{
-	int i;
+	ctrl = queue_remove_if(ctrl_list, ctrl_match_cookie,
+						UINT_TO_PTR(cookie));
+	if (!ctrl)
+		return;
 
-	for (i = 0; i < MAX_CONN; i++) {
-		if (conn_list[i].handle == handle) {
-			conn_list[i].handle = 0x0000;
-			conn_list[i].type = 0x00;
-			break;
-		}
-	}
+	if (format)
+		*format = ctrl->format;
+	if (name)
+		strncpy(name, ctrl->name, 20);
+
+	free(ctrl);
 }
 
-static uint8_t get_type(uint16_t handle)
+static uint16_t get_format(uint32_t cookie)
 {
-	int i;
+	struct ctrl_data *ctrl;
 
-	for (i = 0; i < MAX_CONN; i++) {
-		if (conn_list[i].handle == handle)
-			return conn_list[i].type;
-	}
+	ctrl = queue_find(ctrl_list, ctrl_match_cookie, UINT_TO_PTR(cookie));
+	if (!ctrl)
+		return 0xffff;
 
-	return 0xff;
+	return ctrl->format;
 }
 
 bool packet_has_filter(unsigned long filter)
@@ -260,16 +220,204 @@ void packet_select_index(uint16_t index)
 
 #define MAX_INDEX 16
 
+/* Smallest connection table, grown by doubling once it is full */
+#define CONN_TABLE_MIN 16
+
+struct conn_entry {
+	struct packet_conn_data data;
+	struct conn_entry *next;
+};
+
+struct conn_table {
+	struct conn_entry **buckets;
+	unsigned int size;
+	unsigned int count;
+};
+
 struct index_data {
 	uint8_t  type;
 	uint8_t  bdaddr[6];
 	uint16_t manufacturer;
 	uint16_t msft_opcode;
 	size_t   frame;
+	struct conn_table conns;
 };
 
 static struct index_data index_list[MAX_INDEX];
 
+/*
+ * Controllers hand out connection handles from a small range, so the low
+ * bits alone spread them evenly over a power of two sized table.
+ */
+static struct conn_entry **conn_bucket(struct conn_table *table,
+							uint16_t handle)
+{
+	return &table->buckets[handle & (table->size - 1)];
+}
+
+static void conn_table_grow(struct conn_table *table)
+{
+	struct conn_entry **buckets = table->buckets;
+	unsigned int i, size = table->size;
+
+	table->size = size ? size * 2 : CONN_TABLE_MIN;
+	table->buckets = new0(struct conn_entry *, table->size);
+
+	for (i = 0; i < size; i++) {
+		struct conn_entry *entry = buckets[i];
+
+		while (entry) {
+			struct conn_entry *next = entry->next;
+			struct conn_entry **bucket;
+
+			bucket = conn_bucket(table, entry->data.handle);
+			entry->next = *bucket;
+			*bucket = entry;
+
+			entry = next;
+		}
+	}
+
+	free(buckets);
+}
+
+static void conn_table_clear(struct conn_table *table)
+{
+	unsigned int i;
+
+	for (i = 0; i < table->size; i++) {
+		struct conn_entry *entry = table->buckets[i];
+
+		while (entry) {
+			struct conn_entry *next = entry->next;
+
+			free(entry);
+			entry = next;
+		}
+	}
+
+	free(table->buckets);
+	memset(table, 0, sizeof(*table));
+}
+
+struct packet_conn_data *packet_get_conn_data(uint16_t index,
+							uint16_t handle)
+{
+	struct conn_table *table;
+	struct conn_entry *entry;
+
+	if (index >= MAX_INDEX)
+		return NULL;
+
+	table = &index_list[index].conns;
+	if (!table->size)
+		return NULL;
+
+	for (entry = *conn_bucket(table, handle); entry; entry = entry->next) {
+		if (entry->data.handle == handle)
+			return &entry->data;
+	}
+
+	return NULL;
+}
+
+static struct packet_conn_data *assign_handle(uint16_t handle, uint8_t type)
+{
+	struct packet_conn_data *conn;
+	struct conn_table *table;
+	struct conn_entry *entry, **bucket;
+
+	if (index_current >= MAX_INDEX)
+		return NULL;
+
+	/* A handle is only reused once disconnected, start over if missed */
+	conn = packet_get_conn_data(index_current, handle);
+	if (conn) {
+		memset(conn, 0, sizeof(*conn));
+		goto done;
+	}
+
+	table = &index_list[index_current].conns;
+	if (table->count >= table->size)
+		conn_table_grow(table);
+
+	entry = new0(struct conn_entry, 1);
+	bucket = conn_bucket(table, handle);
+	entry->next = *bucket;
+	*bucket = entry;
+	table->count++;
+
+	conn = &entry->data;
+
+done:
+	conn->index = index_current;
+	conn->handle = handle;
+	conn->type = type;
+
+	return conn;
+}
+
+static void release_handle(uint16_t handle)
+{
+	struct conn_table *table;
+	struct conn_entry **bucket;
+
+	if (index_current >= MAX_INDEX)
+		return;
+
+	table = &index_list[index_current].conns;
+	if (!table->size)
+		return;
+
+	for (bucket = conn_bucket(table, handle); *bucket;
+					bucket = &(*bucket)->next) {
+		struct conn_entry *entry = *bucket;
+
+		if (entry->data.handle != handle)
+			continue;
+
+		*bucket = entry->next;
+		table->count--;
+		free(entry);
+		break;
+	}
+}
+
+static uint8_t get_type(uint16_t handle)
+{
+	struct packet_conn_data *conn;
+
+	conn = packet_get_conn_data(index_current, handle);
+	if (!conn)
+		return 0xff;
+
+	return conn->type;
+}
+
+static struct packet_conn_data *find_conn_by_addr(const uint8_t *bdaddr,
+								uint8_t type)
+{
+	struct conn_table *table;
+	unsigned int i;
+
+	if (index_current >= MAX_INDEX)
+		return NULL;
+
+	table = &index_list[index_current].conns;
+
+	for (i = 0; i < table->size; i++) {
+		struct conn_entry *entry;
+
+		for (entry = table->buckets[i]; entry; entry = entry->next) {
+			if (entry->data.type == type &&
+					!memcmp(entry->data.dst, bdaddr, 6))
+				return &entry->data;
+		}
+	}
+
+	return NULL;
+}
+
 void packet_set_fallback_manufacturer(uint16_t manufacturer)
 {
 	int i;
@@ -3887,6 +4035,12 @@ void packet_monitor(struct timeval *tv, struct ucred *cred,
 	if (tv && time_offset == ((time_t) -1))
 		time_offset = tv->tv_sec;
 
+	/* Statistics replace the per packet decoding */
+	if (stats_is_enabled()) {
+		stats_packet(tv, index, opcode, data, size);
+		return;
+	}
+
 	switch (opcode) {
 	case BTSNOOP_OPCODE_NEW_INDEX:
 		ni = data;
@@ -3902,9 +4056,10 @@ void packet_monitor(struct timeval *tv, struct ucred *cred,
 		packet_new_index(tv, index, str, ni->type, ni->bus, ni->name);
 		break;
 	case BTSNOOP_OPCODE_DEL_INDEX:
-		if (index < MAX_INDEX)
+		if (index < MAX_INDEX) {
 			addr2str(index_list[index].bdaddr, str);
-		else
+			conn_table_clear(&index_list[index].conns);
+		} else
 			sprintf(str, "00:00:00:00:00:00");
 
 		packet_del_index(tv, index, str);
@@ -9105,6 +9260,18 @@ static const char *get_supported_command(int bit)
 	return NULL;
 }
 
+const char *packet_get_opcode_str(uint16_t opcode)
+{
+	int i;
+
+	for (i = 0; opcode_table[i].str; i++) {
+		if (opcode_table[i].opcode == opcode)
+			return opcode_table[i].str;
+	}
+
+	return NULL;
+}
+
 static const char *current_vendor_str(void)
 {
 	uint16_t manufacturer;
@@ -9195,8 +9362,16 @@ static void conn_complete_evt(const void *data, uint8_t size)
 	print_link_type(evt->link_type);
 	print_enable("Encryption", evt->encr_mode);
 
-	if (evt->status == 0x00)
-		assign_handle(le16_to_cpu(evt->handle), 0x00);
+	if (evt->status == 0x00) {
+		struct packet_conn_data *conn;
+
+		conn = assign_handle(le16_to_cpu(evt->handle),
+						PACKET_CONN_TYPE_BREDR);
+		if (conn) {
+			memcpy(conn->dst, evt->bdaddr, 6);
+			conn->role = 0xff;
+		}
+	}
 }
 
 static void conn_request_evt(const void *data, uint8_t size)
@@ -9473,6 +9648,14 @@ static void role_change_evt(const void *data, uint8_t size)
 	print_status(evt->status);
 	print_bdaddr(evt->bdaddr);
 	print_role(evt->role);
+
+	if (evt->status == 0x00) {
+		struct packet_conn_data *conn;
+
+		conn = find_conn_by_addr(evt->bdaddr, PACKET_CONN_TYPE_BREDR);
+		if (conn)
+			conn->role = evt->role;
+	}
 }
 
 static void num_completed_packets_evt(const void *data, uint8_t size)
@@ -9651,6 +9834,17 @@ static void sync_conn_complete_evt(const void *data, uint8_t size)
 	print_field("RX packet length: %d", le16_to_cpu(evt->rx_pkt_len));
 	print_field("TX packet length: %d", le16_to_cpu(evt->tx_pkt_len));
 	print_air_mode(evt->air_mode);
+
+	if (evt->status == 0x00) {
+		struct packet_conn_data *conn;
+
+		conn = assign_handle(le16_to_cpu(evt->handle),
+						PACKET_CONN_TYPE_SCO);
+		if (conn) {
+			memcpy(conn->dst, evt->bdaddr, 6);
+			conn->role = 0xff;
+		}
+	}
 }
 
 static void sync_conn_changed_evt(const void *data, uint8_t size)
@@ -10025,6 +10219,24 @@ static void auth_payload_timeout_expired_evt(const void *data, uint8_t size)
 	print_handle(evt->handle);
 }
 
+static void assign_le_conn(uint16_t handle, uint8_t role,
+				const uint8_t *peer_addr, uint8_t peer_addr_type)
+{
+	struct packet_conn_data *conn;
+
+	conn = assign_handle(handle, PACKET_CONN_TYPE_LE);
+	if (!conn)
+		return;
+
+	conn->role = role;
+	memcpy(conn->dst, peer_addr, 6);
+	conn->dst_type = peer_addr_type;
+
+	/* Every LE connection starts out on the 1M PHY */
+	conn->tx_phy = 0x01;
+	conn->rx_phy = 0x01;
+}
+
 static void le_conn_complete_evt(const void *data, uint8_t size)
 {
 	const struct bt_hci_evt_le_conn_complete *evt = data;
@@ -10042,7 +10254,8 @@ static void le_conn_complete_evt(const void *data, uint8_t size)
 	print_field("Master clock accuracy: 0x%2.2x", evt->clock_accuracy);
 
 	if (evt->status == 0x00)
-		assign_handle(le16_to_cpu(evt->handle), 0x01);
+		assign_le_conn(le16_to_cpu(evt->handle), evt->role,
+					evt->peer_addr, evt->peer_addr_type);
 }
 
 static void le_adv_report_evt(const void *data, uint8_t size)
@@ -10163,7 +10376,8 @@ static void le_enhanced_conn_complete_evt(const void *data, uint8_t size)
 	print_field("Master clock accuracy: 0x%2.2x", evt->clock_accuracy);
 
 	if (evt->status == 0x00)
-		assign_handle(le16_to_cpu(evt->handle), 0x01);
+		assign_le_conn(le16_to_cpu(evt->handle), evt->role,
+					evt->peer_addr, evt->peer_addr_type);
 }
 
 static void le_direct_adv_report_evt(const void *data, uint8_t size)
@@ -10191,6 +10405,17 @@ static void le_phy_update_complete_evt(const void *data, uint8_t size)
 	print_handle(evt->handle);
 	print_le_phy("TX PHY", evt->tx_phy);
 	print_le_phy("RX PHY", evt->rx_phy);
+
+	if (evt->status == 0x00) {
+		struct packet_conn_data *conn;
+
+		conn = packet_get_conn_data(index_current,
+						le16_to_cpu(evt->handle));
+		if (conn) {
+			conn->tx_phy = evt->tx_phy;
+			conn->rx_phy = evt->rx_phy;
+		}
+	}
 }
 
 static const struct bitfield_data ext_adv_report_evt_type[] = {
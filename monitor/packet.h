@@ -23,6 +23,23 @@
 #define PACKET_FILTER_SHOW_A2DP_STREAM	(1 << 6)
 #define PACKET_FILTER_SHOW_MGMT_SOCKET	(1 << 7)
 
+#define PACKET_CONN_TYPE_BREDR		0x00
+#define PACKET_CONN_TYPE_LE		0x01
+#define PACKET_CONN_TYPE_SCO		0x02
+
+struct packet_conn_data {
+	uint16_t index;
+	uint16_t handle;
+	uint8_t  type;
+	uint8_t  role;
+	uint8_t  dst[6];
+	uint8_t  dst_type;
+	uint16_t mtu;
+	uint16_t mtu_req;
+	uint8_t  tx_phy;
+	uint8_t  rx_phy;
+};
+
 bool packet_has_filter(unsigned long filter);
 void packet_set_filter(unsigned long filter);
 void packet_add_filter(unsigned long filter);
@@ -32,6 +49,10 @@ void packet_set_priority(const char *priority);
 void packet_select_index(uint16_t index);
 void packet_set_fallback_manufacturer(uint16_t manufacturer);
 
+const char *packet_get_opcode_str(uint16_t opcode);
+struct packet_conn_data *packet_get_conn_data(uint16_t index,
+							uint16_t handle);
+
 void packet_hexdump(const unsigned char *buf, uint16_t len);
 void packet_print_error(const char *label, uint8_t error);
 void packet_print_version(const char *label, uint8_t version,
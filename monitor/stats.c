@@ -0,0 +1,774 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib/bluetooth.h"
+#include "lib/hci.h"
+
+#include "src/shared/util.h"
+#include "src/shared/queue.h"
+#include "src/shared/btsnoop.h"
+#include "src/shared/mainloop.h"
+#include "monitor/bt.h"
+#include "packet.h"
+#include "latency.h"
+#include "stats.h"
+
+#define LINK_ACL		0x00
+#define LINK_LE			0x01
+#define LINK_SCO		0x02
+#define LINK_ISO		0x03
+
+#define DIR_TX			0
+#define DIR_RX			1
+
+/* Controller buffers, as reported by the Read Buffer Size commands */
+struct stats_pool {
+	uint16_t mtu;
+	uint16_t max_pkt;
+	unsigned int in_flight;
+	struct timeval last_tv;
+
+	/* Occupancy over the current interval */
+	unsigned int peak;
+	unsigned long long area;
+	unsigned long long full_usec;
+};
+
+struct stats_cmd {
+	uint16_t opcode;
+	unsigned long num_sent;
+	bool pending;
+	struct timeval sent_tv;
+	struct latency status;
+	struct latency complete;
+};
+
+struct stats_conn {
+	uint16_t handle;
+	uint8_t link;
+	bool closed;
+	struct stats_pool *pool;
+	unsigned int in_flight;
+	unsigned long num_completed;
+	unsigned long packets[2];
+	unsigned long long bytes[2];
+
+	/* Traffic over the current interval */
+	unsigned long long interval_bytes[2];
+};
+
+struct stats_dev {
+	uint16_t index;
+	uint8_t ncmd;
+	unsigned long num_nocp;
+	struct stats_pool acl;
+	struct stats_pool le;
+	struct stats_pool iso;
+	struct queue *cmd_list;
+	struct queue *conn_list;
+	struct queue *closed_list;
+	struct timeval interval_tv;
+	struct timeval last_tv;
+};
+
+static bool stats_enabled;
+static unsigned int stats_interval;
+static int stats_timeout = -1;
+static struct queue *dev_list;
+
+static void conn_free(void *data)
+{
+	free(data);
+}
+
+static void dev_free(void *data)
+{
+	struct stats_dev *dev = data;
+
+	queue_destroy(dev->cmd_list, free);
+	queue_destroy(dev->conn_list, conn_free);
+	queue_destroy(dev->closed_list, conn_free);
+	free(dev);
+}
+
+static bool dev_match_index(const void *a, const void *b)
+{
+	const struct stats_dev *dev = a;
+
+	return dev->index == PTR_TO_UINT(b);
+}
+
+static struct stats_dev *dev_lookup(uint16_t index, struct timeval *tv)
+{
+	struct stats_dev *dev;
+
+	dev = queue_find(dev_list, dev_match_index, UINT_TO_PTR(index));
+	if (!dev) {
+		dev = new0(struct stats_dev, 1);
+		dev->index = index;
+		dev->cmd_list = queue_new();
+		dev->conn_list = queue_new();
+		dev->closed_list = queue_new();
+		dev->interval_tv = *tv;
+
+		queue_push_tail(dev_list, dev);
+	}
+
+	dev->last_tv = *tv;
+
+	return dev;
+}
+
+static bool cmd_match_opcode(const void *a, const void *b)
+{
+	const struct stats_cmd *cmd = a;
+
+	return cmd->opcode == PTR_TO_UINT(b);
+}
+
+static struct stats_cmd *cmd_lookup(struct stats_dev *dev, uint16_t opcode)
+{
+	struct stats_cmd *cmd;
+
+	cmd = queue_find(dev->cmd_list, cmd_match_opcode, UINT_TO_PTR(opcode));
+	if (!cmd) {
+		cmd = new0(struct stats_cmd, 1);
+		cmd->opcode = opcode;
+
+		queue_push_tail(dev->cmd_list, cmd);
+	}
+
+	return cmd;
+}
+
+static bool conn_match_handle(const void *a, const void *b)
+{
+	const struct stats_conn *conn = a;
+
+	return conn->handle == PTR_TO_UINT(b);
+}
+
+static struct stats_conn *conn_lookup(struct stats_dev *dev, uint16_t handle,
+								uint8_t link)
+{
+	struct stats_conn *conn;
+
+	conn = queue_find(dev->conn_list, conn_match_handle,
+						UINT_TO_PTR(handle));
+	if (!conn) {
+		conn = new0(struct stats_conn, 1);
+		conn->handle = handle;
+		conn->link = link;
+
+		queue_push_tail(dev->conn_list, conn);
+	}
+
+	return conn;
+}
+
+static struct stats_pool *conn_pool(struct stats_dev *dev,
+						struct stats_conn *conn)
+{
+	switch (conn->link) {
+	case LINK_ACL:
+		return &dev->acl;
+	case LINK_LE:
+		/* Without dedicated LE buffers the ACL ones are shared */
+		return dev->le.max_pkt ? &dev->le : &dev->acl;
+	case LINK_ISO:
+		return &dev->iso;
+	}
+
+	return NULL;
+}
+
+static void pool_update(struct stats_pool *pool, struct timeval *tv)
+{
+	unsigned long long usec = 0;
+
+	if (timerisset(&pool->last_tv))
+		usec = latency_usec(&pool->last_tv, tv);
+
+	pool->area += usec * pool->in_flight;
+
+	if (pool->max_pkt && pool->in_flight >= pool->max_pkt)
+		pool->full_usec += usec;
+
+	pool->last_tv = *tv;
+}
+
+static void pool_add(struct stats_pool *pool, struct timeval *tv, int count)
+{
+	pool_update(pool, tv);
+
+	if (count < 0 && (unsigned int) -count > pool->in_flight)
+		pool->in_flight = 0;
+	else
+		pool->in_flight += count;
+
+	if (pool->in_flight > pool->peak)
+		pool->peak = pool->in_flight;
+}
+
+static void conn_release(struct stats_conn *conn, struct timeval *tv,
+							unsigned int count)
+{
+	if (count > conn->in_flight)
+		count = conn->in_flight;
+
+	conn->in_flight -= count;
+
+	if (conn->pool)
+		pool_add(conn->pool, tv, -(int) count);
+}
+
+static void conn_data(struct stats_dev *dev, struct timeval *tv,
+				uint16_t handle, uint8_t link, int dir,
+				uint16_t len)
+{
+	struct stats_conn *conn;
+
+	conn = conn_lookup(dev, handle & 0x0fff, link);
+
+	conn->packets[dir]++;
+	conn->bytes[dir] += len;
+	conn->interval_bytes[dir] += len;
+
+	if (dir != DIR_TX || conn->link == LINK_SCO)
+		return;
+
+	/*
+	 * Every packet sent takes a controller buffer until completed, the
+	 * pool is fixed while any are in flight so that releases balance
+	 * even if the buffer sizes are read in between.
+	 */
+	if (!conn->in_flight)
+		conn->pool = conn_pool(dev, conn);
+
+	conn->in_flight++;
+
+	if (conn->pool)
+		pool_add(conn->pool, tv, 1);
+}
+
+static void conn_close(struct stats_dev *dev, struct stats_conn *conn,
+							struct timeval *tv)
+{
+	/* The controller flushes whatever was still queued */
+	conn_release(conn, tv, conn->in_flight);
+	conn->closed = true;
+
+	/* Kept until its traffic has been reported */
+	queue_remove(dev->conn_list, conn);
+	queue_push_tail(dev->closed_list, conn);
+}
+
+static void reset_dev(struct stats_dev *dev, struct timeval *tv)
+{
+	struct stats_conn *conn;
+
+	while ((conn = queue_peek_head(dev->conn_list)))
+		conn_close(dev, conn, tv);
+}
+
+static void cmd_complete(struct stats_dev *dev, struct timeval *tv,
+					const void *data, uint16_t size)
+{
+	const struct bt_hci_evt_cmd_complete *evt = data;
+	struct stats_cmd *cmd;
+	uint16_t opcode;
+
+	if (size < sizeof(*evt))
+		return;
+
+	data += sizeof(*evt);
+	size -= sizeof(*evt);
+
+	dev->ncmd = evt->ncmd;
+	opcode = le16_to_cpu(evt->opcode);
+
+	if (opcode == BT_HCI_CMD_NOP)
+		return;
+
+	cmd = cmd_lookup(dev, opcode);
+	if (cmd->pending) {
+		latency_add(&cmd->complete, latency_usec(&cmd->sent_tv, tv));
+		cmd->pending = false;
+	}
+
+	switch (opcode) {
+	case BT_HCI_CMD_RESET:
+		reset_dev(dev, tv);
+		break;
+	case BT_HCI_CMD_READ_BUFFER_SIZE:
+		if (size >= sizeof(struct bt_hci_rsp_read_buffer_size)) {
+			const struct bt_hci_rsp_read_buffer_size *rsp = data;
+
+			if (rsp->status)
+				break;
+
+			dev->acl.mtu = le16_to_cpu(rsp->acl_mtu);
+			dev->acl.max_pkt = le16_to_cpu(rsp->acl_max_pkt);
+		}
+		break;
+	case BT_HCI_CMD_LE_READ_BUFFER_SIZE:
+		if (size >= sizeof(struct bt_hci_rsp_le_read_buffer_size)) {
+			const struct bt_hci_rsp_le_read_buffer_size *rsp = data;
+
+			if (rsp->status)
+				break;
+
+			dev->le.mtu = le16_to_cpu(rsp->le_mtu);
+			dev->le.max_pkt = rsp->le_max_pkt;
+		}
+		break;
+	case BT_HCI_CMD_LE_READ_BUFFER_SIZE_V2:
+		if (size >= sizeof(struct bt_hci_rsp_le_read_buffer_size_v2)) {
+			const struct bt_hci_rsp_le_read_buffer_size_v2 *rsp;
+
+			rsp = data;
+			if (rsp->status)
+				break;
+
+			dev->le.mtu = le16_to_cpu(rsp->acl_mtu);
+			dev->le.max_pkt = rsp->acl_max_pkt;
+			dev->iso.mtu = le16_to_cpu(rsp->iso_mtu);
+			dev->iso.max_pkt = rsp->iso_max_pkt;
+		}
+		break;
+	}
+}
+
+static void cmd_status(struct stats_dev *dev, struct timeval *tv,
+					const void *data, uint16_t size)
+{
+	const struct bt_hci_evt_cmd_status *evt = data;
+	struct stats_cmd *cmd;
+	uint16_t opcode;
+
+	if (size < sizeof(*evt))
+		return;
+
+	dev->ncmd = evt->ncmd;
+	opcode = le16_to_cpu(evt->opcode);
+
+	if (opcode == BT_HCI_CMD_NOP)
+		return;
+
+	cmd = cmd_lookup(dev, opcode);
+	if (cmd->pending) {
+		latency_add(&cmd->status, latency_usec(&cmd->sent_tv, tv));
+		cmd->pending = false;
+	}
+}
+
+static void num_completed_packets(struct stats_dev *dev, struct timeval *tv,
+					const void *data, uint16_t size)
+{
+	const uint8_t *num_handles = data;
+	const uint8_t *ptr = data + 1;
+	unsigned int i;
+
+	if (size < 1 || size < 1 + *num_handles * 4)
+		return;
+
+	dev->num_nocp++;
+
+	for (i = 0; i < *num_handles; i++, ptr += 4) {
+		uint16_t handle = get_le16(ptr) & 0x0fff;
+		uint16_t count = get_le16(ptr + 2);
+		struct stats_conn *conn;
+
+		conn = queue_find(dev->conn_list, conn_match_handle,
+						UINT_TO_PTR(handle));
+		if (!conn)
+			continue;
+
+		conn->num_completed += count;
+		conn_release(conn, tv, count);
+	}
+}
+
+static void conn_closed(struct stats_dev *dev, struct timeval *tv,
+							uint16_t handle)
+{
+	struct stats_conn *conn;
+
+	conn = queue_find(dev->conn_list, conn_match_handle,
+				UINT_TO_PTR(le16_to_cpu(handle) & 0x0fff));
+	if (conn)
+		conn_close(dev, conn, tv);
+}
+
+static void conn_opened(struct stats_dev *dev, struct timeval *tv,
+					uint16_t handle, uint8_t link)
+{
+	/* A handle still in use means its disconnection was missed */
+	conn_closed(dev, tv, handle);
+	conn_lookup(dev, le16_to_cpu(handle) & 0x0fff, link);
+}
+
+static void le_meta_event(struct stats_dev *dev, struct timeval *tv,
+					const void *data, uint16_t size)
+{
+	const struct bt_hci_evt_le_conn_complete *evt = data + 1;
+
+	if (size < 1 + sizeof(*evt))
+		return;
+
+	switch (*(const uint8_t *) data) {
+	case BT_HCI_EVT_LE_CONN_COMPLETE:
+	case BT_HCI_EVT_LE_ENHANCED_CONN_COMPLETE:
+		/* Both start with status and handle */
+		if (!evt->status)
+			conn_opened(dev, tv, evt->handle, LINK_LE);
+		break;
+	}
+}
+
+static void event_pkt(struct stats_dev *dev, struct timeval *tv,
+					const void *data, uint16_t size)
+{
+	const struct bt_hci_evt_hdr *hdr = data;
+
+	if (size < sizeof(*hdr))
+		return;
+
+	data += sizeof(*hdr);
+	size -= sizeof(*hdr);
+
+	switch (hdr->evt) {
+	case BT_HCI_EVT_CMD_COMPLETE:
+		cmd_complete(dev, tv, data, size);
+		break;
+	case BT_HCI_EVT_CMD_STATUS:
+		cmd_status(dev, tv, data, size);
+		break;
+	case BT_HCI_EVT_NUM_COMPLETED_PACKETS:
+		num_completed_packets(dev, tv, data, size);
+		break;
+	case BT_HCI_EVT_CONN_COMPLETE:
+		if (size >= sizeof(struct bt_hci_evt_conn_complete)) {
+			const struct bt_hci_evt_conn_complete *evt = data;
+
+			if (!evt->status)
+				conn_opened(dev, tv, evt->handle, LINK_ACL);
+		}
+		break;
+	case BT_HCI_EVT_SYNC_CONN_COMPLETE:
+		if (size >= sizeof(struct bt_hci_evt_sync_conn_complete)) {
+			const struct bt_hci_evt_sync_conn_complete *evt = data;
+
+			if (!evt->status)
+				conn_opened(dev, tv, evt->handle, LINK_SCO);
+		}
+		break;
+	case BT_HCI_EVT_DISCONNECT_COMPLETE:
+		if (size >= sizeof(struct bt_hci_evt_disconnect_complete)) {
+			const struct bt_hci_evt_disconnect_complete *evt = data;
+
+			if (!evt->status)
+				conn_closed(dev, tv, evt->handle);
+		}
+		break;
+	case BT_HCI_EVT_LE_META_EVENT:
+		le_meta_event(dev, tv, data, size);
+		break;
+	}
+}
+
+static void command_pkt(struct stats_dev *dev, struct timeval *tv,
+					const void *data, uint16_t size)
+{
+	const struct bt_hci_cmd_hdr *hdr = data;
+	struct stats_cmd *cmd;
+
+	if (size < sizeof(*hdr))
+		return;
+
+	cmd = cmd_lookup(dev, le16_to_cpu(hdr->opcode));
+
+	cmd->num_sent++;
+	cmd->pending = true;
+	cmd->sent_tv = *tv;
+
+	if (dev->ncmd)
+		dev->ncmd--;
+}
+
+void stats_packet(struct timeval *tv, uint16_t index, uint16_t opcode,
+					const void *data, uint16_t size)
+{
+	const struct bt_hci_acl_hdr *acl = data;
+	struct stats_dev *dev;
+	struct timeval now;
+
+	if (!stats_enabled || index == HCI_DEV_NONE)
+		return;
+
+	if (!tv) {
+		gettimeofday(&now, NULL);
+		tv = &now;
+	}
+
+	switch (opcode) {
+	case BTSNOOP_OPCODE_DEL_INDEX:
+		dev = queue_remove_if(dev_list, dev_match_index,
+						UINT_TO_PTR(index));
+		dev_free(dev);
+		return;
+	case BTSNOOP_OPCODE_COMMAND_PKT:
+	case BTSNOOP_OPCODE_EVENT_PKT:
+	case BTSNOOP_OPCODE_ACL_TX_PKT:
+	case BTSNOOP_OPCODE_ACL_RX_PKT:
+	case BTSNOOP_OPCODE_SCO_TX_PKT:
+	case BTSNOOP_OPCODE_SCO_RX_PKT:
+	case BTSNOOP_OPCODE_ISO_TX_PKT:
+	case BTSNOOP_OPCODE_ISO_RX_PKT:
+		break;
+	default:
+		return;
+	}
+
+	dev = dev_lookup(index, tv);
+
+	switch (opcode) {
+	case BTSNOOP_OPCODE_COMMAND_PKT:
+		command_pkt(dev, tv, data, size);
+		break;
+	case BTSNOOP_OPCODE_EVENT_PKT:
+		event_pkt(dev, tv, data, size);
+		break;
+	case BTSNOOP_OPCODE_ACL_TX_PKT:
+	case BTSNOOP_OPCODE_ACL_RX_PKT:
+		if (size < sizeof(*acl))
+			break;
+
+		conn_data(dev, tv, le16_to_cpu(acl->handle), LINK_ACL,
+				opcode == BTSNOOP_OPCODE_ACL_TX_PKT ?
+							DIR_TX : DIR_RX,
+				size - sizeof(*acl));
+		break;
+	case BTSNOOP_OPCODE_SCO_TX_PKT:
+	case BTSNOOP_OPCODE_SCO_RX_PKT:
+		if (size < sizeof(struct bt_hci_sco_hdr))
+			break;
+
+		conn_data(dev, tv, get_le16(data), LINK_SCO,
+				opcode == BTSNOOP_OPCODE_SCO_TX_PKT ?
+							DIR_TX : DIR_RX,
+				size - sizeof(struct bt_hci_sco_hdr));
+		break;
+	case BTSNOOP_OPCODE_ISO_TX_PKT:
+	case BTSNOOP_OPCODE_ISO_RX_PKT:
+		if (size < sizeof(struct bt_hci_iso_hdr))
+			break;
+
+		conn_data(dev, tv, get_le16(data), LINK_ISO,
+				opcode == BTSNOOP_OPCODE_ISO_TX_PKT ?
+							DIR_TX : DIR_RX,
+				size - sizeof(struct bt_hci_iso_hdr));
+		break;
+	}
+}
+
+static const char *link_str(uint8_t link)
+{
+	switch (link) {
+	case LINK_ACL:
+		return "ACL";
+	case LINK_LE:
+		return "LE";
+	case LINK_SCO:
+		return "SCO";
+	case LINK_ISO:
+		return "ISO";
+	}
+
+	return "unknown";
+}
+
+static void print_pool(const char *label, struct stats_pool *pool,
+				struct timeval *tv, unsigned long long usec)
+{
+	pool_update(pool, tv);
+
+	if (!pool->max_pkt && !pool->peak)
+		goto done;
+
+	printf("  %s buffers: %u", label, pool->in_flight);
+
+	if (pool->max_pkt)
+		printf("/%u", pool->max_pkt);
+
+	printf(" in flight, peak %u", pool->peak);
+
+	if (usec)
+		printf(", average %llu.%02llu, full %llu%%",
+				pool->area / usec,
+				pool->area * 100 / usec % 100,
+				pool->full_usec * 100 / usec);
+
+	printf("\n");
+
+done:
+	pool->peak = pool->in_flight;
+	pool->area = 0;
+	pool->full_usec = 0;
+}
+
+static void print_cmd(void *data, void *user_data)
+{
+	struct stats_cmd *cmd = data;
+	const char *str = packet_get_opcode_str(cmd->opcode);
+
+	printf("    0x%4.4x %-32s %6lu sent%s\n", cmd->opcode,
+					str ? str : "Unknown", cmd->num_sent,
+					cmd->pending ? ", 1 pending" : "");
+
+	if (cmd->status.count)
+		printf("      status   %6lu, min %llu us, avg %llu us, "
+				"max %llu us\n", cmd->status.count,
+				cmd->status.min, latency_avg(&cmd->status),
+				cmd->status.max);
+
+	if (cmd->complete.count)
+		printf("      complete %6lu, min %llu us, avg %llu us, "
+				"max %llu us\n", cmd->complete.count,
+				cmd->complete.min,
+				latency_avg(&cmd->complete),
+				cmd->complete.max);
+}
+
+static void print_conn(struct stats_conn *conn, unsigned long long usec)
+{
+	unsigned long long tx_rate = 0, rx_rate = 0;
+
+	if (usec) {
+		tx_rate = conn->interval_bytes[DIR_TX] * 8 * 1000 / usec;
+		rx_rate = conn->interval_bytes[DIR_RX] * 8 * 1000 / usec;
+	}
+
+	printf("  %-3s handle %u%s: TX %llu kbit/s, RX %llu kbit/s, "
+			"%u in flight, %lu of %lu completed\n",
+			link_str(conn->link), conn->handle,
+			conn->closed ? " (closed)" : "", tx_rate, rx_rate,
+			conn->in_flight, conn->num_completed,
+			conn->packets[DIR_TX]);
+
+	conn->interval_bytes[DIR_TX] = 0;
+	conn->interval_bytes[DIR_RX] = 0;
+}
+
+static void print_dev(void *data, void *user_data)
+{
+	struct stats_dev *dev = data;
+	const struct queue_entry *entry;
+	struct latency status = { }, complete = { };
+	unsigned long long usec;
+	unsigned int pending = 0;
+
+	usec = latency_usec(&dev->interval_tv, &dev->last_tv);
+
+	printf("hci%u statistics over %llu.%03llu seconds\n", dev->index,
+				usec / 1000000, usec / 1000 % 1000);
+
+	for (entry = queue_get_entries(dev->cmd_list); entry;
+							entry = entry->next) {
+		struct stats_cmd *cmd = entry->data;
+
+		latency_merge(&status, &cmd->status);
+		latency_merge(&complete, &cmd->complete);
+		pending += cmd->pending;
+	}
+
+	printf("  Commands: %u pending, %u credits, %lu NOCP events\n",
+				pending, dev->ncmd, dev->num_nocp);
+	latency_print("  ", "Command Status latency", &status);
+	latency_print("  ", "Command Complete latency", &complete);
+	queue_foreach(dev->cmd_list, print_cmd, NULL);
+
+	print_pool("ACL", &dev->acl, &dev->last_tv, usec);
+	print_pool("LE", &dev->le, &dev->last_tv, usec);
+	print_pool("ISO", &dev->iso, &dev->last_tv, usec);
+
+	for (entry = queue_get_entries(dev->closed_list); entry;
+							entry = entry->next)
+		print_conn(entry->data, usec);
+
+	for (entry = queue_get_entries(dev->conn_list); entry;
+							entry = entry->next)
+		print_conn(entry->data, usec);
+
+	queue_remove_all(dev->closed_list, NULL, NULL, conn_free);
+
+	dev->interval_tv = dev->last_tv;
+
+	printf("\n");
+}
+
+void stats_report(void)
+{
+	if (!stats_enabled)
+		return;
+
+	queue_foreach(dev_list, print_dev, NULL);
+	fflush(stdout);
+}
+
+static void stats_timeout_callback(int id, void *user_data)
+{
+	stats_report();
+
+	mainloop_modify_timeout(id, stats_interval * 1000);
+}
+
+void stats_enable(unsigned int interval)
+{
+	if (stats_enabled)
+		return;
+
+	stats_enabled = true;
+	stats_interval = interval;
+	dev_list = queue_new();
+
+	if (interval)
+		stats_timeout = mainloop_add_timeout(interval * 1000,
+						stats_timeout_callback,
+						NULL, NULL);
+}
+
+bool stats_is_enabled(void)
+{
+	return stats_enabled;
+}
+
+void stats_disable(void)
+{
+	if (!stats_enabled)
+		return;
+
+	if (stats_timeout >= 0)
+		mainloop_remove_timeout(stats_timeout);
+
+	stats_timeout = -1;
+	queue_destroy(dev_list, dev_free);
+	dev_list = NULL;
+	stats_enabled = false;
+}
@@ -23,6 +23,7 @@
 #include <sys/ioctl.h>
 #include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/socket.h>
 #include <dirent.h>
 
 #include <glib.h>
@@ -46,6 +47,7 @@
 #include "src/shared/queue.h"
 #include "src/shared/att.h"
 #include "src/shared/gatt-db.h"
+#include "src/shared/batch.h"
 
 #include "btio/btio.h"
 #include "btd.h"
@@ -174,6 +176,29 @@ struct discovery_client {
 	struct discovery_filter *discovery_filter;
 };
 
+#define REPORT_BATCH_MTU		4096
+#define REPORT_BATCH_INTERVAL		100	/* 100 ms */
+
+#define REPORT_FLAG_LEGACY		0x01
+#define REPORT_FLAG_NOT_CONNECTABLE	0x02
+
+/* Record of a batch of advertising reports, see AcquireDiscoveryReports */
+struct report_record {
+	bdaddr_t addr;
+	uint8_t addr_type;
+	int8_t rssi;
+	uint8_t flags;
+	uint8_t len;
+	uint8_t data[];
+} __packed;
+
+struct report_client {
+	struct btd_adapter *adapter;
+	char *owner;
+	guint watch;
+	struct batch *batch;
+};
+
 struct service_auth {
 	guint id;
 	unsigned int svc_id;
@@ -236,6 +261,9 @@ struct btd_adapter {
 	struct discovery_client *client;	/* active discovery client */
 
 	GSList *discovery_found;	/* list of found devices */
+	GSList *report_clients;		/* clients of batched reports */
+	unsigned long reports_duplicate;	/* suppressed duplicates */
+	unsigned long reports_throttled;	/* suppressed over rate */
 	guint discovery_idle_timeout;	/* timeout between discovery runs */
 	guint passive_scan_timeout;	/* timeout between passive scans */
 
@@ -245,6 +273,8 @@ struct btd_adapter {
 	bool pincode_requested;		/* PIN requested during last bonding */
 	GSList *connections;		/* Connected devices */
 	GSList *devices;		/* Devices structure pointers */
+	GHashTable *devices_addr;	/* Devices indexed by address */
+	GHashTable *devices_path;	/* Devices indexed by object path */
 	GSList *connect_list;		/* Devices to connect when found */
 	struct btd_device *connect_le;	/* LE device waiting to be connected */
 	sdp_list_t *services;		/* Services associated to adapter */
@@ -838,6 +868,127 @@ int adapter_set_name(struct btd_adapter *adapter, const char *name)
 	return set_name(adapter, name);
 }
 
+static guint bdaddr_hash(gconstpointer key)
+{
+	const bdaddr_t *bdaddr = key;
+
+	return get_le32(&bdaddr->b[0]) ^ (get_le16(&bdaddr->b[4]) << 8);
+}
+
+static gboolean bdaddr_equal(gconstpointer a, gconstpointer b)
+{
+	return !bacmp(a, b);
+}
+
+/* Object paths have always been matched case insensitive */
+static guint path_hash(gconstpointer key)
+{
+	const char *path = key;
+	guint hash = 5381;
+
+	for (; *path; path++)
+		hash = (hash << 5) + hash + g_ascii_tolower(*path);
+
+	return hash;
+}
+
+static gboolean path_equal(gconstpointer a, gconstpointer b)
+{
+	return !strcasecmp(a, b);
+}
+
+/*
+ * Each address bucket holds the list of devices using it, either as their
+ * current address or as the address of their last connection, so lookups
+ * only need to run device_addr_type_cmp() over a handful of candidates.
+ */
+static void devices_addr_add(GHashTable *table, const bdaddr_t *bdaddr,
+						struct btd_device *device)
+{
+	GSList *list;
+	bdaddr_t *key;
+
+	/* Appending keeps the head, so the table entry stays valid */
+	list = g_hash_table_lookup(table, bdaddr);
+	if (list) {
+		list = g_slist_append(list, device);
+		return;
+	}
+
+	key = g_new(bdaddr_t, 1);
+	bacpy(key, bdaddr);
+
+	g_hash_table_insert(table, key, g_slist_append(NULL, device));
+}
+
+static void devices_addr_remove(GHashTable *table, const bdaddr_t *bdaddr,
+						struct btd_device *device)
+{
+	GSList *list, *new_list;
+	bdaddr_t *key;
+
+	list = g_hash_table_lookup(table, bdaddr);
+	if (!list)
+		return;
+
+	new_list = g_slist_remove(list, device);
+	if (!new_list) {
+		g_hash_table_remove(table, bdaddr);
+		return;
+	}
+
+	if (new_list == list)
+		return;
+
+	/* The existing key is kept and the passed one is freed */
+	key = g_new(bdaddr_t, 1);
+	bacpy(key, bdaddr);
+
+	g_hash_table_insert(table, key, new_list);
+}
+
+static void devices_addr_free(gpointer key, gpointer value,
+							gpointer user_data)
+{
+	g_slist_free(value);
+}
+
+void adapter_index_device_addr(struct btd_adapter *adapter,
+						struct btd_device *device)
+{
+	const bdaddr_t *conn_addr;
+
+	devices_addr_add(adapter->devices_addr, device_get_address(device),
+								device);
+
+	conn_addr = device_get_conn_address(device);
+	if (conn_addr)
+		devices_addr_add(adapter->devices_addr, conn_addr, device);
+}
+
+void adapter_unindex_device_addr(struct btd_adapter *adapter,
+						struct btd_device *device)
+{
+	const bdaddr_t *conn_addr;
+
+	devices_addr_remove(adapter->devices_addr, device_get_address(device),
+								device);
+
+	conn_addr = device_get_conn_address(device);
+	if (conn_addr)
+		devices_addr_remove(adapter->devices_addr, conn_addr, device);
+}
+
+static void adapter_add_device(struct btd_adapter *adapter,
+						struct btd_device *device)
+{
+	adapter->devices = g_slist_append(adapter->devices, device);
+
+	adapter_index_device_addr(adapter, device);
+	g_hash_table_replace(adapter->devices_path,
+				(gpointer) device_get_path(device), device);
+}
+
 struct btd_device *btd_adapter_find_device(struct btd_adapter *adapter,
 							const bdaddr_t *dst,
 							uint8_t bdaddr_type)
@@ -852,8 +1003,8 @@ struct btd_device *btd_adapter_find_device(struct btd_adapter *adapter,
 	bacpy(&addr.bdaddr, dst);
 	addr.bdaddr_type = bdaddr_type;
 
-	list = g_slist_find_custom(adapter->devices, &addr,
-							device_addr_type_cmp);
+	list = g_hash_table_lookup(adapter->devices_addr, dst);
+	list = g_slist_find_custom(list, &addr, device_addr_type_cmp);
 	if (!list)
 		return NULL;
 
@@ -1178,7 +1329,7 @@ static struct btd_device *adapter_create_device(struct btd_adapter *adapter,
 	if (!device)
 		return NULL;
 
-	adapter->devices = g_slist_append(adapter->devices, device);
+	adapter_add_device(adapter, device);
 
 	return device;
 }
@@ -1214,6 +1365,11 @@ void btd_adapter_remove_device(struct btd_adapter *adapter,
 	adapter->connect_list = g_slist_remove(adapter->connect_list, dev);
 
 	adapter->devices = g_slist_remove(adapter->devices, dev);
+	adapter_unindex_device_addr(adapter, dev);
+	if (g_hash_table_lookup(adapter->devices_path,
+					device_get_path(dev)) == dev)
+		g_hash_table_remove(adapter->devices_path,
+					device_get_path(dev));
 	btd_adv_monitor_device_remove(adapter->adv_monitor_manager, dev);
 
 	adapter->discovery_found = g_slist_remove(adapter->discovery_found,
@@ -1481,6 +1637,14 @@ static void discovery_cleanup(struct btd_adapter *adapter, int timeout)
 						invalidate_rssi_and_tx_power);
 	adapter->discovery_found = NULL;
 
+	if (adapter->reports_duplicate || adapter->reports_throttled)
+		DBG("suppressed %lu duplicate and %lu throttled reports",
+						adapter->reports_duplicate,
+						adapter->reports_throttled);
+
+	adapter->reports_duplicate = 0;
+	adapter->reports_throttled = 0;
+
 	if (!adapter->devices)
 		return;
 
@@ -3192,36 +3356,24 @@ static gboolean property_get_roles(const GDBusPropertyTable *property,
 	return TRUE;
 }
 
-static int device_path_cmp(gconstpointer a, gconstpointer b)
-{
-	const struct btd_device *device = a;
-	const char *path = b;
-	const char *dev_path = device_get_path(device);
-
-	return strcasecmp(dev_path, path);
-}
-
 static DBusMessage *remove_device(DBusConnection *conn,
 					DBusMessage *msg, void *user_data)
 {
 	struct btd_adapter *adapter = user_data;
 	struct btd_device *device;
 	const char *path;
-	GSList *list;
 
 	if (dbus_message_get_args(msg, NULL, DBUS_TYPE_OBJECT_PATH, &path,
 						DBUS_TYPE_INVALID) == FALSE)
 		return btd_error_invalid_args(msg);
 
-	list = g_slist_find_custom(adapter->devices, path, device_path_cmp);
-	if (!list)
+	device = g_hash_table_lookup(adapter->devices_path, path);
+	if (!device)
 		return btd_error_does_not_exist(msg);
 
 	if (!(adapter->current_settings & MGMT_SETTING_POWERED))
 		return btd_error_not_ready(msg);
 
-	device = list->data;
-
 	btd_device_set_temporary(device, true);
 
 	if (!btd_device_is_connected(device)) {
@@ -3437,6 +3589,154 @@ static DBusMessage *connect_device(DBusConnection *conn,
 	return NULL;
 }
 
+static void report_client_free(void *data)
+{
+	struct report_client *client = data;
+
+	DBG("owner %s dropped %lu batches", client->owner,
+					batch_get_dropped(client->batch));
+
+	if (client->watch)
+		g_dbus_remove_watch(dbus_conn, client->watch);
+
+	batch_free(client->batch);
+	g_free(client->owner);
+	g_free(client);
+}
+
+static void report_client_remove(struct report_client *client)
+{
+	struct btd_adapter *adapter = client->adapter;
+
+	adapter->report_clients = g_slist_remove(adapter->report_clients,
+								client);
+	report_client_free(client);
+}
+
+static void report_client_hup(void *user_data)
+{
+	struct report_client *client = user_data;
+
+	DBG("owner %s", client->owner);
+
+	report_client_remove(client);
+}
+
+static void report_client_disconnect(DBusConnection *conn, void *user_data)
+{
+	struct report_client *client = user_data;
+
+	DBG("owner %s", client->owner);
+
+	client->watch = 0;
+
+	report_client_remove(client);
+}
+
+static int compare_report_sender(gconstpointer a, gconstpointer b)
+{
+	const struct report_client *client = a;
+	const char *sender = b;
+
+	return g_strcmp0(client->owner, sender);
+}
+
+static bool parse_report_options(DBusMessageIter *iter, uint16_t *interval)
+{
+	DBusMessageIter dict;
+
+	if (dbus_message_iter_get_arg_type(iter) != DBUS_TYPE_ARRAY)
+		return false;
+
+	dbus_message_iter_recurse(iter, &dict);
+
+	while (dbus_message_iter_get_arg_type(&dict) == DBUS_TYPE_DICT_ENTRY) {
+		DBusMessageIter entry, value;
+		const char *key;
+
+		dbus_message_iter_recurse(&dict, &entry);
+		dbus_message_iter_get_basic(&entry, &key);
+
+		dbus_message_iter_next(&entry);
+		if (dbus_message_iter_get_arg_type(&entry) != DBUS_TYPE_VARIANT)
+			return false;
+
+		dbus_message_iter_recurse(&entry, &value);
+
+		if (!strcasecmp(key, "Interval")) {
+			if (dbus_message_iter_get_arg_type(&value) !=
+							DBUS_TYPE_UINT16)
+				return false;
+
+			dbus_message_iter_get_basic(&value, interval);
+			if (!*interval)
+				return false;
+		} else
+			return false;
+
+		dbus_message_iter_next(&dict);
+	}
+
+	return true;
+}
+
+static DBusMessage *acquire_discovery_reports(DBusConnection *conn,
+					DBusMessage *msg, void *user_data)
+{
+	struct btd_adapter *adapter = user_data;
+	const char *sender = dbus_message_get_sender(msg);
+	struct report_client *client;
+	DBusMessageIter iter;
+	uint16_t interval = REPORT_BATCH_INTERVAL;
+	uint16_t mtu = REPORT_BATCH_MTU;
+	DBusMessage *reply;
+	int fds[2];
+
+	DBG("sender %s", sender);
+
+	if (g_slist_find_custom(adapter->report_clients, sender,
+						compare_report_sender))
+		return btd_error_in_progress(msg);
+
+	dbus_message_iter_init(msg, &iter);
+	if (!parse_report_options(&iter, &interval))
+		return btd_error_invalid_args(msg);
+
+	if (socketpair(AF_LOCAL, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC,
+								0, fds) < 0)
+		return btd_error_failed(msg, strerror(errno));
+
+	client = g_new0(struct report_client, 1);
+	client->adapter = adapter;
+
+	client->batch = batch_new(fds[0], mtu, interval);
+	if (!client->batch) {
+		close(fds[0]);
+		close(fds[1]);
+		g_free(client);
+		return btd_error_failed(msg, strerror(EIO));
+	}
+
+	batch_set_disconnect_handler(client->batch, report_client_hup, client,
+									NULL);
+
+	client->owner = g_strdup(sender);
+	client->watch = g_dbus_add_disconnect_watch(dbus_conn, sender,
+						report_client_disconnect,
+						client, NULL);
+
+	adapter->report_clients = g_slist_prepend(adapter->report_clients,
+								client);
+
+	reply = g_dbus_create_reply(msg, DBUS_TYPE_UNIX_FD, &fds[1],
+					DBUS_TYPE_UINT16, &mtu,
+					DBUS_TYPE_INVALID);
+
+	close(fds[1]);
+
+	return reply;
+}
+
 static const GDBusMethodTable adapter_methods[] = {
 	{ GDBUS_ASYNC_METHOD("StartDiscovery", NULL, NULL, start_discovery) },
 	{ GDBUS_METHOD("SetDiscoveryFilter",
@@ -3451,6 +3751,10 @@ static const GDBusMethodTable adapter_methods[] = {
 	{ GDBUS_EXPERIMENTAL_ASYNC_METHOD("ConnectDevice",
 				GDBUS_ARGS({ "properties", "a{sv}" }), NULL,
 				connect_device) },
+	{ GDBUS_EXPERIMENTAL_METHOD("AcquireDiscoveryReports",
+				GDBUS_ARGS({ "options", "a{sv}" }),
+				GDBUS_ARGS({ "fd", "h" }, { "mtu", "q" }),
+				acquire_discovery_reports) },
 	{ }
 };
 
@@ -4439,6 +4743,7 @@ static void load_devices(struct btd_adapter *adapter)
 		struct irk_info *irk_info;
 		struct conn_param *param;
 		uint8_t bdaddr_type;
+		bdaddr_t bdaddr;
 
 		if (entry->d_type == DT_UNKNOWN)
 			entry->d_type = util_get_dt(dirname, entry->d_name);
@@ -4510,7 +4815,9 @@ static void load_devices(struct btd_adapter *adapter)
 		if (param)
 			params = g_slist_append(params, param);
 
-		list = g_slist_find_custom(adapter->devices, entry->d_name,
+		str2ba(entry->d_name, &bdaddr);
+		list = g_hash_table_lookup(adapter->devices_addr, &bdaddr);
+		list = g_slist_find_custom(list, entry->d_name,
 							device_address_cmp);
 		if (list) {
 			device = list->data;
@@ -4523,7 +4830,7 @@ static void load_devices(struct btd_adapter *adapter)
 			goto free;
 
 		btd_device_set_temporary(device, false);
-		adapter->devices = g_slist_append(adapter->devices, device);
+		adapter_add_device(adapter, device);
 
 		/* TODO: register services from pre-loaded list of primaries */
 
@@ -5322,6 +5629,10 @@ static void adapter_free(gpointer user_data)
 	g_queue_foreach(adapter->auths, free_service_auth, NULL);
 	g_queue_free(adapter->auths);
 
+	g_hash_table_foreach(adapter->devices_addr, devices_addr_free, NULL);
+	g_hash_table_destroy(adapter->devices_addr);
+	g_hash_table_destroy(adapter->devices_path);
+
 	/*
 	 * Unregister all handlers for this specific index since
 	 * the adapter bound to them is no longer valid.
@@ -6288,6 +6599,11 @@ static struct btd_adapter *btd_adapter_new(uint16_t index)
 
 	adapter->auths = g_queue_new();
 
+	adapter->devices_addr = g_hash_table_new_full(bdaddr_hash,
+							bdaddr_equal,
+							g_free, NULL);
+	adapter->devices_path = g_hash_table_new(path_hash, path_equal);
+
 	return btd_adapter_ref(adapter);
 }
 
@@ -6307,6 +6623,10 @@ static void adapter_remove(struct btd_adapter *adapter)
 	g_slist_free(adapter->devices);
 	adapter->devices = NULL;
 
+	g_hash_table_foreach(adapter->devices_addr, devices_addr_free, NULL);
+	g_hash_table_remove_all(adapter->devices_addr);
+	g_hash_table_remove_all(adapter->devices_path);
+
 	discovery_cleanup(adapter, 0);
 
 	unload_drivers(adapter);
@@ -6329,6 +6649,9 @@ static void adapter_remove(struct btd_adapter *adapter)
 
 	g_slist_free(adapter->msd_callbacks);
 	adapter->msd_callbacks = NULL;
+
+	g_slist_free_full(adapter->report_clients, report_client_free);
+	adapter->report_clients = NULL;
 }
 
 const char *adapter_get_path(struct btd_adapter *adapter)
@@ -6432,31 +6755,69 @@ static void confirm_name(struct btd_adapter *adapter, const bdaddr_t *bdaddr,
 						confirm_name_timeout, adapter);
 }
 
+struct msd_notify_data {
+	struct btd_adapter *adapter;
+	struct btd_device *dev;
+	btd_msd_cb_t cb;
+};
+
+static void msd_notify(uint16_t company, const uint8_t *data, uint8_t len,
+							void *user_data)
+{
+	struct msd_notify_data *notify = user_data;
+
+	notify->cb(notify->adapter, notify->dev, company, data, len);
+}
+
 static void adapter_msd_notify(struct btd_adapter *adapter,
-							struct btd_device *dev,
-							GSList *msd_list)
+						struct btd_device *dev,
+						const struct eir_view *eir)
 {
+	struct msd_notify_data notify = {
+		.adapter = adapter,
+		.dev = dev,
+	};
 	GSList *cb_l, *cb_next;
-	GSList *msd_l, *msd_next;
+
+	if (!eir->num_msd)
+		return;
 
 	for (cb_l = adapter->msd_callbacks; cb_l != NULL; cb_l = cb_next) {
-		btd_msd_cb_t cb = cb_l->data;
+		notify.cb = cb_l->data;
 
 		cb_next = g_slist_next(cb_l);
 
-		for (msd_l = msd_list; msd_l != NULL; msd_l = msd_next) {
-			const struct eir_msd *msd = msd_l->data;
+		eir_view_foreach_msd(eir, msd_notify, &notify);
+	}
+}
 
-			msd_next = g_slist_next(msd_l);
+struct uuid_match_data {
+	const char *uuid;
+	bool found;
+};
 
-			cb(adapter, dev, msd->company, msd->data,
-								msd->data_len);
-		}
-	}
+static void uuid_match(const char *uuid, void *user_data)
+{
+	struct uuid_match_data *match = user_data;
+
+	if (!match->found && !strcmp(uuid, match->uuid))
+		match->found = true;
+}
+
+static bool eir_has_uuid(const struct eir_view *eir, const char *uuid)
+{
+	struct uuid_match_data match = {
+		.uuid = uuid,
+	};
+
+	eir_view_foreach_uuid(eir, uuid_match, &match);
+
+	return match.found;
 }
 
-static bool is_filter_match(GSList *discovery_filter, struct eir_data *eir_data,
-								int8_t rssi)
+static bool is_filter_match(GSList *discovery_filter,
+					const struct eir_view *eir_data,
+					int8_t rssi)
 {
 	GSList *l, *m;
 	bool got_match = false;
@@ -6486,9 +6847,7 @@ static bool is_filter_match(GSList *discovery_filter, struct eir_data *eir_data,
 				/* m->data contains string representation of
 				 * uuid.
 				 */
-				if (g_slist_find_custom(eir_data->services,
-							m->data,
-							g_strcmp) != NULL)
+				if (eir_has_uuid(eir_data, m->data))
 					got_match = true;
 			}
 		}
@@ -6521,8 +6880,8 @@ static void filter_duplicate_data(void *data, void *user_data)
 }
 
 static bool device_is_discoverable(struct btd_adapter *adapter,
-					struct eir_data *eir, const char *addr,
-					uint8_t bdaddr_type)
+					const struct eir_view *eir,
+					const char *addr, uint8_t bdaddr_type)
 {
 	GSList *l;
 	bool discoverable;
@@ -6558,7 +6917,7 @@ static bool device_is_discoverable(struct btd_adapter *adapter,
 		if (!strncmp(filter->pattern, addr, pattern_len))
 			return true;
 
-		if (eir->name && !strncmp(filter->pattern, eir->name,
+		if (eir->has_name && !strncmp(filter->pattern, eir->name,
 							pattern_len))
 			return true;
 	}
@@ -6566,6 +6925,113 @@ static bool device_is_discoverable(struct btd_adapter *adapter,
 	return discoverable;
 }
 
+static void found_uuid(const char *uuid, void *user_data)
+{
+	struct btd_device *dev = user_data;
+
+	device_add_eir_uuid(dev, uuid);
+}
+
+static void found_msd(uint16_t company, const uint8_t *data, uint8_t len,
+							void *user_data)
+{
+	struct btd_device *dev = user_data;
+
+	device_add_manufacturer_data(dev, company, data, len);
+}
+
+static void found_sd(const char *uuid, const uint8_t *data, uint8_t len,
+							void *user_data)
+{
+	struct btd_device *dev = user_data;
+
+	device_add_service_data(dev, uuid, data, len);
+}
+
+static void found_data(uint8_t type, const uint8_t *data, uint8_t len,
+							void *user_data)
+{
+	struct btd_device *dev = user_data;
+
+	device_add_data(dev, type, data, len);
+}
+
+static void report_client_add(struct report_client *client,
+					const bdaddr_t *bdaddr,
+					uint8_t bdaddr_type, int8_t rssi,
+					uint8_t flags, const uint8_t *data,
+					uint8_t data_len)
+{
+	struct report_record rec;
+	struct iovec iov[2];
+
+	bacpy(&rec.addr, bdaddr);
+	rec.addr_type = bdaddr_type;
+	rec.rssi = rssi;
+	rec.flags = flags;
+	rec.len = data_len;
+
+	iov[0].iov_base = &rec;
+	iov[0].iov_len = sizeof(rec);
+	iov[1].iov_base = (void *) data;
+	iov[1].iov_len = data_len;
+
+	batch_append(client->batch, iov, 2);
+}
+
+/*
+ * Queues the report to the batches of the discovering clients which have
+ * acquired them and whose discovery filter it matches. Returns true if all
+ * discovering clients get batched reports, in which case no device object
+ * needs to be created for it.
+ */
+static bool batch_found_device(struct btd_adapter *adapter,
+					const bdaddr_t *bdaddr,
+					uint8_t bdaddr_type, int8_t rssi,
+					bool legacy, bool not_connectable,
+					const uint8_t *data, uint8_t data_len,
+					const struct eir_view *eir)
+{
+	uint8_t flags = 0;
+	bool batched = true;
+	GSList *l;
+
+	if (!adapter->report_clients || !adapter->discovery_list)
+		return false;
+
+	if (legacy)
+		flags |= REPORT_FLAG_LEGACY;
+
+	if (not_connectable)
+		flags |= REPORT_FLAG_NOT_CONNECTABLE;
+
+	for (l = adapter->discovery_list; l; l = g_slist_next(l)) {
+		struct discovery_client *disc = l->data;
+		struct report_client *client;
+		GSList *match;
+		GSList filter = { .data = disc };
+
+		match = g_slist_find_custom(adapter->report_clients,
+						disc->owner,
+						compare_report_sender);
+		if (!match) {
+			batched = false;
+			continue;
+		}
+
+		client = match->data;
+
+		if (disc->discovery_filter &&
+				!is_filter_match(&filter, eir, rssi))
+			continue;
+
+		report_client_add(client, bdaddr, bdaddr_type, rssi, flags,
+							data, data_len);
+	}
+
+	return batched;
+}
+
 static void update_found_devices(struct btd_adapter *adapter,
 					const bdaddr_t *bdaddr,
 					uint8_t bdaddr_type, int8_t rssi,
@@ -6574,31 +7040,29 @@ static void update_found_devices(struct btd_adapter *adapter,
 					const uint8_t *data, uint8_t data_len)
 {
 	struct btd_device *dev;
-	struct bt_ad *ad = NULL;
-	struct eir_data eir_data;
-	bool name_known, discoverable;
+	struct eir_view eir_data;
+	bool name_known, discoverable, batched;
 	char addr[18];
 	bool duplicate = false;
 	struct queue *matched_monitors = NULL;
 
-	if (bdaddr_type != BDADDR_BREDR)
-		ad = bt_ad_new_with_data(data_len, data);
-
 	/* During the background scanning, update the device only when the data
 	 * match at least one Adv monitor
 	 */
-	if (ad) {
+	if (bdaddr_type != BDADDR_BREDR)
 		matched_monitors = btd_adv_monitor_content_filter(
-					adapter->adv_monitor_manager, ad);
-		bt_ad_unref(ad);
-		ad = NULL;
-	}
+					adapter->adv_monitor_manager,
+					data, data_len);
 
 	if (!adapter->discovering && !matched_monitors)
 		return;
 
-	memset(&eir_data, 0, sizeof(eir_data));
-	eir_parse(&eir_data, data, data_len);
+	/* The view points into data so nothing needs to be freed */
+	eir_view_parse(&eir_data, data, data_len);
+
+	batched = batch_found_device(adapter, bdaddr, bdaddr_type, rssi,
+					legacy, not_connectable, data,
+					data_len, &eir_data);
 
 	ba2str(bdaddr, addr);
 
@@ -6607,10 +7071,9 @@ static void update_found_devices(struct btd_adapter *adapter,
 
 	dev = btd_adapter_find_device(adapter, bdaddr, bdaddr_type);
 	if (!dev) {
-		if (!discoverable) {
-			eir_data_free(&eir_data);
+		/* Batched reports don't need objects for unknown devices */
+		if (!discoverable || (batched && !matched_monitors))
 			return;
-		}
 
 		dev = adapter_create_device(adapter, bdaddr, bdaddr_type);
 	}
@@ -6618,7 +7081,6 @@ static void update_found_devices(struct btd_adapter *adapter,
 	if (!dev) {
 		btd_error(adapter->dev_id,
 			"Unable to create object for found device %s", addr);
-		eir_data_free(&eir_data);
 		return;
 	}
 
@@ -6637,7 +7099,35 @@ static void update_found_devices(struct btd_adapter *adapter,
 		device_update_last_seen(dev, BDADDR_BREDR);
 	}
 
-	if (eir_data.name != NULL && eir_data.name_complete)
+	if (adapter->discovery_list)
+		g_slist_foreach(adapter->discovery_list, filter_duplicate_data,
+								&duplicate);
+
+	/*
+	 * Drop reports of devices already found in this discovery session
+	 * which would not change anything, or exceed the configured rate,
+	 * before touching any property. Adv monitors need every report, and
+	 * so do filtered discovery clients which get every RSSI change.
+	 */
+	if (!matched_monitors && adapter->discovery_list &&
+			g_slist_find(adapter->discovery_found, dev)) {
+		uint8_t hysteresis = btd_opts.report_hysteresis;
+
+		if (duplicate || adapter->filtered_discovery)
+			hysteresis = 0;
+
+		switch (device_filter_report(dev, data, data_len, rssi,
+					hysteresis, btd_opts.report_rate)) {
+		case -EALREADY:
+			adapter->reports_duplicate++;
+			return;
+		case -EBUSY:
+			adapter->reports_throttled++;
+			return;
+		}
+	}
+
+	if (eir_data.has_name && eir_data.name_complete)
 		device_store_cached_name(dev, eir_data.name);
 
 	/*
@@ -6646,20 +7136,16 @@ static void update_found_devices(struct btd_adapter *adapter,
 	 */
 	if (!btd_device_is_connected(dev) &&
 		(device_is_temporary(dev) && !adapter->discovery_list) &&
-		!matched_monitors) {
-		eir_data_free(&eir_data);
+		!matched_monitors)
 		return;
-	}
 
 	/* If there is no matched Adv monitors, don't continue if not
 	 * discoverable or if active discovery filter don't match.
 	 */
 	if (!matched_monitors && (!discoverable ||
 		(adapter->filtered_discovery && !is_filter_match(
-				adapter->discovery_list, &eir_data, rssi)))) {
-		eir_data_free(&eir_data);
+				adapter->discovery_list, &eir_data, rssi))))
 		return;
-	}
 
 	device_set_legacy(dev, legacy);
 
@@ -6678,7 +7164,7 @@ static void update_found_devices(struct btd_adapter *adapter,
 	 * known, but still update the name with the known short name. */
 	name_known = device_name_known(dev);
 
-	if (eir_data.name && (eir_data.name_complete || !name_known))
+	if (eir_data.has_name && (eir_data.name_complete || !name_known))
 		btd_device_device_set_name(dev, eir_data.name);
 
 	if (eir_data.class != 0)
@@ -6691,28 +7177,33 @@ static void update_found_devices(struct btd_adapter *adapter,
 							eir_data.did_product,
 							eir_data.did_version);
 
-	device_add_eir_uuids(dev, eir_data.services);
+	eir_view_foreach_uuid(&eir_data, found_uuid, dev);
 
-	if (adapter->discovery_list)
-		g_slist_foreach(adapter->discovery_list, filter_duplicate_data,
-								&duplicate);
+	if (eir_data.num_msd) {
+		if (duplicate)
+			device_clear_manufacturer_data(dev);
+
+		eir_view_foreach_msd(&eir_data, found_msd, dev);
+		adapter_msd_notify(adapter, dev, &eir_data);
+	}
 
-	if (eir_data.msd_list) {
-		device_set_manufacturer_data(dev, eir_data.msd_list, duplicate);
-		adapter_msd_notify(adapter, dev, eir_data.msd_list);
+	if (eir_data.num_sd) {
+		if (duplicate)
+			device_clear_service_data(dev);
+
+		eir_view_foreach_sd(&eir_data, found_sd, dev);
 	}
 
-	if (eir_data.sd_list)
-		device_set_service_data(dev, eir_data.sd_list, duplicate);
+	if (eir_data.num_data) {
+		if (duplicate)
+			device_clear_data(dev);
 
-	if (eir_data.data_list)
-		device_set_data(dev, eir_data.data_list, duplicate);
+		eir_view_foreach_data(&eir_data, found_data, dev);
+	}
 
 	if (bdaddr_type != BDADDR_BREDR)
 		device_set_flags(dev, eir_data.flags);
 
-	eir_data_free(&eir_data);
-
 	/* After the device is updated, notify the matched Adv monitors */
 	if (matched_monitors) {
 		btd_adv_monitor_notify_monitors(adapter->adv_monitor_manager,
@@ -8737,7 +9228,7 @@ static void connected_callback(uint16_t index, uint16_t length,
 	const struct mgmt_ev_device_connected *ev = param;
 	struct btd_adapter *adapter = user_data;
 	struct btd_device *device;
-	struct eir_data eir_data;
+	struct eir_view eir_data;
 	uint16_t eir_len;
 	char addr[18];
 	bool name_known;
@@ -8765,9 +9256,7 @@ static void connected_callback(uint16_t index, uint16_t length,
 		return;
 	}
 
-	memset(&eir_data, 0, sizeof(eir_data));
-	if (eir_len > 0)
-		eir_parse(&eir_data, ev->eir, eir_len);
+	eir_view_parse(&eir_data, ev->eir, eir_len);
 
 	if (eir_data.class != 0)
 		device_set_class(device, eir_data.class);
@@ -8776,15 +9265,12 @@ static void connected_callback(uint16_t index, uint16_t length,
 
 	name_known = device_name_known(device);
 
-	if (eir_data.name && (eir_data.name_complete || !name_known)) {
+	if (eir_data.has_name && (eir_data.name_complete || !name_known)) {
 		device_store_cached_name(device, eir_data.name);
 		btd_device_device_set_name(device, eir_data.name);
 	}
 
-	if (eir_data.msd_list)
-		adapter_msd_notify(adapter, device, eir_data.msd_list);
-
-	eir_data_free(&eir_data);
+	adapter_msd_notify(adapter, device, &eir_data);
 }
 
 static void controller_resume_notify(struct btd_adapter *adapter)
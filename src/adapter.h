@@ -83,6 +83,10 @@ sdp_list_t *btd_adapter_get_services(struct btd_adapter *adapter);
 struct btd_device *btd_adapter_find_device(struct btd_adapter *adapter,
 							const bdaddr_t *dst,
 							uint8_t dst_type);
+void adapter_index_device_addr(struct btd_adapter *adapter,
+						struct btd_device *device);
+void adapter_unindex_device_addr(struct btd_adapter *adapter,
+						struct btd_device *device);
 
 const char *adapter_get_path(struct btd_adapter *adapter);
 const bdaddr_t *btd_adapter_get_address(struct btd_adapter *adapter);
@@ -56,6 +56,9 @@ struct btd_adv_monitor_manager {
 	uint8_t max_num_patterns;
 
 	struct queue *apps;	/* apps who registered for Adv monitoring */
+
+	/* Patterns of the active monitors, rebuilt on demand */
+	struct bt_ad_matcher *matcher;
 };
 
 struct adv_monitor_app {
@@ -127,7 +130,6 @@ struct app_match_data {
 };
 
 struct adv_content_filter_info {
-	struct bt_ad *ad;
 	struct queue *matched_monitors;	/* List of matched monitors */
 };
 
@@ -251,6 +253,13 @@ static void monitor_remove(struct adv_monitor *monitor)
 	}
 }
 
+/* Drops the compiled patterns so they are rebuilt on the next match */
+static void manager_invalidate_matcher(struct btd_adv_monitor_manager *manager)
+{
+	bt_ad_matcher_free(manager->matcher);
+	manager->matcher = NULL;
+}
+
 /* Destroys monitor object */
 static void monitor_destroy(void *data)
 {
@@ -260,6 +269,7 @@ static void monitor_destroy(void *data)
 		return;
 
 	queue_remove(monitor->app->monitors, monitor);
+	manager_invalidate_matcher(monitor->app->manager);
 
 	monitor_release(monitor);
 	monitor_remove(monitor);
@@ -657,6 +667,7 @@ static void add_adv_patterns_monitor_cb(uint8_t status, uint16_t length,
 
 	monitor->monitor_handle = le16_to_cpu(rp->monitor_handle);
 	monitor->state = MONITOR_STATE_ACTIVE;
+	manager_invalidate_matcher(monitor->app->manager);
 
 	DBG("Calling Activate() on Adv Monitor of owner %s at path %s",
 		monitor->app->owner, monitor->path);
@@ -1065,6 +1076,7 @@ static void manager_free(struct btd_adv_monitor_manager *manager)
 	mgmt_unref(manager->mgmt);
 
 	queue_destroy(manager->apps, app_destroy);
+	bt_ad_matcher_free(manager->matcher);
 
 	free(manager);
 }
@@ -1165,11 +1177,11 @@ void btd_adv_monitor_manager_destroy(struct btd_adv_monitor_manager *manager)
 	manager_destroy(manager);
 }
 
-/* Processes the content matching based pattern(s) of a monitor */
-static void adv_match_per_monitor(void *data, void *user_data)
+/* Adds the patterns of a monitor to the matcher if the monitor is active */
+static void monitor_compile(void *data, void *user_data)
 {
 	struct adv_monitor *monitor = data;
-	struct adv_content_filter_info *info = user_data;
+	struct bt_ad_matcher *matcher = user_data;
 
 	if (!monitor) {
 		error("Unexpected NULL adv_monitor object upon match");
@@ -1179,22 +1191,12 @@ static void adv_match_per_monitor(void *data, void *user_data)
 	if (monitor->state != MONITOR_STATE_ACTIVE)
 		return;
 
-	if (monitor->type == MONITOR_TYPE_OR_PATTERNS &&
-		bt_ad_pattern_match(info->ad, monitor->patterns)) {
-		goto matched;
-	}
-
-	return;
-
-matched:
-	if (!info->matched_monitors)
-		info->matched_monitors = queue_new();
-
-	queue_push_tail(info->matched_monitors, monitor);
+	if (monitor->type == MONITOR_TYPE_OR_PATTERNS)
+		bt_ad_matcher_add(matcher, monitor->patterns, monitor);
 }
 
-/* Processes the content matching for the monitor(s) of an app */
-static void adv_match_per_app(void *data, void *user_data)
+/* Adds the patterns of the monitor(s) of an app to the matcher */
+static void app_compile(void *data, void *user_data)
 {
 	struct adv_monitor_app *app = data;
 
@@ -1203,27 +1205,46 @@ static void adv_match_per_app(void *data, void *user_data)
 		return;
 	}
 
-	queue_foreach(app->monitors, adv_match_per_monitor, user_data);
+	queue_foreach(app->monitors, monitor_compile, user_data);
+}
+
+/* Collects a monitor whose content matched the ad data */
+static void adv_match_monitor(void *data, void *user_data)
+{
+	struct adv_monitor *monitor = data;
+	struct adv_content_filter_info *info = user_data;
+
+	if (!info->matched_monitors)
+		info->matched_monitors = queue_new();
+
+	queue_push_tail(info->matched_monitors, monitor);
 }
 
 /* Processes the content matching for every app without RSSI filtering and
  * notifying monitors. The caller is responsible of releasing the memory of the
- * list but not the ad data.
+ * list but not the ad data, which is matched in place.
+ * The patterns of all active monitors are compiled into a single matcher,
+ * which is rebuilt after monitors are activated or destroyed.
  * Returns the list of monitors whose content match the ad data.
  */
 struct queue *btd_adv_monitor_content_filter(
 				struct btd_adv_monitor_manager *manager,
-				struct bt_ad *ad)
+				const uint8_t *data, size_t len)
 {
 	struct adv_content_filter_info info;
 
-	if (!manager || !ad)
+	if (!manager || !data || !len)
 		return NULL;
 
-	info.ad = ad;
+	if (!manager->matcher) {
+		manager->matcher = bt_ad_matcher_new();
+		queue_foreach(manager->apps, app_compile, manager->matcher);
+	}
+
 	info.matched_monitors = NULL;
 
-	queue_foreach(manager->apps, adv_match_per_app, &info);
+	bt_ad_matcher_match(manager->matcher, data, len, adv_match_monitor,
+									&info);
 
 	return info.matched_monitors;
 }
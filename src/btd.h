@@ -98,6 +98,9 @@ struct btd_opts {
 	uint32_t	tmpto;
 	uint8_t		privacy;
 
+	uint8_t		report_hysteresis;	/* Duplicate report RSSI dBm */
+	uint16_t	report_rate;		/* Max reports/s per device */
+
 	struct btd_defaults defaults;
 
 	gboolean	reverse_discovery;
@@ -115,6 +118,7 @@ struct btd_opts {
 	bt_gatt_cache_t gatt_cache;
 	uint16_t	gatt_mtu;
 	uint8_t		gatt_channels;
+	gboolean	gatt_parallel_discovery;
 	enum mps_mode_t	mps;
 
 	struct btd_avdtp_opts avdtp;
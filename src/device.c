@@ -22,6 +22,8 @@
 #include <errno.h>
 #include <dirent.h>
 #include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <glib.h>
 #include <dbus/dbus.h>
@@ -73,6 +75,9 @@
 
 #define RSSI_THRESHOLD		8
 
+#define REPORT_HASH_OFFSET	0xcbf29ce484222325ULL
+#define REPORT_HASH_PRIME	0x100000001b3ULL
+
 #define GATT_PRIM_SVC_UUID_STR "2800"
 #define GATT_SND_SVC_UUID_STR  "2801"
 #define GATT_INCLUDE_UUID_STR "2802"
@@ -269,6 +274,9 @@ struct btd_device {
 	int8_t		rssi;
 	int8_t		tx_power;
 
+	uint64_t	report_hash;	/* Last processed report */
+	struct timespec	report_time;
+
 	GIOChannel	*att_io;
 	guint		store_id;
 };
@@ -1810,6 +1818,26 @@ done:
 	dev->connect = NULL;
 }
 
+static bool add_eir_uuid(struct btd_device *dev, const char *uuid)
+{
+	if (g_slist_find_custom(dev->eir_uuids, uuid, bt_uuid_strcmp))
+		return false;
+
+	dev->eir_uuids = g_slist_append(dev->eir_uuids, g_strdup(uuid));
+
+	return true;
+}
+
+void device_add_eir_uuid(struct btd_device *dev, const char *uuid)
+{
+	if (dev->bredr_state.svc_resolved || dev->le_state.svc_resolved)
+		return;
+
+	if (add_eir_uuid(dev, uuid))
+		g_dbus_emit_property_changed(dbus_conn, dev->path,
+						DEVICE_INTERFACE, "UUIDs");
+}
+
 void device_add_eir_uuids(struct btd_device *dev, GSList *uuids)
 {
 	GSList *l;
@@ -1818,89 +1846,66 @@ void device_add_eir_uuids(struct btd_device *dev, GSList *uuids)
 	if (dev->bredr_state.svc_resolved || dev->le_state.svc_resolved)
 		return;
 
-	for (l = uuids; l != NULL; l = l->next) {
-		const char *str = l->data;
-		if (g_slist_find_custom(dev->eir_uuids, str, bt_uuid_strcmp))
-			continue;
-		added = true;
-		dev->eir_uuids = g_slist_append(dev->eir_uuids, g_strdup(str));
-	}
+	for (l = uuids; l != NULL; l = l->next)
+		added |= add_eir_uuid(dev, l->data);
 
 	if (added)
 		g_dbus_emit_property_changed(dbus_conn, dev->path,
 						DEVICE_INTERFACE, "UUIDs");
 }
 
-static void add_manufacturer_data(void *data, void *user_data)
+void device_clear_manufacturer_data(struct btd_device *dev)
 {
-	struct eir_msd *msd = data;
-	struct btd_device *dev = user_data;
+	bt_ad_clear_manufacturer_data(dev->ad);
+}
 
-	if (!bt_ad_add_manufacturer_data(dev->ad, msd->company, msd->data,
-								msd->data_len))
+void device_add_manufacturer_data(struct btd_device *dev, uint16_t company,
+					const uint8_t *data, uint8_t len)
+{
+	if (!bt_ad_add_manufacturer_data(dev->ad, company, (void *) data, len))
 		return;
 
 	g_dbus_emit_property_changed(dbus_conn, dev->path,
 					DEVICE_INTERFACE, "ManufacturerData");
 }
 
-void device_set_manufacturer_data(struct btd_device *dev, GSList *list,
-								bool duplicate)
+void device_clear_service_data(struct btd_device *dev)
 {
-	if (duplicate)
-		bt_ad_clear_manufacturer_data(dev->ad);
-
-	g_slist_foreach(list, add_manufacturer_data, dev);
+	bt_ad_clear_service_data(dev->ad);
 }
 
-static void add_service_data(void *data, void *user_data)
+void device_add_service_data(struct btd_device *dev, const char *uuid,
+					const uint8_t *data, uint8_t len)
 {
-	struct eir_sd *sd = data;
-	struct btd_device *dev = user_data;
-	bt_uuid_t uuid;
+	bt_uuid_t btuuid;
 
-	if (bt_string_to_uuid(&uuid, sd->uuid) < 0)
+	if (bt_string_to_uuid(&btuuid, uuid) < 0)
 		return;
 
-	if (!bt_ad_add_service_data(dev->ad, &uuid, sd->data, sd->data_len))
+	if (!bt_ad_add_service_data(dev->ad, &btuuid, (void *) data, len))
 		return;
 
 	g_dbus_emit_property_changed(dbus_conn, dev->path,
 					DEVICE_INTERFACE, "ServiceData");
 }
 
-void device_set_service_data(struct btd_device *dev, GSList *list,
-							bool duplicate)
+void device_clear_data(struct btd_device *dev)
 {
-	if (duplicate)
-		bt_ad_clear_service_data(dev->ad);
-
-	g_slist_foreach(list, add_service_data, dev);
+	bt_ad_clear_data(dev->ad);
 }
 
-static void add_data(void *data, void *user_data)
+void device_add_data(struct btd_device *dev, uint8_t type,
+					const uint8_t *data, uint8_t len)
 {
-	struct eir_ad *ad = data;
-	struct btd_device *dev = user_data;
-
-	if (!bt_ad_add_data(dev->ad, ad->type, ad->data, ad->len))
+	if (!bt_ad_add_data(dev->ad, type, (void *) data, len))
 		return;
 
-	if (ad->type == EIR_TRANSPORT_DISCOVERY)
+	if (type == EIR_TRANSPORT_DISCOVERY)
 		g_dbus_emit_property_changed(dbus_conn, dev->path,
 						DEVICE_INTERFACE,
 						"AdvertisingData");
 }
 
-void device_set_data(struct btd_device *dev, GSList *list,
-							bool duplicate)
-{
-	if (duplicate)
-		bt_ad_clear_data(dev->ad);
-
-	g_slist_foreach(list, add_data, dev);
-}
-
 static struct btd_service *find_connectable_service(struct btd_device *dev,
 							const char *uuid)
 {
@@ -2299,12 +2304,118 @@ static void store_services(struct btd_device *device)
 	g_key_file_free(key_file);
 }
 
+#define GATT_CACHE_MAGIC	"BZGC"
+#define GATT_CACHE_VERSION	0x01
+
+#define GATT_CACHE_FLAG_HASH	0x01
+
+#define GATT_CACHE_PRIMARY	0x01
+#define GATT_CACHE_SECONDARY	0x02
+#define GATT_CACHE_INCLUDE	0x03
+#define GATT_CACHE_CHRC		0x04
+#define GATT_CACHE_DESC		0x05
+
+/*
+ * Binary GATT cache: a header followed by num_svc service records and then
+ * the included service, characteristic and descriptor records of all
+ * services. All fields are little endian and records have a fixed size so
+ * the file can be mapped and inserted into gatt_db without parsing.
+ */
+struct gatt_cache_hdr {
+	uint8_t magic[4];
+	uint8_t version;
+	uint8_t flags;
+	uint16_t num_svc;
+	uint16_t num_attr;
+	uint16_t rfu;
+	uint8_t hash[16];
+} __packed;
+
+struct gatt_cache_attr {
+	uint8_t type;
+	uint8_t uuid_len;
+	uint16_t handle;
+	/* end handle, included start, value handle or extended properties */
+	uint16_t value;
+	/* included end handle or characteristic properties */
+	uint16_t extra;
+	uint8_t uuid[16];
+} __packed;
+
 struct gatt_saver {
 	struct btd_device *device;
 	uint16_t ext_props;
-	GKeyFile *key_file;
+	GByteArray *svcs;
+	GByteArray *attrs;
+	const uint8_t *hash;
 };
 
+static void gatt_cache_path(char *filename, const char *local,
+							const char *peer)
+{
+	snprintf(filename, PATH_MAX, STORAGEDIR "/%s/cache/%s.gatt", local,
+									peer);
+}
+
+static const struct gatt_cache_hdr *gatt_cache_map(const char *filename,
+								size_t *len)
+{
+	const struct gatt_cache_hdr *hdr;
+	struct stat st;
+	void *map;
+	int fd;
+
+	fd = open(filename, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return NULL;
+
+	if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) ||
+				(size_t) st.st_size < sizeof(*hdr)) {
+		close(fd);
+		return NULL;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (map == MAP_FAILED)
+		return NULL;
+
+	hdr = map;
+
+	if (memcmp(hdr->magic, GATT_CACHE_MAGIC, sizeof(hdr->magic)) ||
+			hdr->version != GATT_CACHE_VERSION ||
+			get_le16(&hdr->num_svc) > get_le16(&hdr->num_attr) ||
+			(size_t) st.st_size != sizeof(*hdr) +
+					get_le16(&hdr->num_attr) *
+					sizeof(struct gatt_cache_attr)) {
+		munmap(map, st.st_size);
+		return NULL;
+	}
+
+	*len = st.st_size;
+
+	return hdr;
+}
+
+static void gatt_cache_append(GByteArray *buf, uint8_t type, uint16_t handle,
+					uint16_t value, uint16_t extra,
+					const bt_uuid_t *uuid)
+{
+	struct gatt_cache_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+
+	attr.type = type;
+	attr.uuid_len = uuid->type == BT_UUID16 ? 2 : 16;
+	put_le16(handle, &attr.handle);
+	put_le16(value, &attr.value);
+	put_le16(extra, &attr.extra);
+	bt_uuid_to_le(uuid, attr.uuid);
+
+	g_byte_array_append(buf, (void *) &attr, sizeof(attr));
+}
+
 static void db_hash_read_value_cb(struct gatt_db_attribute *attrib,
 						int err, const uint8_t *value,
 						size_t length, void *user_data)
@@ -2317,35 +2428,38 @@ static void db_hash_read_value_cb(struct gatt_db_attribute *attrib,
 	*hash = value;
 }
 
+static void db_hash_find_cb(struct gatt_db_attribute *attrib, void *user_data)
+{
+	const uint8_t **hash = user_data;
+
+	if (*hash)
+		return;
+
+	gatt_db_attribute_read(attrib, 0, BT_ATT_OP_READ_REQ, NULL,
+					db_hash_read_value_cb, hash);
+}
+
 static void store_desc(struct gatt_db_attribute *attr, void *user_data)
 {
 	struct gatt_saver *saver = user_data;
-	GKeyFile *key_file = saver->key_file;
-	char handle[6], value[100], uuid_str[MAX_LEN_UUID_STR];
 	const bt_uuid_t *uuid;
 	bt_uuid_t ext_uuid;
-	uint16_t handle_num;
-
-	handle_num = gatt_db_attribute_get_handle(attr);
-	sprintf(handle, "%04hx", handle_num);
+	uint16_t value = 0;
 
 	uuid = gatt_db_attribute_get_type(attr);
-	bt_uuid_to_string(uuid, uuid_str, sizeof(uuid_str));
 
 	bt_uuid16_create(&ext_uuid, GATT_CHARAC_EXT_PROPER_UUID);
-	if (!bt_uuid_cmp(uuid, &ext_uuid) && saver->ext_props)
-		sprintf(value, "%04hx:%s", saver->ext_props, uuid_str);
-	else
-		sprintf(value, "%s", uuid_str);
+	if (!bt_uuid_cmp(uuid, &ext_uuid))
+		value = saver->ext_props;
 
-	g_key_file_set_string(key_file, "Attributes", handle, value);
+	gatt_cache_append(saver->attrs, GATT_CACHE_DESC,
+				gatt_db_attribute_get_handle(attr), value, 0,
+				uuid);
 }
 
 static void store_chrc(struct gatt_db_attribute *attr, void *user_data)
 {
 	struct gatt_saver *saver = user_data;
-	GKeyFile *key_file = saver->key_file;
-	char handle[6], value[100], uuid_str[MAX_LEN_UUID_STR];
 	uint16_t handle_num, value_handle;
 	uint8_t properties;
 	bt_uuid_t uuid, hash_uuid;
@@ -2357,37 +2471,15 @@ static void store_chrc(struct gatt_db_attribute *attr, void *user_data)
 		return;
 	}
 
-	sprintf(handle, "%04hx", handle_num);
-	bt_uuid_to_string(&uuid, uuid_str, sizeof(uuid_str));
-
-	/* Store Database Hash  value if available */
+	/* Store Database Hash value if available */
 	bt_uuid16_create(&hash_uuid, GATT_CHARAC_DB_HASH);
-	if (!bt_uuid_cmp(&uuid, &hash_uuid)) {
-		const uint8_t *hash = NULL;
-
-		attr = gatt_db_get_attribute(saver->device->db, value_handle);
-
-		gatt_db_attribute_read(attr, 0, BT_ATT_OP_READ_REQ, NULL,
-					db_hash_read_value_cb, &hash);
-		if (hash)
-			sprintf(value, GATT_CHARAC_UUID_STR ":%04hx:%02hhx:"
-				"%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx"
-				"%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx"
-				"%02hhx%02hhx:%s", value_handle, properties,
-				hash[0], hash[1], hash[2], hash[3],
-				hash[4], hash[5], hash[6], hash[7],
-				hash[8], hash[9], hash[10], hash[11],
-				hash[12], hash[13], hash[14], hash[15],
-				uuid_str);
-		else
-			sprintf(value, GATT_CHARAC_UUID_STR ":%04hx:%02hhx:%s",
-				value_handle, properties, uuid_str);
-
-	} else
-		sprintf(value, GATT_CHARAC_UUID_STR ":%04hx:%02hhx:%s",
-				value_handle, properties, uuid_str);
+	if (!bt_uuid_cmp(&uuid, &hash_uuid) && !saver->hash)
+		db_hash_find_cb(gatt_db_get_attribute(saver->device->db,
+							value_handle),
+							&saver->hash);
 
-	g_key_file_set_string(key_file, "Attributes", handle, value);
+	gatt_cache_append(saver->attrs, GATT_CACHE_CHRC, handle_num,
+					value_handle, properties, &uuid);
 
 	gatt_db_service_foreach_desc(attr, store_desc, saver);
 }
@@ -2395,9 +2487,7 @@ static void store_chrc(struct gatt_db_attribute *attr, void *user_data)
 static void store_incl(struct gatt_db_attribute *attr, void *user_data)
 {
 	struct gatt_saver *saver = user_data;
-	GKeyFile *key_file = saver->key_file;
 	struct gatt_db_attribute *service;
-	char handle[6], value[100], uuid_str[MAX_LEN_UUID_STR];
 	uint16_t handle_num, start, end;
 	bt_uuid_t uuid;
 
@@ -2412,25 +2502,18 @@ static void store_incl(struct gatt_db_attribute *attr, void *user_data)
 		return;
 	}
 
-	sprintf(handle, "%04hx", handle_num);
-
 	gatt_db_attribute_get_service_uuid(service, &uuid);
-	bt_uuid_to_string(&uuid, uuid_str, sizeof(uuid_str));
-	sprintf(value, GATT_INCLUDE_UUID_STR ":%04hx:%04hx:%s", start,
-								end, uuid_str);
 
-	g_key_file_set_string(key_file, "Attributes", handle, value);
+	gatt_cache_append(saver->attrs, GATT_CACHE_INCLUDE, handle_num, start,
+								end, &uuid);
 }
 
 static void store_service(struct gatt_db_attribute *attr, void *user_data)
 {
 	struct gatt_saver *saver = user_data;
-	GKeyFile *key_file = saver->key_file;
-	char uuid_str[MAX_LEN_UUID_STR], handle[6], value[256];
 	uint16_t start, end;
 	bt_uuid_t uuid;
 	bool primary;
-	char *type;
 
 	if (!gatt_db_attribute_get_service_data(attr, &start, &end, &primary,
 								&uuid)) {
@@ -2438,31 +2521,52 @@ static void store_service(struct gatt_db_attribute *attr, void *user_data)
 		return;
 	}
 
-	sprintf(handle, "%04hx", start);
+	gatt_cache_append(saver->svcs, primary ? GATT_CACHE_PRIMARY :
+						GATT_CACHE_SECONDARY,
+						start, end, 0, &uuid);
 
-	bt_uuid_to_string(&uuid, uuid_str, sizeof(uuid_str));
+	gatt_db_service_foreach_incl(attr, store_incl, saver);
+	gatt_db_service_foreach_char(attr, store_chrc, saver);
+}
 
-	if (primary)
-		type = GATT_PRIM_SVC_UUID_STR;
-	else
-		type = GATT_SND_SVC_UUID_STR;
+static void remove_legacy_gatt_db(const char *local, const char *peer)
+{
+	char filename[PATH_MAX];
+	GKeyFile *key_file;
+	char *data;
+	gsize length = 0;
 
-	sprintf(value, "%s:%04hx:%s", type, end, uuid_str);
+	snprintf(filename, PATH_MAX, STORAGEDIR "/%s/cache/%s", local, peer);
 
-	g_key_file_set_string(key_file, "Attributes", handle, value);
+	key_file = g_key_file_new();
 
-	gatt_db_service_foreach_incl(attr, store_incl, saver);
-	gatt_db_service_foreach_char(attr, store_chrc, saver);
+	if (!g_key_file_load_from_file(key_file, filename, 0, NULL) ||
+			!g_key_file_has_group(key_file, "Attributes"))
+		goto done;
+
+	/* Attributes are now kept in the binary cache */
+	g_key_file_remove_group(key_file, "Attributes", NULL);
+
+	data = g_key_file_to_data(key_file, &length, NULL);
+	g_file_set_contents(filename, data, length, NULL);
+	g_free(data);
+
+done:
+	g_key_file_free(key_file);
 }
 
 static void store_gatt_db(struct btd_device *device)
 {
+	const char *local = btd_adapter_get_storage_dir(device->adapter);
+	const struct gatt_cache_hdr *old;
+	struct gatt_cache_hdr hdr;
 	char filename[PATH_MAX];
 	char dst_addr[18];
-	GKeyFile *key_file;
-	char *data;
-	gsize length = 0;
 	struct gatt_saver saver;
+	const uint8_t *hash = NULL;
+	bt_uuid_t hash_uuid;
+	GByteArray *buf;
+	size_t old_len = 0;
 
 	if (device_address_is_private(device)) {
 		DBG("Can't store GATT db for private addressed device %s",
@@ -2474,28 +2578,60 @@ static void store_gatt_db(struct btd_device *device)
 		return;
 
 	ba2str(&device->bdaddr, dst_addr);
+	gatt_cache_path(filename, local, dst_addr);
 
-	snprintf(filename, PATH_MAX, STORAGEDIR "/%s/cache/%s",
-				btd_adapter_get_storage_dir(device->adapter),
-				dst_addr);
-	create_file(filename, S_IRUSR | S_IWUSR);
-
-	key_file = g_key_file_new();
-	g_key_file_load_from_file(key_file, filename, 0, NULL);
+	old = gatt_cache_map(filename, &old_len);
 
-	/* Remove current attributes since it might have changed */
-	g_key_file_remove_group(key_file, "Attributes", NULL);
+	/* Cache is keyed by Database Hash so skip it if the hash matches */
+	bt_uuid16_create(&hash_uuid, GATT_CHARAC_DB_HASH);
+	gatt_db_find_by_type(device->db, 0x0001, 0xffff, &hash_uuid,
+						db_hash_find_cb, &hash);
+	if (old && hash && (old->flags & GATT_CACHE_FLAG_HASH) &&
+				!memcmp(old->hash, hash, sizeof(old->hash))) {
+		DBG("GATT cache for %s is up to date", dst_addr);
+		munmap((void *) old, old_len);
+		return;
+	}
 
-	saver.key_file = key_file;
+	memset(&saver, 0, sizeof(saver));
 	saver.device = device;
+	saver.svcs = g_byte_array_new();
+	saver.attrs = g_byte_array_new();
 
 	gatt_db_foreach_service(device->db, NULL, store_service, &saver);
 
-	data = g_key_file_to_data(key_file, &length, NULL);
-	g_file_set_contents(filename, data, length, NULL);
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, GATT_CACHE_MAGIC, sizeof(hdr.magic));
+	hdr.version = GATT_CACHE_VERSION;
+	put_le16(saver.svcs->len / sizeof(struct gatt_cache_attr),
+							&hdr.num_svc);
+	put_le16((saver.svcs->len + saver.attrs->len) /
+				sizeof(struct gatt_cache_attr), &hdr.num_attr);
+	if (saver.hash) {
+		hdr.flags |= GATT_CACHE_FLAG_HASH;
+		memcpy(hdr.hash, saver.hash, sizeof(hdr.hash));
+	}
+
+	buf = g_byte_array_sized_new(sizeof(hdr) + saver.svcs->len +
+							saver.attrs->len);
+	g_byte_array_append(buf, (void *) &hdr, sizeof(hdr));
+	g_byte_array_append(buf, saver.svcs->data, saver.svcs->len);
+	g_byte_array_append(buf, saver.attrs->data, saver.attrs->len);
+
+	if (!old || old_len != buf->len || memcmp(old, buf->data, buf->len)) {
+		create_file(filename, S_IRUSR | S_IWUSR);
+		g_file_set_contents(filename, (char *) buf->data, buf->len,
+									NULL);
+	}
 
-	g_free(data);
-	g_key_file_free(key_file);
+	if (old)
+		munmap((void *) old, old_len);
+	else
+		remove_legacy_gatt_db(local, dst_addr);
+
+	g_byte_array_free(buf, TRUE);
+	g_byte_array_free(saver.attrs, TRUE);
+	g_byte_array_free(saver.svcs, TRUE);
 }
 
 
@@ -2975,8 +3111,10 @@ void device_add_connection(struct btd_device *dev, uint8_t bdaddr_type)
 		return;
 	}
 
+	adapter_unindex_device_addr(dev->adapter, dev);
 	bacpy(&dev->conn_bdaddr, &dev->bdaddr);
 	dev->conn_bdaddr_type = dev->bdaddr_type;
+	adapter_index_device_addr(dev->adapter, dev);
 
 	/* If this is the first connection over this bearer */
 	if (bdaddr_type == BDADDR_BREDR)
@@ -3748,17 +3886,183 @@ static int load_gatt_db_impl(GKeyFile *key_file, char **keys,
 	return 0;
 }
 
+static bool gatt_cache_get_uuid(const struct gatt_cache_attr *attr,
+							bt_uuid_t *uuid)
+{
+	uint128_t u128;
+
+	switch (attr->uuid_len) {
+	case 2:
+		bt_uuid16_create(uuid, get_le16(attr->uuid));
+		return true;
+	case 16:
+		bswap_128(attr->uuid, &u128);
+		bt_uuid128_create(uuid, u128);
+		return true;
+	default:
+		return false;
+	}
+}
+
+static struct gatt_db_attribute *
+load_gatt_cache_attr(struct gatt_db *db, const struct gatt_cache_hdr *hdr,
+					const struct gatt_cache_attr *attr,
+					struct gatt_db_attribute *service)
+{
+	struct gatt_db_attribute *att;
+	uint16_t handle, value, extra;
+	uint8_t val[2];
+	bt_uuid_t uuid, ext_uuid, hash_uuid;
+
+	if (!gatt_cache_get_uuid(attr, &uuid))
+		return NULL;
+
+	handle = get_le16(&attr->handle);
+	value = get_le16(&attr->value);
+	extra = get_le16(&attr->extra);
+
+	switch (attr->type) {
+	case GATT_CACHE_INCLUDE:
+		att = gatt_db_get_attribute(db, value);
+		if (!att)
+			return NULL;
+
+		att = gatt_db_service_insert_included(service, handle, att);
+		break;
+	case GATT_CACHE_CHRC:
+		att = gatt_db_service_insert_characteristic(service, value,
+							&uuid, 0, extra,
+							NULL, NULL, NULL);
+		if (!att || gatt_db_attribute_get_handle(att) != value)
+			return NULL;
+
+		bt_uuid16_create(&hash_uuid, GATT_CHARAC_DB_HASH);
+		if (!bt_uuid_cmp(&uuid, &hash_uuid) &&
+				(hdr->flags & GATT_CACHE_FLAG_HASH) &&
+				!gatt_db_attribute_write(att, 0, hdr->hash,
+							sizeof(hdr->hash), 0,
+							NULL, load_desc_value,
+							NULL))
+			return NULL;
+		break;
+	case GATT_CACHE_DESC:
+		att = gatt_db_service_insert_descriptor(service, handle, &uuid,
+							0, NULL, NULL, NULL);
+		if (!att || gatt_db_attribute_get_handle(att) != handle)
+			return NULL;
+
+		bt_uuid16_create(&ext_uuid, GATT_CHARAC_EXT_PROPER_UUID);
+		if (!bt_uuid_cmp(&uuid, &ext_uuid) && value) {
+			put_le16(value, val);
+			if (!gatt_db_attribute_write(att, 0, val, sizeof(val),
+							0, NULL,
+							load_desc_value, NULL))
+				return NULL;
+		}
+		break;
+	default:
+		return NULL;
+	}
+
+	return att;
+}
+
+static int load_gatt_cache(struct gatt_db *db, const char *filename)
+{
+	const struct gatt_cache_hdr *hdr;
+	const struct gatt_cache_attr *attrs;
+	struct gatt_db_attribute **services;
+	struct gatt_db_attribute *service = NULL;
+	uint16_t num_svc, num_attr, start = 0, end = 0;
+	size_t len;
+	int i, err = -EIO;
+
+	hdr = gatt_cache_map(filename, &len);
+	if (!hdr)
+		return -ENOENT;
+
+	attrs = (const void *) (hdr + 1);
+	num_svc = get_le16(&hdr->num_svc);
+	num_attr = get_le16(&hdr->num_attr);
+
+	services = g_new0(struct gatt_db_attribute *, num_svc);
+
+	/* Services come first so includes can refer to any of them */
+	for (i = 0; i < num_svc; i++) {
+		const struct gatt_cache_attr *attr = &attrs[i];
+		bt_uuid_t uuid;
+
+		if ((attr->type != GATT_CACHE_PRIMARY &&
+				attr->type != GATT_CACHE_SECONDARY) ||
+				!gatt_cache_get_uuid(attr, &uuid))
+			goto done;
+
+		start = get_le16(&attr->handle);
+		end = get_le16(&attr->value);
+		if (end < start)
+			goto done;
+
+		services[i] = gatt_db_insert_service(db, start, &uuid,
+					attr->type == GATT_CACHE_PRIMARY,
+					end - start + 1);
+		if (!services[i]) {
+			error("Unable load service into db!");
+			goto done;
+		}
+	}
+
+	for (; i < num_attr; i++) {
+		const struct gatt_cache_attr *attr = &attrs[i];
+		uint16_t handle = get_le16(&attr->handle);
+
+		if (!service || handle < start || handle > end) {
+			service = gatt_db_get_service(db, handle);
+			if (!service)
+				goto done;
+
+			gatt_db_attribute_get_service_handles(service, &start,
+									&end);
+		}
+
+		if (!load_gatt_cache_attr(db, hdr, attr, service)) {
+			warn("loading attribute 0x%04x to db failed", handle);
+			goto done;
+		}
+	}
+
+	for (i = 0; i < num_svc; i++)
+		gatt_db_service_set_active(services[i], true);
+
+	err = 0;
+
+done:
+	if (err)
+		gatt_db_clear(db);
+
+	g_free(services);
+	munmap((void *) hdr, len);
+
+	return err;
+}
+
 static void load_gatt_db(struct btd_device *device, const char *local,
 							const char *peer)
 {
 	char **keys, filename[PATH_MAX];
 	GKeyFile *key_file;
+	int err;
 
 	if (!gatt_cache_is_enabled(device))
 		return;
 
 	DBG("Restoring %s gatt database from file", peer);
 
+	gatt_cache_path(filename, local, peer);
+
+	if (!load_gatt_cache(device->db, filename))
+		goto done;
+
+	/* Fallback to key file format and migrate it to the binary cache */
 	snprintf(filename, PATH_MAX, STORAGEDIR "/%s/cache/%s", local, peer);
 
 	key_file = g_key_file_new();
@@ -3771,12 +4075,17 @@ static void load_gatt_db(struct btd_device *device, const char *local,
 		return;
 	}
 
-	if (load_gatt_db_impl(key_file, keys, device->db))
+	err = load_gatt_db_impl(key_file, keys, device->db);
+	if (err)
 		warn("Unable to load gatt db from file for %s", peer);
 
 	g_strfreev(keys);
 	g_key_file_free(key_file);
 
+	if (!err)
+		store_gatt_db(device);
+
+done:
 	g_slist_free_full(device->primaries, g_free);
 	device->primaries = NULL;
 	gatt_db_foreach_service(device->db, NULL, add_primary,
@@ -4237,8 +4546,10 @@ void device_update_addr(struct btd_device *device, const bdaddr_t *bdaddr,
 	 */
 	device->le = true;
 
+	adapter_unindex_device_addr(device->adapter, device);
 	bacpy(&device->bdaddr, bdaddr);
 	device->bdaddr_type = bdaddr_type;
+	adapter_index_device_addr(device->adapter, device);
 
 	store_device_info(device);
 
@@ -5192,6 +5503,10 @@ static void gatt_client_init(struct btd_device *device)
 
 	bt_gatt_client_set_debug(device->client, gatt_debug, NULL, NULL);
 
+	if (btd_opts.gatt_parallel_discovery)
+		bt_gatt_client_set_parallel_discovery(device->client,
+							btd_opts.gatt_channels);
+
 	/*
 	 * Notify notify existing service about the new connection so they can
 	 * react to notifications while discovering services
@@ -5653,6 +5968,17 @@ const bdaddr_t *device_get_address(struct btd_device *device)
 {
 	return &device->bdaddr;
 }
+
+/* Returns the address used by the last connection if it differs */
+const bdaddr_t *device_get_conn_address(struct btd_device *device)
+{
+	if (!bacmp(&device->conn_bdaddr, BDADDR_ANY) ||
+			!bacmp(&device->conn_bdaddr, &device->bdaddr))
+		return NULL;
+
+	return &device->conn_bdaddr;
+}
+
 uint8_t device_get_le_address_type(struct btd_device *device)
 {
 	return device->bdaddr_type;
@@ -5895,6 +6221,56 @@ void device_set_rssi(struct btd_device *device, int8_t rssi)
 	device_set_rssi_with_delta(device, rssi, RSSI_THRESHOLD);
 }
 
+/* FNV-1a hash of the report length and data */
+static uint64_t report_hash(const uint8_t *data, uint8_t len)
+{
+	uint64_t hash = REPORT_HASH_OFFSET;
+	uint8_t i;
+
+	hash = (hash ^ len) * REPORT_HASH_PRIME;
+
+	for (i = 0; i < len; i++)
+		hash = (hash ^ data[i]) * REPORT_HASH_PRIME;
+
+	return hash;
+}
+
+/*
+ * Checks if an advertising report needs to be processed. Returns -EALREADY
+ * if it has the same data as the last processed report and its RSSI is
+ * within rssi_hysteresis dBm of the current one (0 disables the check), or
+ * -EBUSY if processing it would exceed max_rate reports per second (0 for no
+ * limit). Otherwise the report is recorded as processed and 0 is returned.
+ */
+int device_filter_report(struct btd_device *device, const uint8_t *data,
+					uint8_t len, int8_t rssi,
+					uint8_t rssi_hysteresis,
+					unsigned int max_rate)
+{
+	uint64_t hash = report_hash(data, len);
+	struct timespec now;
+
+	if (rssi_hysteresis && device->rssi && hash == device->report_hash &&
+				abs(rssi - device->rssi) < rssi_hysteresis)
+		return -EALREADY;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	if (max_rate) {
+		long long msec;
+
+		msec = (now.tv_sec - device->report_time.tv_sec) * 1000LL +
+			(now.tv_nsec - device->report_time.tv_nsec) / 1000000;
+		if (msec * max_rate < 1000)
+			return -EBUSY;
+	}
+
+	device->report_hash = hash;
+	device->report_time = now;
+
+	return 0;
+}
+
 void device_set_tx_power(struct btd_device *device, int8_t tx_power)
 {
 	if (!device)
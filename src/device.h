@@ -67,17 +67,22 @@ void btd_device_gatt_set_service_changed(struct btd_device *device,
 						uint16_t start, uint16_t end);
 bool device_attach_att(struct btd_device *dev, GIOChannel *io);
 void btd_device_add_uuid(struct btd_device *device, const char *uuid);
+void device_add_eir_uuid(struct btd_device *dev, const char *uuid);
 void device_add_eir_uuids(struct btd_device *dev, GSList *uuids);
-void device_set_manufacturer_data(struct btd_device *dev, GSList *list,
-							bool duplicate);
-void device_set_service_data(struct btd_device *dev, GSList *list,
-							bool duplicate);
-void device_set_data(struct btd_device *dev, GSList *list,
-							bool duplicate);
+void device_clear_manufacturer_data(struct btd_device *dev);
+void device_add_manufacturer_data(struct btd_device *dev, uint16_t company,
+					const uint8_t *data, uint8_t len);
+void device_clear_service_data(struct btd_device *dev);
+void device_add_service_data(struct btd_device *dev, const char *uuid,
+					const uint8_t *data, uint8_t len);
+void device_clear_data(struct btd_device *dev);
+void device_add_data(struct btd_device *dev, uint8_t type,
+					const uint8_t *data, uint8_t len);
 void device_probe_profile(gpointer a, gpointer b);
 void device_remove_profile(gpointer a, gpointer b);
 struct btd_adapter *device_get_adapter(struct btd_device *device);
 const bdaddr_t *device_get_address(struct btd_device *device);
+const bdaddr_t *device_get_conn_address(struct btd_device *device);
 uint8_t device_get_le_address_type(struct btd_device *device);
 const char *device_get_path(const struct btd_device *device);
 gboolean device_is_temporary(struct btd_device *device);
@@ -94,6 +99,10 @@ void device_set_legacy(struct btd_device *device, bool legacy);
 void device_set_rssi_with_delta(struct btd_device *device, int8_t rssi,
 							int8_t delta_threshold);
 void device_set_rssi(struct btd_device *device, int8_t rssi);
+int device_filter_report(struct btd_device *device, const uint8_t *data,
+					uint8_t len, int8_t rssi,
+					uint8_t rssi_hysteresis,
+					unsigned int max_rate);
 void device_set_tx_power(struct btd_device *device, int8_t tx_power);
 void device_set_flags(struct btd_device *device, uint8_t flags);
 bool btd_device_is_connected(struct btd_device *dev);
@@ -24,6 +24,7 @@
 #include "lib/bluetooth.h"
 #include "lib/hci.h"
 #include "lib/sdp.h"
+#include "lib/uuid.h"
 
 #include "src/shared/util.h"
 #include "uuid-helper.h"
@@ -390,6 +391,394 @@ int eir_parse_oob(struct eir_data *eir, uint8_t *eir_data, uint16_t eir_len)
 	return 0;
 }
 
+static void view_foreach_field(const uint8_t *eir_data, uint16_t eir_len,
+					eir_field_func_t func, void *user_data)
+{
+	uint16_t len = 0;
+
+	if (eir_data == NULL)
+		return;
+
+	while (len < eir_len - 1) {
+		uint8_t field_len = eir_data[0];
+
+		/* Check for the end of EIR */
+		if (field_len == 0)
+			break;
+
+		len += field_len + 1;
+
+		/* Do not continue EIR Data parsing if got incorrect length */
+		if (len > eir_len)
+			break;
+
+		func(eir_data[1], &eir_data[2], field_len - 1, user_data);
+
+		eir_data += field_len + 1;
+	}
+}
+
+static void view_set_name(struct eir_view *view, const uint8_t *name,
+								uint8_t len)
+{
+	int i;
+
+	if (len > EIR_NAME_MAX_LEN)
+		len = EIR_NAME_MAX_LEN;
+
+	memcpy(view->name, name, len);
+	view->name[len] = '\0';
+
+	if (g_utf8_validate(view->name, len, NULL))
+		return;
+
+	/* Same as name2utf8() but using the view storage */
+	for (i = 0; view->name[i] != '\0'; i++) {
+		if (!isascii(view->name[i]))
+			view->name[i] = ' ';
+	}
+
+	g_strstrip(view->name);
+}
+
+static void view_parse_field(uint8_t type, const uint8_t *data, uint8_t len,
+							void *user_data)
+{
+	struct eir_view *view = user_data;
+
+	switch (type) {
+	case EIR_UUID16_SOME:
+	case EIR_UUID16_ALL:
+		view->num_uuids += len / 2;
+		break;
+
+	case EIR_UUID32_SOME:
+	case EIR_UUID32_ALL:
+		view->num_uuids += len / 4;
+		break;
+
+	case EIR_UUID128_SOME:
+	case EIR_UUID128_ALL:
+		view->num_uuids += len / 16;
+		break;
+
+	case EIR_FLAGS:
+		if (len > 0)
+			view->flags = *data;
+		break;
+
+	case EIR_NAME_SHORT:
+	case EIR_NAME_COMPLETE:
+		/* Some vendors put a NUL byte terminator into the name */
+		while (len > 0 && data[len - 1] == '\0')
+			len--;
+
+		view_set_name(view, data, len);
+		view->has_name = true;
+		view->name_complete = type == EIR_NAME_COMPLETE;
+		break;
+
+	case EIR_TX_POWER:
+		if (len < 1)
+			break;
+		view->tx_power = (int8_t) data[0];
+		break;
+
+	case EIR_CLASS_OF_DEV:
+		if (len < 3)
+			break;
+		view->class = data[0] | (data[1] << 8) | (data[2] << 16);
+		break;
+
+	case EIR_GAP_APPEARANCE:
+		if (len < 2)
+			break;
+		view->appearance = get_le16(data);
+		break;
+
+	case EIR_SSP_HASH:
+	case EIR_SSP_RANDOMIZER:
+		break;
+
+	case EIR_DEVICE_ID:
+		if (len < 8)
+			break;
+
+		view->did_source = get_le16(&data[0]);
+		view->did_vendor = get_le16(&data[2]);
+		view->did_product = get_le16(&data[4]);
+		view->did_version = get_le16(&data[6]);
+		break;
+
+	case EIR_SVC_DATA16:
+		if (len >= 2 && len <= EIR_SD_MAX_LEN)
+			view->num_sd++;
+		break;
+
+	case EIR_SVC_DATA32:
+		if (len >= 4 && len <= EIR_SD_MAX_LEN)
+			view->num_sd++;
+		break;
+
+	case EIR_SVC_DATA128:
+		if (len >= 16 && len <= EIR_SD_MAX_LEN)
+			view->num_sd++;
+		break;
+
+	case EIR_MANUFACTURER_DATA:
+		if (len >= 2 && len <= 2 + EIR_MSD_MAX_LEN)
+			view->num_msd++;
+		break;
+
+	default:
+		view->num_data++;
+		break;
+	}
+}
+
+/*
+ * Parses the scalar fields of the EIR or advertising data in a single pass
+ * without allocating anything. UUIDs, service data, manufacturer data and
+ * other fields are left in place and accessed with the eir_view_foreach_*
+ * helpers, which yield the same values eir_parse() would have put in its
+ * lists, the num_* counters being the length those lists would have had.
+ */
+void eir_view_parse(struct eir_view *view, const uint8_t *eir_data,
+							uint16_t eir_len)
+{
+	memset(view, 0, sizeof(*view));
+
+	view->data = eir_data;
+	view->len = eir_len;
+	view->tx_power = 127;
+
+	view_foreach_field(eir_data, eir_len, view_parse_field, view);
+}
+
+void eir_view_foreach(const struct eir_view *view, eir_field_func_t func,
+							void *user_data)
+{
+	view_foreach_field(view->data, view->len, func, user_data);
+}
+
+static void view_uuid_to_str(uuid_t *uuid, char *str)
+{
+	bt_uuid_t btuuid;
+	uint128_t u128;
+
+	switch (uuid->type) {
+	case SDP_UUID16:
+		bt_uuid16_create(&btuuid, uuid->value.uuid16);
+		break;
+	case SDP_UUID32:
+		bt_uuid32_create(&btuuid, uuid->value.uuid32);
+		break;
+	default:
+		memcpy(&u128, &uuid->value.uuid128, sizeof(u128));
+		bt_uuid128_create(&btuuid, u128);
+		break;
+	}
+
+	bt_uuid_to_string(&btuuid, str, MAX_LEN_UUID_STR);
+}
+
+/* Converts the UUID at data into its string form, returns its size */
+static uint8_t view_get_uuid(uint8_t type, const uint8_t *data, uint8_t len,
+								char *str)
+{
+	uuid_t uuid;
+	int k;
+
+	switch (type) {
+	case EIR_UUID16_SOME:
+	case EIR_UUID16_ALL:
+	case EIR_SVC_DATA16:
+		if (len < 2)
+			return 0;
+		uuid.type = SDP_UUID16;
+		uuid.value.uuid16 = get_le16(data);
+		break;
+	case EIR_UUID32_SOME:
+	case EIR_UUID32_ALL:
+	case EIR_SVC_DATA32:
+		if (len < 4)
+			return 0;
+		uuid.type = SDP_UUID32;
+		uuid.value.uuid32 = get_le32(data);
+		break;
+	case EIR_UUID128_SOME:
+	case EIR_UUID128_ALL:
+	case EIR_SVC_DATA128:
+		if (len < 16)
+			return 0;
+		uuid.type = SDP_UUID128;
+		for (k = 0; k < 16; k++)
+			uuid.value.uuid128.data[k] = data[16 - k - 1];
+		break;
+	default:
+		return 0;
+	}
+
+	view_uuid_to_str(&uuid, str);
+
+	return uuid.type == SDP_UUID16 ? 2 : uuid.type == SDP_UUID32 ? 4 : 16;
+}
+
+struct view_foreach_data {
+	eir_uuid_func_t uuid_func;
+	eir_sd_func_t sd_func;
+	eir_msd_func_t msd_func;
+	eir_field_func_t data_func;
+	void *user_data;
+};
+
+static void view_uuid_field(uint8_t type, const uint8_t *data, uint8_t len,
+							void *user_data)
+{
+	struct view_foreach_data *foreach = user_data;
+	char str[MAX_LEN_UUID_STR];
+	uint8_t size;
+
+	switch (type) {
+	case EIR_UUID16_SOME:
+	case EIR_UUID16_ALL:
+	case EIR_UUID32_SOME:
+	case EIR_UUID32_ALL:
+	case EIR_UUID128_SOME:
+	case EIR_UUID128_ALL:
+		break;
+	default:
+		return;
+	}
+
+	while ((size = view_get_uuid(type, data, len, str))) {
+		foreach->uuid_func(str, foreach->user_data);
+		data += size;
+		len -= size;
+	}
+}
+
+void eir_view_foreach_uuid(const struct eir_view *view, eir_uuid_func_t func,
+							void *user_data)
+{
+	struct view_foreach_data foreach = {
+		.uuid_func = func,
+		.user_data = user_data,
+	};
+
+	if (view->num_uuids)
+		eir_view_foreach(view, view_uuid_field, &foreach);
+}
+
+static void view_sd_field(uint8_t type, const uint8_t *data, uint8_t len,
+							void *user_data)
+{
+	struct view_foreach_data *foreach = user_data;
+	char str[MAX_LEN_UUID_STR];
+	uint8_t size;
+
+	switch (type) {
+	case EIR_SVC_DATA16:
+	case EIR_SVC_DATA32:
+	case EIR_SVC_DATA128:
+		break;
+	default:
+		return;
+	}
+
+	if (len > EIR_SD_MAX_LEN)
+		return;
+
+	size = view_get_uuid(type, data, len, str);
+	if (!size)
+		return;
+
+	foreach->sd_func(str, data + size, len - size, foreach->user_data);
+}
+
+void eir_view_foreach_sd(const struct eir_view *view, eir_sd_func_t func,
+							void *user_data)
+{
+	struct view_foreach_data foreach = {
+		.sd_func = func,
+		.user_data = user_data,
+	};
+
+	if (view->num_sd)
+		eir_view_foreach(view, view_sd_field, &foreach);
+}
+
+static void view_msd_field(uint8_t type, const uint8_t *data, uint8_t len,
+							void *user_data)
+{
+	struct view_foreach_data *foreach = user_data;
+
+	if (type != EIR_MANUFACTURER_DATA)
+		return;
+
+	if (len < 2 || len > 2 + EIR_MSD_MAX_LEN)
+		return;
+
+	foreach->msd_func(get_le16(data), data + 2, len - 2,
+							foreach->user_data);
+}
+
+void eir_view_foreach_msd(const struct eir_view *view, eir_msd_func_t func,
+							void *user_data)
+{
+	struct view_foreach_data foreach = {
+		.msd_func = func,
+		.user_data = user_data,
+	};
+
+	if (view->num_msd)
+		eir_view_foreach(view, view_msd_field, &foreach);
+}
+
+static void view_data_field(uint8_t type, const uint8_t *data, uint8_t len,
+							void *user_data)
+{
+	struct view_foreach_data *foreach = user_data;
+
+	switch (type) {
+	case EIR_UUID16_SOME:
+	case EIR_UUID16_ALL:
+	case EIR_UUID32_SOME:
+	case EIR_UUID32_ALL:
+	case EIR_UUID128_SOME:
+	case EIR_UUID128_ALL:
+	case EIR_FLAGS:
+	case EIR_NAME_SHORT:
+	case EIR_NAME_COMPLETE:
+	case EIR_TX_POWER:
+	case EIR_CLASS_OF_DEV:
+	case EIR_GAP_APPEARANCE:
+	case EIR_SSP_HASH:
+	case EIR_SSP_RANDOMIZER:
+	case EIR_DEVICE_ID:
+	case EIR_SVC_DATA16:
+	case EIR_SVC_DATA32:
+	case EIR_SVC_DATA128:
+	case EIR_MANUFACTURER_DATA:
+		return;
+	}
+
+	foreach->data_func(type, data, len, foreach->user_data);
+}
+
+/* Iterates over the fields eir_parse() would have put in data_list */
+void eir_view_foreach_data(const struct eir_view *view, eir_field_func_t func,
+							void *user_data)
+{
+	struct view_foreach_data foreach = {
+		.data_func = func,
+		.user_data = user_data,
+	};
+
+	if (view->num_data)
+		eir_view_foreach(view, view_data_field, &foreach);
+}
+
 #define SIZEOF_UUID128 16
 
 static void eir_generate_uuid128(sdp_list_t *list, uint8_t *ptr,
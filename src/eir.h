@@ -50,6 +50,7 @@
 
 #define EIR_SD_MAX_LEN              238  /* 240 (EIR) - 2 (len) */
 #define EIR_MSD_MAX_LEN             236  /* 240 (EIR) - 2 (len & type) - 2 */
+#define EIR_NAME_MAX_LEN            248
 
 struct eir_msd {
 	uint16_t company;
@@ -89,8 +90,49 @@ struct eir_data {
 	GSList *data_list;
 };
 
+/* Allocation free view of EIR or advertising data, see eir_view_parse() */
+struct eir_view {
+	const uint8_t *data;
+	uint16_t len;
+	unsigned int flags;
+	char name[EIR_NAME_MAX_LEN + 1];
+	bool has_name;
+	bool name_complete;
+	uint32_t class;
+	uint16_t appearance;
+	int8_t tx_power;
+	uint16_t did_vendor;
+	uint16_t did_product;
+	uint16_t did_version;
+	uint16_t did_source;
+	unsigned int num_uuids;
+	unsigned int num_sd;
+	unsigned int num_msd;
+	unsigned int num_data;
+};
+
+typedef void (*eir_field_func_t)(uint8_t type, const uint8_t *data,
+						uint8_t len, void *user_data);
+typedef void (*eir_uuid_func_t)(const char *uuid, void *user_data);
+typedef void (*eir_sd_func_t)(const char *uuid, const uint8_t *data,
+						uint8_t len, void *user_data);
+typedef void (*eir_msd_func_t)(uint16_t company, const uint8_t *data,
+						uint8_t len, void *user_data);
+
 void eir_data_free(struct eir_data *eir);
 void eir_parse(struct eir_data *eir, const uint8_t *eir_data, uint8_t eir_len);
+void eir_view_parse(struct eir_view *view, const uint8_t *eir_data,
+							uint16_t eir_len);
+void eir_view_foreach(const struct eir_view *view, eir_field_func_t func,
+							void *user_data);
+void eir_view_foreach_uuid(const struct eir_view *view, eir_uuid_func_t func,
+							void *user_data);
+void eir_view_foreach_sd(const struct eir_view *view, eir_sd_func_t func,
+							void *user_data);
+void eir_view_foreach_msd(const struct eir_view *view, eir_msd_func_t func,
+							void *user_data);
+void eir_view_foreach_data(const struct eir_view *view, eir_field_func_t func,
+							void *user_data);
 int eir_parse_oob(struct eir_data *eir, uint8_t *eir_data, uint16_t eir_len);
 int eir_create_oob(const bdaddr_t *addr, const char *name, uint32_t cod,
 			const uint8_t *hash, const uint8_t *randomizer,
@@ -13,6 +13,7 @@
 #endif
 
 #include <stdint.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <errno.h>
 #include <unistd.h>
@@ -1137,6 +1138,7 @@ static void db_hash_read_cb(struct gatt_db_attribute *attrib,
 					void *user_data)
 {
 	struct btd_gatt_database *database = user_data;
+	struct gatt_db_hash_stats stats;
 	const uint8_t *hash;
 	struct device_state *state;
 	bdaddr_t bdaddr;
@@ -1146,6 +1148,12 @@ static void db_hash_read_cb(struct gatt_db_attribute *attrib,
 
 	hash = gatt_db_get_hash(database->db);
 
+	if (gatt_db_get_hash_stats(database->db, &stats))
+		DBG("Database Hash updates %u services hashed %u "
+				"time %" PRIu64 " us (max %" PRIu64 " us)",
+				stats.updates, stats.services_hashed,
+				stats.total_time, stats.max_time);
+
 	gatt_db_attribute_read_result(attrib, id, 0, hash, 16);
 
 	if (!get_dst_info(att, &bdaddr, &bdaddr_type))
@@ -56,6 +56,7 @@
 #define DEFAULT_PAIRABLE_TIMEOUT       0 /* disabled */
 #define DEFAULT_DISCOVERABLE_TIMEOUT 180 /* 3 minutes */
 #define DEFAULT_TEMPORARY_TIMEOUT     30 /* 30 seconds */
+#define DEFAULT_REPORT_HYSTERESIS      8 /* 8 dBm */
 
 #define SHUTDOWN_GRACE_SECONDS 10
 
@@ -79,6 +80,8 @@ static const char *supported_options[] = {
 	"Privacy",
 	"JustWorksRepairing",
 	"TemporaryTimeout",
+	"DiscoveryRSSIHysteresis",
+	"DiscoveryMaxReportRate",
 	NULL
 };
 
@@ -135,6 +138,7 @@ static const char *gatt_options[] = {
 	"KeySize",
 	"ExchangeMTU",
 	"Channels",
+	"ParallelDiscovery",
 	NULL
 };
 
@@ -617,6 +621,30 @@ static void parse_config(GKeyFile *config)
 		btd_opts.tmpto = val;
 	}
 
+	val = g_key_file_get_integer(config, "General",
+					"DiscoveryRSSIHysteresis", &err);
+	if (err) {
+		DBG("%s", err->message);
+		g_clear_error(&err);
+	} else {
+		val = MAX(val, 0);
+		val = MIN(val, INT8_MAX);
+		DBG("report_hysteresis=%d", val);
+		btd_opts.report_hysteresis = val;
+	}
+
+	val = g_key_file_get_integer(config, "General",
+					"DiscoveryMaxReportRate", &err);
+	if (err) {
+		DBG("%s", err->message);
+		g_clear_error(&err);
+	} else {
+		val = MAX(val, 0);
+		val = MIN(val, UINT16_MAX);
+		DBG("report_rate=%d", val);
+		btd_opts.report_rate = val;
+	}
+
 	str = g_key_file_get_string(config, "General", "Name", &err);
 	if (err) {
 		DBG("%s", err->message);
@@ -752,6 +780,13 @@ static void parse_config(GKeyFile *config)
 		btd_opts.gatt_channels = val;
 	}
 
+	boolean = g_key_file_get_boolean(config, "GATT",
+						"ParallelDiscovery", &err);
+	if (err)
+		g_clear_error(&err);
+	else
+		btd_opts.gatt_parallel_discovery = boolean;
+
 	str = g_key_file_get_string(config, "AVDTP", "SessionMode", &err);
 	if (err) {
 		DBG("%s", err->message);
@@ -801,6 +836,7 @@ static void init_defaults(void)
 	btd_opts.pairto = DEFAULT_PAIRABLE_TIMEOUT;
 	btd_opts.discovto = DEFAULT_DISCOVERABLE_TIMEOUT;
 	btd_opts.tmpto = DEFAULT_TEMPORARY_TIMEOUT;
+	btd_opts.report_hysteresis = DEFAULT_REPORT_HYSTERESIS;
 	btd_opts.reverse_discovery = TRUE;
 	btd_opts.name_resolv = TRUE;
 	btd_opts.debug_keys = FALSE;
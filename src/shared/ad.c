@@ -1143,3 +1143,346 @@ struct bt_ad_pattern *bt_ad_pattern_match(struct bt_ad *ad,
 
 	return info.matched_pattern;
 }
+
+/* Returns the next AD field at *offset with the same rules as
+ * bt_ad_new_with_data, or NULL once the end of the data is reached.
+ */
+static const uint8_t *ad_next_field(const uint8_t *data, size_t len,
+							size_t *offset)
+{
+	const uint8_t *field;
+
+	if (*offset + 1 >= len || !data[*offset])
+		return NULL;
+
+	field = &data[*offset];
+	*offset += field[0] + 1;
+
+	if (*offset > len)
+		return NULL;
+
+	return field;
+}
+
+/* Returns the field bt_ad_new_with_data would have stored for type */
+static const uint8_t *ad_find_field(const uint8_t *data, size_t len,
+						size_t end, uint8_t type)
+{
+	const uint8_t *field, *last = NULL;
+	size_t offset = 0;
+
+	while (offset < end && (field = ad_next_field(data, len, &offset))) {
+		if (field[1] == type)
+			last = field;
+	}
+
+	return last;
+}
+
+/* Checks the data would have been accepted by bt_ad_new_with_data */
+static bool ad_data_is_valid(const uint8_t *data, size_t len)
+{
+	const uint8_t *field, *prev;
+	size_t offset = 0, start;
+
+	while (1) {
+		start = offset;
+
+		field = ad_next_field(data, len, &offset);
+		if (!field)
+			break;
+
+		if (!ad_is_type_valid(field[1]))
+			return false;
+
+		/* Repeating the current value of a type is rejected */
+		prev = ad_find_field(data, len, start, field[1]);
+		if (prev && prev[0] == field[0] &&
+				!memcmp(&prev[2], &field[2], field[0] - 1))
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Same as bt_ad_pattern_match but works directly on the raw advertising data
+ * so no bt_ad needs to be allocated for each report.
+ */
+struct bt_ad_pattern *bt_ad_pattern_match_data(const uint8_t *data,
+						size_t len,
+						struct queue *patterns)
+{
+	const struct queue_entry *entry;
+
+	if (!data || !len || queue_isempty(patterns))
+		return NULL;
+
+	if (!ad_data_is_valid(data, len))
+		return NULL;
+
+	for (entry = queue_get_entries(patterns); entry;
+						entry = entry->next) {
+		struct bt_ad_pattern *pattern = entry->data;
+		const uint8_t *field;
+
+		if (!pattern)
+			continue;
+
+		field = ad_find_field(data, len, len, pattern->type);
+		if (!field)
+			continue;
+
+		if (field[0] - 1 < pattern->offset + pattern->len)
+			continue;
+
+		if (!memcmp(&field[2] + pattern->offset, pattern->data,
+								pattern->len))
+			return pattern;
+	}
+
+	return NULL;
+}
+
+/*
+ * Patterns are anchored at a fixed offset of a field, so instead of a content
+ * automaton they are indexed by AD type, then offset, then first byte. Only
+ * the patterns sharing all three need to be compared for each report.
+ */
+struct matcher_pattern {
+	unsigned int entry;
+	uint8_t len;
+	uint8_t data[BT_AD_MAX_DATA_LEN];
+	struct matcher_pattern *next;
+};
+
+struct matcher_offset {
+	uint8_t offset;
+	struct matcher_pattern *patterns[256];	/* By first byte */
+	struct matcher_offset *next;		/* Sorted by offset */
+};
+
+struct bt_ad_matcher {
+	struct matcher_offset *types[256];	/* By AD type */
+	void **entries;
+	unsigned long *matched;
+	unsigned int num_entries;
+	unsigned int max_entries;
+};
+
+#define MATCHER_LONG_BITS	(sizeof(unsigned long) * 8)
+#define MATCHER_LONGS(n)	(((n) + MATCHER_LONG_BITS - 1) / \
+							MATCHER_LONG_BITS)
+
+struct bt_ad_matcher *bt_ad_matcher_new(void)
+{
+	return new0(struct bt_ad_matcher, 1);
+}
+
+void bt_ad_matcher_free(struct bt_ad_matcher *matcher)
+{
+	unsigned int i, j;
+
+	if (!matcher)
+		return;
+
+	for (i = 0; i < ARRAY_SIZE(matcher->types); i++) {
+		struct matcher_offset *node = matcher->types[i];
+
+		while (node) {
+			struct matcher_offset *next = node->next;
+
+			for (j = 0; j < ARRAY_SIZE(node->patterns); j++) {
+				struct matcher_pattern *p = node->patterns[j];
+
+				while (p) {
+					struct matcher_pattern *tmp = p->next;
+
+					free(p);
+					p = tmp;
+				}
+			}
+
+			free(node);
+			node = next;
+		}
+	}
+
+	free(matcher->entries);
+	free(matcher->matched);
+	free(matcher);
+}
+
+static struct matcher_offset *matcher_get_offset(struct bt_ad_matcher *matcher,
+						uint8_t type, uint8_t offset)
+{
+	struct matcher_offset **node = &matcher->types[type];
+	struct matcher_offset *new_node;
+
+	while (*node && (*node)->offset < offset)
+		node = &(*node)->next;
+
+	if (*node && (*node)->offset == offset)
+		return *node;
+
+	new_node = new0(struct matcher_offset, 1);
+	new_node->offset = offset;
+	new_node->next = *node;
+	*node = new_node;
+
+	return new_node;
+}
+
+static bool matcher_grow(struct bt_ad_matcher *matcher)
+{
+	unsigned int max = matcher->max_entries ? matcher->max_entries * 2 : 16;
+	void **entries;
+	unsigned long *matched;
+
+	entries = realloc(matcher->entries, max * sizeof(*entries));
+	if (!entries)
+		return false;
+
+	matcher->entries = entries;
+
+	matched = realloc(matcher->matched, MATCHER_LONGS(max) *
+							sizeof(*matched));
+	if (!matched)
+		return false;
+
+	matcher->matched = matched;
+	matcher->max_entries = max;
+
+	return true;
+}
+
+/*
+ * Adds an entry matching when any of the patterns would match according to
+ * bt_ad_pattern_match_data. The patterns are copied so the queue does not
+ * need to outlive the matcher.
+ */
+bool bt_ad_matcher_add(struct bt_ad_matcher *matcher, struct queue *patterns,
+							void *user_data)
+{
+	const struct queue_entry *entry;
+	unsigned int index;
+
+	if (!matcher || queue_isempty(patterns))
+		return false;
+
+	for (entry = queue_get_entries(patterns); entry;
+						entry = entry->next) {
+		struct bt_ad_pattern *pattern = entry->data;
+
+		if (!pattern || !pattern->len)
+			return false;
+	}
+
+	if (matcher->num_entries == matcher->max_entries &&
+						!matcher_grow(matcher))
+		return false;
+
+	index = matcher->num_entries++;
+	matcher->entries[index] = user_data;
+
+	for (entry = queue_get_entries(patterns); entry;
+						entry = entry->next) {
+		struct bt_ad_pattern *pattern = entry->data;
+		struct matcher_offset *node;
+		struct matcher_pattern *p;
+
+		node = matcher_get_offset(matcher, pattern->type,
+							pattern->offset);
+
+		p = new0(struct matcher_pattern, 1);
+		p->entry = index;
+		p->len = pattern->len;
+		memcpy(p->data, pattern->data, pattern->len);
+
+		p->next = node->patterns[p->data[0]];
+		node->patterns[p->data[0]] = p;
+	}
+
+	return true;
+}
+
+/* Checks no later field of the same type overrides the one ending at offset */
+static bool ad_field_is_last(const uint8_t *data, size_t len, size_t offset,
+								uint8_t type)
+{
+	const uint8_t *field;
+
+	while ((field = ad_next_field(data, len, &offset))) {
+		if (field[1] == type)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Calls func with the user_data of every entry matching the raw advertising
+ * data, once per entry and in the order they were added. Returns true if any
+ * entry matched.
+ */
+bool bt_ad_matcher_match(struct bt_ad_matcher *matcher, const uint8_t *data,
+					size_t len, bt_ad_func_t func,
+					void *user_data)
+{
+	const uint8_t *field;
+	size_t offset = 0;
+	bool found = false;
+	unsigned int i;
+
+	if (!matcher || !matcher->num_entries || !data || !len)
+		return false;
+
+	if (!ad_data_is_valid(data, len))
+		return false;
+
+	memset(matcher->matched, 0, MATCHER_LONGS(matcher->num_entries) *
+						sizeof(*matcher->matched));
+
+	while ((field = ad_next_field(data, len, &offset))) {
+		const struct matcher_offset *node = matcher->types[field[1]];
+		size_t field_len = field[0] - 1;
+
+		if (!node || !ad_field_is_last(data, len, offset, field[1]))
+			continue;
+
+		for (; node && node->offset < field_len; node = node->next) {
+			const uint8_t *value = &field[2] + node->offset;
+			const struct matcher_pattern *p;
+
+			for (p = node->patterns[value[0]]; p; p = p->next) {
+				unsigned long bit = 1UL << (p->entry %
+							MATCHER_LONG_BITS);
+				unsigned long *word = &matcher->matched[
+						p->entry / MATCHER_LONG_BITS];
+
+				if (*word & bit)
+					continue;
+
+				if (field_len < node->offset + p->len)
+					continue;
+
+				if (memcmp(value + 1, p->data + 1, p->len - 1))
+					continue;
+
+				*word |= bit;
+				found = true;
+			}
+		}
+	}
+
+	if (!found || !func)
+		return found;
+
+	for (i = 0; i < matcher->num_entries; i++) {
+		if (matcher->matched[i / MATCHER_LONG_BITS] &
+					(1UL << (i % MATCHER_LONG_BITS)))
+			func(matcher->entries[i], user_data);
+	}
+
+	return true;
+}
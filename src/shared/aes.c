@@ -0,0 +1,370 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+
+#include "src/shared/aes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <wmmintrin.h>
+#define HAVE_AES_NI
+#endif
+
+static const uint8_t sbox[256] = {
+	0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5,
+	0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+	0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+	0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+	0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc,
+	0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+	0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a,
+	0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+	0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+	0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+	0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b,
+	0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+	0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85,
+	0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+	0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+	0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+	0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17,
+	0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+	0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88,
+	0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+	0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+	0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+	0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9,
+	0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+	0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6,
+	0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+	0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+	0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+	0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94,
+	0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+	0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68,
+	0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+static const uint8_t rcon[10] = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36,
+};
+
+static inline uint8_t xtime(uint8_t x)
+{
+	return (x << 1) ^ ((x & 0x80) ? 0x1b : 0x00);
+}
+
+static void soft_set_key(uint8_t *rk, const uint8_t k[16])
+{
+	int i;
+
+	memcpy(rk, k, 16);
+
+	for (i = 16; i < 11 * 16; i += 4) {
+		uint8_t t[4];
+
+		memcpy(t, &rk[i - 4], 4);
+
+		if (!(i % 16)) {
+			uint8_t tmp = t[0];
+
+			t[0] = sbox[t[1]] ^ rcon[i / 16 - 1];
+			t[1] = sbox[t[2]];
+			t[2] = sbox[t[3]];
+			t[3] = sbox[tmp];
+		}
+
+		rk[i + 0] = rk[i - 16] ^ t[0];
+		rk[i + 1] = rk[i - 15] ^ t[1];
+		rk[i + 2] = rk[i - 14] ^ t[2];
+		rk[i + 3] = rk[i - 13] ^ t[3];
+	}
+}
+
+static void soft_encrypt(const uint8_t *rk, const uint8_t in[16],
+							uint8_t out[16])
+{
+	uint8_t s[16], t[16];
+	int round, i;
+
+	for (i = 0; i < 16; i++)
+		s[i] = in[i] ^ rk[i];
+
+	for (round = 1; round <= 10; round++) {
+		/* SubBytes and ShiftRows */
+		for (i = 0; i < 16; i++)
+			t[i] = sbox[s[(i + 4 * (i % 4)) % 16]];
+
+		/* MixColumns, skipped in the last round */
+		if (round < 10) {
+			for (i = 0; i < 16; i += 4) {
+				uint8_t a0 = t[i], a1 = t[i + 1];
+				uint8_t a2 = t[i + 2], a3 = t[i + 3];
+				uint8_t all = a0 ^ a1 ^ a2 ^ a3;
+
+				t[i + 0] ^= all ^ xtime(a0 ^ a1);
+				t[i + 1] ^= all ^ xtime(a1 ^ a2);
+				t[i + 2] ^= all ^ xtime(a2 ^ a3);
+				t[i + 3] ^= all ^ xtime(a3 ^ a0);
+			}
+		}
+
+		/* AddRoundKey */
+		for (i = 0; i < 16; i++)
+			s[i] = t[i] ^ rk[round * 16 + i];
+	}
+
+	memcpy(out, s, 16);
+}
+
+#ifdef HAVE_AES_NI
+#define AES_NI_TARGET __attribute__((target("aes,sse2")))
+
+static AES_NI_TARGET __m128i ni_expand(__m128i key, __m128i assist)
+{
+	assist = _mm_shuffle_epi32(assist, 0xff);
+	key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+	key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+	key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+
+	return _mm_xor_si128(key, assist);
+}
+
+#define NI_EXPAND(rk, i, rc) \
+	rk[i] = ni_expand(rk[i - 1], _mm_aeskeygenassist_si128(rk[i - 1], rc))
+
+static AES_NI_TARGET void ni_set_key(uint8_t *out, const uint8_t k[16])
+{
+	__m128i rk[11];
+	int i;
+
+	rk[0] = _mm_loadu_si128((const __m128i *) k);
+	NI_EXPAND(rk, 1, 0x01);
+	NI_EXPAND(rk, 2, 0x02);
+	NI_EXPAND(rk, 3, 0x04);
+	NI_EXPAND(rk, 4, 0x08);
+	NI_EXPAND(rk, 5, 0x10);
+	NI_EXPAND(rk, 6, 0x20);
+	NI_EXPAND(rk, 7, 0x40);
+	NI_EXPAND(rk, 8, 0x80);
+	NI_EXPAND(rk, 9, 0x1b);
+	NI_EXPAND(rk, 10, 0x36);
+
+	for (i = 0; i < 11; i++)
+		_mm_store_si128((__m128i *) &out[i * 16], rk[i]);
+}
+
+static AES_NI_TARGET void ni_encrypt(const uint8_t *rk, const uint8_t in[16],
+							uint8_t out[16])
+{
+	__m128i s;
+	int i;
+
+	s = _mm_loadu_si128((const __m128i *) in);
+	s = _mm_xor_si128(s, _mm_load_si128((const __m128i *) rk));
+
+	for (i = 1; i < 10; i++)
+		s = _mm_aesenc_si128(s,
+				_mm_load_si128((const __m128i *) &rk[i * 16]));
+
+	s = _mm_aesenclast_si128(s,
+				_mm_load_si128((const __m128i *) &rk[10 * 16]));
+
+	_mm_storeu_si128((__m128i *) out, s);
+}
+
+#define NI_ROUND(s, k, r) \
+	s = _mm_aesenc_si128(s, _mm_load_si128((const __m128i *) &k[r * 16]))
+
+#define NI_LAST(s, k) \
+	s = _mm_aesenclast_si128(s, _mm_load_si128((const __m128i *) &k[160]))
+
+/* Interleaves four independent keys to keep the AES unit pipeline busy */
+static AES_NI_TARGET void ni_encrypt_keys(const struct bt_aes_key *keys,
+						size_t num, const uint8_t in[16],
+						uint8_t (*out)[16])
+{
+	__m128i p, s0, s1, s2, s3;
+	size_t i;
+	int r;
+
+	p = _mm_loadu_si128((const __m128i *) in);
+
+	for (i = 0; i + 4 <= num; i += 4) {
+		const uint8_t *k0 = keys[i].rk, *k1 = keys[i + 1].rk;
+		const uint8_t *k2 = keys[i + 2].rk, *k3 = keys[i + 3].rk;
+
+		s0 = _mm_xor_si128(p, _mm_load_si128((const __m128i *) k0));
+		s1 = _mm_xor_si128(p, _mm_load_si128((const __m128i *) k1));
+		s2 = _mm_xor_si128(p, _mm_load_si128((const __m128i *) k2));
+		s3 = _mm_xor_si128(p, _mm_load_si128((const __m128i *) k3));
+
+		for (r = 1; r < 10; r++) {
+			NI_ROUND(s0, k0, r);
+			NI_ROUND(s1, k1, r);
+			NI_ROUND(s2, k2, r);
+			NI_ROUND(s3, k3, r);
+		}
+
+		NI_LAST(s0, k0);
+		NI_LAST(s1, k1);
+		NI_LAST(s2, k2);
+		NI_LAST(s3, k3);
+
+		_mm_storeu_si128((__m128i *) out[i], s0);
+		_mm_storeu_si128((__m128i *) out[i + 1], s1);
+		_mm_storeu_si128((__m128i *) out[i + 2], s2);
+		_mm_storeu_si128((__m128i *) out[i + 3], s3);
+	}
+
+	for (; i < num; i++)
+		ni_encrypt(keys[i].rk, in, out[i]);
+}
+#endif
+
+bool bt_aes_ni_supported(void)
+{
+#ifdef HAVE_AES_NI
+	static int supported = -1;
+
+	if (supported < 0) {
+		__builtin_cpu_init();
+		supported = __builtin_cpu_supports("aes") &&
+					__builtin_cpu_supports("sse2");
+	}
+
+	return supported;
+#else
+	return false;
+#endif
+}
+
+void bt_aes_set_key(struct bt_aes_key *key, const uint8_t k[16])
+{
+	key->ni = bt_aes_ni_supported();
+
+#ifdef HAVE_AES_NI
+	if (key->ni) {
+		ni_set_key(key->rk, k);
+		return;
+	}
+#endif
+
+	soft_set_key(key->rk, k);
+}
+
+void bt_aes_encrypt(const struct bt_aes_key *key, const uint8_t in[16],
+							uint8_t out[16])
+{
+#ifdef HAVE_AES_NI
+	if (key->ni) {
+		ni_encrypt(key->rk, in, out);
+		return;
+	}
+#endif
+
+	soft_encrypt(key->rk, in, out);
+}
+
+void bt_aes_encrypt_keys(const struct bt_aes_key *keys, size_t num,
+				const uint8_t in[16], uint8_t (*out)[16])
+{
+	size_t i;
+
+	if (!num)
+		return;
+
+#ifdef HAVE_AES_NI
+	if (keys[0].ni) {
+		ni_encrypt_keys(keys, num, in, out);
+		return;
+	}
+#endif
+
+	for (i = 0; i < num; i++)
+		soft_encrypt(keys[i].rk, in, out[i]);
+}
+
+static void cmac_subkey(const uint8_t in[16], uint8_t out[16])
+{
+	uint8_t msb = in[0] & 0x80;
+	int i;
+
+	for (i = 0; i < 15; i++)
+		out[i] = (in[i] << 1) | (in[i + 1] >> 7);
+
+	out[15] = in[15] << 1;
+
+	if (msb)
+		out[15] ^= 0x87;
+}
+
+void bt_aes_cmac(const uint8_t k[16], const struct iovec *iov,
+					size_t iov_len, uint8_t res[16])
+{
+	struct bt_aes_key key;
+	uint8_t x[16] = {}, block[16], l[16], subkey[16];
+	size_t i, len = 0;
+
+	bt_aes_set_key(&key, k);
+
+	/*
+	 * Process every full block as soon as more data is known to follow
+	 * it, the last (possibly partial) block is kept for the final step.
+	 */
+	for (i = 0; i < iov_len; i++) {
+		const uint8_t *data = iov[i].iov_base;
+		size_t left = iov[i].iov_len;
+
+		while (left) {
+			size_t n;
+
+			if (len == 16) {
+				int j;
+
+				for (j = 0; j < 16; j++)
+					x[j] ^= block[j];
+
+				bt_aes_encrypt(&key, x, x);
+				len = 0;
+			}
+
+			n = 16 - len;
+			if (n > left)
+				n = left;
+
+			memcpy(&block[len], data, n);
+			len += n;
+			data += n;
+			left -= n;
+		}
+	}
+
+	memset(l, 0, sizeof(l));
+	bt_aes_encrypt(&key, l, l);
+	cmac_subkey(l, subkey);
+
+	if (len < 16) {
+		/* Incomplete last block: pad and use K2 */
+		cmac_subkey(subkey, subkey);
+
+		block[len++] = 0x80;
+		memset(&block[len], 0, 16 - len);
+	}
+
+	for (i = 0; i < 16; i++)
+		x[i] ^= block[i] ^ subkey[i];
+
+	bt_aes_encrypt(&key, x, res);
+}
@@ -0,0 +1,39 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+/*
+ * Userspace AES-128 implementation used to avoid the kernel crypto API round
+ * trips for single block operations. All keys and blocks are in the byte
+ * order defined by FIPS-197, i.e. most significant octet first.
+ */
+
+struct bt_aes_key {
+	uint8_t rk[11 * 16] __attribute__((aligned(16)));
+	bool ni;
+};
+
+/* Returns true if AES-NI instructions are used for block encryption */
+bool bt_aes_ni_supported(void);
+
+void bt_aes_set_key(struct bt_aes_key *key, const uint8_t k[16]);
+void bt_aes_encrypt(const struct bt_aes_key *key, const uint8_t in[16],
+							uint8_t out[16]);
+
+/* Encrypts the same block with each of the num keys */
+void bt_aes_encrypt_keys(const struct bt_aes_key *keys, size_t num,
+				const uint8_t in[16], uint8_t (*out)[16]);
+
+/* AES-CMAC as defined in RFC 4493 over the concatenation of iov */
+void bt_aes_cmac(const uint8_t k[16], const struct iovec *iov,
+					size_t iov_len, uint8_t res[16]);
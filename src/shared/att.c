@@ -34,6 +34,14 @@
 /* Length of signature in write signed packet */
 #define BT_ATT_SIGNATURE_LEN		12
 
+/* Send operations kept around for reuse, per bt_att */
+#define ATT_OP_POOL_SIZE		16
+
+/* Most payload segments written without copying them first */
+#define ATT_SEND_IOV_MAX		4
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
 struct att_send_op;
 
 struct bt_att_chan {
@@ -53,6 +61,12 @@ struct bt_att_chan {
 
 	uint8_t *buf;
 	uint16_t mtu;
+
+	uint64_t tx_pdus;		/* Traffic counters for bt_att_stats */
+	uint64_t tx_octets;
+	uint64_t rx_pdus;
+	uint64_t rx_octets;
+	uint64_t requests;
 };
 
 struct bt_att {
@@ -71,6 +85,8 @@ struct bt_att {
 	struct queue *req_queue;	/* Queued ATT protocol requests */
 	struct queue *ind_queue;	/* Queued ATT protocol indications */
 	struct queue *write_queue;	/* Queue of PDUs ready to send */
+	struct queue *op_pool;		/* Send operations free for reuse */
+	struct queue *pins;		/* Handles pinned to a channel */
 	bool in_disc;			/* Cleanup queues on disconnect_cb */
 
 	bt_att_timeout_func_t timeout_callback;
@@ -81,6 +97,11 @@ struct bt_att {
 	bt_att_destroy_func_t debug_destroy;
 	void *debug_data;
 
+	unsigned int stats_id;
+	bt_att_stats_func_t stats_callback;
+	bt_att_destroy_func_t stats_destroy;
+	void *stats_data;
+
 	struct bt_crypto *crypto;
 
 	struct sign_info *local_sign;
@@ -185,17 +206,60 @@ static uint8_t get_req_opcode(uint8_t rsp_opcode)
 }
 
 struct att_send_op {
+	struct bt_att *att;
+	struct bt_att_chan *chan;	/* Channel the handle is pinned to */
 	unsigned int id;
 	unsigned int timeout_id;
 	enum att_op_type type;
 	uint8_t opcode;
 	void *pdu;
 	uint16_t len;
+	uint16_t size;			/* Allocated size of pdu */
 	bt_att_response_func_t callback;
 	bt_att_destroy_func_t destroy;
 	void *user_data;
 };
 
+static void free_att_send_op(void *data)
+{
+	struct att_send_op *op = data;
+
+	free(op->pdu);
+	free(op);
+}
+
+static struct att_send_op *alloc_att_send_op(struct bt_att *att)
+{
+	struct att_send_op *op;
+
+	op = queue_pop_head(att->op_pool);
+	if (!op)
+		op = new0(struct att_send_op, 1);
+
+	op->att = att;
+
+	return op;
+}
+
+static void release_att_send_op(struct att_send_op *op)
+{
+	struct bt_att *att = op->att;
+	void *pdu = op->pdu;
+	uint16_t size = op->size;
+
+	if (queue_length(att->op_pool) >= ATT_OP_POOL_SIZE) {
+		free_att_send_op(op);
+		return;
+	}
+
+	/* Keep the PDU buffer, most PDUs on a bearer have similar sizes */
+	memset(op, 0, sizeof(*op));
+	op->pdu = pdu;
+	op->size = size;
+
+	queue_push_head(att->op_pool, op);
+}
+
 static void destroy_att_send_op(void *data)
 {
 	struct att_send_op *op = data;
@@ -206,8 +270,7 @@ static void destroy_att_send_op(void *data)
 	if (op->destroy)
 		op->destroy(op->user_data);
 
-	free(op->pdu);
-	free(op);
+	release_att_send_op(op);
 }
 
 static void cancel_att_send_op(void *data)
@@ -274,36 +337,136 @@ static bool match_disconn_id(const void *a, const void *b)
 	return disconn->id == id;
 }
 
+struct att_pin {
+	uint16_t handle;
+	struct bt_att_chan *chan;
+};
+
+static bool match_pin_handle(const void *a, const void *b)
+{
+	const struct att_pin *pin = a;
+	uint16_t handle = PTR_TO_UINT(b);
+
+	return pin->handle == handle;
+}
+
+static bool match_pin_chan(const void *a, const void *b)
+{
+	const struct att_pin *pin = a;
+
+	return pin->chan == b;
+}
+
+static bool opcode_has_handle(uint8_t opcode)
+{
+	switch (opcode) {
+	case BT_ATT_OP_READ_REQ:
+	case BT_ATT_OP_READ_BLOB_REQ:
+	case BT_ATT_OP_WRITE_REQ:
+	case BT_ATT_OP_WRITE_CMD:
+	case BT_ATT_OP_SIGNED_WRITE_CMD:
+	case BT_ATT_OP_PREP_WRITE_REQ:
+	case BT_ATT_OP_HANDLE_NFY:
+	case BT_ATT_OP_HANDLE_IND:
+		return true;
+	}
+
+	return false;
+}
+
+/* Look up the channel the attribute handle in the payload is pinned to */
+static struct bt_att_chan *find_pin(struct bt_att *att, uint8_t opcode,
+					const struct iovec *iov, int iovcnt)
+{
+	struct att_pin *pin;
+	uint8_t value[2];
+	size_t len = 0;
+	int i;
+
+	if (queue_isempty(att->pins) || !opcode_has_handle(opcode))
+		return NULL;
+
+	for (i = 0; i < iovcnt && len < sizeof(value); i++) {
+		size_t n = MIN(iov[i].iov_len, sizeof(value) - len);
+
+		memcpy(value + len, iov[i].iov_base, n);
+		len += n;
+	}
+
+	if (len < sizeof(value))
+		return NULL;
+
+	pin = queue_find(att->pins, match_pin_handle,
+					UINT_TO_PTR(get_le16(value)));
+	if (!pin)
+		return NULL;
+
+	return pin->chan;
+}
+
+static bool iov_length(const struct iovec *iov, int iovcnt, uint16_t *length)
+{
+	size_t len = 0;
+	int i;
+
+	for (i = 0; i < iovcnt; i++) {
+		if (iov[i].iov_len && !iov[i].iov_base)
+			return false;
+
+		len += iov[i].iov_len;
+		if (len > UINT16_MAX)
+			return false;
+	}
+
+	*length = len;
+
+	return true;
+}
+
 static bool encode_pdu(struct bt_att *att, struct att_send_op *op,
-					const void *pdu, uint16_t length)
+				const struct iovec *iov, int iovcnt,
+				uint16_t length)
 {
-	uint16_t pdu_len = 1;
+	uint16_t pdu_len = 1 + length;
 	struct sign_info *sign = att->local_sign;
 	uint32_t sign_cnt;
+	uint8_t *ptr;
+	int i;
 
 	if (sign && (op->opcode & ATT_OP_SIGNED_MASK))
 		pdu_len += BT_ATT_SIGNATURE_LEN;
 
-	if (length && pdu)
-		pdu_len += length;
-
 	if (pdu_len > att->mtu)
 		return false;
 
+	if (op->size < pdu_len) {
+		void *buf = realloc(op->pdu, pdu_len);
+
+		if (!buf)
+			return false;
+
+		op->pdu = buf;
+		op->size = pdu_len;
+	}
+
 	op->len = pdu_len;
-	op->pdu = malloc(op->len);
-	if (!op->pdu)
-		return false;
 
-	((uint8_t *) op->pdu)[0] = op->opcode;
-	if (pdu_len > 1)
-		memcpy(op->pdu + 1, pdu, length);
+	ptr = op->pdu;
+	*ptr++ = op->opcode;
+
+	for (i = 0; i < iovcnt; i++) {
+		if (!iov[i].iov_len)
+			continue;
+
+		memcpy(ptr, iov[i].iov_base, iov[i].iov_len);
+		ptr += iov[i].iov_len;
+	}
 
 	if (!sign || !(op->opcode & ATT_OP_SIGNED_MASK) || !att->crypto)
 		return true;
 
 	if (!sign->counter(&sign_cnt, sign->user_data))
-		goto fail;
+		return false;
 
 	if ((bt_crypto_sign_att(att->crypto, sign->key, op->pdu, 1 + length,
 				sign_cnt, &((uint8_t *) op->pdu)[1 + length])))
@@ -312,89 +475,171 @@ static bool encode_pdu(struct bt_att *att, struct att_send_op *op,
 	util_debug(att->debug_callback, att->debug_data,
 					"ATT unable to generate signature");
 
-fail:
-	free(op->pdu);
 	return false;
 }
 
-static struct att_send_op *create_att_send_op(struct bt_att *att,
-						uint8_t opcode,
-						const void *pdu,
-						uint16_t length,
-						bt_att_response_func_t callback,
-						void *user_data,
-						bt_att_destroy_func_t destroy)
+static bool check_op_callback(enum att_op_type type,
+					bt_att_response_func_t callback)
 {
-	struct att_send_op *op;
-	enum att_op_type type;
-
-	if (length && !pdu)
-		return NULL;
-
-	type = get_op_type(opcode);
 	if (type == ATT_OP_TYPE_UNKNOWN)
-		return NULL;
+		return false;
 
 	/* If the opcode corresponds to an operation type that does not elicit a
 	 * response from the remote end, then no callback should have been
 	 * provided, since it will never be called.
 	 */
 	if (callback && type != ATT_OP_TYPE_REQ && type != ATT_OP_TYPE_IND)
-		return NULL;
+		return false;
 
 	/* Similarly, if the operation does elicit a response then a callback
 	 * must be provided.
 	 */
 	if (!callback && (type == ATT_OP_TYPE_REQ || type == ATT_OP_TYPE_IND))
+		return false;
+
+	return true;
+}
+
+static struct att_send_op *create_att_send_op(struct bt_att *att,
+						uint8_t opcode,
+						const struct iovec *iov,
+						int iovcnt,
+						bt_att_response_func_t callback,
+						void *user_data,
+						bt_att_destroy_func_t destroy)
+{
+	struct att_send_op *op;
+	enum att_op_type type;
+	uint16_t length;
+
+	if (!iov_length(iov, iovcnt, &length))
 		return NULL;
 
-	op = new0(struct att_send_op, 1);
+	type = get_op_type(opcode);
+	if (!check_op_callback(type, callback))
+		return NULL;
+
+	op = alloc_att_send_op(att);
 	op->type = type;
 	op->opcode = opcode;
 	op->callback = callback;
 	op->destroy = destroy;
 	op->user_data = user_data;
 
-	if (!encode_pdu(att, op, pdu, length)) {
-		free(op);
+	if (!encode_pdu(att, op, iov, iovcnt, length)) {
+		release_att_send_op(op);
 		return NULL;
 	}
 
+	op->chan = find_pin(att, opcode, iov, iovcnt);
+
 	return op;
 }
 
+static bool chan_can_send(struct bt_att_chan *chan, struct att_send_op *op)
+{
+	if (op->len > chan->mtu)
+		return false;
+
+	return !op->chan || op->chan == chan;
+}
+
+static bool match_op_chan(const void *data, const void *user_data)
+{
+	const struct att_send_op *op = data;
+
+	return chan_can_send((struct bt_att_chan *) user_data,
+						(struct att_send_op *) op);
+}
+
+/*
+ * Pick the channel a request should go to: among the channels able to take
+ * it right away the one with the least work queued wins, ties going to the
+ * bigger MTU so long reads need fewer round trips.
+ */
+static struct bt_att_chan *select_req_chan(struct bt_att *att,
+						struct att_send_op *op)
+{
+	const struct queue_entry *entry;
+	struct bt_att_chan *best = NULL;
+	unsigned int best_load = 0;
+
+	for (entry = queue_get_entries(att->chans); entry;
+						entry = entry->next) {
+		struct bt_att_chan *chan = entry->data;
+		unsigned int load;
+
+		if (chan->pending_req || !chan_can_send(chan, op))
+			continue;
+
+		load = queue_length(chan->queue) + (chan->pending_ind ? 1 : 0);
+
+		if (!best || load < best_load ||
+				(load == best_load && chan->mtu > best->mtu)) {
+			best = chan;
+			best_load = load;
+		}
+	}
+
+	return best;
+}
+
+static void wakeup_chan_writer(void *data, void *user_data);
+static void wakeup_writer(struct bt_att *att);
+
+static struct att_send_op *pick_req_op(struct bt_att_chan *chan)
+{
+	struct bt_att *att = chan->att;
+	const struct queue_entry *entry;
+
+	for (entry = queue_get_entries(att->req_queue); entry;
+						entry = entry->next) {
+		struct att_send_op *op = entry->data;
+		struct bt_att_chan *best;
+
+		if (!chan_can_send(chan, op))
+			continue;
+
+		best = select_req_chan(att, op);
+		if (best == chan) {
+			queue_remove(att->req_queue, op);
+			return op;
+		}
+
+		/* Make sure the preferred channel gets to it */
+		wakeup_chan_writer(best, NULL);
+	}
+
+	return NULL;
+}
+
 static struct att_send_op *pick_next_send_op(struct bt_att_chan *chan)
 {
 	struct bt_att *att = chan->att;
 	struct att_send_op *op;
 
-	/* Check if there is anything queued on the channel */
+	/* Responses and confirmations are queued on the channel itself */
 	op = queue_pop_head(chan->queue);
 	if (op)
 		return op;
 
+	/* Indications block the remote until confirmed so send them next */
+	if (!chan->pending_ind) {
+		op = queue_remove_if(att->ind_queue, match_op_chan, chan);
+		if (op)
+			return op;
+	}
+
 	/* See if any operations are already in the write queue */
-	op = queue_peek_head(att->write_queue);
-	if (op && op->len <= chan->mtu)
-		return queue_pop_head(att->write_queue);
+	op = queue_remove_if(att->write_queue, match_op_chan, chan);
+	if (op)
+		return op;
 
 	/* If there is no pending request, pick an operation from the
-	 * request queue.
+	 * request queue unless another channel is better suited for it.
 	 */
-	if (!chan->pending_req) {
-		op = queue_peek_head(att->req_queue);
-		if (op && op->len <= chan->mtu)
-			return queue_pop_head(att->req_queue);
-	}
-
-	/* There is either a request pending or no requests queued. If there is
-	 * no pending indication, pick an operation from the indication queue.
-	 */
-	if (!chan->pending_ind) {
-		op = queue_peek_head(att->ind_queue);
-		if (op && op->len <= chan->mtu)
-			return queue_pop_head(att->ind_queue);
-	}
+	if (!chan->pending_req)
+		return pick_req_op(chan);
 
 	return NULL;
 }
@@ -460,20 +705,18 @@ static void write_watch_destroy(void *user_data)
 }
 
 static ssize_t bt_att_chan_write(struct bt_att_chan *chan, uint8_t opcode,
-					const void *pdu, uint16_t len)
+					const struct iovec *iov, int iovcnt)
 {
 	struct bt_att *att = chan->att;
 	ssize_t ret;
-	struct iovec iov;
-
-	iov.iov_base = (void *) pdu;
-	iov.iov_len = len;
+	size_t len;
+	int i;
 
 	util_debug(att->debug_callback, att->debug_data,
 					"(chan %p) ATT op 0x%02x",
 					chan, opcode);
 
-	ret = io_send(chan->io, &iov, 1);
+	ret = io_send(chan->io, iov, iovcnt);
 	if (ret < 0) {
 		util_debug(att->debug_callback, att->debug_data,
 					"(chan %p) write failed: %s",
@@ -482,7 +725,19 @@ static ssize_t bt_att_chan_write(struct bt_att_chan *chan, uint8_t opcode,
 		return ret;
 	}
 
-	util_hexdump('<', pdu, ret, att->debug_callback, att->debug_data);
+	chan->tx_pdus++;
+	chan->tx_octets += ret;
+
+	if (!att->debug_callback)
+		return ret;
+
+	for (i = 0, len = ret; i < iovcnt && len; i++) {
+		size_t n = MIN(iov[i].iov_len, len);
+
+		util_hexdump('<', iov[i].iov_base, n, att->debug_callback,
+							att->debug_data);
+		len -= n;
+	}
 
 	return ret;
 }
@@ -492,12 +747,16 @@ static bool can_write_data(struct io *io, void *user_data)
 	struct bt_att_chan *chan = user_data;
 	struct att_send_op *op;
 	struct timeout_data *timeout;
+	struct iovec iov;
 
 	op = pick_next_send_op(chan);
 	if (!op)
 		return false;
 
-	if (!bt_att_chan_write(chan, op->opcode, op->pdu, op->len)) {
+	iov.iov_base = op->pdu;
+	iov.iov_len = op->len;
+
+	if (!bt_att_chan_write(chan, op->opcode, &iov, 1)) {
 		if (op->callback)
 			op->callback(BT_ATT_OP_ERROR_RSP, NULL, 0,
 							op->user_data);
@@ -512,6 +771,14 @@ static bool can_write_data(struct io *io, void *user_data)
 	switch (op->type) {
 	case ATT_OP_TYPE_REQ:
 		chan->pending_req = op;
+		chan->requests++;
+
+		/*
+		 * Requests skipped as better suited for this channel are up
+		 * for grabs again now that it is busy.
+		 */
+		if (!queue_isempty(chan->att->req_queue))
+			wakeup_writer(chan->att);
 		break;
 	case ATT_OP_TYPE_IND:
 		chan->pending_ind = op;
@@ -598,6 +865,14 @@ static void bt_att_chan_free(void *data)
 	free(chan);
 }
 
+static void unpin_att_send_op(void *data, void *user_data)
+{
+	struct att_send_op *op = data;
+
+	if (op->chan == user_data)
+		op->chan = NULL;
+}
+
 static bool disconnect_cb(struct io *io, void *user_data)
 {
 	struct bt_att_chan *chan = user_data;
@@ -621,6 +896,12 @@ static bool disconnect_cb(struct io *io, void *user_data)
 	/* Dettach channel */
 	queue_remove(att->chans, chan);
 
+	/* Pinned handles go back to whichever channel is available */
+	queue_remove_all(att->pins, match_pin_chan, chan, free);
+	queue_foreach(att->req_queue, unpin_att_send_op, chan);
+	queue_foreach(att->ind_queue, unpin_att_send_op, chan);
+	queue_foreach(att->write_queue, unpin_att_send_op, chan);
+
 	if (chan->pending_req) {
 		disc_att_send_op(chan->pending_req);
 		chan->pending_req = NULL;
@@ -987,6 +1268,9 @@ static bool can_read_data(struct io *io, void *user_data)
 	if (bytes_read < 0)
 		return false;
 
+	chan->rx_pdus++;
+	chan->rx_octets += bytes_read;
+
 	util_debug(att->debug_callback, att->debug_data,
 				"(chan %p) ATT received: %zd",
 				chan, bytes_read);
@@ -1091,6 +1375,12 @@ static void bt_att_free(struct bt_att *att)
 	if (att->debug_destroy)
 		att->debug_destroy(att->debug_data);
 
+	if (att->stats_id)
+		timeout_remove(att->stats_id);
+
+	if (att->stats_destroy)
+		att->stats_destroy(att->stats_data);
+
 	free(att->local_sign);
 	free(att->remote_sign);
 
@@ -1099,7 +1389,9 @@ static void bt_att_free(struct bt_att *att)
 	queue_destroy(att->write_queue, NULL);
 	queue_destroy(att->notify_list, NULL);
 	queue_destroy(att->disconn_list, NULL);
+	queue_destroy(att->pins, free);
 	queue_destroy(att->chans, bt_att_chan_free);
+	queue_destroy(att->op_pool, free_att_send_op);
 
 	free(att);
 }
@@ -1217,13 +1509,18 @@ struct bt_att *bt_att_new(int fd, bool ext_signed)
 	att->chans = queue_new();
 	att->mtu = chan->mtu;
 
-	/* crypto is optional, if not available leave it NULL */
+	/*
+	 * crypto is optional, if not available leave it NULL. Signatures are
+	 * verified per PDU so avoid the kernel crypto API round trips.
+	 */
 	if (!ext_signed)
-		att->crypto = bt_crypto_new();
+		att->crypto = bt_crypto_new_backend(BT_CRYPTO_BACKEND_USER);
 
 	att->req_queue = queue_new();
 	att->ind_queue = queue_new();
 	att->write_queue = queue_new();
+	att->op_pool = queue_new();
+	att->pins = queue_new();
 	att->notify_list = queue_new();
 	att->disconn_list = queue_new();
 
@@ -1331,6 +1628,115 @@ bool bt_att_set_debug(struct bt_att *att, bt_att_debug_func_t callback,
 	return true;
 }
 
+static void chan_stats(void *data, void *user_data)
+{
+	struct bt_att_chan *chan = data;
+	struct bt_att *att = user_data;
+	struct bt_att_chan_stats stats;
+
+	if (!bt_att_chan_get_stats(chan, &stats))
+		return;
+
+	att->stats_callback(chan, &stats, att->stats_data);
+}
+
+static bool stats_timeout(void *user_data)
+{
+	struct bt_att *att = user_data;
+
+	queue_foreach(att->chans, chan_stats, att);
+
+	return true;
+}
+
+bool bt_att_set_stats(struct bt_att *att, unsigned int interval,
+				bt_att_stats_func_t callback, void *user_data,
+				bt_att_destroy_func_t destroy)
+{
+	if (!att || (callback && !interval))
+		return false;
+
+	if (att->stats_id) {
+		timeout_remove(att->stats_id);
+		att->stats_id = 0;
+	}
+
+	if (att->stats_destroy)
+		att->stats_destroy(att->stats_data);
+
+	att->stats_callback = callback;
+	att->stats_destroy = destroy;
+	att->stats_data = user_data;
+
+	if (callback)
+		att->stats_id = timeout_add(interval, stats_timeout, att, NULL);
+
+	return true;
+}
+
+bool bt_att_chan_get_stats(struct bt_att_chan *chan,
+					struct bt_att_chan_stats *stats)
+{
+	if (!chan || !stats)
+		return false;
+
+	memset(stats, 0, sizeof(*stats));
+
+	stats->type = chan->type;
+	stats->mtu = chan->mtu;
+	stats->queued = queue_length(chan->queue);
+	stats->pending_req = chan->pending_req != NULL;
+	stats->pending_ind = chan->pending_ind != NULL;
+	stats->requests = chan->requests;
+	stats->tx_pdus = chan->tx_pdus;
+	stats->tx_octets = chan->tx_octets;
+	stats->rx_pdus = chan->rx_pdus;
+	stats->rx_octets = chan->rx_octets;
+
+	return true;
+}
+
+bool bt_att_pin_handle(struct bt_att *att, uint16_t handle,
+						struct bt_att_chan *chan)
+{
+	struct att_pin *pin;
+
+	if (!att || !handle || !chan || chan->att != att)
+		return false;
+
+	pin = queue_find(att->pins, match_pin_handle, UINT_TO_PTR(handle));
+	if (!pin) {
+		pin = new0(struct att_pin, 1);
+		pin->handle = handle;
+		queue_push_tail(att->pins, pin);
+	}
+
+	pin->chan = chan;
+
+	util_debug(att->debug_callback, att->debug_data,
+				"Handle 0x%04x pinned to channel %p",
+				handle, chan);
+
+	return true;
+}
+
+bool bt_att_unpin_handle(struct bt_att *att, uint16_t handle)
+{
+	struct att_pin *pin;
+
+	if (!att)
+		return false;
+
+	pin = queue_remove_if(att->pins, match_pin_handle,
+						UINT_TO_PTR(handle));
+	if (!pin)
+		return false;
+
+	free(pin);
+
+	return true;
+}
+
 uint16_t bt_att_get_mtu(struct bt_att *att)
 {
 	if (!att)
@@ -1456,26 +1862,89 @@ bool bt_att_unregister_disconnect(struct bt_att *att, unsigned int id)
 	return true;
 }
 
-unsigned int bt_att_send(struct bt_att *att, uint8_t opcode,
-				const void *pdu, uint16_t length,
+static unsigned int next_send_id(struct bt_att *att)
+{
+	if (att->next_send_id < 1)
+		att->next_send_id = 1;
+
+	return att->next_send_id++;
+}
+
+/*
+ * Commands and notifications don't wait for anything once written, so when
+ * nothing is queued ahead of them they are written straight from the caller
+ * buffers instead of being copied into a queued operation first.
+ */
+static bool send_direct(struct bt_att *att, uint8_t opcode,
+				const struct iovec *iov, int iovcnt,
+				uint16_t length)
+{
+	struct iovec pdu_iov[ATT_SEND_IOV_MAX + 1];
+	const struct queue_entry *entry;
+	struct bt_att_chan *pin;
+	enum att_op_type type;
+
+	if (iovcnt > ATT_SEND_IOV_MAX || opcode & ATT_OP_SIGNED_MASK)
+		return false;
+
+	type = get_op_type(opcode);
+	if (type != ATT_OP_TYPE_CMD && type != ATT_OP_TYPE_NFY)
+		return false;
+
+	if (1 + length > att->mtu || !queue_isempty(att->write_queue))
+		return false;
+
+	pin = find_pin(att, opcode, iov, iovcnt);
+
+	pdu_iov[0].iov_base = &opcode;
+	pdu_iov[0].iov_len = 1;
+	memcpy(pdu_iov + 1, iov, iovcnt * sizeof(*iov));
+
+	for (entry = queue_get_entries(att->chans); entry;
+						entry = entry->next) {
+		struct bt_att_chan *chan = entry->data;
+
+		if (pin && chan != pin)
+			continue;
+
+		if (chan->writer_active || !queue_isempty(chan->queue) ||
+							1 + length > chan->mtu)
+			continue;
+
+		/* Leave anything that cannot be written now to the writer */
+		return bt_att_chan_write(chan, opcode, pdu_iov,
+							iovcnt + 1) >= 0;
+	}
+
+	return false;
+}
+
+unsigned int bt_att_sendv(struct bt_att *att, uint8_t opcode,
+				const struct iovec *iov, int iovcnt,
 				bt_att_response_func_t callback, void *user_data,
 				bt_att_destroy_func_t destroy)
 {
 	struct att_send_op *op;
+	uint16_t length;
 	bool result;
 
 	if (!att || queue_isempty(att->chans))
 		return 0;
 
-	op = create_att_send_op(att, opcode, pdu, length, callback, user_data,
+	/*
+	 * Callers may still use user_data once this returns, e.g. to store
+	 * the id, so only skip queueing when there is nothing to destroy.
+	 */
+	if (!callback && !destroy && iov_length(iov, iovcnt, &length) &&
+				send_direct(att, opcode, iov, iovcnt, length))
+		return next_send_id(att);
+
+	op = create_att_send_op(att, opcode, iov, iovcnt, callback, user_data,
 								destroy);
 	if (!op)
 		return 0;
 
-	if (att->next_send_id < 1)
-		att->next_send_id = 1;
-
-	op->id = att->next_send_id++;
+	op->id = next_send_id(att);
 
 	/* Add the op to the correct queue based on its type */
 	switch (op->type) {
@@ -1496,8 +1965,7 @@ unsigned int bt_att_send(struct bt_att *att, uint8_t opcode,
 	}
 
 	if (!result) {
-		free(op->pdu);
-		free(op);
+		release_att_send_op(op);
 		return 0;
 	}
 
@@ -1506,8 +1974,25 @@ unsigned int bt_att_send(struct bt_att *att, uint8_t opcode,
 	return op->id;
 }
 
-unsigned int bt_att_chan_send(struct bt_att_chan *chan, uint8_t opcode,
-				const void *pdu, uint16_t len,
+unsigned int bt_att_send(struct bt_att *att, uint8_t opcode,
+				const void *pdu, uint16_t length,
+				bt_att_response_func_t callback, void *user_data,
+				bt_att_destroy_func_t destroy)
+{
+	struct iovec iov;
+
+	if (length && !pdu)
+		return 0;
+
+	iov.iov_base = (void *) pdu;
+	iov.iov_len = length;
+
+	return bt_att_sendv(att, opcode, &iov, 1, callback, user_data,
+								destroy);
+}
+
+unsigned int bt_att_chan_sendv(struct bt_att_chan *chan, uint8_t opcode,
+				const struct iovec *iov, int iovcnt,
 				bt_att_response_func_t callback,
 				void *user_data,
 				bt_att_destroy_func_t destroy)
@@ -1517,14 +2002,13 @@ unsigned int bt_att_chan_send(struct bt_att_chan *chan, uint8_t opcode,
 	if (!chan || !chan->att)
 		return -EINVAL;
 
-	op = create_att_send_op(chan->att, opcode, pdu, len, callback,
+	op = create_att_send_op(chan->att, opcode, iov, iovcnt, callback,
 						user_data, destroy);
 	if (!op)
 		return -EINVAL;
 
 	if (!queue_push_tail(chan->queue, op)) {
-		free(op->pdu);
-		free(op);
+		release_att_send_op(op);
 		return 0;
 	}
 
@@ -1533,6 +2017,24 @@ unsigned int bt_att_chan_send(struct bt_att_chan *chan, uint8_t opcode,
 	return op->id;
 }
 
+unsigned int bt_att_chan_send(struct bt_att_chan *chan, uint8_t opcode,
+				const void *pdu, uint16_t len,
+				bt_att_response_func_t callback,
+				void *user_data,
+				bt_att_destroy_func_t destroy)
+{
+	struct iovec iov;
+
+	if (len && !pdu)
+		return -EINVAL;
+
+	iov.iov_base = (void *) pdu;
+	iov.iov_len = len;
+
+	return bt_att_chan_sendv(chan, opcode, &iov, 1, callback, user_data,
+								destroy);
+}
+
 static bool match_op_id(const void *a, const void *b)
 {
 	const struct att_send_op *op = a;
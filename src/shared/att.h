@@ -10,6 +10,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <sys/uio.h>
 
 #include "src/shared/att-types.h"
 
@@ -44,6 +45,33 @@ typedef bool (*bt_att_counter_func_t)(uint32_t *sign_cnt, void *user_data);
 bool bt_att_set_debug(struct bt_att *att, bt_att_debug_func_t callback,
 				void *user_data, bt_att_destroy_func_t destroy);
 
+struct bt_att_chan_stats {
+	uint8_t type;
+	uint16_t mtu;
+	unsigned int queued;
+	bool pending_req;
+	bool pending_ind;
+	uint64_t requests;
+	uint64_t tx_pdus;
+	uint64_t tx_octets;
+	uint64_t rx_pdus;
+	uint64_t rx_octets;
+};
+
+typedef void (*bt_att_stats_func_t)(struct bt_att_chan *chan,
+					const struct bt_att_chan_stats *stats,
+					void *user_data);
+
+bool bt_att_set_stats(struct bt_att *att, unsigned int interval,
+				bt_att_stats_func_t callback, void *user_data,
+				bt_att_destroy_func_t destroy);
+bool bt_att_chan_get_stats(struct bt_att_chan *chan,
+					struct bt_att_chan_stats *stats);
+
+bool bt_att_pin_handle(struct bt_att *att, uint16_t handle,
+						struct bt_att_chan *chan);
+bool bt_att_unpin_handle(struct bt_att *att, uint16_t handle);
+
 uint16_t bt_att_get_mtu(struct bt_att *att);
 bool bt_att_set_mtu(struct bt_att *att, uint16_t mtu);
 uint8_t bt_att_get_link_type(struct bt_att *att);
@@ -62,6 +90,16 @@ unsigned int bt_att_chan_send(struct bt_att_chan *chan, uint8_t opcode,
 					bt_att_response_func_t callback,
 					void *user_data,
 					bt_att_destroy_func_t destroy);
+unsigned int bt_att_sendv(struct bt_att *att, uint8_t opcode,
+					const struct iovec *iov, int iovcnt,
+					bt_att_response_func_t callback,
+					void *user_data,
+					bt_att_destroy_func_t destroy);
+unsigned int bt_att_chan_sendv(struct bt_att_chan *chan, uint8_t opcode,
+					const struct iovec *iov, int iovcnt,
+					bt_att_response_func_t callback,
+					void *user_data,
+					bt_att_destroy_func_t destroy);
 #define bt_att_chan_send_rsp(chan, opcode, pdu, len) \
 	bt_att_chan_send(chan, opcode, pdu, len, NULL, NULL, NULL)
 bool bt_att_chan_cancel(struct bt_att_chan *chan, unsigned int id);
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <sys/socket.h>
+
+#include "src/shared/util.h"
+#include "src/shared/io.h"
+#include "src/shared/timeout.h"
+#include "src/shared/batch.h"
+
+/*
+ * Packs records written one at a time into datagrams of up to mtu bytes,
+ * sent when full or interval milliseconds after the first record went in.
+ * A peer not reading fast enough loses whole datagrams rather than
+ * stalling the producer.
+ */
+struct batch {
+	struct io *io;
+	unsigned int interval;
+	unsigned int timeout_id;
+	unsigned long dropped;
+	batch_disconnect_func_t disconnect_callback;
+	batch_destroy_func_t disconnect_destroy;
+	void *disconnect_data;
+	uint16_t mtu;
+	uint16_t len;
+	uint8_t buf[];
+};
+
+struct batch *batch_new(int fd, uint16_t mtu, unsigned int interval)
+{
+	struct batch *batch;
+
+	if (fd < 0 || !mtu || !interval)
+		return NULL;
+
+	batch = malloc0(sizeof(*batch) + mtu);
+	if (!batch)
+		return NULL;
+
+	batch->io = io_new(fd);
+	if (!batch->io) {
+		free(batch);
+		return NULL;
+	}
+
+	io_set_close_on_destroy(batch->io, true);
+
+	batch->mtu = mtu;
+	batch->interval = interval;
+
+	return batch;
+}
+
+void batch_free(struct batch *batch)
+{
+	if (!batch)
+		return;
+
+	timeout_remove(batch->timeout_id);
+
+	if (batch->disconnect_destroy)
+		batch->disconnect_destroy(batch->disconnect_data);
+
+	io_destroy(batch->io);
+	free(batch);
+}
+
+static bool batch_disconnect(struct io *io, void *user_data)
+{
+	struct batch *batch = user_data;
+
+	if (batch->disconnect_callback)
+		batch->disconnect_callback(batch->disconnect_data);
+
+	return false;
+}
+
+bool batch_set_disconnect_handler(struct batch *batch,
+				batch_disconnect_func_t callback,
+				void *user_data, batch_destroy_func_t destroy)
+{
+	if (!batch)
+		return false;
+
+	if (!io_set_disconnect_handler(batch->io, batch_disconnect, batch,
+									NULL))
+		return false;
+
+	if (batch->disconnect_destroy)
+		batch->disconnect_destroy(batch->disconnect_data);
+
+	batch->disconnect_callback = callback;
+	batch->disconnect_destroy = destroy;
+	batch->disconnect_data = user_data;
+
+	return true;
+}
+
+/* Sends what is pending, leaving the timeout to the caller */
+static void batch_send(struct batch *batch)
+{
+	if (!batch->len)
+		return;
+
+	/* Hangups are reported through the disconnect handler */
+	if (send(io_get_fd(batch->io), batch->buf, batch->len,
+					MSG_DONTWAIT | MSG_NOSIGNAL) < 0)
+		batch->dropped++;
+
+	batch->len = 0;
+}
+
+static bool batch_timeout(void *user_data)
+{
+	struct batch *batch = user_data;
+
+	batch->timeout_id = 0;
+	batch_send(batch);
+
+	return false;
+}
+
+bool batch_flush(struct batch *batch)
+{
+	if (!batch)
+		return false;
+
+	if (batch->timeout_id) {
+		timeout_remove(batch->timeout_id);
+		batch->timeout_id = 0;
+	}
+
+	batch_send(batch);
+
+	return true;
+}
+
+bool batch_append(struct batch *batch, const struct iovec *iov, int iovcnt)
+{
+	size_t len = 0;
+	int i;
+
+	if (!batch || iovcnt < 0 || (iovcnt && !iov))
+		return false;
+
+	for (i = 0; i < iovcnt; i++)
+		len += iov[i].iov_len;
+
+	if (len > batch->mtu)
+		return false;
+
+	if (batch->len + len > batch->mtu)
+		batch_flush(batch);
+
+	for (i = 0; i < iovcnt; i++) {
+		memcpy(batch->buf + batch->len, iov[i].iov_base,
+							iov[i].iov_len);
+		batch->len += iov[i].iov_len;
+	}
+
+	if (!batch->timeout_id)
+		batch->timeout_id = timeout_add(batch->interval, batch_timeout,
+								batch, NULL);
+
+	return true;
+}
+
+unsigned long batch_get_dropped(struct batch *batch)
+{
+	if (!batch)
+		return 0;
+
+	return batch->dropped;
+}
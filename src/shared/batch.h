@@ -0,0 +1,30 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+typedef void (*batch_destroy_func_t)(void *user_data);
+typedef void (*batch_disconnect_func_t)(void *user_data);
+
+struct batch;
+
+struct batch *batch_new(int fd, uint16_t mtu, unsigned int interval);
+void batch_free(struct batch *batch);
+
+bool batch_set_disconnect_handler(struct batch *batch,
+				batch_disconnect_func_t callback,
+				void *user_data, batch_destroy_func_t destroy);
+
+bool batch_append(struct batch *batch, const struct iovec *iov, int iovcnt);
+bool batch_flush(struct batch *batch);
+
+unsigned long batch_get_dropped(struct batch *batch);
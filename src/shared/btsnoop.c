@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <limits.h>
 #include <arpa/inet.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 #include "src/shared/btsnoop.h"
@@ -54,6 +55,9 @@ struct pklg_pkt {
 } __attribute__ ((packed));
 #define PKLG_PKT_SIZE (sizeof(struct pklg_pkt))
 
+/* Traces that are not mapped are read through a buffer of this size */
+#define READ_BUF_SIZE (64 * 1024)
+
 struct btsnoop {
 	int ref_count;
 	int fd;
@@ -68,8 +72,39 @@ struct btsnoop {
 	size_t cur_size;
 	unsigned int max_count;
 	unsigned int cur_count;
+	uint8_t *rbuf;
+	size_t rbuf_len;
+	size_t rbuf_off;
+	bool mapped;
 };
 
+static bool map_trace(struct btsnoop *btsnoop)
+{
+	struct stat st;
+	off_t off;
+	void *map;
+
+	if (fstat(btsnoop->fd, &st) < 0 || !S_ISREG(st.st_mode))
+		return false;
+
+	off = lseek(btsnoop->fd, 0, SEEK_CUR);
+	if (off < 0 || st.st_size <= off || (uintmax_t) st.st_size > SIZE_MAX)
+		return false;
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, btsnoop->fd, 0);
+	if (map == MAP_FAILED)
+		return false;
+
+	madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+	btsnoop->rbuf = map;
+	btsnoop->rbuf_len = st.st_size;
+	btsnoop->rbuf_off = off;
+	btsnoop->mapped = true;
+
+	return true;
+}
+
 struct btsnoop *btsnoop_open(const char *path, unsigned long flags)
 {
 	struct btsnoop *btsnoop;
@@ -117,6 +152,12 @@ struct btsnoop *btsnoop_open(const char *path, unsigned long flags)
 		lseek(btsnoop->fd, 0, SEEK_SET);
 	}
 
+	if (!(flags & BTSNOOP_FLAG_MMAP) || !map_trace(btsnoop)) {
+		btsnoop->rbuf = malloc(READ_BUF_SIZE);
+		if (!btsnoop->rbuf)
+			goto failed;
+	}
+
 	return btsnoop_ref(btsnoop);
 
 failed:
@@ -197,6 +238,11 @@ void btsnoop_unref(struct btsnoop *btsnoop)
 	if (__sync_sub_and_fetch(&btsnoop->ref_count, 1))
 		return;
 
+	if (btsnoop->mapped)
+		munmap(btsnoop->rbuf, btsnoop->rbuf_len);
+	else
+		free(btsnoop->rbuf);
+
 	if (btsnoop->fd >= 0)
 		close(btsnoop->fd);
 
@@ -366,44 +412,79 @@ bool btsnoop_write_phy(struct btsnoop *btsnoop, struct timeval *tv,
 	return btsnoop_write(btsnoop, tv, flags, 0, data, size);
 }
 
-static bool pklg_read_hci(struct btsnoop *btsnoop, struct timeval *tv,
+/*
+ * Returns the next len octets of the trace, either straight from the file
+ * mapping or from the read buffer which is refilled in large chunks. The
+ * data is only valid until the next call. Running out of data is an error
+ * unless it happens cleanly at a packet boundary.
+ */
+static const uint8_t *read_data(struct btsnoop *btsnoop, size_t len,
+								bool pkt_start)
+{
+	const uint8_t *ptr;
+
+	while (btsnoop->rbuf_len - btsnoop->rbuf_off < len) {
+		size_t avail = btsnoop->rbuf_len - btsnoop->rbuf_off;
+		ssize_t rlen = 0;
+
+		if (!btsnoop->mapped) {
+			memmove(btsnoop->rbuf, btsnoop->rbuf + btsnoop->rbuf_off,
+									avail);
+			btsnoop->rbuf_len = avail;
+			btsnoop->rbuf_off = 0;
+
+			rlen = read(btsnoop->fd, btsnoop->rbuf + avail,
+						READ_BUF_SIZE - avail);
+		}
+
+		if (rlen <= 0) {
+			if (rlen < 0 || avail || !pkt_start)
+				btsnoop->aborted = true;
+
+			return NULL;
+		}
+
+		btsnoop->rbuf_len += rlen;
+	}
+
+	ptr = btsnoop->rbuf + btsnoop->rbuf_off;
+	btsnoop->rbuf_off += len;
+
+	return ptr;
+}
+
+static bool pklg_next_hci(struct btsnoop *btsnoop, struct timeval *tv,
 					uint16_t *index, uint16_t *opcode,
-					void *data, uint16_t *size)
+					const void **data, uint16_t *size)
 {
-	struct pklg_pkt pkt;
+	const struct pklg_pkt *pkt;
 	uint32_t toread;
 	uint64_t ts;
-	ssize_t len;
-
-	len = read(btsnoop->fd, &pkt, PKLG_PKT_SIZE);
-	if (len == 0)
-		return false;
 
-	if (len < 0 || len != PKLG_PKT_SIZE) {
-		btsnoop->aborted = true;
+	pkt = (const void *) read_data(btsnoop, PKLG_PKT_SIZE, true);
+	if (!pkt)
 		return false;
-	}
 
 	if (btsnoop->pklg_v2) {
-		toread = le32toh(pkt.len) - (PKLG_PKT_SIZE - 4);
+		toread = le32toh(pkt->len) - (PKLG_PKT_SIZE - 4);
 
-		ts = le64toh(pkt.ts);
+		ts = le64toh(pkt->ts);
 		tv->tv_sec = ts & 0xffffffff;
 		tv->tv_usec = ts >> 32;
 	} else {
-		toread = be32toh(pkt.len) - (PKLG_PKT_SIZE - 4);
+		toread = be32toh(pkt->len) - (PKLG_PKT_SIZE - 4);
 
-		ts = be64toh(pkt.ts);
+		ts = be64toh(pkt->ts);
 		tv->tv_sec = ts >> 32;
 		tv->tv_usec = ts & 0xffffffff;
 	}
 
 	if (toread > BTSNOOP_MAX_PACKET_SIZE) {
-                btsnoop->aborted = true;
-                return false;
-        }
+		btsnoop->aborted = true;
+		return false;
+	}
 
-	switch (pkt.type) {
+	switch (pkt->type) {
 	case 0x00:
 		*index = 0x0000;
 		*opcode = BTSNOOP_OPCODE_COMMAND_PKT;
@@ -442,11 +523,9 @@ static bool pklg_read_hci(struct btsnoop *btsnoop, struct timeval *tv,
 		break;
 	}
 
-	len = read(btsnoop->fd, data, toread);
-	if (len < 0) {
-		btsnoop->aborted = true;
+	*data = read_data(btsnoop, toread, false);
+	if (!*data)
 		return false;
-	}
 
 	*size = toread;
 
@@ -488,40 +567,34 @@ static uint16_t get_opcode_from_flags(uint8_t type, uint32_t flags)
 	return 0xffff;
 }
 
-bool btsnoop_read_hci(struct btsnoop *btsnoop, struct timeval *tv,
+bool btsnoop_next_hci(struct btsnoop *btsnoop, struct timeval *tv,
 					uint16_t *index, uint16_t *opcode,
-					void *data, uint16_t *size)
+					const void **data, uint16_t *size)
 {
-	struct btsnoop_pkt pkt;
+	const struct btsnoop_pkt *pkt;
+	const uint8_t *pkt_type;
 	uint32_t toread, flags;
 	uint64_t ts;
-	uint8_t pkt_type;
-	ssize_t len;
 
-	if (!btsnoop || btsnoop->aborted)
+	if (!btsnoop || btsnoop->aborted || !btsnoop->rbuf)
 		return false;
 
 	if (btsnoop->pklg_format)
-		return pklg_read_hci(btsnoop, tv, index, opcode, data, size);
-
-	len = read(btsnoop->fd, &pkt, BTSNOOP_PKT_SIZE);
-	if (len == 0)
-		return false;
+		return pklg_next_hci(btsnoop, tv, index, opcode, data, size);
 
-	if (len < 0 || len != BTSNOOP_PKT_SIZE) {
-		btsnoop->aborted = true;
+	pkt = (const void *) read_data(btsnoop, BTSNOOP_PKT_SIZE, true);
+	if (!pkt)
 		return false;
-	}
 
-	toread = be32toh(pkt.size);
+	toread = be32toh(pkt->size);
 	if (toread > BTSNOOP_MAX_PACKET_SIZE) {
 		btsnoop->aborted = true;
 		return false;
 	}
 
-	flags = be32toh(pkt.flags);
+	flags = be32toh(pkt->flags);
 
-	ts = be64toh(pkt.ts) - 0x00E03AB44A676000ll;
+	ts = be64toh(pkt->ts) - 0x00E03AB44A676000ll;
 	tv->tv_sec = (ts / 1000000ll) + 946684800ll;
 	tv->tv_usec = ts % 1000000ll;
 
@@ -532,15 +605,19 @@ bool btsnoop_read_hci(struct btsnoop *btsnoop, struct timeval *tv,
 		break;
 
 	case BTSNOOP_FORMAT_UART:
-		len = read(btsnoop->fd, &pkt_type, 1);
-		if (len < 0) {
+		if (!toread) {
 			btsnoop->aborted = true;
 			return false;
 		}
+
+		pkt_type = read_data(btsnoop, 1, false);
+		if (!pkt_type)
+			return false;
+
 		toread--;
 
 		*index = 0;
-		*opcode = get_opcode_from_flags(pkt_type, flags);
+		*opcode = get_opcode_from_flags(*pkt_type, flags);
 		break;
 
 	case BTSNOOP_FORMAT_MONITOR:
@@ -553,17 +630,69 @@ bool btsnoop_read_hci(struct btsnoop *btsnoop, struct timeval *tv,
 		return false;
 	}
 
-	len = read(btsnoop->fd, data, toread);
-	if (len < 0) {
-		btsnoop->aborted = true;
+	*data = read_data(btsnoop, toread, false);
+	if (!*data)
 		return false;
-	}
 
 	*size = toread;
 
 	return true;
 }
 
+bool btsnoop_read_hci(struct btsnoop *btsnoop, struct timeval *tv,
+					uint16_t *index, uint16_t *opcode,
+					void *data, uint16_t *size)
+{
+	const void *ptr;
+
+	if (!btsnoop_next_hci(btsnoop, tv, index, opcode, &ptr, size))
+		return false;
+
+	memcpy(data, ptr, *size);
+
+	return true;
+}
+
+off_t btsnoop_tell(struct btsnoop *btsnoop)
+{
+	off_t off;
+
+	if (!btsnoop || !btsnoop->rbuf)
+		return -1;
+
+	if (btsnoop->mapped)
+		return btsnoop->rbuf_off;
+
+	off = lseek(btsnoop->fd, 0, SEEK_CUR);
+	if (off < 0)
+		return -1;
+
+	return off - (btsnoop->rbuf_len - btsnoop->rbuf_off);
+}
+
+bool btsnoop_seek(struct btsnoop *btsnoop, off_t offset)
+{
+	if (!btsnoop || !btsnoop->rbuf || offset < 0)
+		return false;
+
+	if (btsnoop->mapped) {
+		if ((uintmax_t) offset > btsnoop->rbuf_len)
+			return false;
+
+		btsnoop->rbuf_off = offset;
+	} else {
+		if (lseek(btsnoop->fd, offset, SEEK_SET) < 0)
+			return false;
+
+		btsnoop->rbuf_len = 0;
+		btsnoop->rbuf_off = 0;
+	}
+
+	btsnoop->aborted = false;
+
+	return true;
+}
+
 bool btsnoop_read_phy(struct btsnoop *btsnoop, struct timeval *tv,
 			uint16_t *frequency, void *data, uint16_t *size)
 {
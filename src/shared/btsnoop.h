@@ -11,6 +11,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <sys/time.h>
+#include <sys/types.h>
 
 #define BTSNOOP_FORMAT_INVALID		0
 #define BTSNOOP_FORMAT_HCI		1001
@@ -21,6 +22,7 @@
 #define BTSNOOP_FORMAT_SIMULATOR	2002
 
 #define BTSNOOP_FLAG_PKLG_SUPPORT	(1 << 0)
+#define BTSNOOP_FLAG_MMAP		(1 << 1)
 
 #define BTSNOOP_OPCODE_NEW_INDEX	0
 #define BTSNOOP_OPCODE_DEL_INDEX	1
@@ -107,5 +109,21 @@ bool btsnoop_write_phy(struct btsnoop *btsnoop, struct timeval *tv,
 bool btsnoop_read_hci(struct btsnoop *btsnoop, struct timeval *tv,
 					uint16_t *index, uint16_t *opcode,
 					void *data, uint16_t *size);
+
+/*
+ * Same as btsnoop_read_hci() without copying the packet: data points into
+ * the trace mapping (BTSNOOP_FLAG_MMAP) or the read buffer and is only
+ * valid until the next read or unref.
+ */
+bool btsnoop_next_hci(struct btsnoop *btsnoop, struct timeval *tv,
+					uint16_t *index, uint16_t *opcode,
+					const void **data, uint16_t *size);
+/*
+ * Offset of the next packet to be read, which can be passed to
+ * btsnoop_seek() by this or any other reader of the same trace.
+ */
+off_t btsnoop_tell(struct btsnoop *btsnoop);
+bool btsnoop_seek(struct btsnoop *btsnoop, off_t offset);
+
 bool btsnoop_read_phy(struct btsnoop *btsnoop, struct timeval *tv,
 			uint16_t *frequency, void *data, uint16_t *size);
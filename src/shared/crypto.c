@@ -15,11 +15,17 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <string.h>
+#include <limits.h>
 #include <sys/socket.h>
 
 #include "src/shared/util.h"
+#include "src/shared/aes.h"
 #include "src/shared/crypto.h"
 
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
 #ifndef HAVE_LINUX_IF_ALG_H
 #ifndef HAVE_LINUX_TYPES_H
 typedef uint8_t __u8;
@@ -62,10 +68,15 @@ struct af_alg_iv {
 /* Maximum message length that can be passed to aes_cmac */
 #define CMAC_MSG_MAX	80
 
+/* Number of IRKs evaluated per batch and resolved address cache size */
+#define RPA_BATCH	64
+#define RPA_CACHE_SIZE	256
+
 #define ATT_SIGN_LEN	12
 
 struct bt_crypto {
 	int ref_count;
+	enum bt_crypto_backend backend;
 	int ecb_aes;
 	int urandom;
 	int cmac_aes;
@@ -126,29 +137,59 @@ static int cmac_aes_setup(void)
 	return fd;
 }
 
-struct bt_crypto *bt_crypto_new(void)
+static bool kernel_setup(struct bt_crypto *crypto)
+{
+	crypto->ecb_aes = ecb_aes_setup();
+	if (crypto->ecb_aes < 0)
+		return false;
+
+	crypto->cmac_aes = cmac_aes_setup();
+	if (crypto->cmac_aes < 0) {
+		close(crypto->ecb_aes);
+		crypto->ecb_aes = -1;
+		return false;
+	}
+
+	return true;
+}
+
+struct bt_crypto *bt_crypto_new_backend(enum bt_crypto_backend backend)
 {
 	struct bt_crypto *crypto;
 
 	crypto = new0(struct bt_crypto, 1);
-
-	crypto->ecb_aes = ecb_aes_setup();
-	if (crypto->ecb_aes < 0) {
+	crypto->ecb_aes = -1;
+	crypto->cmac_aes = -1;
+
+	switch (backend) {
+	case BT_CRYPTO_BACKEND_AUTO:
+		/* Fallback to userspace if AF_ALG is not available */
+		if (kernel_setup(crypto))
+			backend = BT_CRYPTO_BACKEND_KERNEL;
+		else
+			backend = BT_CRYPTO_BACKEND_USER;
+		break;
+	case BT_CRYPTO_BACKEND_KERNEL:
+		if (!kernel_setup(crypto)) {
+			free(crypto);
+			return NULL;
+		}
+		break;
+	case BT_CRYPTO_BACKEND_USER:
+		break;
+	default:
 		free(crypto);
 		return NULL;
 	}
 
+	crypto->backend = backend;
+
 	crypto->urandom = urandom_setup();
 	if (crypto->urandom < 0) {
-		close(crypto->ecb_aes);
-		free(crypto);
-		return NULL;
-	}
-
-	crypto->cmac_aes = cmac_aes_setup();
-	if (crypto->cmac_aes < 0) {
-		close(crypto->urandom);
-		close(crypto->ecb_aes);
+		if (crypto->ecb_aes >= 0)
+			close(crypto->ecb_aes);
+		if (crypto->cmac_aes >= 0)
+			close(crypto->cmac_aes);
 		free(crypto);
 		return NULL;
 	}
@@ -156,6 +197,19 @@ struct bt_crypto *bt_crypto_new(void)
 	return bt_crypto_ref(crypto);
 }
 
+struct bt_crypto *bt_crypto_new(void)
+{
+	return bt_crypto_new_backend(BT_CRYPTO_BACKEND_AUTO);
+}
+
+enum bt_crypto_backend bt_crypto_get_backend(struct bt_crypto *crypto)
+{
+	if (!crypto)
+		return BT_CRYPTO_BACKEND_AUTO;
+
+	return crypto->backend;
+}
+
 struct bt_crypto *bt_crypto_ref(struct bt_crypto *crypto)
 {
 	if (!crypto)
@@ -175,8 +229,12 @@ void bt_crypto_unref(struct bt_crypto *crypto)
 		return;
 
 	close(crypto->urandom);
-	close(crypto->ecb_aes);
-	close(crypto->cmac_aes);
+
+	if (crypto->ecb_aes >= 0)
+		close(crypto->ecb_aes);
+
+	if (crypto->cmac_aes >= 0)
+		close(crypto->cmac_aes);
 
 	free(crypto);
 }
@@ -244,6 +302,78 @@ static bool alg_encrypt(int fd, const void *inbuf, size_t inlen,
 	return true;
 }
 
+/* Encrypts a single block, key and data are most significant octet first */
+static bool crypto_encrypt(struct bt_crypto *crypto, const uint8_t key[16],
+					const uint8_t in[16], uint8_t out[16])
+{
+	struct bt_aes_key aes;
+	bool ret;
+	int fd;
+
+	if (crypto->backend == BT_CRYPTO_BACKEND_USER) {
+		bt_aes_set_key(&aes, key);
+		bt_aes_encrypt(&aes, in, out);
+		return true;
+	}
+
+	fd = alg_new(crypto->ecb_aes, key, 16);
+	if (fd < 0)
+		return false;
+
+	ret = alg_encrypt(fd, in, 16, out, 16);
+
+	close(fd);
+
+	return ret;
+}
+
+/* Calculates AES-CMAC, key and data are most significant octet first */
+static bool crypto_cmac(struct bt_crypto *crypto, const uint8_t key[16],
+				struct iovec *iov, size_t iov_len,
+				uint8_t res[16])
+{
+	ssize_t len;
+	int fd;
+
+	if (crypto->backend == BT_CRYPTO_BACKEND_USER) {
+		bt_aes_cmac(key, iov, iov_len, res);
+		return true;
+	}
+
+	fd = alg_new(crypto->cmac_aes, key, 16);
+	if (fd < 0)
+		return false;
+
+	/* Feed the input in chunks if it exceeds the iovec limit */
+	while (iov_len > IOV_MAX) {
+		struct msghdr msg;
+
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = iov;
+		msg.msg_iovlen = IOV_MAX;
+
+		if (sendmsg(fd, &msg, MSG_MORE) < 0) {
+			close(fd);
+			return false;
+		}
+
+		iov += IOV_MAX;
+		iov_len -= IOV_MAX;
+	}
+
+	len = writev(fd, iov, iov_len);
+	if (len < 0) {
+		close(fd);
+		return false;
+	}
+
+	len = read(fd, res, 16);
+
+	close(fd);
+
+	return len == 16;
+}
+
 static inline void swap_buf(const uint8_t *src, uint8_t *dst, uint16_t len)
 {
 	int i;
@@ -257,12 +387,11 @@ bool bt_crypto_sign_att(struct bt_crypto *crypto, const uint8_t key[16],
 				uint32_t sign_cnt,
 				uint8_t signature[ATT_SIGN_LEN])
 {
-	int fd;
-	int len;
 	uint8_t tmp[16], out[16];
 	uint16_t msg_len = m_len + sizeof(uint32_t);
 	uint8_t msg[msg_len];
 	uint8_t msg_s[msg_len];
+	struct iovec iov;
 
 	if (!crypto)
 		return false;
@@ -276,26 +405,14 @@ bool bt_crypto_sign_att(struct bt_crypto *crypto, const uint8_t key[16],
 	/* The most significant octet of key corresponds to key[0] */
 	swap_buf(key, tmp, 16);
 
-	fd = alg_new(crypto->cmac_aes, tmp, 16);
-	if (fd < 0)
-		return false;
-
 	/* Swap msg before signing */
 	swap_buf(msg, msg_s, msg_len);
 
-	len = send(fd, msg_s, msg_len, 0);
-	if (len < 0) {
-		close(fd);
-		return false;
-	}
+	iov.iov_base = msg_s;
+	iov.iov_len = msg_len;
 
-	len = read(fd, out, 16);
-	if (len < 0) {
-		close(fd);
+	if (!crypto_cmac(crypto, tmp, &iov, 1, out))
 		return false;
-	}
-
-	close(fd);
 
 	/*
 	 * As to BT spec. 4.1 Vol[3], Part C, chapter 10.4.1 sign counter should
@@ -351,7 +468,6 @@ bool bt_crypto_e(struct bt_crypto *crypto, const uint8_t key[16],
 			const uint8_t plaintext[16], uint8_t encrypted[16])
 {
 	uint8_t tmp[16], in[16], out[16];
-	int fd;
 
 	if (!crypto)
 		return false;
@@ -359,27 +475,152 @@ bool bt_crypto_e(struct bt_crypto *crypto, const uint8_t key[16],
 	/* The most significant octet of key corresponds to key[0] */
 	swap_buf(key, tmp, 16);
 
-	fd = alg_new(crypto->ecb_aes, tmp, 16);
-	if (fd < 0)
-		return false;
-
-
 	/* Most significant octet of plaintextData corresponds to in[0] */
 	swap_buf(plaintext, in, 16);
 
-	if (!alg_encrypt(fd, in, 16, out, 16)) {
-		close(fd);
+	if (!crypto_encrypt(crypto, tmp, in, out))
 		return false;
-	}
 
 	/* Most significant octet of encryptedData corresponds to out[0] */
 	swap_buf(out, encrypted, 16);
 
-	close(fd);
+	return true;
+}
+
+struct rpa_cache_entry {
+	uint8_t addr[6];
+	bool valid;
+	int index;
+};
+
+struct bt_crypto_rpa_resolver {
+	struct bt_aes_key *keys;
+	void **user_data;
+	size_t num;
+	size_t size;
+	struct rpa_cache_entry cache[RPA_CACHE_SIZE];
+};
+
+struct bt_crypto_rpa_resolver *bt_crypto_rpa_resolver_new(void)
+{
+	return new0(struct bt_crypto_rpa_resolver, 1);
+}
+
+void bt_crypto_rpa_resolver_free(struct bt_crypto_rpa_resolver *resolver)
+{
+	if (!resolver)
+		return;
+
+	free(resolver->keys);
+	free(resolver->user_data);
+	free(resolver);
+}
+
+bool bt_crypto_rpa_resolver_add(struct bt_crypto_rpa_resolver *resolver,
+					const uint8_t irk[16], void *user_data)
+{
+	uint8_t key[16];
+
+	if (!resolver || !irk)
+		return false;
+
+	if (resolver->num == resolver->size) {
+		size_t size = resolver->size ? resolver->size * 2 : 16;
+		struct bt_aes_key *keys;
+		void **data;
+
+		keys = realloc(resolver->keys, size * sizeof(*keys));
+		if (!keys)
+			return false;
+
+		resolver->keys = keys;
+
+		data = realloc(resolver->user_data, size * sizeof(*data));
+		if (!data)
+			return false;
+
+		resolver->user_data = data;
+		resolver->size = size;
+	}
+
+	/* The most significant octet of key corresponds to key[0] */
+	swap_buf(irk, key, 16);
+
+	bt_aes_set_key(&resolver->keys[resolver->num], key);
+	resolver->user_data[resolver->num] = user_data;
+	resolver->num++;
+
+	/* Addresses which did not resolve before may resolve now */
+	memset(resolver->cache, 0, sizeof(resolver->cache));
 
 	return true;
 }
 
+static unsigned int rpa_cache_hash(const uint8_t addr[6])
+{
+	return (addr[0] ^ addr[1] ^ addr[2] ^ (addr[3] << 1) ^
+				(addr[4] << 2) ^ (addr[5] << 3)) % RPA_CACHE_SIZE;
+}
+
+/*
+ * Resolves a resolvable private address against all IRKs added so far.
+ *
+ * The prand part is encrypted with every key in batches, which allows the
+ * AES implementation to interleave several keys, and the outcome (including
+ * addresses that did not resolve) is cached since devices keep advertising
+ * with the same address until it rotates.
+ *
+ * Returns the user_data associated with the matching IRK or NULL.
+ */
+void *bt_crypto_rpa_resolve(struct bt_crypto_rpa_resolver *resolver,
+						const uint8_t addr[6])
+{
+	uint8_t rp[16], out[RPA_BATCH][16];
+	struct rpa_cache_entry *entry;
+	size_t i, j, num;
+	int index = -1;
+
+	if (!resolver || !addr)
+		return NULL;
+
+	entry = &resolver->cache[rpa_cache_hash(addr)];
+	if (entry->valid && !memcmp(entry->addr, addr, 6))
+		goto done;
+
+	/* r' = padding || prand, most significant octet first */
+	memset(rp, 0, 13);
+	rp[13] = addr[5];
+	rp[14] = addr[4];
+	rp[15] = addr[3];
+
+	for (i = 0; i < resolver->num && index < 0; i += num) {
+		num = resolver->num - i;
+		if (num > RPA_BATCH)
+			num = RPA_BATCH;
+
+		bt_aes_encrypt_keys(&resolver->keys[i], num, rp, out);
+
+		/* ah(k, r) = e(k, r') mod 2^24 */
+		for (j = 0; j < num; j++) {
+			if (out[j][15] == addr[0] && out[j][14] == addr[1] &&
+							out[j][13] == addr[2]) {
+				index = i + j;
+				break;
+			}
+		}
+	}
+
+	memcpy(entry->addr, addr, 6);
+	entry->index = index;
+	entry->valid = true;
+
+done:
+	if (entry->index < 0)
+		return NULL;
+
+	return resolver->user_data[entry->index];
+}
+
 /*
  * Random Address Hash function ah
  *
@@ -583,34 +824,25 @@ static bool aes_cmac(struct bt_crypto *crypto, const uint8_t key[16],
 			const uint8_t *msg, size_t msg_len, uint8_t res[16])
 {
 	uint8_t key_msb[16], out[16], msg_msb[CMAC_MSG_MAX];
-	ssize_t len;
-	int fd;
+	struct iovec iov;
 
-	if (msg_len > CMAC_MSG_MAX)
+	if (!crypto)
 		return false;
 
-	swap_buf(key, key_msb, 16);
-	fd = alg_new(crypto->cmac_aes, key_msb, 16);
-	if (fd < 0)
+	if (msg_len > CMAC_MSG_MAX)
 		return false;
 
+	swap_buf(key, key_msb, 16);
 	swap_buf(msg, msg_msb, msg_len);
-	len = send(fd, msg_msb, msg_len, 0);
-	if (len < 0) {
-		close(fd);
-		return false;
-	}
 
-	len = read(fd, out, 16);
-	if (len < 0) {
-		close(fd);
+	iov.iov_base = msg_msb;
+	iov.iov_len = msg_len;
+
+	if (!crypto_cmac(crypto, key_msb, &iov, 1, out))
 		return false;
-	}
 
 	swap_buf(out, res, 16);
 
-	close(fd);
-
 	return true;
 }
 
@@ -704,29 +936,9 @@ bool bt_crypto_gatt_hash(struct bt_crypto *crypto, struct iovec *iov,
 				size_t iov_len, uint8_t res[16])
 {
 	const uint8_t key[16] = {};
-	ssize_t len;
-	int fd;
 
 	if (!crypto)
 		return false;
 
-	fd = alg_new(crypto->cmac_aes, key, 16);
-	if (fd < 0)
-		return false;
-
-	len = writev(fd, iov, iov_len);
-	if (len < 0) {
-		close(fd);
-		return false;
-	}
-
-	len = read(fd, res, 16);
-	if (len < 0) {
-		close(fd);
-		return false;
-	}
-
-	close(fd);
-
-	return true;
+	return crypto_cmac(crypto, key, iov, iov_len, res);
 }
@@ -0,0 +1,3980 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+/*
+ * Copyright (C) 2026  agent <agent@local>
+ *
+ */
+
+/* Fixed-base table for ecc_point_mult_base(). Entry [i][j] is the affine
+ * point (j + 1) * 16^i * G, with coordinates as little endian 64-bit digits.
+ * Generated by tools/gen-ecc-table.py, do not edit.
+ */
+static const struct ecc_point base_table[BASE_WINDOWS][BASE_ROW_SIZE] = {
+	{	/* 16^0 * G */
+		{ { 0xF4A13945D898C296ull, 0x77037D812DEB33A0ull,
+		    0xF8BCE6E563A440F2ull, 0x6B17D1F2E12C4247ull },
+		  { 0xCBB6406837BF51F5ull, 0x2BCE33576B315ECEull,
+		    0x8EE7EB4A7C0F9E16ull, 0x4FE342E2FE1A7F9Bull } },
+		{ { 0xA60B48FC47669978ull, 0xC08969E277F21B35ull,
+		    0x8A52380304B51AC3ull, 0x7CF27B188D034F7Eull },
+		  { 0x9E04B79D227873D1ull, 0xBA7DADE63CE98229ull,
+		    0x293D9AC69F7430DBull, 0x07775510DB8ED040ull } },
+		{ { 0xFB41661BC6E7FD6Cull, 0xE6C6B721EFADA985ull,
+		    0xC8F7EF951D4BF165ull, 0x5ECBE4D1A6330A44ull },
+		  { 0x9A79B127A27D5032ull, 0xD82AB036384FB83Dull,
+		    0x374B06CE1A64A2ECull, 0x8734640C4998FF7Eull } },
+		{ { 0x509302446B030852ull, 0x031FE2DB785596EFull,
+		    0xA02DDE659EE62BD0ull, 0xE2534A3532D08FBBull },
+		  { 0x5C42C23F184ED8C6ull, 0x4EFC96C3F30EE005ull,
+		    0x19DFEE5FDA862D76ull, 0xE0F1575A4C633CC7ull } },
+		{ { 0x21554A0DC3D033EDull, 0xEF8C82FD1F5BE524ull,
+		    0xD784C85608668FDFull, 0x51590B7A515140D2ull },
+		  { 0xD1D0BB44FDA16DA4ull, 0x0D012F00D4D80888ull,
+		    0x8AE1BF36BF8A7926ull, 0xE0C17DA8904A727Dull } },
+		{ { 0xC6B0AAE93C2291A9ull, 0x024C740DEBB215B4ull,
+		    0x92D3242CB897DDE3ull, 0xB01A172A76A4602Cull },
+		  { 0xFD7C48538FC77FE2ull, 0x1C00F7701C7E16BDull,
+		    0x6FEC0E2DFBA70379ull, 0xE85C10743237DAD5ull } },
+		{ { 0x300628703187B2A3ull, 0x7EF9F8B8A80FEF5Bull,
+		    0x25BB30667C01FB60ull, 0x8E533B6FA0BF7B46ull },
+		  { 0xC55E1A86C1F400B4ull, 0x53C73633CB041B21ull,
+		    0x6D069F83A6F59000ull, 0x73EB1DBDE0331836ull } },
+		{ { 0xB4DD9DC1DB6FB393ull, 0xC1D238980FCE97DBull,
+		    0x4042742D3AB54CADull, 0x62D9779DBEE9B053ull },
+		  { 0xDA540A6A0F09957Eull, 0xA2ED51F6BBE76A78ull,
+		    0x4FF15D771167CEE0ull, 0xAD5ACCBD91E9D824ull } },
+		{ { 0xD79E8A4B90949EE0ull, 0x9E0ACB8C2C6DF8B3ull,
+		    0x878938D51D71F872ull, 0xEA68D7B6FEDF0B71ull },
+		  { 0xE85A224A4DD048FAull, 0x4D714FEAA4DE823Full,
+		    0x87014A964A8EA0C8ull, 0x2A2744C972C9FCE7ull } },
+		{ { 0x4C36069404C5723Full, 0x45CA6C471C48306Eull,
+		    0x591214D1EA223FB5ull, 0xCEF66D6B2A3A993Eull },
+		  { 0xCA34BBAA44AF0773ull, 0x590DED29FE751EEEull,
+		    0x6E123CDD9D3B4C10ull, 0x878662A229AAAE90ull } },
+		{ { 0x433391D374BC21D1ull, 0x16742ED0255048BFull,
+		    0x0638379DB0C21CDAull, 0x3ED113B7883B4C59ull },
+		  { 0xE2F8EEFCE82A3740ull, 0x090D04DA5E9889DAull,
+		    0x24C843AFA4F4C68Aull, 0x9099209ACCC4C8A2ull } },
+		{ { 0xD500C5EE8624E3C4ull, 0x79983028B2F82C99ull,
+		    0x4626537320E5D551ull, 0x741DD5BDA817D95Eull },
+		  { 0x1995FF22CD4481D3ull, 0x8EEB912C35BA5CA7ull,
+		    0x567383554887B154ull, 0x0770B46A9C385FDCull } },
+		{ { 0x98E15D9D46072C01ull, 0x792E284B65EAD58Aull,
+		    0x61805DF2D85EE2FCull, 0x177C837AE0AC495Aull },
+		  { 0x9C43BBE2EFC7BFD8ull, 0x26EE14C3A1FB4DF3ull,
+		    0xA24091ADB40F4E72ull, 0x63BB58CD4EBEA558ull } },
+		{ { 0x5709277324D2920Bull, 0xF126ACBE7A069C5Eull,
+		    0x7A76647F4336DF3Cull, 0x54E77A001C3862B9ull },
+		  { 0x1BA7C82F60D0B375ull, 0x7171EA7773509008ull,
+		    0x42121F8C05A2E7C3ull, 0xF599F1BB29F43175ull } },
+		{ { 0x63668C63E59B9D5Full, 0xAE03AF92DE3A0EF1ull,
+		    0xADFB378999888265ull, 0xF0454DC6971ABAE7ull },
+		  { 0x47E59CDE0D034F36ull, 0x2A3B21CE75B5FA3Full,
+		    0x4E6594E51F9643E6ull, 0xB5B93EE3592E2D1Full } },
+	},
+	{	/* 16^1 * G */
+		{ { 0xA5EB4787E1277C6Eull, 0xCD28392EFF6CA038ull,
+		    0x8B821C629836315Full, 0x76A94D138A6B4185ull },
+		  { 0x0E9DDD724B8C5110ull, 0x8599A0040FC78BAAull,
+		    0x6CB0A1B5E11E8720ull, 0xA985FE61341F260Eull } },
+		{ { 0xD1475BD52A7ED0E1ull, 0xAA557FD5B68371D9ull,
+		    0x6C45074E8EA5BEEFull, 0x2377C7D690A242CAull },
+		  { 0xE7C067B1DDB8D2B2ull, 0x6658A6CDECF46716ull,
+		    0x3F8D90E9BF901B7Eull, 0x47A13FB98413A439ull } },
+		{ { 0xABFB9DC69E4536CAull, 0x1C2E92960A201A61ull,
+		    0x8CCE745BE070CDA1ull, 0x9482FB0E492539ECull },
+		  { 0x1FAD863BF58CC1C8ull, 0xF63D5E295707BFBBull,
+		    0x1A5D638CA7534E63ull, 0x351D9CA745F157F9ull } },
+		{ { 0xAA4110A6B90EE785ull, 0x25B35EDC7338D816ull,
+		    0xF67A6A5EB1BF8E91ull, 0x0A0643FB8FCC14DEull },
+		  { 0xBAC0D100861F9CC2ull, 0x0DA10D00E7012ED7ull,
+		    0xC520DACDA2920E70ull, 0x553438324A9E7955ull } },
+		{ { 0x49B1DAE295ECFF13ull, 0x63764A1CDBD0633Cull,
+		    0x5B835A5153081EEBull, 0xB2E1B7C17AE93119ull },
+		  { 0xA3BA4989B2187D44ull, 0x87DA1A9817DEA2E6ull,
+		    0xF233A1A2AAD758C3ull, 0xE6C0441313A3EBCCull } },
+		{ { 0xAD24CB7AFC635A50ull, 0xE512FCB2ACBAC2F4ull,
+		    0xD24451D361C37440ull, 0x492003A35C8C3794ull },
+		  { 0xC9166B28B8188B9Aull, 0x3C1BC670E0B2E049ull,
+		    0x4D832FF96BDC79A2ull, 0x1F1569CFB333B4DEull } },
+		{ { 0x38BBB334EEF87286ull, 0x0703E87DFC2309E4ull,
+		    0xCB34177DCBC6EE34ull, 0xB433462E7F1B6BC2ull },
+		  { 0x7AC047F6841496D9ull, 0x9DCE20806A2CEA4Bull,
+		    0x383F4E72C1692E6Full, 0xA0DA54526ED2B5FEull } },
+		{ { 0x6A9E6235A674C4F6ull, 0xC556DEA678F85962ull,
+		    0xD7CE2F8EEDE4B762ull, 0xAE3F7DBA0BDE8B6Aull },
+		  { 0x1EE0553E711F4B53ull, 0x7940500D085F8A5Cull,
+		    0x24B8C213249DB9A9ull, 0x1C0549FC0A69995Aull } },
+		{ { 0x1B986B5B19794381ull, 0x189158875EB0C760ull,
+		    0xC186E905B5567B19ull, 0xA47420CE4D3DA24Cull },
+		  { 0x696CE3A7E2769C52ull, 0xF3A5C08DB9F6AC78ull,
+		    0xE73DF93619967AFFull, 0x2EBBFFDF7BE1BFE0ull } },
+		{ { 0x551A403F2288EBE0ull, 0x916EB1D24497C893ull,
+		    0x291FF705BF720876ull, 0xD677AE721A5D60C9ull },
+		  { 0x031DAC28500C4395ull, 0x21882AE6CA10AA9Dull,
+		    0x72A8CEB0DED3DDDFull, 0x509497A204AD2506ull } },
+		{ { 0xEC74466489A5185Aull, 0x5B870AC89F5E6F2Bull,
+		    0x5FECD4012B0DA319ull, 0x05BA7A19B9D09148ull },
+		  { 0x1543C88E01DE3A4Eull, 0x7606220BC905AE00ull,
+		    0xE467823E24E3D48Eull, 0x30E0D2B5E82C1896ull } },
+		{ { 0xA3B73FB2EFDBA936ull, 0xB9C7DE5ADEFD7C62ull,
+		    0x71F2A56EAA14F436ull, 0x366018516F5A5A22ull },
+		  { 0x8F3AE9D3626ADCB1ull, 0x4CF24008D15AF99Dull,
+		    0x195D35B2E9A028CAull, 0x91EC1AACF53CEB78ull } },
+		{ { 0x5AA398B5F99B85FEull, 0x9C0EFE9AAE3A5DFDull,
+		    0x69798D918083E0B7ull, 0xB29F74C9D0DFE2FDull },
+		  { 0xDBA642976DA604DCull, 0x2DEF63D30BF59E80ull,
+		    0xD5D0712E96D7C6D9ull, 0xA3CE5BC3A6C29785ull } },
+		{ { 0xADFA3814EB04054Dull, 0xA7DCA6C6280CFA08ull,
+		    0xEB36DD90B05F92E7ull, 0x78C6BE72B982CC60ull },
+		  { 0xA729E7A30B0DFA2Dull, 0x0B6764277E0F8951ull,
+		    0x4B4D0C3C5CEC2330ull, 0x491CE81CBBAEF847ull } },
+		{ { 0x2767456E87E030EFull, 0x576B2B057CD50E96ull,
+		    0x076CBF03F2482B08ull, 0x99299BAA8B91BCF5ull },
+		  { 0x4D8E6B7DD8D9AA9Aull, 0x57C12C499F400844ull,
+		    0xBF338101A6CEAA79ull, 0x5CC2E3D3333F8E18ull } },
+	},
+	{	/* 16^2 * G */
+		{ { 0x2DB2E35F12D0441Bull, 0x190D0B710D6A564Cull,
+		    0x87FFD1528603ED61ull, 0x34A2D4A3B0091659ull },
+		  { 0xB424E7845E93B146ull, 0xE7D766B9DEDDD81Dull,
+		    0x2BCA71046E777FC0ull, 0xBEAAED6A53A1E3C2ull } },
+		{ { 0x3469CEA39F3F98DEull, 0xA416B9AE0B3C5DFCull,
+		    0xE8897BBD818D459Aull, 0x04C490528BE759E4ull },
+		  { 0xEBD949434E8D6E96ull, 0x471D9D7B4A4605EEull,
+		    0xADE84C66242A8107ull, 0x30E50B46405CC74Full } },
+		{ { 0xDCE4AE33BDA08424ull, 0x3ABFB7AB74F644A9ull,
+		    0x1B58C5FFA95D23EDull, 0xA98B0A07ADC359AAull },
+		  { 0x361287A0E831800Cull, 0x752BE80BA0DF582Dull,
+		    0xE5319E8C8E1D1320ull, 0x4754C64722499B66ull } },
+		{ { 0x80E76BB98E61CA07ull, 0xCDC5849AE1D527E2ull,
+		    0x897299B9EB6FE80Cull, 0x16949B7287D4F481ull },
+		  { 0xA09C2BE7A0420427ull, 0x4D2D6AC6FEDF983Aull,
+		    0xBDF997B75B601209ull, 0xE7A4146D770EDEDEull } },
+		{ { 0xB52D7E5E883C2D6Aull, 0xD22F918D81BD29B3ull,
+		    0xD21B6B78C85A696Dull, 0xA034F009C88DAAC5ull },
+		  { 0xF4336EF2C2C30E72ull, 0xBE06035F16267E7Cull,
+		    0xB0CDB8545CECEB06ull, 0xFE1B0036CA899C1Full } },
+		{ { 0x6D61FDB48F6752CDull, 0xB71BDD3C3F3F923Bull,
+		    0xA8420FE520B265CBull, 0x3FB660A7F0E14DA3ull },
+		  { 0x2F12E8C064C6017Eull, 0x8BC013BD1100A0C1ull,
+		    0x4C2869C4D9577D59ull, 0x6545851D4224637Cull } },
+		{ { 0x716A51DD28BE8C78ull, 0x4A096CF82B793E4Dull,
+		    0xA076E2B40962E9A1ull, 0xB52226FF319D4401ull },
+		  { 0x203367CA51686903ull, 0x819F7FC8E5B58FF3ull,
+		    0xCA1B36697E92851Aull, 0x701EE0C9F539F540ull } },
+		{ { 0xE1404A861ABE45C0ull, 0x281B195FF46F925Aull,
+		    0x886A8F4749B86176ull, 0xB01A67F716475F72ull },
+		  { 0xC72F0DBE0090106Cull, 0x72FC676341B62C7Full,
+		    0xACD56B13164EF994ull, 0x7C521BBF5A3956E2ull } },
+		{ { 0x7040FE40A058B5A4ull, 0xDE4464F87931979Bull,
+		    0xD968CECCFCCC4713ull, 0xA3E38861868E05B3ull },
+		  { 0x8F306D90E7113AEFull, 0x3CEE845BB771A294ull,
+		    0x3848E6B3AE97E68Full, 0xCFD457887DF0D12Cull } },
+		{ { 0x17C2D788EBBE0146ull, 0x637136EEDBDBD882ull,
+		    0xB872C1D0E0EC1188ull, 0x03ACF89AA3770E03ull },
+		  { 0x243D71C1D38A0D8Aull, 0xCABA4BE850A0AE08ull,
+		    0xF06762038C11CC48ull, 0x1CCEDF94C3C6BD27ull } },
+		{ { 0xA05F5EC904A08314ull, 0x82FE36DB2DC7DFF7ull,
+		    0x333CCAB9A221197Aull, 0x2099544A131FA539ull },
+		  { 0xE7F8C9C5E7573CCCull, 0xD406E5A736FCFE96ull,
+		    0x90FBA8E5CB9048DFull, 0xA5CF3DFD2AA33B18ull } },
+		{ { 0x8136DA613FA8DC8Full, 0xFC7405CC6E1372F8ull,
+		    0xB7438645C660CB24ull, 0x8AC1F41FB4E187E6ull },
+		  { 0x1D95F312D9509804ull, 0x1DB6FB884FBADD73ull,
+		    0xC1506FAC6DAF3CDFull, 0x2122B32472D8FCE1ull } },
+		{ { 0x502FF94AE9078C18ull, 0x99E0C3CAEEEDE929ull,
+		    0x308F6E72AADFD39Bull, 0x751D6513ACC0EC70ull },
+		  { 0x998D6E95CECE0D67ull, 0xF00948C1CBE05AC7ull,
+		    0x85354BAF6A2A2A4Eull, 0xBA9C3FFDCA4A4158ull } },
+		{ { 0x1FE1767FF462EA0Eull, 0x02E6B44D10140294ull,
+		    0x46D90525E450A1A7ull, 0x7854E90D1144129Eull },
+		  { 0x3BF725275902544Cull, 0xB7742EA17EF95B20ull,
+		    0x4A3004BBF427C03Eull, 0xD6728E8D1F9513FFull } },
+		{ { 0x92CFCD5C9E86D900ull, 0x405EE09D17A3DB44ull,
+		    0x17B48308A03A3B36ull, 0x5BE0F5225C478011ull },
+		  { 0xC4CDD69BF58A5755ull, 0xF921725241B34F5Aull,
+		    0xD347E3A4E7B5423Dull, 0x83D1D9E6DFF2C422ull } },
+	},
+	{	/* 16^3 * G */
+		{ { 0xF077E8DAA245573Full, 0x508676F2F4FD0A64ull,
+		    0x997789672E6D6BD2ull, 0xE716AED2CF069E4Dull },
+		  { 0x505FC26B469218D1ull, 0xD13D0DF2FA07C9B3ull,
+		    0x5912B06687B9A851ull, 0x353663E694FC72ABull } },
+		{ { 0xB5113C2B357174B3ull, 0x6B2E5D2FCEC451F4ull,
+		    0x2F4541CF25B5E81Bull, 0x5A57C3E3548207EFull },
+		  { 0x88CF5959383437E3ull, 0x28886700134BB928ull,
+		    0x01B1165729F34433ull, 0x077C7B303E692246ull } },
+		{ { 0x7F987930657008ACull, 0x19CE1ECEE329EDFBull,
+		    0x64E5558A4C1DA22Dull, 0xD2BF898D6F507CE8ull },
+		  { 0x8111534A727BEB55ull, 0x679CE10AB5FF0798ull,
+		    0x3F8195DB3FA90C56ull, 0x69C0B1CB5A6B77AAull } },
+		{ { 0x8937F00FACB006FFull, 0x1A87A974797E4FC5ull,
+		    0xD10920ADECFB86ADull, 0x5CE96505EEF7208Cull },
+		  { 0x818DCDA107152613ull, 0x669D20BEBD955C2Bull,
+		    0xEC56D1F22FDE7BC3ull, 0xD16B6EBD381F5AD5ull } },
+		{ { 0xFD0D7CA9782F1580ull, 0xB0E4DDEE24203EB7ull,
+		    0x87FA57391F3064F8ull, 0x4D88304EE583CE60ull },
+		  { 0x0C0FB16D5616EDD7ull, 0xAAFCA3BD68EB1E11ull,
+		    0xE8D6800898FD6518ull, 0x28A94E709AB0636Cull } },
+		{ { 0xA0C1C454C543D986ull, 0x76754B6EBB642A20ull,
+		    0xB28AAA0AA37D9E16ull, 0x541C97A5C80BE642ull },
+		  { 0x7B0B8F98424B2EA7ull, 0x7FB3DDC8C61678BDull,
+		    0x54D48455EB64B144ull, 0x054D35662CD2B632ull } },
+		{ { 0x5F84C3DAE0C38E11ull, 0x7156421BEA6E26BAull,
+		    0x3267399202E5AF9Eull, 0x17C72727C8FC0EEBull },
+		  { 0xCD8366BBAE90DECDull, 0x7E539945A60CDAE3ull,
+		    0x40602FCCE901802Eull, 0x95C5A4F4FE664B3Cull } },
+		{ { 0x15261B05D0B79FBCull, 0x63A5B8311D31A919ull,
+		    0x4B2A3A4635B10433ull, 0x71A5BD27C625CA1Bull },
+		  { 0xC2E37CCC8F277F6Bull, 0xC76B6051EBAA32D0ull,
+		    0xB39452CA1A02F2EFull, 0xC5BF524D066741FFull } },
+		{ { 0xD955FD8AE32F36EAull, 0xCD4F46A7293541C3ull,
+		    0x8463B1CFC84CB8B3ull, 0x7E03FDAAC47450A8ull },
+		  { 0x8ACC23FC8A68B8AFull, 0x419E979A4C5009D6ull,
+		    0x668E6B170184AF99ull, 0xDCF6D5F1201228DAull } },
+		{ { 0x0C5E14BFA3D9AEEAull, 0x6C04351AF9985153ull,
+		    0xF2017DE615706416ull, 0xED42091A6C5EA880ull },
+		  { 0x1A456364C16E9AE7ull, 0x954EBDD1E2105392ull,
+		    0xE0D3092B508982C4ull, 0x340932A238F9D141ull } },
+		{ { 0xD43E52A6D953BAA9ull, 0x2615AE8649E18DE8ull,
+		    0x61637AC1DCA0B214ull, 0x8CE6DA684B1BCF07ull },
+		  { 0x78E75C28F52689E5ull, 0x07F3986BB6A9341Dull,
+		    0xE69B3BC90061B568ull, 0x3D9F4FB8FA93120Bull } },
+		{ { 0x2BF3909A3F490661ull, 0x7835611CE53CAD64ull,
+		    0x087E87C9CEB75878ull, 0x1F4179B924A320C8ull },
+		  { 0x2E477122B437B2E2ull, 0xB971141104890217ull,
+		    0xD9485F70AF853CA0ull, 0x82AC86B413A8BAA0ull } },
+		{ { 0x4AB8D853AF22A96Aull, 0x08B1BA9D9C6AB8F9ull,
+		    0x20A5354975BAE2B0ull, 0xB570E73040DC054Aull },
+		  { 0xCB33F661C85D1B00ull, 0xA7C9BB7A5855CC9Cull,
+		    0x028C3769B5C0CFBDull, 0xDCD8A2638F71E77Full } },
+		{ { 0x495BA2D5E264BD27ull, 0xA5A1B3BA7EF715A6ull,
+		    0x94567B56A196E517ull, 0xF8A34AD3387C6344ull },
+		  { 0xA7F3956FF71AC586ull, 0x0E528E13DBCF1FB0ull,
+		    0x7F6375ADFE7D67A5ull, 0x69EC806150467434ull } },
+		{ { 0x9E40EB94589A7509ull, 0xE1270B9641FA8054ull,
+		    0x04A11A3E75C7F20Dull, 0x44D94323CBAB943Bull },
+		  { 0xE20A2B9B60437234ull, 0x6F93E1FDF14DD126ull,
+		    0x03423BCD277B9358ull, 0xB2C5B38008401F0Aull } },
+	},
+	{	/* 16^4 * G */
+		{ { 0x03E8465C6EADE3C4ull, 0x714AB749C9052A05ull,
+		    0x8E5C643340E586B4ull, 0xA018366F4E91E90Dull },
+		  { 0xF45C42026B26E8D0ull, 0xD5F7284E44614F37ull,
+		    0x7C6CE578349D8369ull, 0xE2BBEC1714110B16ull } },
+		{ { 0xFEBCCEE647A9112Dull, 0xEB7D5ADFFE1CE3EEull,
+		    0x9EA25487EA254C45ull, 0xCD7CE65D707DA2A6ull },
+		  { 0xFFBABE0D3A92B3AFull, 0xA190AA498BEE60A5ull,
+		    0x89B9016AA5EE6708ull, 0x85E04A4B4C966F97ull } },
+		{ { 0x6E1CDEAC59E0AF06ull, 0x92F398A562ED958Dull,
+		    0x50BD3B5A6D45055Cull, 0x9CDF1F00B88D8964ull },
+		  { 0x8D7A32DB6216ADE7ull, 0x828522DC197CA546ull,
+		    0x4D958BBCDC8D94B0ull, 0x916D25FED3F2AD66ull } },
+		{ { 0x6C88AD96C3212F1Aull, 0xE8AF0BC36C998BEFull,
+		    0x8E67D4C73705AE59ull, 0x0F5F0AEA09963471ull },
+		  { 0x755D7B1E7712B09Aull, 0x4F5ED40DDE29AF7Cull,
+		    0x5886AADD4BA16B78ull, 0xF8A8B2B7C8593C95ull } },
+		{ { 0x81372B939305097Eull, 0x38D6170E843BA519ull,
+		    0xAB6B1B2D05404483ull, 0x45BFD9D5D1A663EDull },
+		  { 0x54BA058E908DDC04ull, 0x683B9D33BFD2C159ull,
+		    0xBAD88305470CE908ull, 0x09D1DC12855AFD2Bull } },
+		{ { 0x000349ACD95BCC47ull, 0xB0E2D44B1A7F80EFull,
+		    0x3407FAE48FA79A96ull, 0x7784F06CF9BFB400ull },
+		  { 0x02FBDE0180FBB3B4ull, 0xF464B5CDD4F6FFB6ull,
+		    0x3F8DE493B2FEE6CEull, 0xCCA2733EC3EDC43Aull } },
+		{ { 0xCD31F1A0B63BD6DFull, 0xD1FC23C2DD66AEC3ull,
+		    0x671E9F9C02895E6Full, 0xB599AD156476693Bull },
+		  { 0x8EA1CEA38EFA09ACull, 0x6A40C4F691134B45ull,
+		    0x4637360B8B23C416ull, 0x6979D1DEC4FAB332ull } },
+		{ { 0x2435158CFC4471BBull, 0x91428BF4E1E6E917ull,
+		    0xF15F0D870AE25C90ull, 0x471AD0A8D57F5939ull },
+		  { 0x454318FA49693A0Cull, 0xB0D7E9FF7F23982Cull,
+		    0x2A367AB48094D138ull, 0x2234CA62778E8E39ull } },
+		{ { 0xAF8613F327142D62ull, 0x1D9A6A35F83BC26Dull,
+		    0x92662B1227E854C1ull, 0xF4DCA1F16732AC0Eull },
+		  { 0xAC9ECCC07A618FC9ull, 0xBB979ACEFDCD3D7Full,
+		    0xD49F381B91ABC659ull, 0x551167E5B4B4CD46ull } },
+		{ { 0xA92C68146C180378ull, 0xB3040EBDF3523741ull,
+		    0x49D201427DAF6500ull, 0x45DC683E625BAE73ull },
+		  { 0x42A66EA68E817A27ull, 0xD04CED33A08DF786ull,
+		    0xC89BEAAC3E588137ull, 0xBD0197242631880Full } },
+		{ { 0x1ECB1FF4615FAE61ull, 0x7F15C7DC4F395F82ull,
+		    0xD9C4E240E716BB5Aull, 0xF07278A0E6E09B66ull },
+		  { 0xF7D0CB74896376F9ull, 0x2C270715B837EABCull,
+		    0xF7D7A0821898F7D4ull, 0x1A681B2B14A71EA5ull } },
+		{ { 0x2E06DAE905566022ull, 0xA2D3E61463D4DFFFull,
+		    0x7405E146BE83337Full, 0x93E498F09E88D0D6ull },
+		  { 0xB1CB31EEC7C53F91ull, 0x3B27A24BC689E611ull,
+		    0x9096E0F3540088F4ull, 0x7D974929D221120Dull } },
+		{ { 0x0C4E04152466591Full, 0xBE172EA8FFC68D6Aull,
+		    0xF143AB533BA858CCull, 0x1FC52457AF0A0DB0ull },
+		  { 0x44EFEF57396F8CDBull, 0x29F8CAC232EC7822ull,
+		    0xE9EC76FE5B434E16ull, 0x489C1838089EBC11ull } },
+		{ { 0x5EA48F58173B4DF8ull, 0x1DF4170C442D4D0Aull,
+		    0xCC34630510B36F5Dull, 0xED9EA11F2D7B0206ull },
+		  { 0xCF5AFD9CE069CE7Bull, 0x52ACBB37E2CE6A55ull,
+		    0x3D0E3D4C3F02B537ull, 0x175D2F8031D02978ull } },
+		{ { 0x125D0B8C322A8EBCull, 0xA291CDB718F96715ull,
+		    0xFD7F0B5B30CA56D5ull, 0xFA2501B31A48C5F4ull },
+		  { 0x80D927B5AA8A775Bull, 0xEA58E08E6CBC8331ull,
+		    0x33851E661A6FA8CBull, 0x71C932B14F858962ull } },
+	},
+	{	/* 16^5 * G */
+		{ { 0x8F7DCECB7D96DFF1ull, 0x30E431C1AAD5FCFEull,
+		    0xFEF6A0B570CD98D5ull, 0x0EC73885141FE54Full },
+		  { 0x9EC841AC7C7B552Cull, 0x1D5264CE87ED78AAull,
+		    0x91ACC4EF58065251ull, 0xD6224F4E87AE875Dull } },
+		{ { 0xB183B5399660B7C9ull, 0x9BA12B3112FB6DCFull,
+		    0x059A0E2532C8F0C6ull, 0x477778364E6E1CDEull },
+		  { 0x5C205FA39918C3DFull, 0x5E0604C1F142EBCFull,
+		    0x7373EFB6A7C89E8Aull, 0x2DD89D00B8389E31ull } },
+		{ { 0x51C324AB088D58E9ull, 0xE94A5C1C64E31838ull,
+		    0xE992A46A7C42A7B6ull, 0x96DAC3FDC7064A86ull },
+		  { 0x80349312AEBEBC5Eull, 0x685BE89B9487E6E3ull,
+		    0x856CC4949382C439ull, 0xCB1FAFF3AD46C1ADull } },
+		{ { 0x0FD8013B26D69D8Eull, 0x2EC38FAF35F45D26ull,
+		    0xC73D989017E14DD2ull, 0x353D458D3491B5A8ull },
+		  { 0x842B9D0020F32B82ull, 0x825DFC12FB71A9A8ull,
+		    0x3130FDE40C040A8Aull, 0x9C7D37BF4F5BDE24ull } },
+		{ { 0x8952AD132DB29F92ull, 0x1D21D271B947B2C5ull,
+		    0xA105DC378AEB8F81ull, 0xE297B23CEB14F312ull },
+		  { 0x60F294C8A5E58DDBull, 0x1223CEBB85ED4141ull,
+		    0xB480DBABB8CD9149ull, 0xE1372520F8CB70B4ull } },
+		{ { 0x3F4DACC55B5E6A6Cull, 0x86679FDEA1D8DE80ull,
+		    0x3171BDB6D33F07E5ull, 0xA737BB3DA35A3B5Eull },
+		  { 0xB730C7D69054745Dull, 0x0D4E7D487692ED0Aull,
+		    0x2B1E765D8E905F15ull, 0xC68F53E01F98FFD2ull } },
+		{ { 0xFD943B7B8AD88C33ull, 0xD91AE394D9746BCAull,
+		    0x6B06BC920D24DA97ull, 0x1CD22338FB2B94B6ull },
+		  { 0x628EA784248FB1B2ull, 0x13FE51315ECA1E49ull,
+		    0x96C8640AB136BC27ull, 0xFC3ACDF838AB48B0ull } },
+		{ { 0xAF0D4E79E330C098ull, 0x28E6BF035DC617CCull,
+		    0xD57180FF0B1BA76Eull, 0xDDAD6BF0172E2240ull },
+		  { 0x3E5A994D63B67B58ull, 0xFA333BAD2DB9D140ull,
+		    0x7530A4736125ADDAull, 0x0B1371E6935A2189ull } },
+		{ { 0xF53AC89C3B26AA73ull, 0xCDF7E11B0C63A0E0ull,
+		    0xCB1CAD30DFFB1EE0ull, 0xF462D7ADB9E9FBBFull },
+		  { 0x245EAC1778479E73ull, 0x49E8E0A300502CCAull,
+		    0x0D53BA4A68733C7Aull, 0x406A0D1A78345314ull } },
+		{ { 0xF58BEBAE5B2E97CCull, 0x89EF670C852039CDull,
+		    0x1D6F05DA10F6CD68ull, 0x22AD3FEE717113B9ull },
+		  { 0xC2D34EDE848B42A0ull, 0xE03640043CB4CD37ull,
+		    0xD0A598DB6A4DCC1Dull, 0xBCE4EC07B05351A2ull } },
+		{ { 0x3EE1E02ABCD015E3ull, 0xAF90E9597E650227ull,
+		    0x75BDBEB3CA895168ull, 0xE0F68925D3F70CAFull },
+		  { 0xDAA24D42D2157CCEull, 0x55B8B5391E2936BBull,
+		    0x5362696C7274C77Cull, 0x08531E310E483AA9ull } },
+		{ { 0x2082B63685CE7562ull, 0x7C8DED40B882A851ull,
+		    0x5364F7C14BCC66E2ull, 0xF6C5EF5DB04ED3ABull },
+		  { 0x0747F96B177EDDB3ull, 0x51ED33CAD490A6F0ull,
+		    0xC5A533360DBA5118ull, 0x4149117A17145D88ull } },
+		{ { 0x1E6C43114BB76B12ull, 0xEA8E76773E192769ull,
+		    0xC1D82B312AF75A00ull, 0x28E4ADC1552BF57Full },
+		  { 0x57E453A7EC4747BDull, 0x03A0A60F171628FFull,
+		    0xF4E4B65B6B9EA3F7ull, 0x14D74C4EFD9A01B3ull } },
+		{ { 0xAFAE5FBA343040C6ull, 0x20D07018EA77661Eull,
+		    0xC78446B476DD149Eull, 0xDF30EF720FCFE8D0ull },
+		  { 0x2F3560036CA02B72ull, 0x43CB0CF4429C03BCull,
+		    0x09278A77D903449Dull, 0x18E1AEBF6D6DBB45ull } },
+		{ { 0x8BF5801FE76FF697ull, 0x369B688652076462ull,
+		    0xD271EDABB3A097C6ull, 0x85A0BA2794BA805Eull },
+		  { 0x309ED4DA52142721ull, 0x1DE97FFA790A58B9ull,
+		    0x554790D3DCEDAA55ull, 0xADF32E61EAC3E24Aull } },
+	},
+	{	/* 16^6 * G */
+		{ { 0x3725C5DCE392D805ull, 0xA87A8069875405D4ull,
+		    0xA4A54DAAFAA3449Aull, 0xF8F5DCCF4C6A93D7ull },
+		  { 0x026619516CDA02FAull, 0x51F3DA64A52143BAull,
+		    0x389D3E3364613273ull, 0xE58176CF66D63054ull } },
+		{ { 0xACA7F0B2AC51D8A6ull, 0xFD42D88478182A90ull,
+		    0x9B317FE248AF581Full, 0xA118B0F24BC45D9Cull },
+		  { 0x8621B55D5C87B030ull, 0x81922408E376967Dull,
+		    0xDF7B25AE09464D6Aull, 0x698B53FD0F7E1798ull } },
+		{ { 0x19D4B3167FA046F7ull, 0x17110F390207309Dull,
+		    0x4E084AC8946E2D45ull, 0xE12C8E4A865883A9ull },
+		  { 0x53A55A28A12646ADull, 0xDD0C04E113311934ull,
+		    0x433B3ED5393126F6ull, 0x7CEC04610FD9A2F3ull } },
+		{ { 0xFA42E8729CF5250Eull, 0x7BD24BE788828675ull,
+		    0xDE9EC29566D715EAull, 0xFCC8CA2E4E502D2Eull },
+		  { 0x602E0FBF730FD4A2ull, 0x9046BC05C03B2120ull,
+		    0xF6B9880A8B34DA5Cull, 0x30B57BCCEEF8BD04ull } },
+		{ { 0xB9B127E8C2853C43ull, 0x48166C57AE22E466ull,
+		    0x3D08E2EFE3D13236ull, 0x394BD47417969209ull },
+		  { 0xB17828CCA064469Dull, 0xD52F6712D90FCF0Cull,
+		    0x207E3FC2F1D60767ull, 0x2B4D6D52151DC6B9ull } },
+		{ { 0x18DA08BA74CB5CBFull, 0x1F177E3ABC30F120ull,
+		    0x26A78CADBC7ED64Eull, 0x81341AE328B19095ull },
+		  { 0x461726673E856D6Full, 0x80BABDC773BC3358ull,
+		    0x0DD25CFE06CF0349ull, 0xF2A47728B2DEB5F4ull } },
+		{ { 0xEC2DD739FC722E94ull, 0x4ED810396D058961ull,
+		    0x445C6656C5940433ull, 0xCA8538DF38DE82E9ull },
+		  { 0x3A0A62DF1049A527ull, 0xF20953A8A48B26A4ull,
+		    0x11E73126A1FB9F12ull, 0x3B27FC42EB9E05C3ull } },
+		{ { 0x2318AA0489A95E03ull, 0xF349F675D2AF3C3Dull,
+		    0xEE9A4B43CF2E4E3Aull, 0x24BBE05BFA35DDC0ull },
+		  { 0x87DF45ED8D793C4Dull, 0xD40AA52E375AA149ull,
+		    0x17182D4DD2760FAAull, 0xD49405EE090A22CFull } },
+		{ { 0x87174629DCAD6309ull, 0xD31A1FC2F239FF48ull,
+		    0xA1BB74624CA67B3Dull, 0x663E1A59F2357B75ull },
+		  { 0x53286BA389981F28ull, 0xB907D44402EB52BDull,
+		    0xC102C183CB1CF918ull, 0x292FB73B8066A8C3ull } },
+		{ { 0x70D45A4DED4D335Full, 0xF2ACCB5F8A3EDD13ull,
+		    0xAAF94227EAC9C482ull, 0x46E22FDC70432F68ull },
+		  { 0xAB8AA54C61BDB9A8ull, 0x9CB893A34C6225EAull,
+		    0xD59F4B2940A2AEB3ull, 0x1E1F378D8436FBB7ull } },
+		{ { 0x9275B24522C23D03ull, 0x3BA1B04D8FC7FF24ull,
+		    0x96C36C23707BEEABull, 0xA2D9EFE730636670ull },
+		  { 0x102E4C04F085DB74ull, 0xEA09A7E95839DF45ull,
+		    0x15530436C7101B92ull, 0x1CC85228CC841B8Full } },
+		{ { 0xFA22EB9BA08EAF08ull, 0x6DF610B42AE2C020ull,
+		    0xEB76C8E73D40E0DFull, 0x86F0D61C0C8A0982ull },
+		  { 0xDD71FBAA13A0C1A2ull, 0x14A0C650CC021492ull,
+		    0x3104DF1399953635ull, 0x03059E9C7572FB0Full } },
+		{ { 0x1755F96707D4C6D1ull, 0xF662CD519AD9FFFBull,
+		    0xE0B910B5273F35D0ull, 0x5657E12B48B1A9EFull },
+		  { 0x88303F298106BDECull, 0xBFF9A35A1452C141ull,
+		    0xACFB390F33AE6A0Aull, 0x72B5BEF4B8DD49F9ull } },
+		{ { 0xBFC50FBBF32D296Eull, 0x59D03D9AE280DE5Cull,
+		    0x1A257A892C9EC527ull, 0x5E378784112A2A52ull },
+		  { 0x491EFF584E42294Dull, 0x4C9118EF208FDE89ull,
+		    0x4FCDEB66D5B8AD3Eull, 0xA559D906505D0E67ull } },
+		{ { 0xF8654DD55933564Aull, 0x7A68B4FAEDE3AF44ull,
+		    0x0864EDC6676D8D2Bull, 0x5B686215D40AE001ull },
+		  { 0x3B5F04588204EF63ull, 0x392AEE228878869Full,
+		    0x52D30C54D19D95DEull, 0x76B5EA69CF3A2645ull } },
+	},
+	{	/* 16^7 * G */
+		{ { 0x984A23176F922DBDull, 0x1CA631161F99218Full,
+		    0x3F85EAAD8E4D71B9ull, 0x6D28B6BFFD4DAF31ull },
+		  { 0x44ABFF02A0EF3CFFull, 0x4C24E9F0B84DA299ull,
+		    0x40FBE1A61CCB4A1Cull, 0xAF39D905141DD2FAull } },
+		{ { 0x9789404FC4FB240Aull, 0x50EA585CAFB75250ull,
+		    0xE613947F2D302F2Full, 0xD131E661DD93D815ull },
+		  { 0x22F60E1402501A57ull, 0x7423D4EBCDEACDF4ull,
+		    0xE79B4C37F48F4FD4ull, 0x34342C8461A95DA2ull } },
+		{ { 0xB590DFF99B168B64ull, 0xA153D02AC586C840ull,
+		    0xD3DF0905FC14467Eull, 0x7CD3157A7FBFE3DDull },
+		  { 0x856C0D2B5ABBB16Bull, 0x13AC4D9B72E02E35ull,
+		    0x20568E78BCDBFAFBull, 0x9CA08D2117292C62ull } },
+		{ { 0x67E5FDD7B8087DDEull, 0xD0434584477FE2E8ull,
+		    0x712E02810BE246A2ull, 0xAFFF5AF92C807615ull },
+		  { 0x178346ACD44EB3A2ull, 0xAACF175292DDABE7ull,
+		    0x099A747EE10A2A22ull, 0x659F6EA22CD060C2ull } },
+		{ { 0xB2B1C6FA06EF29E8ull, 0x64DC554B09D9AEE3ull,
+		    0x56B243199D453562ull, 0xED860BDB5F2DF8C4ull },
+		  { 0x501A1C49B9B90F8Full, 0xE7630F5C2D8DAA33ull,
+		    0x7C6BF6B340417BB1ull, 0xB837E74375D5A7FDull } },
+		{ { 0x3D8EF9236DBF52E9ull, 0xC01974D056F6F88Full,
+		    0x6A65739B8B079177ull, 0x3E65FB3B08594F3Aull },
+		  { 0x3A52541EC710D348ull, 0x600D56D126AEBB43ull,
+		    0x10BEA6890CF95987ull, 0xE79BB6600EF807C0ull } },
+		{ { 0x9DF918B3F636E617ull, 0x47DCD03BC1F1CF59ull,
+		    0x735E1C2E7E272C9Dull, 0x6868CC8FD1D21243ull },
+		  { 0x1C8DDCF3FCBB3D27ull, 0x60FE30C8A4384CD7ull,
+		    0xB3C5903879313F0Aull, 0xEED008A5B91BF9E6ull } },
+		{ { 0x99FB69A100371F53ull, 0xE89DFDB368BC6669ull,
+		    0x05B8000A73853A82ull, 0x8437A7CAB8F3E67Cull },
+		  { 0x248872D7879CBBABull, 0x10E124FEDBFBE259ull,
+		    0x735483F43819BB8Eull, 0x968FD75882812A40ull } },
+		{ { 0xC79DA2A6113E2A34ull, 0x291D2E65CE3A11E2ull,
+		    0x2C5CB49F10AFD318ull, 0xEC03B360EAC8FE20ull },
+		  { 0xA42243EEB84566D6ull, 0x8AA8156E65A136B7ull,
+		    0x7BEFDE2101212272ull, 0x86020FFB60A05843ull } },
+		{ { 0x20409A178519526Bull, 0x133A579D37D4DD4Full,
+		    0x4C7B1DE8989EB9E6ull, 0x15F2CF68579CA9D4ull },
+		  { 0x355E35BB66D83FC1ull, 0x2669BCF4F324B2ADull,
+		    0xE46819DDC47D4D7Eull, 0x21A51E5BD1986A77ull } },
+		{ { 0x5EAE0CE5C87C1B18ull, 0x101E2CB5484991A2ull,
+		    0xE6A3035A591056FAull, 0xA79464A39E78B90Dull },
+		  { 0xBEB585097B94809Aull, 0x0D98DE9C71562821ull,
+		    0x249A57879E9A89F6ull, 0x1361F4E3F72858CCull } },
+		{ { 0xB510CAE477159A25ull, 0x1F456B063DA3E65Bull,
+		    0xF5F7B88E7E1BDA6Eull, 0x0701A78DD6546551ull },
+		  { 0x0A843A51FBFCDBA3ull, 0x55FE9158099DCE97ull,
+		    0x19EDA0A206BEAA8Eull, 0x8BD65E64E6B94200ull } },
+		{ { 0x594E28C6DED10D26ull, 0x5A9ABEF829E595F6ull,
+		    0x90E91FB694F30CCCull, 0x544EF280AA8FBCC7ull },
+		  { 0x2FC24F7276DAFCC2ull, 0x683D6F976E2C06AEull,
+		    0x9D6B1DFE8D8D70D3ull, 0x95B91C9DC45AC2CEull } },
+		{ { 0x812686C1AFC59084ull, 0xC4C4ACCA4B1F3C5Aull,
+		    0x778469AC0CDC7F64ull, 0x8C259414E492EA1Cull },
+		  { 0xC8236DB59F30F7C3ull, 0xEB03A88B88F09232ull,
+		    0x916B4F0997ECAD5Cull, 0x6E162F4D40B152E6ull } },
+		{ { 0x249479F8B7AD18E6ull, 0x57AD3E798D3CAD5Eull,
+		    0x4DE53C846B4AFF9Bull, 0xE2C26C885F34C621ull },
+		  { 0xADAFE51AA554CFADull, 0x3BC515CA71981DE4ull,
+		    0x51CE266EA117BA11ull, 0xB2121B284F488188ull } },
+	},
+	{	/* 16^8 * G */
+		{ { 0x3A5A9E22185A5943ull, 0x1AB919365C65DFB6ull,
+		    0x21656B32262C71DAull, 0x7FE36B40AF22AF89ull },
+		  { 0xD50D152C699CA101ull, 0x74B3D5867B8AF212ull,
+		    0x9F09F40407DCA6F1ull, 0xE697D45825B63624ull } },
+		{ { 0x336DD1E7C68278C2ull, 0xA1DD10B8A60E47C0ull,
+		    0x6554CAA343ADFA5Aull, 0x6177947147864343ull },
+		  { 0x9D03ECB2EFABD2CFull, 0x327969992317A1A6ull,
+		    0x03BFF005C8986473ull, 0x4ECEE7D5A568791Full } },
+		{ { 0x76A78091DF0922A8ull, 0x8E90E9D2545CF8D9ull,
+		    0x80924E56022F8B80ull, 0x4B656A405B4E2D73ull },
+		  { 0x4DADCAC5999A80BBull, 0xD473B9E2B9850F69ull,
+		    0x20D04CC255D8C4D6ull, 0xEE1EA31D12E77839ull } },
+		{ { 0xAEAB93965A7D9344ull, 0xF7221ABA0101B56Bull,
+		    0x193D8758ABF96019ull, 0x521CF0CD89729D1Aull },
+		  { 0x4529F28196B7064Aull, 0x7A1341CA5A95FBA1ull,
+		    0xC583FE0ED386371Bull, 0xD60220DACBF9E9BAull } },
+		{ { 0xB504F88869D07E9Eull, 0xA09E7CA1F6A60C36ull,
+		    0x93DB2BE0FB3D8E5Eull, 0x9D78956EBD65E13Dull },
+		  { 0xF4DD615AC3D8C8EEull, 0x7460A2DA3B94C7B2ull,
+		    0x6542A89C1D3210CEull, 0xD5149E6EF48EA8CDull } },
+		{ { 0xBB430CF33B281418ull, 0x7CE5019BB0000E35ull,
+		    0x4D56C2613639E706ull, 0x7C86B3AD8863A8DDull },
+		  { 0x79DD3EED3117E0ECull, 0x82EA7C317BC0861Bull,
+		    0x4C62B97768DAA72Full, 0xD958BACCEEBEFE95ull } },
+		{ { 0x667750867DC4950Full, 0x5741B2ADBD394207ull,
+		    0x57236846E4DB6316ull, 0x4ACB1272E1353FA9ull },
+		  { 0x66C6E44463D8B4DFull, 0xDF9E4280B5866AC5ull,
+		    0x8CF298F6CC71E29Full, 0x726CD20FB743CDADull } },
+		{ { 0x0B3184A32B3FCE8Cull, 0xBD4BBDEC1543D1A7ull,
+		    0x562FC9EFCE42700Bull, 0x176C11C1328ED07Bull },
+		  { 0x6EA68436A3C9F19Full, 0x5C5D842A5BB51AB1ull,
+		    0x89592180B7DE3B7Eull, 0xD17F8DAE934B8A35ull } },
+		{ { 0xF40C7A7BED7E8CBDull, 0x2A667F8AF007D816ull,
+		    0x234453550C81464Aull, 0x640C5EBF1A6B17B4ull },
+		  { 0x06E2903CBEC5A5DBull, 0xBA069FB18CFF9B02ull,
+		    0x2AE9C6EB701EAB9Eull, 0xD6AE88FD829CFD2Full } },
+		{ { 0x63AE2B005E57D10Dull, 0xAF42E93B573FE788ull,
+		    0x09D378B7CF26B9D2ull, 0x493471ABC939487Bull },
+		  { 0x83259603C6056DBEull, 0xBDADD5EC623364EDull,
+		    0xE96C54F99A845ACCull, 0x60D9691165077EFFull } },
+		{ { 0xF70A04B07E86BDDCull, 0xF1D26B97975CE3D5ull,
+		    0x451562C90DDB6B9Bull, 0x8BBA04B1B4284B32ull },
+		  { 0x5223C5A1E9E349C4ull, 0xC6ACFDE4F4196E5Full,
+		    0x659BF9216699437Aull, 0xC34099C09C208EBFull } },
+		{ { 0x5DD2C18196A081E1ull, 0x482C9028D974A0EFull,
+		    0xFC1C48CF4A13975Eull, 0x7085B59C1C09E312ull },
+		  { 0x914ADEA64659F1ECull, 0x4E9F136375066381ull,
+		    0x3CC6B741515810A6ull, 0x55A062A24931EECBull } },
+		{ { 0xD170E7804257F582ull, 0x1F9909EADEC3A258ull,
+		    0x10A6943F7C5A5FE4ull, 0x8B0A5744FECD37E2ull },
+		  { 0x4817FEDF37372D4Bull, 0x56DB46BA7B160766ull,
+		    0x662A15A137E37D46ull, 0x9E57A44EC0D6C739ull } },
+		{ { 0xD1D41ECA113FB3BBull, 0xC52FBE5033F758E6ull,
+		    0xD8EC684ABBEA778Full, 0x526FD9E3E7B79DD1ull },
+		  { 0x8B72D1CF470B5E0Eull, 0x2622644C6800F600ull,
+		    0xA0FCE55430C0A98Full, 0xCB3D9FDBE104383Aull } },
+		{ { 0x3F1449F9985E797Eull, 0xF06E224F2E3C3168ull,
+		    0x1F856F493D9678A6ull, 0x0A13FF97C2647897ull },
+		  { 0x8327AB9F539D666Full, 0xF27F6F0A7580C392ull,
+		    0x917D818E8FA1DC3Full, 0xEB1A964B225C83D5ull } },
+	},
+	{	/* 16^9 * G */
+		{ { 0x7AFF4FE1FDDE3445ull, 0x76BBA9DDA2AEA781ull,
+		    0x85371FE7FF26519Eull, 0x6965B6384D7061E6ull },
+		  { 0x7CC4389E18855113ull, 0xF47CE6051A5F99D9ull,
+		    0x325E496638732DBEull, 0xD1BCDAE39C482511ull } },
+		{ { 0x0375C0C6EDEE30EEull, 0x48526336679189F1ull,
+		    0x9BA834FCB1840971ull, 0x9BA1E12F974AC9F3ull },
+		  { 0x8A96B83B67B43C5Eull, 0x62067EBB8C7D4F38ull,
+		    0x277C3EEA86A877BEull, 0x03D2F132311BEA6Cull } },
+		{ { 0xF5E40F96888ACFC5ull, 0xB1EF589B36689789ull,
+		    0x027E7DDBD4091A71ull, 0xE1CBC51DDE75C7DAull },
+		  { 0x3BC5FED5A249A225ull, 0xE7D3292BEEBFBA52ull,
+		    0xB312764FFDB9E23Cull, 0xEC678397CDE7DAEDull } },
+		{ { 0x8AFBC67F51C57125ull, 0x5A1658F6D17C5B10ull,
+		    0x485B544D9567E863ull, 0xC90EA1FBE9020055ull },
+		  { 0xC669A504DEFB8D94ull, 0xB6A3D07D6DE19A69ull,
+		    0x19667AF636E660B1ull, 0x05ACA66C710EDE6Bull } },
+		{ { 0x758EA53FE107CCC6ull, 0x1D3897E1543C8228ull,
+		    0x731E9D2845A90048ull, 0x9C3F267971138AA1ull },
+		  { 0x840794CD3DEA9152ull, 0x51A8FD4E95F9B186ull,
+		    0x8BE375F4BF3E6ECAull, 0xDAEE0C1B64B51D9Cull } },
+		{ { 0x61067DF977FC555Dull, 0xD1DF6426ED18D433ull,
+		    0xAA47106437DC1824ull, 0x67A51D096D01CB39ull },
+		  { 0x5D9AC5946C12C1D7ull, 0x4363755443132B3Eull,
+		    0xE175487A3FA794F2ull, 0xC1095AEA14BF7BE0ull } },
+		{ { 0x21C5EB4395A449E7ull, 0x2FA2A034E53C2BE4ull,
+		    0x796FAC17B140922Bull, 0x5C30D9577C6B2D72ull },
+		  { 0x770EA481AE2677D0ull, 0xB75E4053C3CE790Eull,
+		    0x164B65F799C592D0ull, 0x8025E3B5B08E1B92ull } },
+		{ { 0xC1BF1F2DAB3CD7FEull, 0x9CF25089F822DF8Full,
+		    0x3D3A1BB4A48C105Bull, 0x0A88B8F77C896230ull },
+		  { 0x6A3BD234F1661FD1ull, 0x0C491C0994D7154Cull,
+		    0x1D4D29D246CAA990ull, 0x15B63B6905525AC2ull } },
+		{ { 0xFA558C028B8CEB07ull, 0x5379252BFFEE271Cull,
+		    0xAFE4E2B07EA8D995ull, 0xAA3BBF230C8E9682ull },
+		  { 0x99A8462E9FD83984ull, 0x3B71B2BC7AB3F9EBull,
+		    0x44DCB0FE4C9162ECull, 0xE6320CB09C1EC268ull } },
+		{ { 0xC35C99281F9D5429ull, 0x7D4A5CC6A003762Full,
+		    0xBAFAF9CB5D606FF2ull, 0x34233278994634FDull },
+		  { 0xDFDA0AD8402E2826ull, 0x68094C6B36D9D8F0ull,
+		    0xD34B5DC46E068D45ull, 0xA3258285F3856A65ull } },
+		{ { 0xE40EA55583BFD1F1ull, 0x3A36DC3515D65732ull,
+		    0x79E60FC991400194ull, 0xAB4A325113334181ull },
+		  { 0x21139610C8E1C233ull, 0xA57D9324279E98CFull,
+		    0xB4EB3BD0412FE057ull, 0xEA6C64BB036C8668ull } },
+		{ { 0x9277D1148A50A1E1ull, 0x164B7EA9C4A0CD28ull,
+		    0x6CAC5FAE0FFAE1B1ull, 0xBD58ADD042642EC7ull },
+		  { 0xFDF7ACCB06773780ull, 0xC5C046287663EC57ull,
+		    0xC6F41FBA2B27AB6Bull, 0x8AD1183E2EA2FBC1ull } },
+		{ { 0x08406D780B1D6D3Full, 0x5F37668A4EEEBB89ull,
+		    0xF7337F5CD8A5A810ull, 0xDBA9B259DDED5D77ull },
+		  { 0xC42E928289CD8133ull, 0x48BD9BC4512BD93Cull,
+		    0x5ACA994F4FEB8714ull, 0xB3862D3F57535B7Bull } },
+		{ { 0x2C12B388701F3DE8ull, 0x0CD3C187FAAC904Dull,
+		    0xE53A635B6CBCD930ull, 0xED3588338031F0A4ull },
+		  { 0x5F4E485F7266EBE3ull, 0x98EEE3EC1AC407D8ull,
+		    0x3FB6CBBF1554B67Dull, 0x87FE94DC7DEEAB86ull } },
+		{ { 0x679A038031FA2A6Aull, 0x34FC1D585B0E4B25ull,
+		    0x07ADD742B1A3CDFEull, 0x1998F4C42E982745ull },
+		  { 0x607EDB4BC6415142ull, 0x4C6C02387B7258B5ull,
+		    0x9700F8008B78A1E9ull, 0x2EBB416D190AFA10ull } },
+	},
+	{	/* 16^10 * G */
+		{ { 0x258FCA6C4D9AEFBDull, 0x1EFE47B273B95775ull,
+		    0x32CA9F0D41BC43DCull, 0x0FBC341C8C669D76ull },
+		  { 0xED3B6EA9D3E71CA0ull, 0x950B069E200A9FF1ull,
+		    0xE4014B1D4957D3D3ull, 0xBD8022632F360E3Full } },
+		{ { 0xF3A6DB8A73E44B54ull, 0x54DBEEFA7C1E27F7ull,
+		    0x2DCB6C352620546Cull, 0x829019319D8F776Aull },
+		  { 0x6803F5E4FE5FE6ACull, 0x9F47A0A101135484ull,
+		    0x65888D6EAC1DD9A0ull, 0xE6A26E713EA8FA1Dull } },
+		{ { 0x8796DFFEE9434837ull, 0xADB3140B8620C1BBull,
+		    0xB1341C6FFB4FB06Dull, 0xD76D18ABC4A87AEDull },
+		  { 0x4FAA04F9BB215B4Cull, 0x90A458E775B7CCC2ull,
+		    0xDE0E4214F7AB9332ull, 0xF6BC4DA32ED96644ull } },
+		{ { 0xA5E743CEEA394A20ull, 0xB41CA518E198A281ull,
+		    0x444CD57DB517AC92ull, 0xC48DBFA12299CF2Aull },
+		  { 0x4A0580DBEA77A75Bull, 0x9440B125991BB5E2ull,
+		    0x64FF2E411BDBD6CDull, 0xBC83CBA00E1380BAull } },
+		{ { 0x02E89F219C07F222ull, 0xC5E21C63AC60FE7Dull,
+		    0x4F481D1A1F1753D1ull, 0xD5C0C6506167FF60ull },
+		  { 0xE2EF691E0C6FFD57ull, 0xBAF3F51A78813A86ull,
+		    0x0CDE0C77F49F75B9ull, 0x15A30B860817B885ull } },
+		{ { 0x5BB8CBE596A178D4ull, 0x2233BC4FF408A8EFull,
+		    0x4439015B8BCE969Cull, 0x1B71B816FCB52791ull },
+		  { 0x4A2D7EBBB5507F51ull, 0xE0E5B6C1F6CC1171ull,
+		    0xDE6EF1C28D738FC0ull, 0x7E659D1DA48A8E2Cull } },
+		{ { 0x4A4716A24E93BFA6ull, 0xD39D295A09A1362Aull,
+		    0xE549CBA66B4C9FE0ull, 0x734C364E4A46F62Cull },
+		  { 0xFC6FA79998D10774ull, 0xECA13620890297C4ull,
+		    0x9DE981E3520C5F48ull, 0x09951503AAA79D04ull } },
+		{ { 0xCD013F88B049E7CDull, 0xE8F9257AE57FDC00ull,
+		    0x3BE71969FC3A9301ull, 0x987F256D58CFF937ull },
+		  { 0xB7254BBC6EFA35D6ull, 0x47B4605207AAFFDBull,
+		    0xE860EBD60007E39Eull, 0x8E92695694EC505Cull } },
+		{ { 0xF0EB517F5FA194AEull, 0x0640291D9A054AECull,
+		    0x01175D9D2A9EB149ull, 0x79A3D9DA07B66A89ull },
+		  { 0x4FC65E9C9FCF634Bull, 0x6BD425F32F79BC4Dull,
+		    0x4B3671B858AF03D8ull, 0x84E1DBCA7254B1B3ull } },
+		{ { 0xD66EC4E5390CCFA9ull, 0xC41860A21B4B3B74ull,
+		    0x2F50838A4E371875ull, 0xA72CB8E993EC35DEull },
+		  { 0x22FBE345AF0FD4A3ull, 0xF1A4C6EDBDD2BB28ull,
+		    0x7B5B7066FC5D44B9ull, 0x91A660E391681A4Cull } },
+		{ { 0x6AC9060021E8B7FEull, 0x5DD0E2E17785B26Aull,
+		    0x8A3E4CAADCFC98E0ull, 0x3393FD094D5B0582ull },
+		  { 0x0C142442023C6821ull, 0x8E56B30A8A9B94B7ull,
+		    0x2EAFEAED9C5A668Dull, 0x130437BEC867BEB8ull } },
+		{ { 0x0A5DB33FC75F4DDFull, 0xE955273186EC58F7ull,
+		    0x8507A52F4805EB98ull, 0x41DB43D818F963FBull },
+		  { 0x285C41FBB53425B3ull, 0xD53DB5D79F7F2E31ull,
+		    0xDD2EC30777538B8Full, 0x4210DA1AD0865781ull } },
+		{ { 0xA09579D561528CF6ull, 0xE6A0250AF650694Eull,
+		    0x5E1B4586EE5B0A52ull, 0xA16B2886134627E1ull },
+		  { 0x80B920F9FCE93F3Bull, 0x3493FBC813CC8013ull,
+		    0x913CED79D81150F4ull, 0xF40598AE8537AD99ull } },
+		{ { 0xB81DBE564D20D1B2ull, 0x2E47DD806702F9F8ull,
+		    0x7F9E7BE17E483448ull, 0xAF7E078E17F3E1D4ull },
+		  { 0x7230AE89764CC6B3ull, 0xE6600A25C7A08DA4ull,
+		    0xA62DDBAE81B2497Eull, 0xD8BD0F435B22B2BFull } },
+		{ { 0x3510A66B8C8DB2E0ull, 0x473CBDC15F0D7358ull,
+		    0xBF6C89ABA95A74F6ull, 0xD317CE2018E3474Cull },
+		  { 0xA5B34A2B274BC9A9ull, 0xCAA274D022B860F3ull,
+		    0x99C2C3E8E3979136ull, 0xD61A210A9093844Bull } },
+	},
+	{	/* 16^11 * G */
+		{ { 0xC6E3197AA3FE67B2ull, 0x34A8BFE70A2E3338ull,
+		    0xBC666B9BA97323B2ull, 0x6608C243773C85DCull },
+		  { 0x1923FE5CE5B47A28ull, 0xC22B159F40C54308ull,
+		    0x846F640DA746E03Full, 0xA1A916BEC521C168ull } },
+		{ { 0x5FC1209B0378BC7Full, 0x58BC6E018BE06286ull,
+		    0x9979BC856E976E53ull, 0x70C1FD6918000AA9ull },
+		  { 0x6D68171CA6AEB856ull, 0xF5A9F32F61E1CB0Dull,
+		    0xAAEDF6F122428543ull, 0xF7DAABC20D5BC522ull } },
+		{ { 0x13E6EAAD2BC73E02ull, 0x8496614EEB65312Cull,
+		    0x206A98117D578631ull, 0xF0956AE2A6C5DC23ull },
+		  { 0x2D2CF6998611219Dull, 0x672D048DBBAE9457ull,
+		    0x76E2058AF2839356ull, 0x433FE6601144E03Cull } },
+		{ { 0xBC63B9F4E77E03C2ull, 0xFE32C900BFB0192Cull,
+		    0xC0733FDEACEC50AAull, 0x30AC8E52250D76B2ull },
+		  { 0xA11914FED1DC3F83ull, 0x6704BA32CD8786DCull,
+		    0x69AA6584002E77A0ull, 0xD694B530C099785Eull } },
+		{ { 0x7DE22DE51C5FE45Cull, 0x88B281A8387C0F59ull,
+		    0xA52F249D7CF72834ull, 0xDB98EBEA3CA2A60Cull },
+		  { 0x44A701C43EF45A22ull, 0xE983204FAA480E1Cull,
+		    0xDE15129DD8912C8Cull, 0xE0C0F30B75BD85A2ull } },
+		{ { 0xCBA43ACB80C6C0BCull, 0x4D9F8D7283DF687Full,
+		    0x785A855FF7C71008ull, 0x0B92902A077E8E4Cull },
+		  { 0xD088E9D8BAF5DD22ull, 0x04785EE3D92ED23Cull,
+		    0x0D6E697A2D161E20ull, 0xDDBBD3CDAD5F6A8Cull } },
+		{ { 0xAF59E60DE2128EACull, 0x0C4758D5CCAF1CCBull,
+		    0x21BA6B3B7D6A5169ull, 0x0A73C0160ADDA5F4ull },
+		  { 0x3859291D64F1180Dull, 0x793759F17755D9CAull,
+		    0xA55CB6DD94F50A7Cull, 0x443FDA56044E838Cull } },
+		{ { 0x2D86A63C3E689186ull, 0x36BBA6C05ECDB6AFull,
+		    0xEF5A97AE73396212ull, 0x5BB99589230A0DF5ull },
+		  { 0xEDFB310D1BE3A018ull, 0x92643ED05BC1DCC4ull,
+		    0x5724D461A33C413Eull, 0x189E83E977ED3159ull } },
+		{ { 0xC65A933163CCBC30ull, 0x9EDFE5D21D349618ull,
+		    0x70ED37667A099724ull, 0x378720C347CB4F23ull },
+		  { 0x6A20327F1315729Eull, 0x16BCF955D1348F84ull,
+		    0x93118AC0AAA79B6Dull, 0x8F1BDDB9CF72538Cull } },
+		{ { 0x33D38005E9583501ull, 0x9086801C76B5D18Dull,
+		    0xC9DBA87327404C39ull, 0xA65A3767559B10FEull },
+		  { 0xAD2FA9DF73F552DFull, 0xA8C24997DCF28874ull,
+		    0xE564913CD393E2E0ull, 0xB71CA7025CBD7194ull } },
+		{ { 0xA64A8DE543BB1B6Bull, 0x575FEF32F47C2BFAull,
+		    0x9D98118C1055A621ull, 0xFE8FD21DB78B1A61ull },
+		  { 0x97B5D9BA30EAAF93ull, 0x0F14DDCFF0ABF889ull,
+		    0x69E28E95F5AD13C0ull, 0x791E22AEC3256E37ull } },
+		{ { 0x1DDAA1DF0C177775ull, 0xABDF0902D2C5B43Eull,
+		    0xC8C2557C4DD03E4Dull, 0xAFCF5A6575201206ull },
+		  { 0xCC45B4D397BD04DAull, 0xFAE009A7293517D5ull,
+		    0xD3D10B5CC45DF251ull, 0xC19F249E540E3F43ull } },
+		{ { 0xE805599CB44B7CEAull, 0x47446940916CF87Dull,
+		    0xE820402278B3DCCAull, 0x2C331FD579FB7E2Eull },
+		  { 0x7FC2B46AD5D1C9C2ull, 0x6192511FF1309407ull,
+		    0xFCF3F3D8C3BDD650ull, 0x20567B1CCE061E76ull } },
+		{ { 0xB00DD4E0D6789065ull, 0xA8DAFDB00B195F64ull,
+		    0x6D5C45D51F6BA24Cull, 0xC22F67BD7CC643A2ull },
+		  { 0xDA5BEFF2814712D3ull, 0x9DA87B73DB5CEC2Full,
+		    0xEFE4E67CBEE5AF85ull, 0xC8FB0A3BD1D6E392ull } },
+		{ { 0x8F929B378112278Cull, 0xDD01649D0A8D9A15ull,
+		    0xA348B4C87F844B66ull, 0x509BC06C4651A320ull },
+		  { 0xEC875C988E178F66ull, 0x0F65FE86E735F945ull,
+		    0x1760F4F17B8F6457ull, 0xB4B168C2B72246ECull } },
+	},
+	{	/* 16^12 * G */
+		{ { 0xC2EBAF8017E55104ull, 0xF73A835FBB8E9C71ull,
+		    0x63DE93C34D8B561Cull, 0xD8DE765227B78737ull },
+		  { 0x2A02EF80E52E08CDull, 0xC2F73FCE1940DB1Bull,
+		    0x5C4C628AD1DCF924ull, 0x2FD29465BE13F2D1ull } },
+		{ { 0x06EB9409F722A81Bull, 0xE9227BAB9467B68Full,
+		    0x6020F71756A0A320ull, 0xD03EB26A9A38B79Bull },
+		  { 0x95E25F86D8A85767ull, 0x9DFF1A286DF208F5ull,
+		    0x6CE057045262D412ull, 0x50C5FCB02C21A3E7ull } },
+		{ { 0x6939C2C7E987BFD3ull, 0x87C5472FF4C4284Cull,
+		    0x551DFBEAFADDD191ull, 0xE3A5786FBD518E33ull },
+		  { 0x7ED31B6C8CC23E7Dull, 0xA3DCF2ECD928E081ull,
+		    0x8477B9FF4AD8210Cull, 0xF74BAD09535840E6ull } },
+		{ { 0xE834110D03F61C13ull, 0xFF6986D6F1790DD7ull,
+		    0x2D3AD94E07C7976Full, 0xFE4091010EB8CDA7ull },
+		  { 0xC3D3CECDBDA0B3AEull, 0xF986FBDB99E1D973ull,
+		    0x39486FAF093B0B79ull, 0x081759C1DA404032ull } },
+		{ { 0xB67951D222D5056Eull, 0x0EDCB5A7E247A07Cull,
+		    0x11525FFCE96E5E48ull, 0x42A97041ECA520D4ull },
+		  { 0x48414DC8B0F7DB11ull, 0xB64E483D6E9FD1FDull,
+		    0x6EC36DD26B563B26ull, 0xF2FC7F66CF008706ull } },
+		{ { 0x7BCA829E0A94A6B1ull, 0xCA300C28D0D9E4B6ull,
+		    0x28A7CEBE93FC4323ull, 0x5873B9F32AA7B78Dull },
+		  { 0x52BF9F98DE524C9Dull, 0x1F5054889FFB3DF0ull,
+		    0xF4E0379CC39BB95Aull, 0x17A7DBF4ED5E2EB5ull } },
+		{ { 0xC6745F91D3DAFD3Bull, 0x6FB899F02DCB3956ull,
+		    0xFE232C2ED65379D6ull, 0x0D6CA71B1C27964Cull },
+		  { 0xD6ADF1421A6FE6E8ull, 0xA02248ABEE88771Aull,
+		    0x9FE494A02707DE58ull, 0xA85130B38FDE293Dull } },
+		{ { 0x13D00C248FA8EE41ull, 0xCB4E6644C7743648ull,
+		    0x1E80957063154403ull, 0xC90E300839DD5895ull },
+		  { 0x47A63667C3D7C1AEull, 0x5045534717ACCD6Eull,
+		    0x9C0710C653840362ull, 0x62F504176D19E73Cull } },
+		{ { 0xF6BF9C7FF1131F8Bull, 0x69646960CFA20D4Dull,
+		    0x7D4C22DF9C431FB4ull, 0x05EDCA7AD865A3D9ull },
+		  { 0x0ECF0B19BA6F779Full, 0x33525005F0E89D49ull,
+		    0x01C9D71B5F0271BEull, 0x9E58881E48E886BCull } },
+		{ { 0xB379F9608DC703CCull, 0xAEA569B7160376B3ull,
+		    0xAC9356EB5857C526ull, 0x73CFDACBEF8C6A4Cull },
+		  { 0xA65E18594E1E5C55ull, 0x78EF3B9A43E85885ull,
+		    0x394DFCDF253517EDull, 0x4F80F3584201E6D2ull } },
+		{ { 0x9C8F9F41EB597E4Dull, 0x4974F325E77D1A31ull,
+		    0x121B45A33B771C11ull, 0x5A13C0560BC7A0A4ull },
+		  { 0xAF7E4869E41856E0ull, 0x7BDE87AB59136664ull,
+		    0x51FD18A0F22D73CEull, 0xC9E73C13890F97FFull } },
+		{ { 0xF790B4EFA70216CAull, 0x57E23B198E1539BAull,
+		    0xB21C60AE448FB2EAull, 0xB6EE9F71AB3F761Cull },
+		  { 0x24865BA1C5759234ull, 0x76EED96A290F9F0Bull,
+		    0xC820B826A8E9F4BBull, 0x5594644173E90B46ull } },
+		{ { 0xDAA789614260FAF0ull, 0xA2BBD34597E95935ull,
+		    0x43144E1A680F272Eull, 0x96B25656017B6E75ull },
+		  { 0xC0E42520E366D412ull, 0x890BBF98707D4F5Aull,
+		    0x00AD8E5733BF99E1ull, 0xDCF8A6A001B37CACull } },
+		{ { 0x8D9140F3D7F07578ull, 0x59B20724D6DB1A81ull,
+		    0x455322BB63570DF1ull, 0x8F51C431527FD5DEull },
+		  { 0x500400F045E9298Bull, 0x044CD7048083BE29ull,
+		    0x912A4F8D105DADE4ull, 0xFB97B65F1E044468ull } },
+		{ { 0xA49A1BE4AAD13276ull, 0xCA6350EAE9C043C7ull,
+		    0x26F12B2B387771A3ull, 0x0B971910C41CDE24ull },
+		  { 0xB338F3420A84DADBull, 0x593D79298270FAE3ull,
+		    0xD4E2E45B3BF6811Full, 0xAC28486EF006EEFBull } },
+	},
+	{	/* 16^13 * G */
+		{ { 0xEEA6BC92071E5C83ull, 0x8BD27F198542A0BEull,
+		    0x20A845B72A58E5B1ull, 0x54CCC9415026D73Full },
+		  { 0xCFD08EF7140916A1ull, 0x929E0BCC5D8EE496ull,
+		    0x3A8F8715DAD2BF22ull, 0x1C433F45B4514532ull } },
+		{ { 0x831BB80C01287C25ull, 0x83FD5B1E946F64B2ull,
+		    0x9D841014DCFBE833ull, 0x29E34B1BED8AA814ull },
+		  { 0x1D23AD1D75A7E46Eull, 0xCF3A198B6E15A439ull,
+		    0xC1417CDFCCD96B25ull, 0xEA4397DF95EEB3A3ull } },
+		{ { 0x4C5E3622AF76167Cull, 0x2F2F422CC4746739ull,
+		    0x39C22C692DCCD9F2ull, 0x87582EDCB73EFF95ull },
+		  { 0x6C6FBB616F4D7FF6ull, 0x88028F0677197BE8ull,
+		    0xFDE102C3C37236A8ull, 0x075B94350AD64A7Bull } },
+		{ { 0xF3D5BE3A53A3A383ull, 0x876F31533AB62409ull,
+		    0xEA5B5F1D3C001919ull, 0xD2A076367C5BA19Eull },
+		  { 0x65F2ABB22E7E0640ull, 0x5981AEFF3F598BCEull,
+		    0x6643A0F5BB9DCE30ull, 0x79AA09B893B7FCC0ull } },
+		{ { 0x46723EE874DE6611ull, 0x33F657394B821FB0ull,
+		    0x1C25B7363566F11Eull, 0x4A107ACA1F2736DBull },
+		  { 0x0358EBEE58A805FEull, 0x075D547A5C2132ACull,
+		    0x34CE64E8F700052Eull, 0x809B26510063EF39ull } },
+		{ { 0xE7381D983BD73A10ull, 0xA25280129DEC7B0Cull,
+		    0x13309D38E8962018ull, 0x206084C4FE23394Cull },
+		  { 0x4912D18DD8D2F229ull, 0xF5C315C424ECC003ull,
+		    0x0C08A9672CEB8393ull, 0x6133A0F86DA01697ull } },
+		{ { 0xFCBA4ED06DCFECB0ull, 0xE983FD1D30A8D846ull,
+		    0x654A0E0D49BF49F6ull, 0xFD402EB372AADFC9ull },
+		  { 0x10593F3DEDA08DE8ull, 0x1A4B4C24BDE65E79ull,
+		    0xE9A626389BABA86Bull, 0xD6B34030DDA63A22ull } },
+		{ { 0x7748532D4FA43529ull, 0xD505671AE1ABB34Aull,
+		    0x66DCEB631977D5BAull, 0xC56DD686B0FD846Aull },
+		  { 0x59EDEDACF9A521F6ull, 0x619E467816FB7EEEull,
+		    0x555D2C60A76B8C11ull, 0xF2ACAA85F3F1B263ull } },
+		{ { 0x5B4DD60F554659EDull, 0x7FAE3D22195D966Eull,
+		    0x5DFB8E07FEC9D0A0ull, 0x467BB34646187515ull },
+		  { 0x9B207D0B2800CF83ull, 0x701BC10DCD013E00ull,
+		    0xA1F2CD586DB82CD3ull, 0xD01EFFD05AA978E8ull } },
+		{ { 0x21478FE34E0592FCull, 0xA251B7F48713FD20ull,
+		    0xD32E184D6F066D54ull, 0xA217AC1F2A3F0F18ull },
+		  { 0xC080635E0EFB307Bull, 0xE860753A3E69ABF3ull,
+		    0x9E644EB36C550D68ull, 0x237FF4EE54584A0Full } },
+		{ { 0xEE64984ADC97E515ull, 0x6914D6C339885A5Full,
+		    0x6C879B630E9EC7E5ull, 0xCF66B98F8CDDC0E4ull },
+		  { 0x958214EA806C8A51ull, 0x33F07458D990033Aull,
+		    0x1C25B41034EC6A7Bull, 0x0A70717B90446121ull } },
+		{ { 0x0A86AF7404E21B27ull, 0x57CF59E4820A93DAull,
+		    0x52AA94EEB7EA8E3Dull, 0xB1C35B7E83DC78C2ull },
+		  { 0xF410A29F634AC059ull, 0x924BB475B7C4B4F5ull,
+		    0xFCD952A9563FFDB4ull, 0xA622031FF4E87D1Bull } },
+		{ { 0x3BA52A10186154E5ull, 0x86402A669AAFA0DDull,
+		    0x751C8953AD486770ull, 0x3D9252C60FBFAA34ull },
+		  { 0x77FC93F69603A8A2ull, 0xAEA1FB7D7C7DD707ull,
+		    0xC4493342896B4CF3ull, 0x3D0D01DCD2FA9D7Full } },
+		{ { 0xE8280185114A280Dull, 0x629CC4D8054C9997ull,
+		    0x7D05DACF9AFE3FA3ull, 0xA07CC3AF9DC3571Cull },
+		  { 0xDD0FAD4B744A44A6ull, 0x901015F9D7DBF4FEull,
+		    0x36DC228DC77DD726ull, 0x00C714B8A61A49C6ull } },
+		{ { 0xD3B63B62AA4A8DAAull, 0xE510600EF28A5CA3ull,
+		    0x760EB5B48F4A968Cull, 0x2BBE38B26889769Cull },
+		  { 0x7E08774E9236E49Bull, 0x9902B3A4E3EB6E7Dull,
+		    0x5E2CFEF91F960850ull, 0xF85707F600D3B36Full } },
+	},
+	{	/* 16^14 * G */
+		{ { 0xC30FB77122D32936ull, 0xE40CD02E32847F01ull,
+		    0x9F6CC7D1513D7F38ull, 0xC5440C597814A47Dull },
+		  { 0x9A42FA3747CABFD4ull, 0xD8A6D28631E41E5Dull,
+		    0x2EDC1E1D23ECF4ACull, 0xD27EE9BA383E1FA7ull } },
+		{ { 0xCBE1A18D2C2E32B9ull, 0xF165803DFBD492C0ull,
+		    0xFF3E42D52F5BAB12ull, 0xD07E95892DAA15AFull },
+		  { 0x5E78AD6A2C1A4F5Cull, 0x23ED98F15228E81Eull,
+		    0x731F0769F893EF4Eull, 0x774E4D6506724528ull } },
+		{ { 0x7D8501EC7989A8E1ull, 0x7C1D96F374EE4BDDull,
+		    0x7500E0479B9CFE0Aull, 0x3E4D03C45CDFA79Bull },
+		  { 0x98791388441C240Aull, 0xFFAF18D5F3BD6740ull,
+		    0xAAC117CAD7CAA719ull, 0x12F744D0815A6475ull } },
+		{ { 0x7601AEEEF79F7B91ull, 0x4275A149E19D957Cull,
+		    0x3A06AE0295829D32ull, 0x437F6E07B86FD8FCull },
+		  { 0x64B6ACE375270033ull, 0x589A771191396833ull,
+		    0xBF38B8289B15D63Cull, 0x5FE8D37CA889F13Aull } },
+		{ { 0x6939A8D0D9BB7902ull, 0xD8C26C7286B7C73Full,
+		    0x9A9A249E94485E9Full, 0x01B68449B3D61035ull },
+		  { 0xCD7F44B1E03EE653ull, 0xFCEB260471836682ull,
+		    0x0BF198E5C36D1581ull, 0xE59063A1E9379C3Eull } },
+		{ { 0x360CDEED45046203ull, 0x5533528ADC6CFCBDull,
+		    0x534665997D06E463ull, 0xD2EA9FB217FD7E77ull },
+		  { 0x8599F27A3E8EA623ull, 0x15DFF2D56A34C3F5ull,
+		    0x5B06420824500D44ull, 0x16AD23B09F909A70ull } },
+		{ { 0xC29B56D4C371D9FEull, 0xF04B356C1999D6BBull,
+		    0x335955A7C3AB3A4Cull, 0x952C3CB1ACCC9CA2ull },
+		  { 0xD76CE6D24189A13Full, 0x664464F11808C75Eull,
+		    0xA7DF9136F6ECE5D0ull, 0x59B98546F7D62F06ull } },
+		{ { 0xA969ECFEC51CD9C7ull, 0xB80A7C8A3447DB8Full,
+		    0x79CA1E2A6483EE28ull, 0xCECDFF7A5CAB844Full },
+		  { 0xEB76EAC729389632ull, 0x0D09D06B645E5A3Full,
+		    0x92AF68819C7D0F6Bull, 0x9323E54D22868008ull } },
+		{ { 0x847FFC768BC2C885ull, 0x1551EE775264E57Cull,
+		    0x858980450B97CDE5ull, 0xDFCB4EE15B166EACull },
+		  { 0x75D4A6431345D92Eull, 0x1C7738947BABE975ull,
+		    0x53C4FC26C82C0F41ull, 0x536A2395550613A1ull } },
+		{ { 0x0B2A89EDA94F574Eull, 0x803E0089BAC61D1Eull,
+		    0x5B409EB88958224Eull, 0x5885CFF254B12348ull },
+		  { 0xAE6CF88E4EFEAFEFull, 0x884A4C6BB7FA01C9ull,
+		    0xB5A3B70F2EE0CADEull, 0x83216E65A72BF298ull } },
+		{ { 0x738B852BF510208Eull, 0xDB8CCE2D84D79438ull,
+		    0x8A87AF3A047C97BBull, 0x157966C09BE6500Cull },
+		  { 0xD60EEE250D207357ull, 0x008FC64432DA43DFull,
+		    0xABDFF7B7BB8CBE07ull, 0x40446D5AB712264Eull } },
+		{ { 0x381B3C5D60776090ull, 0x6D23B7438180AF23ull,
+		    0x417D17453E33BC47ull, 0x01A002F610F90A08ull },
+		  { 0xF82C98A82445E13Aull, 0x93D90B768A2BEF87ull,
+		    0x963F415207A9B3E8ull, 0x30922DA21FEE7AA1ull } },
+		{ { 0x1C9FCCBE8B96FE13ull, 0xE4924AD3B4852EA8ull,
+		    0xD6E1A8FF813F6E23ull, 0xC6B21E3C4B1E990Aull },
+		  { 0xA006B96AF7BB1417ull, 0xFF65509179E6D2D6ull,
+		    0xE54B781E34EB28A2ull, 0x335BCDD8C3334D48ull } },
+		{ { 0x35790805FA8C8FA4ull, 0x46BD73BC9820A03Eull,
+		    0x95076388B655FBC2ull, 0x8D01C86339DEC705ull },
+		  { 0x10D61EDCC6DBDE83ull, 0x789EB1A45EB7EED0ull,
+		    0xB0B494B461A8DBD6ull, 0x9FD55DDDFA2FDCA0ull } },
+		{ { 0xC365819AC3936565ull, 0x97A7B36D977FA4C7ull,
+		    0x0B4BCA9D539522D9ull, 0xA231E4C478C7296Full },
+		  { 0x8AE56A0635EC5F19ull, 0x2BA56E0096F15426ull,
+		    0xC0D94EC68803CF94ull, 0x80E0C98BEC7FBE91ull } },
+	},
+	{	/* 16^15 * G */
+		{ { 0xBF9F4172B066FD48ull, 0x1C37101CB8971583ull,
+		    0x06C79B97A6BADCA6ull, 0x241C567A4227F1C5ull },
+		  { 0x7F7D2C6792857B08ull, 0x8EA87138AEA36605ull,
+		    0x9363817C043203A4ull, 0x40A62D93D4302D4Bull } },
+		{ { 0x42AE5B50783DFB7Cull, 0xA518B52EA2004466ull,
+		    0x609077A9243B173Cull, 0x4EA220C78BED1C8Dull },
+		  { 0xE5D9E6E88415E13Eull, 0x28C2A2B452324480ull,
+		    0x27417D9D954C8298ull, 0xC644DD2F1EC88D3Aull } },
+		{ { 0x861F7DB90DF9591Dull, 0xDCEC3AC242B4C82Aull,
+		    0xCBA0D3C4AB327218ull, 0xDE2FD23B826978E9ull },
+		  { 0xB4E1973D0457AD84ull, 0xDA9A8A1F88C036A4ull,
+		    0x05ECB7EC84B92EBBull, 0x400D71133B6243F3ull } },
+		{ { 0x0F02E89487D70D2Eull, 0x558DD9397551CE0Dull,
+		    0xEB27E145F21C1935ull, 0x9C8651CED75AE94Eull },
+		  { 0x9CD3DA9320F35D28ull, 0xF3ED01A82D75CF12ull,
+		    0x3BB36E293A2454C8ull, 0x9532E363AD04E53Eull } },
+		{ { 0x2EA8254AF562282Cull, 0xF02F3AF938FBC377ull,
+		    0x993948B024E11340ull, 0x8DF889B0304CCBDDull },
+		  { 0x7256ABD961D195CDull, 0x247F7044CEF9BB15ull,
+		    0x6C741E63188AF35Eull, 0x74525B673205CEEDull } },
+		{ { 0x9AE50A7E3DA4A543ull, 0xB2B21C2E5EDD208Cull,
+		    0x439D86DCA7A03FBBull, 0x211A671DAACF935Dull },
+		  { 0x532117BB36B69C0Bull, 0x37810C54418A6CF7ull,
+		    0x436D68DCA868838Aull, 0xF46D47A89BFEF4A0ull } },
+		{ { 0xF9D528950DDDB2DDull, 0x078864CDCC2C0DA6ull,
+		    0x001FB80CF152F245ull, 0xA0FD758CD98B80F8ull },
+		  { 0x7FD94FF873EDE6B2ull, 0x1C8CE96F89409A7Cull,
+		    0xF8691FD313B08F31ull, 0x53E5D835C13368D5ull } },
+		{ { 0x17A4F678C5D62AF3ull, 0xE93E7CA26BC0EC36ull,
+		    0xA708FBC0A52E5A71ull, 0x298A401A6EE92414ull },
+		  { 0x94763EF0AF0A3D96ull, 0x4866E6B9604ED6EFull,
+		    0xE40985FFC80C90DFull, 0x18F9A3AA04FE0466ull } },
+		{ { 0xE08CBAA04F542E36ull, 0x4E22FFAFA13415C2ull,
+		    0x7DE59267946335D8ull, 0x3170C58472D1A0F6ull },
+		  { 0xC6C475AEF63288B5ull, 0x006F75695999BE1Bull,
+		    0x37515093FEB9773Dull, 0xB2083612FC3A7FE2ull } },
+		{ { 0xE94C733AB6025D6Bull, 0xC002060FA12BAD98ull,
+		    0x32B2DB74238391DCull, 0x5B099DB0C70B101Cull },
+		  { 0x22502CA7F82FC98Dull, 0xB5D4ECD04852EEB4ull,
+		    0xADE148D1F5F01656ull, 0x9F529E2E79A81012ull } },
+		{ { 0x799B23A5DC7548E9ull, 0xD8DDA8070892D54Cull,
+		    0x9DB481694F063FE5ull, 0x92FAB0A90A2D3E02ull },
+		  { 0x8C712CD04917758Full, 0xC8A0DC68EF2D0848ull,
+		    0xF431714E0C2679FFull, 0x55E7B4680CB246BCull } },
+		{ { 0xDCB5D5B2E7795486ull, 0x33D2E0AD04572CD6ull,
+		    0x643976F1021E0380ull, 0x60EA8CDD9A9CD83Dull },
+		  { 0x07D5CC267CAF96A1ull, 0x475534ED19CD7093ull,
+		    0xEAD5790FD0685F4Bull, 0x262967E6F092D4B0ull } },
+		{ { 0xE0D8050B9498F7F8ull, 0xC4DF67D326411622ull,
+		    0x9D0BE11B192C8712ull, 0x91B065BE18035517ull },
+		  { 0x3C740D9E3F23195Bull, 0xDF2C7B425789639Eull,
+		    0xFF9FF3490017E264ull, 0x035B6F77FB671620ull } },
+		{ { 0x24F9181974EED127ull, 0xDDD013E967492859ull,
+		    0xF408B832247DC145ull, 0x1228C7E6BC4D4A41ull },
+		  { 0x6A01CC351A1DA910ull, 0x90F8CDCB12F0F703ull,
+		    0x492B6CB25F9A6B04ull, 0x61044D3DDE684EBEull } },
+		{ { 0x51DCBEE24060E322ull, 0x3ECDC737A9C4D14Bull,
+		    0x9C390697489AB992ull, 0x8E4A1F4CCAC9CB3Aull },
+		  { 0x4E2183CD904619D7ull, 0xFB00A98D954FBFE0ull,
+		    0x2FB05ED2406E7BC4ull, 0x4936B75EB328D775ull } },
+	},
+	{	/* 16^16 * G */
+		{ { 0x90E75CB48E14DB63ull, 0x29493BAAAD651F7Eull,
+		    0x8492592E326E25DEull, 0x0FA822BC2811AAA5ull },
+		  { 0xE41124545F462EE7ull, 0x34B1A65050FE82F5ull,
+		    0x6F4AD4BCB3DF188Bull, 0xBFF44AE8F5DBA80Dull } },
+		{ { 0x794A16BAA05F57B5ull, 0x53FE448A57324591ull,
+		    0xE4C13D0306960801ull, 0x031A8747DF8DC746ull },
+		  { 0x1827EE579C0343FDull, 0x1431C18C42B8DEF2ull,
+		    0x60E8AA6C1E387A32ull, 0x883A2C64FDA8D586ull } },
+		{ { 0x752C453F7DB3CDECull, 0xDBEF3A12B228EBF5ull,
+		    0xE596645E7BEA4BC8ull, 0x85B2C064FF912F5Cull },
+		  { 0x8F4D08204A03F81Full, 0xDC980B34E64CF8E0ull,
+		    0x63C7FA2D2FCC6D00ull, 0xF64B278F39D11536ull } },
+		{ { 0x015E2E65580B2322ull, 0x4ECCAC6096513CCAull,
+		    0xF9571975C0D5934Aull, 0xA7163C2B9B973C17ull },
+		  { 0x3933B2232197FFE9ull, 0xB841A4F4E09952D7ull,
+		    0x63389991545A6B7Aull, 0x308A9A797AF31FA5ull } },
+		{ { 0x288A5AE48607B030ull, 0x24DAFF63E584D673ull,
+		    0x7851FBACEC16F29Cull, 0x110B0376C4021467ull },
+		  { 0xF43AA112B3617C3Aull, 0x87BE1556FB298749ull,
+		    0x4C6EB89F8461C70Cull, 0x84432B85318EE673ull } },
+		{ { 0x9AFBD3916A334020ull, 0xA18159998EF9AFB9ull,
+		    0xE22A0772517690ACull, 0x3C714524875D4EEDull },
+		  { 0x6102A85CBA701655ull, 0x152FCAAFE7938C2Cull,
+		    0x4889E729FF7F3D8Cull, 0x7F090565771AAF5Cull } },
+		{ { 0x54EDD81C75A76F08ull, 0x3295F2538BBBED4Eull,
+		    0x14F6E1242B1CAAF8ull, 0x18784E449F6471D7ull },
+		  { 0x0B39605D6B824993ull, 0xFC9D74A7A60A2532ull,
+		    0x1777A8FDAC71E671ull, 0x8D76ED7F4A1E1AE7ull } },
+		{ { 0x6CB04A6A5C42A280ull, 0x02A50C382DB2670Cull,
+		    0x811B3923EF4B991Full, 0x1BFFAB8C03AB8279ull },
+		  { 0xC9C742364DDB9261ull, 0x982A369AA9D24FB6ull,
+		    0x332AC758529F1AAAull, 0x2982B620CEB1D098ull } },
+		{ { 0xCE8E33C9FA6FAD81ull, 0x9C3365748C0CB03Eull,
+		    0xAEF56DD7703A037Dull, 0x58A2F9E07D05E6B9ull },
+		  { 0x5400615E3B109594ull, 0x798BB2D32D300B82ull,
+		    0xC1B682F8717FA6BDull, 0x06AB64C5AC5560E0ull } },
+		{ { 0xF0EBCB0ED3444C74ull, 0x9E5CB1D7B595F7FFull,
+		    0xFB88219241F2D6C5ull, 0xD9A822BA07B6BC2Aull },
+		  { 0x5F9ED1AFC2338891ull, 0x2D6ABBD72AEF8A78ull,
+		    0x0E7B8740FF7B504Full, 0x48E4749ECB370ECBull } },
+		{ { 0xFB22F11F9EB52583ull, 0xEA8A99CEC10CC13Aull,
+		    0x40EE6DBB278F676Full, 0x1EF020DCCE7EBBA2ull },
+		  { 0x55B278197A3F17AEull, 0x6AC300F97012D4CBull,
+		    0x097F6C0F4B969530ull, 0x594476B25A7A14B0ull } },
+		{ { 0xE788E04AB021A9BEull, 0x18B0C59B8AC074B7ull,
+		    0x9D76B8258B28B28Cull, 0x66AA4FD12ADD747Aull },
+		  { 0x88B5A3AC03A15A99ull, 0x9D64422D106AA108ull,
+		    0xCA94F6C567E1DC3Full, 0x10C65E609047474Cull } },
+		{ { 0xB5C23EC1F0A1958Full, 0x4F39B5246FB56643ull,
+		    0x95DD144CFABFA32Cull, 0x4E4A8163C1D6A213ull },
+		  { 0xA43B3F5148636F8Aull, 0x4004085FB2C43D66ull,
+		    0x033F4A3EE29C6FA8ull, 0x2574A45B79E8C8D1ull } },
+		{ { 0xEF0F43B30A7338BFull, 0xD10A694EA5FF8400ull,
+		    0x7C2B1A4EBB312CC8ull, 0xE31D414BC13EA842ull },
+		  { 0xD23C40B0F878F170ull, 0x35CEE4F5D7185BC0ull,
+		    0xA87559754BF051FCull, 0xF8AB200A672A9E53ull } },
+		{ { 0xE8275A8464935DB5ull, 0x281798261C6BDB0Eull,
+		    0xE3327E0ED594519Eull, 0xF6966A16ADD61104ull },
+		  { 0x3A34836C1D166838ull, 0x2D7453A34401BF01ull,
+		    0xC1A5EE572C3C755Eull, 0xBA0DE307A9031DB2ull } },
+	},
+	{	/* 16^17 * G */
+		{ { 0x68F41305B76A6987ull, 0x2B481AB443DA43FFull,
+		    0x7DDC6988D7EE1B3Full, 0x54BC18D7A9989954ull },
+		  { 0xFE457CD05B9AAE49ull, 0x52EB8ED4BB73B119ull,
+		    0x7391B851BA73E2FDull, 0x4B2C8C1211E6EAF3ull } },
+		{ { 0xB2A64C6196260250ull, 0xBA770F18355CCA4Cull,
+		    0xF33D8173A6FB4D96ull, 0x1F380071781DFF16ull },
+		  { 0xB1519B2E6B011955ull, 0x1B8567660590D693ull,
+		    0xA33705176CA2CF62ull, 0xB1521EC4BA6C681Dull } },
+		{ { 0x38BF47F5FD1FD820ull, 0x7887854648767500ull,
+		    0xA863502262B1271Bull, 0xBAFBBCF680C1C52Aull },
+		  { 0xEAEDAD521BF074F0ull, 0xE81C34A1231FCAD6ull,
+		    0x2CE7BF5AC89BC0FDull, 0x1487997C9DB4DD81ull } },
+		{ { 0xEA6D95D177AE84DAull, 0x58E6EA55222034F3ull,
+		    0x41E0BE2B789273A0ull, 0x99EBA192AADB019Full },
+		  { 0x8DA39DBE02155CACull, 0xB630D866D7108D10ull,
+		    0xF4F806644530184Dull, 0xFC4DC4CDE1EFBFD9ull } },
+		{ { 0xE917081294299B7Eull, 0x24E79F2D0986E0D0ull,
+		    0x2A3C3BFC75C220ECull, 0x9B1938F7103389FEull },
+		  { 0xC57B2857447B84DEull, 0x0ACDE851F86B8232ull,
+		    0x3140E98E1CAA3EC9ull, 0xFB12AA6EF1710283ull } },
+		{ { 0xCA3A26BA0409CA06ull, 0xB46C5F5F8FA42E6Eull,
+		    0xE81EF0EA907BF3D8ull, 0x19B738FC965208DCull },
+		  { 0x023530A35741156Dull, 0x7CB418DF147531E7ull,
+		    0xE02610B7E55A7ACFull, 0x6FAAD12C8F69664Bull } },
+		{ { 0xFD410740D10CC4C4ull, 0xB71D35A2C4A53DA0ull,
+		    0x7C381FDC06761B2Cull, 0xA6771985CC017590ull },
+		  { 0xC20F3B237C976570ull, 0xBC745773A6FF3094ull,
+		    0xF29BD6601E5D9C3Dull, 0x85506185F750DD98ull } },
+		{ { 0x896BF7C7F7F96003ull, 0x9D4E993B7604A5FAull,
+		    0xFC5945CE21621E08ull, 0x6D50856433968435ull },
+		  { 0x0271CCAAAC7E969Cull, 0xD6C0D6DC8263A0D9ull,
+		    0xC6BC5D8AA2C7EEF9ull, 0xCCF57357E968C6E7ull } },
+		{ { 0x5410802D54242A28ull, 0x455BCB21253CA771ull,
+		    0x09E8AF784B774ECAull, 0x88B7ED536B0EAFC1ull },
+		  { 0xFB9681EC794ED8CEull, 0x4E366A1C8F83E347ull,
+		    0x47FBF9DD3587BD93ull, 0x22B053206245345Eull } },
+		{ { 0x80C3376AE718BE8Dull, 0x81903D7CE982EA1Aull,
+		    0xE4432457540E80D9ull, 0x3C7716E62CCC6873ull },
+		  { 0x49BA01CC4164D021ull, 0xA59E60C87A45FECBull,
+		    0xDB110B6C00DBCAEBull, 0x5A32EA941FCAD1BFull } },
+		{ { 0x016144EC9BC1A94Cull, 0x51671D2B3E71DAF8ull,
+		    0x052D72B0225E8757ull, 0x037114012A86B3D2ull },
+		  { 0x8C0C0B6CEFC2073Cull, 0xC8518C362AC42483ull,
+		    0xEF8C21A54AD05335ull, 0x4D1D693D51DD7390ull } },
+		{ { 0x37876C952CB163FFull, 0x13D2B7E10192292Full,
+		    0x1C57C7CCDF9D70E0ull, 0xDAE897C18D42E1A1ull },
+		  { 0x1C8BEA7D89379690ull, 0x8F0D25BE5F08FAEFull,
+		    0x6322B3CF21D9789Bull, 0x5F4C0F44A1B406A4ull } },
+		{ { 0xEFBD1E09877F88BAull, 0x50980779EE9BED36ull,
+		    0x34B5A32E84EA2CC3ull, 0xCC98214C8984293Eull },
+		  { 0x0A462EFC87885278ull, 0xEFF60E7EEF354C4Eull,
+		    0x114C4A64677D63ABull, 0x04EBB4E8E525AFA9ull } },
+		{ { 0x7048622FDF2DA37Cull, 0xF4C671631A8E1E03ull,
+		    0x63089FEA4FF8EF3Eull, 0xF8A801D390B66981ull },
+		  { 0x2A4C6789B77A8615ull, 0x1898C6F78D44E052ull,
+		    0x7ABC626C8F5A7BFAull, 0x0AD9434C776BC636ull } },
+		{ { 0x1573194DFD70187Cull, 0x751AC8629B640C7Full,
+		    0x9814E5E0290F5BF8ull, 0x0AD3AE029A42A10Full },
+		  { 0x7DFFCF4B3FC775A7ull, 0xD034FB081662A0F6ull,
+		    0x785C55F05FABB33Dull, 0x2AF040D4758846E3ull } },
+	},
+	{	/* 16^18 * G */
+		{ { 0x60AAFAD170AAE231ull, 0x5194B85279F96B7Cull,
+		    0x85F248239267756Full, 0x1D35C9699761E3F2ull },
+		  { 0x5867063ACCD6AC71ull, 0xEDF58AA4729A66F1ull,
+		    0x1D660AB622EBF810ull, 0xC7226CB62DF60823ull } },
+		{ { 0x501A327426432D92ull, 0xD9C9823C2B473903ull,
+		    0x9910E1C2A6397AB4ull, 0x6F2B065A7800CDD8ull },
+		  { 0x6D2D1C4963E17C9Full, 0x093BF02DE33DBECBull,
+		    0xEB1472CF700826C5ull, 0x0ACFEB77E5E7A2E4ull } },
+		{ { 0xCE0D3FE18CFA3FACull, 0x23AD869FC32B8193ull,
+		    0xE2CEBB45D60D8030ull, 0xDF3D4047A6D2234Cull },
+		  { 0xF4626D938FC7D419ull, 0xAFD63CE496882975ull,
+		    0x24AA21F29C0F9DBFull, 0x48FA6F5229FD40DBull } },
+		{ { 0xE3065E088A6EDBF5ull, 0x2F3352569662876Bull,
+		    0x68991DA7FDADD0AFull, 0x870AC12BA3DD7774ull },
+		  { 0x1906D2DCF02F8CE3ull, 0xD03C64022E5F297Eull,
+		    0x8DE7EFD769D05A67ull, 0x7543728B999A7699ull } },
+		{ { 0xAED925AE1F1322D4ull, 0xCB0A69404ACCDCBBull,
+		    0xEA1E6C4CA311F822ull, 0xDBB2AF6AB1F96144ull },
+		  { 0xAA492B4F4A8C5311ull, 0x9A9FC9787B7E3A5Full,
+		    0xA1B60D1ED6433F9Dull, 0xEBAE75B92F13561Aull } },
+		{ { 0xE8A58ADA373A6B7Aull, 0xF3ADF06C6252D45Bull,
+		    0x09B667AA14226D09ull, 0x17B29FD1B5222134ull },
+		  { 0x0C1482074844EBACull, 0x39D03897D388CBAEull,
+		    0xE9924E663EFEFBD2ull, 0x15FB4490352F3D4Eull } },
+		{ { 0xF069A33CA1138F7Bull, 0xC4C1C93E2DF2E8F2ull,
+		    0xCAFA8A267F9B5F0Bull, 0x1DBA7B597F261FD4ull },
+		  { 0xDC82D8C7A39BF268ull, 0x8136E6B7998232C0ull,
+		    0x3AE19006BB8007F5ull, 0x6AAF7D3E5DE7EFC6ull } },
+		{ { 0x7AA6E46350C06AF3ull, 0x6A9E8C749FDBF0F0ull,
+		    0xA0BF5FEF8034DB34ull, 0xDBEC13E6DA0D5592ull },
+		  { 0x7CAF0F7CB6D243EDull, 0x42243A3264EDB664ull,
+		    0xC0E57348B745E4D4ull, 0xF859978FD619E5F8ull } },
+		{ { 0x8DA87770179A70AFull, 0xEC9D429A9B64DF28ull,
+		    0x31BBE82D5F5305C6ull, 0x348A2E442626919Dull },
+		  { 0xCA84861487B66E82ull, 0xB2A7C2C5B7E13E5Aull,
+		    0x8C747BCE00230105ull, 0xA1B9FA79F55A3E80ull } },
+		{ { 0x59476EB82CF4B3EBull, 0x8F8E3C46C59E4946ull,
+		    0x88D9640515697BFBull, 0x2820910FB5E0FF12ull },
+		  { 0xBDA69D20C1D6DF4Cull, 0xC0F9BD31A62B982Aull,
+		    0xA8DEC339EC825A12ull, 0x94D9C37635A1A28Dull } },
+		{ { 0xC7476D76C4D3A201ull, 0x36E926A4FD9B9EEFull,
+		    0xA86A4FBF931ADF5Full, 0x3A4EC851999C9E1Cull },
+		  { 0xDD8596F768635F89ull, 0x27D31E5AF73CD55Bull,
+		    0x69E03C11A4774A8Bull, 0xC99A2EF82F6262DEull } },
+		{ { 0xFBCBD75EEC3BACF9ull, 0x0254295C49227F9Full,
+		    0xBA6D73897768FEDAull, 0x148CF7FD16F0A1ADull },
+		  { 0xADDD8AED8D143036ull, 0x2ABF4481C576DD9Bull,
+		    0x78AA8117E505B36Cull, 0xFFF2799DEF47DCC3ull } },
+		{ { 0x1EFAE72FDC978567ull, 0xE15DA68840DC1F98ull,
+		    0x84E935D62FF1F60Bull, 0xB1BA52D88334D457ull },
+		  { 0x77FA482A362DC291ull, 0xD9A46CB0BAFCD40Aull,
+		    0x7C5F7CF713DBB78Full, 0xA46BAEC7A86943A7ull } },
+		{ { 0xDF392C1F5C5D5653ull, 0xDA88B77C165C55B9ull,
+		    0xA7650860A2D365C5ull, 0xF2C392BA6EC31DE1ull },
+		  { 0x93152947AF189F45ull, 0x5CD94A9F671B8640ull,
+		    0xB3010946E5903D65ull, 0x5B7396AE40589537ull } },
+		{ { 0xD228EEA512350DA1ull, 0x19414C77C175F043ull,
+		    0x2718B7B969612C2Full, 0x0AE6EB3D8EF2AAFDull },
+		  { 0xC73E09F370A14BC3ull, 0x66D468F0ED43DA4Bull,
+		    0x2DD034F7FC4189B5ull, 0x99CDEE9FB6006CAEull } },
+	},
+	{	/* 16^19 * G */
+		{ { 0x5572AEA8750E4F5Full, 0xCBF5CA9AA567E0E6ull,
+		    0x388FF0F7AA02F29Aull, 0x55D9A959844B5AEFull },
+		  { 0xC858EB76BCA97DB0ull, 0x4C9810C633AD1B15ull,
+		    0x766D574FBCC8EC52ull, 0x69CB7F9AA5DAD203ull } },
+		{ { 0x0758CB4D57C6F8FBull, 0xF517323E3F09B5D3ull,
+		    0x38F9434C2F72E662ull, 0x8C76689BA78A1661ull },
+		  { 0x7DC5B39A9BCF2306ull, 0xF0B11FC3136BC05Full,
+		    0x288489B0C63D6DCDull, 0xCD3172990A409D3Aull } },
+		{ { 0xC06A9887FEB142E9ull, 0xC176EB064607FCFBull,
+		    0x794D86838FAED480ull, 0x4B0043EBE46F3E11ull },
+		  { 0x04B2C52D62C68552ull, 0x0F23290F3A125888ull,
+		    0xDB17884636222D87ull, 0x173CCF23A30DAC1Aull } },
+		{ { 0x1EE45F92ED69F1D5ull, 0x46543768CE5E1244ull,
+		    0xF0C6A4169281BF87ull, 0x3FB5909A93DFE46Aull },
+		  { 0x13D4FEFE99A56CC5ull, 0x25D35688FD0562B0ull,
+		    0x704A4E3A3BDF7754ull, 0x549991AC0BE8809Full } },
+		{ { 0xF6DD4AE717F1AA96ull, 0x13D7A5F734FF6481ull,
+		    0x32728DCBB73463C5ull, 0x79EAD27992AD6FC2ull },
+		  { 0x80BA71CE4B0A3FB7ull, 0xDE84D71111B3955Aull,
+		    0x1A6E439356256542ull, 0xA95DE9CFFBAADABFull } },
+		{ { 0x66C3EB2F1637A274ull, 0x45210457612D5806ull,
+		    0x4DA377C3236DC074ull, 0xF01DEE116A3E4A41ull },
+		  { 0x743FD470839D3465ull, 0xE6923F6ECF94C497ull,
+		    0x42615F231E1D01CAull, 0x24CFADBC9AF48BF3ull } },
+		{ { 0xC805CA72F93A9AE6ull, 0x8EE0AA059C77F8ADull,
+		    0xB5279E3631AD743Full, 0x318E0050F24DA1CEull },
+		  { 0x184B5694DC447D79ull, 0x94536FDBAED3A8EEull,
+		    0xF4D17CA51E504BD0ull, 0x2792EE1119CE9299ull } },
+		{ { 0x506F1270BDE7BC7Full, 0x7FEABB0CBEED3E03ull,
+		    0x8AE227E16FEAF253ull, 0xC34ACE1CE5DD9040ull },
+		  { 0xAEB63980697806C4ull, 0xD6554299BD55A442ull,
+		    0xE623B8BE80166F12ull, 0xE1EF3B3A009857E2ull } },
+		{ { 0x137945B4DD30585Aull, 0x95FF8A1AA3501495ull,
+		    0xB88032F490C0A4B4ull, 0x6BBC5471D2F1E43Bull },
+		  { 0x6AF97EEF348B05F3ull, 0x09F0428102F9EAD9ull,
+		    0x4A9EE2B15F2226BEull, 0x467B189B0C1529F0ull } },
+		{ { 0x75E8371F56AFD841ull, 0x6BF9F5C2298A21BAull,
+		    0xF00FBBDB9E100B79ull, 0x09B4645C389DBFE9ull },
+		  { 0xA99C9A5EDCA8547Aull, 0xE158B7EC83FB5A87ull,
+		    0x0D51D52781161D80ull, 0xC0D370E6FB9944A3ull } },
+		{ { 0x2624F808C0136275ull, 0xA647C00173877535ull,
+		    0x89B51A90F7760D78ull, 0x940148C610C1FD11ull },
+		  { 0x5D63A1115997AA47ull, 0x5D4B3AE5604E1A42ull,
+		    0x7AA24C4AB505D669ull, 0x6967F95F1367A4F7ull } },
+		{ { 0x4D8A0E970F154768ull, 0xD6446F4C54960456ull,
+		    0xC3B5AD54CD3B6D7Full, 0x11C6B94FF7180C69ull },
+		  { 0x0A98238928F3C0E4ull, 0x62085B9673D6CB8Eull,
+		    0xD71027BDFF700360ull, 0xA84AFE0696A2D9EBull } },
+		{ { 0xC3A13DD39F0FE850ull, 0x864D230BE511A7BDull,
+		    0x91B56C928DA5F98Eull, 0xC41833926039B49Cull },
+		  { 0x1358F446BD38666Dull, 0x065A7EC9E01A0AF0ull,
+		    0xEB8095D426AFD558ull, 0x3537FEC9C8D40F7Aull } },
+		{ { 0x4FEA097BA99DE8DFull, 0xCEDBEBC89AE27B3Full,
+		    0xA9B0EF3B1B65592Aull, 0x4BC2CD77649DD764ull },
+		  { 0x03D0C1F3CCA78F3Aull, 0xEC450902D2E16337ull,
+		    0xBE112B9429EAAF87ull, 0x00BB1FC03A547A1Full } },
+		{ { 0xCFE4413774937FBEull, 0xC0B04DDDF051BA6Eull,
+		    0xE0C14001AF96F546ull, 0x2BABA3F627C67D70ull },
+		  { 0x9390E557573A1DF4ull, 0xEC2DC4B190AC8110ull,
+		    0xD783B0CD924EABC9ull, 0x77E5C765B2208B88ull } },
+	},
+	{	/* 16^20 * G */
+		{ { 0xD4D3D2DE4351964Cull, 0x346924376F5412C1ull,
+		    0xAE5ABCA185755C08ull, 0x6E29F959BE28C47Full },
+		  { 0x118824BD563FD88Full, 0xEF640C527A0BFB63ull,
+		    0x5052EC6CC184246Dull, 0x34565D9F500F32F6ull } },
+		{ { 0x61E0F0EFE5E84DA4ull, 0x3B09F0776ED90CADull,
+		    0x10CFA381496E6894ull, 0x8EFA0F79B5909A0Bull },
+		  { 0xFDE19F42596969D3ull, 0x79957C4897816035ull,
+		    0x9FA46F1C5DAAFD14ull, 0x242418E7934CD613ull } },
+		{ { 0x3F9501038C0E49CCull, 0x41232DA85BC5400Dull,
+		    0xDD8288DECBB740EDull, 0xD691D4A978970F6Eull },
+		  { 0xDD0BB4C1D00F4152ull, 0xAC5BE1D02AD043F2ull,
+		    0xF7FBBDB5763E0C52ull, 0x7A79E7874B78F397ull } },
+		{ { 0x4ACAF2C0023AC4CEull, 0x1F8973E31EB3F397ull,
+		    0xB9D6D6D0F360DB2Full, 0xD0D4AF73CB8FDB30ull },
+		  { 0xE3DF0360A47DD6B9ull, 0x61850B1C863AAE77ull,
+		    0xBBE9CCEE3E529530ull, 0xED90F8C8F15D7DDCull } },
+		{ { 0x3D876B9F2B9B930Aull, 0xDEB1352A4530F58Full,
+		    0xDEE5B7DF7A7BBC49ull, 0x2A5D6846A2E0D7C5ull },
+		  { 0x86FF345F3B2CAECAull, 0xEA5B73435E271685ull,
+		    0xE5CCF03903C4AB58ull, 0xDC3D7C096876476Dull } },
+		{ { 0x0BC6E130B886719Aull, 0x165CB495470922F0ull,
+		    0xFD851C4D332B75E3ull, 0x8B277F8CE445915Bull },
+		  { 0x078B30FE6ED37C38ull, 0x55213780CEA31A3Dull,
+		    0x6E4B52EE69EC9139ull, 0xCF44D77B164543BCull } },
+		{ { 0xFA7DCBD2816959EFull, 0x7679D056741DB59Aull,
+		    0x2F0431412E275DF8ull, 0x8764496A389BB526ull },
+		  { 0x660311CBE0CD5010ull, 0x2856AD4172F9E3F1ull,
+		    0x9E0B412796ED961Full, 0x599B69D61D002FFDull } },
+		{ { 0xE399DA6192397D42ull, 0x38D1D60251256EACull,
+		    0xA6D6F71B65B85F90ull, 0x829B8DD0ED5452E8ull },
+		  { 0x91B71631E3DF5612ull, 0x5C5ADC4263AD1A5Dull,
+		    0x99E73C8A896241AFull, 0xD300EC543FCCF46Dull } },
+		{ { 0x639409CE3AEF0F84ull, 0xB0BB506A871C75B9ull,
+		    0x33DE3FAC17ADB8CAull, 0x94D393BC812471B1ull },
+		  { 0x85AE61B9378BA7C1ull, 0xDD3F402650ACF12Aull,
+		    0x1E1CBC386B239A07ull, 0x5A826AB4EB4B63F2ull } },
+		{ { 0xEADECF09028CDCB4ull, 0x72A1B40690A1CF86ull,
+		    0x2EA231DCCE55180Full, 0xE925A006C6F2A348ull },
+		  { 0xBB9619760589AF3Aull, 0x8EAD37DD62073759ull,
+		    0x4DD045436194510Dull, 0xE402787FAD456996ull } },
+		{ { 0xED455784EFFED1B7ull, 0xE2DBD126564AA3B4ull,
+		    0xD17509702D34BD2Eull, 0x4A72B5A0889E4E2Dull },
+		  { 0xB5F29FD89601DC5Full, 0x85E64B8EC74D9845ull,
+		    0xC8C33FC047C8EA96ull, 0x3531E6EA4A1D20E2ull } },
+		{ { 0x368F5340EA0046BFull, 0xCFCF8A096442A045ull,
+		    0xEC01DB905A3615F7ull, 0x88EF3688969B1509ull },
+		  { 0xEBE6AD23BFA86F2Eull, 0x8AE2D212F193196Cull,
+		    0xDF93DEEA7A4B46FCull, 0xE4204DDF22F356B9ull } },
+		{ { 0x02043F25D0467317ull, 0x9141DC41D8D9186Aull,
+		    0xA78666F2FADE7900ull, 0xD7F01CFC5A371E15ull },
+		  { 0x5CB957D5CF7D014Eull, 0x28A01743697FBD89ull,
+		    0xEC7361406C15EF57ull, 0x888DBBD987726C26ull } },
+		{ { 0x33BE1811B6799F9Aull, 0x85D6390ACDF4C550ull,
+		    0x072DB42A73B408F2ull, 0xDBFE86D71283894Full },
+		  { 0x50DE611DC79DC6E9ull, 0x7FAEF77D234E71F8ull,
+		    0xA558A73FBF3E51FCull, 0x445B3C7D17C68718ull } },
+		{ { 0x3BD7590A7DEA02C1ull, 0xE4FBB9B7C774087Cull,
+		    0xBE80BF9D91E31206ull, 0x7E50A0B9F77C371Bull },
+		  { 0x33C946DFED45C201ull, 0x7423934F158E1B28ull,
+		    0x616C6F1DDB8B9517ull, 0xC3405D3C4E0FE29Cull } },
+	},
+	{	/* 16^21 * G */
+		{ { 0x28A7D4110CB71280ull, 0xC141C259A8456311ull,
+		    0xC00F2EF0796F458Eull, 0xFF046A9EB2BFEED9ull },
+		  { 0x7EC3271F5EC33919ull, 0x012B6E6EBD28487Aull,
+		    0x0A01EDDBDD4CFCC9ull, 0x432F55ACC0953A17ull } },
+		{ { 0xB2BD41C7B0B3DA07ull, 0x011745F856DE35ACull,
+		    0x8FABBCCC41287DF4ull, 0x5890C0F334DDC2B0ull },
+		  { 0x623D0AE88D3813E0ull, 0x55A279CE3E2A8166ull,
+		    0x5E4604FA4F792726ull, 0xCC9EAC788B1D9C04ull } },
+		{ { 0x5F2782AA33CA3CE3ull, 0xEF2B1865AB6A77E2ull,
+		    0x1A95BC1F5312231Full, 0xF717C45D14D3DCD3ull },
+		  { 0x6894CCDB50ED88E9ull, 0xAF53E2BDDC176DF0ull,
+		    0xCA9B54ED0AADEE55ull, 0x422C40768C99512Dull } },
+		{ { 0xFDC73E83BF780C2Cull, 0xFFDC67942D666817ull,
+		    0xC14B66DD02436893ull, 0x6EEC95670D54650Cull },
+		  { 0x089EC1A1EDBFCD32ull, 0x79AB66153A07FF89ull,
+		    0xFC281DE065EA0105ull, 0x14BB5350997732C2ull } },
+		{ { 0xC368430D5B28CD88ull, 0x738E097502A9BD9Aull,
+		    0xC2FEB5627F91B32Cull, 0x60E269B4F3370B20ull },
+		  { 0xE29BA8A42BE2066Cull, 0x02456138C6C846B0ull,
+		    0x609211889728DF76ull, 0xFE00175A6579F0A9ull } },
+		{ { 0x0DE04E8FF43FAE7Aull, 0x06D74F465C3813B8ull,
+		    0x01E037ACD13E8ACAull, 0x2209938B8C24AD56ull },
+		  { 0x866F6AA1C7E52306ull, 0x53B8E6AF17AFD946ull,
+		    0x28002F3A42008C8Cull, 0x9BF8E087B32B55A5ull } },
+		{ { 0x153B1932861CC594ull, 0x964BDD1704D0536Bull,
+		    0x0AA5BA05FCB46855ull, 0x799297A1E6739949ull },
+		  { 0x9E9110920F8D309Eull, 0x27DA86AE0BAC6E90ull,
+		    0xE1069118789FE501ull, 0x132FF18CD523C9B0ull } },
+		{ { 0x53D6D6E9019FC555ull, 0x08F69591EEB51BD8ull,
+		    0xB79470F6AD3DA829ull, 0xA0E2410CD09C01A1ull },
+		  { 0xCF340818C1AC6D8Dull, 0x8BBAF19F6B667930ull,
+		    0x2AC3B57BA5B2FE89ull, 0x1E29648C71BFDED4ull } },
+		{ { 0xDC8C47A2572D0ABAull, 0xD8D190ADC77E1B16ull,
+		    0x79EE0EEB5501241Dull, 0x2D9BE94EFE428070ull },
+		  { 0xF8F731FB31FA0876ull, 0xBAD1C67988B710E6ull,
+		    0x295EF934B619D91Bull, 0xA9708DB5E9E898A2ull } },
+		{ { 0x54BD04AC01A9645Cull, 0x01E8D05EEB9C3D74ull,
+		    0xCCC8B4D00C53D2DAull, 0xC7FF399F359F33ADull },
+		  { 0x119C0CDD46B6EDF0ull, 0x2A82A5219723665Aull,
+		    0x672EFCBB7DA1EA09ull, 0x4DDDEB8F46852216ull } },
+		{ { 0xE0C07B48355E8732ull, 0xCFA62EDE506D1E31ull,
+		    0x60CBC6531492C243ull, 0x2127039EC8824216ull },
+		  { 0xD59235F460CACC07ull, 0xD693F3F3BAD7BD68ull,
+		    0x0194B9DBBB7F0A5Cull, 0x85219C6F23AE35AAull } },
+		{ { 0x6F15B01492205E77ull, 0xE6BCB55C30A0ADBCull,
+		    0x7E1B44C540379E31ull, 0xD659B87F2A2AD401ull },
+		  { 0xE15820B5B448991Dull, 0x76A0B2EB631CD452ull,
+		    0xFDE13C935ACB7287ull, 0x845D83F4F6E49E35ull } },
+		{ { 0x6091340CF2083347ull, 0x9E1AE3E6771A5322ull,
+		    0x97AD0F5ABA02B42Bull, 0xFAB5B54B2BD8E0EBull },
+		  { 0x9CCC9CD83D38FD2Full, 0xC05E37A616A69AFAull,
+		    0x3C87AAF2260A3EAFull, 0x5758D116186D4150ull } },
+		{ { 0xB4E7EB431114CC35ull, 0xA49CD1B2E4B1FB8Full,
+		    0x1F067857DE8521D0ull, 0x91FA0534BF36FD47ull },
+		  { 0x5638B951BC92CB28ull, 0x12688CEECCBFA684ull,
+		    0x20DD5A3CE0F981DCull, 0x358D02069A62FE26ull } },
+		{ { 0x3F672614FF572554ull, 0xF3842E4718F4DAB7ull,
+		    0x579096770B7EA56Full, 0x685D275727971FCAull },
+		  { 0xB71AF6D0A0979E03ull, 0xC58AAA2AC0F4CCA4ull,
+		    0x06E39C8041E0377Cull, 0xA82F89C220AB45FCull } },
+	},
+	{	/* 16^22 * G */
+		{ { 0xC7D0B24CC5852E50ull, 0x8B2C7E63CF570CC5ull,
+		    0xC1F9AA2349EE7EFFull, 0xE486C7DFFEABB058ull },
+		  { 0x66BA3CADAECF107Dull, 0x694463D63392EBD8ull,
+		    0x9EE88A5C9F51E05Aull, 0x51FD75ED5606A12Eull } },
+		{ { 0x74502CA378692E20ull, 0x63AD9E86C339D0EAull,
+		    0x21FF1441906276E9ull, 0x69A16E245A5FCB88ull },
+		  { 0x996E69A9B3116C8Full, 0x113D28620F7DA894ull,
+		    0x06F01E9A4CDDBA10ull, 0xA7C968CD891AFC01ull } },
+		{ { 0xC66AA6455C881907ull, 0x142C86735B00B1DAull,
+		    0x964105CC66AE0415ull, 0x4ACF44BB8E2FFB7Cull },
+		  { 0x2926B456F63CDAFCull, 0x99352B2F7CD84B25ull,
+		    0x3544285AD10A5457ull, 0xAD99A8FE0FFD587Bull } },
+		{ { 0x47BDE79706BC8D71ull, 0x7A39F95BC79B0D17ull,
+		    0x21190E12FA0E745Aull, 0xDCAD8B2A7EEFB2C7ull },
+		  { 0x470CFE2EA297FCF2ull, 0x2726C4077B717B56ull,
+		    0x2211993CE07C0FA3ull, 0x8BF1287AB91FAF9Bull } },
+		{ { 0x82BAE0697439383Full, 0x34FFA562B601A2AAull,
+		    0xDD7AA292C8234EECull, 0x4DDF22834188A649ull },
+		  { 0x632FA81823D52337ull, 0x3DD5D045131F8269ull,
+		    0x74ABAE97D38C0C6Bull, 0xE71C627B0D91883Dull } },
+		{ { 0x1F6B16A30EF15DB0ull, 0xEF4C1AD601C829F8ull,
+		    0xF3F78331882EBA59ull, 0x89BE840A1731EB21ull },
+		  { 0x791D68C71D0B8200ull, 0x53B9DF77CA29A81Full,
+		    0xF4C5644675E9016Cull, 0x70EC8C193CB32816ull } },
+		{ { 0x26DC88155822B4F4ull, 0xA5353AFCF865DF8Full,
+		    0x1334E9E0797BF39Bull, 0x58B065791379879Eull },
+		  { 0x6607A8210C60FBCAull, 0x1CA4A076FC4E5259ull,
+		    0x027CA55F0262836Cull, 0x55A98AA4145A2C37ull } },
+		{ { 0xD7273629AA99AD56ull, 0x13FEA55AAD0E2F87ull,
+		    0x4DCA9848228C57C4ull, 0xD9F8B3771D318BC5ull },
+		  { 0xD4E919385F5C61B9ull, 0x995DE59A31F63CB4ull,
+		    0xC6551557FB70A4A3ull, 0x07AAD641F0D22377ull } },
+		{ { 0x4B2BD10C34FE39B0ull, 0x8A3173CD74B4DED1ull,
+		    0x763A441C23381F35ull, 0xA345E058A64B3529ull },
+		  { 0x3709480BABAF79DCull, 0xCE8C6A75AB369DF5ull,
+		    0x91F0855B28F9D949ull, 0x7C6DD5A6D5CAA70Full } },
+		{ { 0x9DDE20720523A7E8ull, 0x5199C8DF557E0D70ull,
+		    0x513A7190E5207A86ull, 0x4E218F3B641DEC95ull },
+		  { 0xEDAA0ED47090DB7Bull, 0xAB9FA70FCC821C50ull,
+		    0x445A159D2BC658F9ull, 0x65120AC1EFDAFA5Dull } },
+		{ { 0x3FBE07B9926695FBull, 0xAFD0BB9FE43ADEE1ull,
+		    0x201ACB8746D6CCB6ull, 0x3A10BF830190A2C8ull },
+		  { 0x755C72B2A4EB7E47ull, 0xF28FEA6C43D45288ull,
+		    0x76203848688A65C5ull, 0xB5D585B3EC1A2715ull } },
+		{ { 0xD3DF8E1B4354F993ull, 0x5CD8982354AFE75Bull,
+		    0xFED9B396FBBA71CFull, 0xADBBA24F50E000A2ull },
+		  { 0x25B83AC1A2AF4773ull, 0x5C756A550B61EB26ull,
+		    0xD3628F1206AC8F2Dull, 0x7C112BA338A4D9AFull } },
+		{ { 0x241A8E967D2C8614ull, 0xA7B0960A60584596ull,
+		    0xCA5CF5AC30912876ull, 0x12FBDDFAC9010433ull },
+		  { 0xF077BC1D58B0B174ull, 0x4D4258239C19F495ull,
+		    0x33FD91428CD2CFB5ull, 0xA5FF20D290278068ull } },
+		{ { 0xD48A96F55C19970Dull, 0xD77460EA61C45079ull,
+		    0x1F455E000CDB9FE0ull, 0x7C8039BEE6F3994Cull },
+		  { 0xC25775979AC55427ull, 0x3AFBE1730E033715ull,
+		    0x99FA1CE5569EDEBBull, 0xBEA167D2487ED355ull } },
+		{ { 0x53F764302D9AEEAFull, 0x05D0794CA05AFC86ull,
+		    0x7B8AE3A1FAF99A30ull, 0x8BECE859A2B97877ull },
+		  { 0x55A0DA3C85F9EB5Eull, 0xBB22038F6F8980F7ull,
+		    0xFBB8910B0EFFC368ull, 0x35F933C4C50651FCull } },
+	},
+	{	/* 16^23 * G */
+		{ { 0x84B6B8EC2B519178ull, 0xB63B9998A43D1FC5ull,
+		    0xCFE08CF8B5E2EE0Aull, 0xF41D7F4BB5E50430ull },
+		  { 0xA7A1665DCA6A3551ull, 0xAB49ACC36919E1F9ull,
+		    0xF1046DE3FAA82347ull, 0xE6A669BEBD9AF8D6ull } },
+		{ { 0x2A937E108F089B4Bull, 0x0D80E91BD6616F3Dull,
+		    0xF85BC3DA3881EC45ull, 0x3B2369FF19DDD591ull },
+		  { 0xF065556F67F00F4Full, 0x3970E7B02723E7C1ull,
+		    0x2D22213DD27D7876ull, 0x5DF102ECB29A762Cull } },
+		{ { 0x1A71313E1E3501D9ull, 0x1BE82CE1BB61FC8Bull,
+		    0x3332D691D62D3E61ull, 0xD65F827ED62D4E7Full },
+		  { 0xAB9446C6EB55759Eull, 0x61C13AAD5D730BE1ull,
+		    0x537B7CA5166B87FCull, 0xF24B60FCF09A90FEull } },
+		{ { 0xBB180BC7B8352AA1ull, 0x997CD06E999C1020ull,
+		    0xC7661093249BFF8Full, 0xECA3EEF00455B406ull },
+		  { 0x85F3AD39ECC12EA3ull, 0xA8359B399B78ED23ull,
+		    0xF6B863F37CA79007ull, 0x9E6BC281E78C25B8ull } },
+		{ { 0xCB62FE240F2ED84Eull, 0xE7994DF35FE2EA12ull,
+		    0x5EE6C8B5782CC0ADull, 0x55A9B5B6DEB05C38ull },
+		  { 0x579DC550546495A3ull, 0xE8FFB4D712A0D8F0ull,
+		    0x29174D190ED7F43Aull, 0xC4F22196AC9F19ABull } },
+		{ { 0xD6D4D26B5E4C47D4ull, 0xC20E8839A7615C7Eull,
+		    0x41BB5A14A5E51CA1ull, 0xF91386EBE69EF8CFull },
+		  { 0x37D18A490E9CDD72ull, 0x5B8E120559B73B3Full,
+		    0x606F08DD4849F9C4ull, 0xF43574316FED3B26ull } },
+		{ { 0x9BD2CF87075495A2ull, 0x9FDE1EB648BC00B2ull,
+		    0x1F7ED60A62548BC4ull, 0x79DE576DC7DB71DAull },
+		  { 0x802C8C6AAAEC6FB8ull, 0x8314F5096493A746ull,
+		    0x785E6DAE47DC79C6ull, 0x3B2D3D0E6B186A02ull } },
+		{ { 0xFD94A8B61A93D03Full, 0x468F41CE1B0DAD7Bull,
+		    0xCBA214B7FB45EA98ull, 0x5C97699D44B7DAFFull },
+		  { 0x67499CA90E6F2BA7ull, 0x20680F3274536159ull,
+		    0x238FF9A6CA28F2ECull, 0x4737A353A4CB0FB1ull } },
+		{ { 0xEEE92ACC82D1E7BBull, 0x24C3FF903511964Cull,
+		    0xE264B3695957E555ull, 0x8FE04E32162404B6ull },
+		  { 0xDA759AD0DA62E84Full, 0x5B9164646F046A8Cull,
+		    0xE5D6CEA57A8DB34Eull, 0x3987DB5022F6358Full } },
+		{ { 0x53009EE20CA9E67Aull, 0x7A08F60A51A9AD2Cull,
+		    0xCD6783471BD61BFCull, 0xD5B806EA4C696E07ull },
+		  { 0x784A6F319B05F005ull, 0xAAC0B16B6E428E6Full,
+		    0x32F37C90D9E4C348ull, 0xD4D0BE409375E771ull } },
+		{ { 0x101A4AEC69F7C360ull, 0x4EFCD577E48085C2ull,
+		    0x50A94A6368D224E2ull, 0x3AF4990957EDF8F1ull },
+		  { 0xD39DC2AA687D7A7Bull, 0x48554DD62760895Cull,
+		    0x531F86482E733C33ull, 0xD1706030D3B1D91Dull } },
+		{ { 0x1C72AA59DF7F547Full, 0x1515A21178FF09F3ull,
+		    0xCCB1033C5C15B297ull, 0x12D805C8AE7F1AF3ull },
+		  { 0x1A31BD8ED1E68394ull, 0x8657A4C14FF1C6D0ull,
+		    0x38036615A3B8898Bull, 0xA431415979654ED1ull } },
+		{ { 0x39A523AE770373BEull, 0x213D06221263D3B5ull,
+		    0xC1A582F3FE227C4Eull, 0x31A7E05C623C8076ull },
+		  { 0x8ED78790E90950A8ull, 0x8CE82B9951A25430ull,
+		    0x021B0AAE3423DB1Eull, 0xC23D2EF3F8D1DE67ull } },
+		{ { 0x9EA22681C57E51D5ull, 0xC82BC56A88CBC44Bull,
+		    0x2F8F451D94774EE2ull, 0xD0C2AB52F8CF7AE0ull },
+		  { 0x188896AEC0B1EFA0ull, 0x03891DA1C8FD0909ull,
+		    0x806CFF053C532724ull, 0x9EA4F0CD1F306929ull } },
+		{ { 0xB42610EDCB923B45ull, 0xA33A9FBFF13E24BDull,
+		    0xD15513462DD98458ull, 0x740A66481356D23Eull },
+		  { 0xA8C13E3851ECAA5Full, 0xA897993907C8480Bull,
+		    0x2F4E4788A75606CFull, 0x7F6D048C25CD523Full } },
+	},
+	{	/* 16^24 * G */
+		{ { 0xA84AA9397512218Eull, 0xE9A521B074CA0141ull,
+		    0x57880B3A18A2E902ull, 0x4A5B506612A677A6ull },
+		  { 0x0BEADA7A4C4F3840ull, 0x626DB15419E26D9Dull,
+		    0xC42604FBE1627D40ull, 0xEB13461CEAC089F1ull } },
+		{ { 0x1B68EDCCBF8D5842ull, 0xDA74BE4D8455B67Cull,
+		    0x521473143EB337C5ull, 0xCC8FE9ECCCDAF543ull },
+		  { 0x567E1AC9487100C7ull, 0x5DF1592D458677C8ull,
+		    0x75CEC6140B91FB77ull, 0xC2A5D01CD9F2FC3Full } },
+		{ { 0x52EF40E2518473FDull, 0xBBB9026BC6973391ull,
+		    0x85292AB99728A9E3ull, 0x1064063233318BA0ull },
+		  { 0xAFA6162E785CF805ull, 0xCFBE190D0C21D039ull,
+		    0xC8E7829E6585883Cull, 0x9C6832823B8BA2D8ull } },
+		{ { 0x23F389BE0C37DA54ull, 0x71B0B96CBC1184DEull,
+		    0x8006B50F37E86261ull, 0x11C881390823D8CEull },
+		  { 0x567C651408EE3DF5ull, 0xB3E32B21384D2ADFull,
+		    0xA42AAF13CAF61AE4ull, 0x82F5CA516726BDA3ull } },
+		{ { 0x3567EEC8653F30F3ull, 0x2B423ED2EDA238DDull,
+		    0x5EDA410D54083F21ull, 0x38C8AD8FF05F27BFull },
+		  { 0xA060E749EBE9217Bull, 0x6583FA982959DF37ull,
+		    0xF3909654DDBD641Full, 0x83C2617876DCB116ull } },
+		{ { 0x62B66E34FD7046CCull, 0x280398B6E32D8D77ull,
+		    0x23A5D12E930F5E51ull, 0x3F789C12505A876Cull },
+		  { 0x1487856590683E4Dull, 0x6320DE848E0B3FD6ull,
+		    0x64C974DD964E47A2ull, 0xD0D9F1B3A291A6E5ull } },
+		{ { 0x543E6911B6EF1584ull, 0x77A9A2A38F920CBFull,
+		    0x5858FBE3FD351842ull, 0x6FCB8CBCE860BB09ull },
+		  { 0xC3C9F7C21D3110F2ull, 0x5992F6D6928A4325ull,
+		    0xD54C0823AC30459Dull, 0xA8F1A83D8B721D76ull } },
+		{ { 0x355C95A1FD698F73ull, 0xCB4CB3A72A5C98EAull,
+		    0x676E37E7FC8B8D71ull, 0x9C7A4EFA52A32680ull },
+		  { 0x122443BD120CF142ull, 0x94B07CD5EA879E7Cull,
+		    0x16C424C1D0ADE69Bull, 0xA2C4A71AB2150C7Bull } },
+		{ { 0xE8F51340462255EFull, 0x50D71D346764078Cull,
+		    0x73515C90DE45B0EEull, 0x7811D0B93F76E2BDull },
+		  { 0xA58BEF9B1BE3252Eull, 0xF51ED0513AD43768ull,
+		    0x54C02E9401B85132ull, 0x99BB76370BB5AC7Aull } },
+		{ { 0x1BF6578B3517B889ull, 0xB998A3F0AFB9323Aull,
+		    0x3798D6C6E4CB1ECFull, 0xBAF532BFBEC94D7Dull },
+		  { 0xFA19FE6749FDCA6Cull, 0xFEF1D3823E27338Full,
+		    0xF1B51983B721939Dull, 0xE7BCC2A44E4A22D0ull } },
+		{ { 0x93E110F1353D2EA7ull, 0x9EED0823A3FA8650ull,
+		    0x0C7B729D5F816F2Aull, 0xC3583D944A8B50CEull },
+		  { 0x2B183E9E0B667BBDull, 0xD6C925A6515F1C43ull,
+		    0x5964627EF89FCCCDull, 0x53967AC09391E90Full } },
+		{ { 0xFDF0B36A7A032C75ull, 0xA4F6C1826B9D71D5ull,
+		    0x346E877E467A90E1ull, 0x0280A27D97EF8D60ull },
+		  { 0x6C3043CB76C0F2B1ull, 0xDC7171891F30FD67ull,
+		    0x41351993ED79A6ADull, 0x8CA3591D1507693Cull } },
+		{ { 0x8EDDF0E0502E3099ull, 0x53F213A662840165ull,
+		    0xF3A0F018BB7AD00Dull, 0xD591CF283CDEE501ull },
+		  { 0x33BC2765455AC5AFull, 0x5CF2EFF88B116FD6ull,
+		    0x4E51330D350BC582ull, 0x87EBE5CFC478E6E4ull } },
+		{ { 0xC03562BD884A85E9ull, 0xDC75980F62E2FBA9ull,
+		    0x829800F8315DA4D5ull, 0x86192922E83C5BC0ull },
+		  { 0x34B026A6CF94138Bull, 0x72EB2277193E431Full,
+		    0x9F84E2C1FA2CBD68ull, 0x9A468A0E4B1B52DFull } },
+		{ { 0x2B26564632A940A5ull, 0x4A435EB5A414E6B1ull,
+		    0xC01241E1A4F9E871ull, 0xA0AA0D612F3235C4ull },
+		  { 0x93F882A68B950422ull, 0x6C691CDDA7D1BF93ull,
+		    0x19B34CF9A0181F3Eull, 0x22340EBA76F76428ull } },
+	},
+	{	/* 16^25 * G */
+		{ { 0x6628D837008E2DF0ull, 0x32C3B2574328E5F7ull,
+		    0x012C29DF8BBE0F50ull, 0x2EB3910BDE2AB995ull },
+		  { 0x0910CC4ED274EAAEull, 0x9540D120ECF65F49ull,
+		    0x77D37D348DA4999Full, 0x3F29C02337474B3Aull } },
+		{ { 0xFE39D9ACA1DC428Eull, 0x10EC719690525DB1ull,
+		    0xFBA2F5BDF8F04826ull, 0xD32E851A25C965C2ull },
+		  { 0xB551D5B501CFE158ull, 0x31F58D904694F768ull,
+		    0x45CC6D22A98A8340ull, 0x6BEC05A1FCC5D64Eull } },
+		{ { 0xBF02B84B682867F0ull, 0xA21426E21B190A39ull,
+		    0x2AABD16A780900F0ull, 0xF6E9DB88E64C7CE2ull },
+		  { 0x475B3AF10F1861EAull, 0x27041BA5F970B623ull,
+		    0x81D93B76E8C0D5B1ull, 0x53CA790B7AD2AB74ull } },
+		{ { 0x71FC28E6E42F662Dull, 0xC681312779800DBFull,
+		    0xF54D0746449C0331ull, 0xE644041C2ED2CFF4ull },
+		  { 0x6711C11D66E6D591ull, 0x52E1678F917FD7C0ull,
+		    0x4BA0050D00C7B4D0ull, 0xBC79FFB9DE665ACFull } },
+		{ { 0x9ADD0438F20D6102ull, 0xF06D5378A3453940ull,
+		    0x785C15B9B6199A5Eull, 0xFD1DDB38760E449Dull },
+		  { 0xDA0A6491AE003B7Cull, 0x163E191211513983ull,
+		    0xEDAA1F1F7883B700ull, 0xCB54B8739050638Aull } },
+		{ { 0x60621D9F7E801AE2ull, 0x77B825CFFA6774C6ull,
+		    0x974719DA5058F18Dull, 0xBB14B0B942C15AC6ull },
+		  { 0x8B0DE51E5C1DC5F1ull, 0x795E4FBB66856143ull,
+		    0x87483CE636BAC7DEull, 0x96AE967F4513A674ull } },
+		{ { 0xF3F7341DC2C77CB7ull, 0xEF6D940902DC15B6ull,
+		    0x9FE4A73E65EE698Full, 0x61A273C22599901Dull },
+		  { 0x854611F81DDB25EDull, 0xC5C5AD9A70AE1F74ull,
+		    0xF4EA219F5EEB0CC9ull, 0x5BBACD334D3AD3D3ull } },
+		{ { 0xDD030872B7314C65ull, 0x4C287DFB6F6E6AADull,
+		    0xB59F52272CA6064Bull, 0xA626C3F311CB5315ull },
+		  { 0xB6607DB5A63F1919ull, 0xEE365BD68035523Aull,
+		    0xD949B781E9EFC624ull, 0xBB882A6B990EC04Cull } },
+		{ { 0xB998D56E377D8976ull, 0x5E173A38E30F292Dull,
+		    0x4CB02C98229D04B5ull, 0xCD2E8E65EF7601B6ull },
+		  { 0x11696F41C867BC22ull, 0xF60EDE0F35428C05ull,
+		    0xFC31CE8F2D46FF68ull, 0xF58EAD362342A31Full } },
+		{ { 0xECE636D0B24E5799ull, 0xAF13CE53415B8D3Eull,
+		    0x16D066739A778615ull, 0x45AF3CDDE409657Dull },
+		  { 0x924A679BF98C446Full, 0x1E0867D2E800DD10ull,
+		    0x3B941C0C7496F37Cull, 0xA4988CAF8A60D7A7ull } },
+		{ { 0x609B306C2C67C998ull, 0x9A9B07EAA3CF1B86ull,
+		    0x40225EA8A4304C25ull, 0x9BD61F9C38223EFBull },
+		  { 0xC340AF9C28199514ull, 0x927D9C1E90424B18ull,
+		    0x5C8F2096969450FAull, 0x77B20409916C6F5Cull } },
+		{ { 0x1E56F33244C73526ull, 0x886DF7CDD3BEB534ull,
+		    0x2673A399356DFAABull, 0x50C2845BE4DC506Full },
+		  { 0xA744F4DE53D49AB9ull, 0xD87E018A680D49E2ull,
+		    0xA6A8D73B5FD47D25ull, 0xAD81723489B95F70ull } },
+		{ { 0x6A45E17BEAAFA568ull, 0xB4CD7A97701E2276ull,
+		    0x12AE27A41117A016ull, 0x7AFAEB4F79707775ull },
+		  { 0x3ED53A2F81C1F2DFull, 0x972E694329D39023ull,
+		    0x895D14135041365Aull, 0xC6EFE61933FBD27Dull } },
+		{ { 0x5CD9A87B3CC16C2Full, 0x3D0C0108D3434B8Dull,
+		    0x59606DC354DFB1FEull, 0x0C402240C35341FEull },
+		  { 0xC4694CFC55D78E18ull, 0x4E33958F7033B3C9ull,
+		    0x5DF2A69A71D1D760ull, 0x61684DEB17DF1610ull } },
+		{ { 0xB7E703E50E59DDEBull, 0x483E629CAD1E98A8ull,
+		    0x061D94C1496B0C3Bull, 0xD9A002227E2412F9ull },
+		  { 0x5F393FF80F0AF5A4ull, 0x8562A8BCAB5F18CEull,
+		    0x43C60F8A43670581ull, 0x975EB2F93B7A022Cull } },
+	},
+	{	/* 16^26 * G */
+		{ { 0xC739A5EA3ECCA7E0ull, 0xA7D2C98F6743333Eull,
+		    0x0FEF6335224D9428ull, 0x7EF2EE3C5C792A0Cull },
+		  { 0x302B22DD552AC094ull, 0x81B21450DFBD3D20ull,
+		    0xA4F67F51D5E609DBull, 0xAFB6862730ACC011ull } },
+		{ { 0x6DB02C92AB896D0Full, 0x5E880BE50C09223Cull,
+		    0x93539DEF6986C76Bull, 0x0646472486E68DB1ull },
+		  { 0x90D74508A4F528EAull, 0xDB1B895DC63B4F90ull,
+		    0xF2B3F5CEF9047CFEull, 0xF1F4EE22FE7063BBull } },
+		{ { 0x72F3583DA33F0FFAull, 0xCAE4CAC611807A41ull,
+		    0x7624A576C9D9C641ull, 0x3704572716887ACDull },
+		  { 0x5FED3FC660FA35ACull, 0x57BA3EB7AA8BF2FCull,
+		    0x841BB4BB8895FF4Cull, 0x5C6408C61A71E74Full } },
+		{ { 0x699C584DA8D5825Eull, 0x7BEB467E384D570Bull,
+		    0x2EA713544FF03FD1ull, 0x0D42E1F15292FC71ull },
+		  { 0xED1808977A8946B3ull, 0x0C4CB2EC4B4340CBull,
+		    0x2C1F17A55A85CA7Eull, 0xADDA2B0A21F69ACBull } },
+		{ { 0x3C6F986532603513ull, 0xF6C64DC6814A0095ull,
+		    0x2D1EAA42C08BB697ull, 0xC2A979E54298DB72ull },
+		  { 0x95755B2C3C3505B9ull, 0x8CC666DF48151449ull,
+		    0x54278081935BCE7Eull, 0xEF9DD74A1E6EB5C8ull } },
+		{ { 0xDFB7DBF315FC7295ull, 0x4307AD9549CF786Full,
+		    0x3FB48BE1F115D687ull, 0xAE67ECD7D603693Aull },
+		  { 0x04FF9C5EFA4F5B62ull, 0xFC3019722C2AEE34ull,
+		    0x072B94B84A82D9C1ull, 0xD23CD2AEA5FAA6D2ull } },
+		{ { 0xE646FFB1D9FDEE3Eull, 0x681F97716C302E01ull,
+		    0x172BB15CDB17AFB9ull, 0xC9F4186AB1FC59E1ull },
+		  { 0x51E66CC5CCED22E7ull, 0x44E1531C7B58DF4Full,
+		    0x0DF73142B8832143ull, 0x09420A7F3CB3A341ull } },
+		{ { 0xF9C18A469AD780B2ull, 0x8C3B0DA6F68440E7ull,
+		    0x0E19D0C28F9AE751ull, 0x44DC4D9E945C7DB2ull },
+		  { 0x91437413AB93B11Eull, 0xB47775E1C2CEC39Dull,
+		    0xF8FD19DC683F5F95ull, 0xDBEB918745C2F9C9ull } },
+		{ { 0xF0CB3E674814F217ull, 0xA9DA3F7B8756CFFAull,
+		    0xB08A0024F83BB6A4ull, 0x27DCF55B80480256ull },
+		  { 0x14C94B588CF2ED4Cull, 0x0A4E8FAB191FC3BFull,
+		    0x0BC8BAB094A02A38ull, 0xBE18F54F548D5DEEull } },
+		{ { 0x362527575748E77Full, 0x64E639F9657DD5E0ull,
+		    0xAC8C9BD589D5CF2Eull, 0x88A467996FF7321Bull },
+		  { 0xB7CBB84FBE6DA255ull, 0x5F7287FF80C02EC5ull,
+		    0x0B2703CE8EA583A7ull, 0x13BB751380982F1Dull } },
+		{ { 0x75A2A4FD5B9E310Cull, 0x313CE5B9B84CFD4Aull,
+		    0x9C8D24AC33959187ull, 0x3B8B0203B256EA4Bull },
+		  { 0x99416605AD19FC9Bull, 0xA8FF804B82B30583ull,
+		    0xD6176E377C4117A6ull, 0x91117C4EB033615Bull } },
+		{ { 0xBC65DA82A6BC3AE1ull, 0x14BF635521C7AD1Cull,
+		    0xC6E95C0A52D798D1ull, 0x89CB789F517F1FF2ull },
+		  { 0x97C3234E607FF499ull, 0xB6FD080BBFB07DD0ull,
+		    0xDF6D7EBF5B94658Cull, 0xA3A9F5D8EFC0F55Full } },
+		{ { 0x8F1E1E2BA7615B36ull, 0x2A4FF1E8C7F3C15Full,
+		    0x105C2406F914C337ull, 0xA5E7398C5BCC103Aull },
+		  { 0x4D982E3949136D80ull, 0x47FFC19370B613C0ull,
+		    0x46438DEF2A15F8C5ull, 0x1F3FF58DC974E4CEull } },
+		{ { 0x40423ADE3C0FF1C1ull, 0x7B4F1B46873CC23Dull,
+		    0xFE08D7BCB9E9CFF5ull, 0x869CC5794942B544ull },
+		  { 0xBA20E3931D28539Bull, 0xE8AE4078A44F6597ull,
+		    0xAB2317C57747F0C6ull, 0xC4C2EF2E96BDB88Full } },
+		{ { 0xBB7B0432ED3E10DBull, 0x47732E1AC8B87159ull,
+		    0xDEE0443FF4EB61FAull, 0xAAD218355AC9532Bull },
+		  { 0x63535ABD6FA05FB3ull, 0x72032772B31CBA27ull,
+		    0x3A7DDE28FD5F8B4Aull, 0x793B1EEEBAF82E3Bull } },
+	},
+	{	/* 16^27 * G */
+		{ { 0x6701F090EC49E853ull, 0xA9CB53529975E04Aull,
+		    0x57802554EB5FA77Aull, 0x0E51416421640AEBull },
+		  { 0x336E3D1376405CB2ull, 0xF568394190C9EE36ull,
+		    0x278EB4A53A91030Dull, 0xCF331CEA65905469ull } },
+		{ { 0xBF7FBADB5AB7AA65ull, 0x43E17E0A2710F1A2ull,
+		    0x83D8640F8DB563D5ull, 0x8525D0B3EF763142ull },
+		  { 0xF9BE830FDDE8648Cull, 0xD0DFCCC1923F092Aull,
+		    0x06CC431C1E676976ull, 0x0E63A7E111F91FD6ull } },
+		{ { 0xC4A23F1C1DC6AFADull, 0x1BD3D92295F80F46ull,
+		    0xDE8ED25F64C0C677ull, 0x977BA06765CACF25ull },
+		  { 0x4D62CDC51D7FAA09ull, 0x2F75A1241DDA1A15ull,
+		    0x8833FAA0D081D999ull, 0x1BC3BC43AEDB8FA2ull } },
+		{ { 0x29DD16ED044C1B21ull, 0xD8432893C3D8180Full,
+		    0xB39E7D7665BC22D4ull, 0x1B3E00B320971112ull },
+		  { 0x8DE24014B7F594C7ull, 0x4FFF41A9F0B6A9E9ull,
+		    0xF11325D9C0DF7684ull, 0x9B442543FAF3E2D2ull } },
+		{ { 0x65F745D7DD81983Bull, 0x10220FD02F8EAB78ull,
+		    0x4C3CB60771FFFACCull, 0x3BC328612A123ABEull },
+		  { 0xBD99F28511A637B6ull, 0x4334885A8FBB848Dull,
+		    0x250B305CAAF00A7Full, 0xA6B5826DED0C8A20ull } },
+		{ { 0x4F30B43AE18CBD32ull, 0xE5E453919505C729ull,
+		    0x8171864FBFA379A1ull, 0x02A3759B87C0C622ull },
+		  { 0xC327F4E1A6CF9EC4ull, 0x6419A83A7C8DF6D0ull,
+		    0x1EA5D75B001E1E1Eull, 0xA88356CC1F9F211Full } },
+		{ { 0x75F76C1FF7C8537Bull, 0xCA8CACB7441F8061ull,
+		    0x51BAEFE1CAF96C21ull, 0x67CBA4E8E9EC04ACull },
+		  { 0x1CEB5057385726DAull, 0x7BDF043ED0403F6Eull,
+		    0xA1E1C61F2FB1CC04ull, 0x5B65EDEDEA1C8984ull } },
+		{ { 0xC828BBEE5AB90065ull, 0x26DDC475BBFA75B7ull,
+		    0x899DB93959F2E876ull, 0x778468F5252B48E4ull },
+		  { 0xC8F76AA2F2D79FF1ull, 0x27BBCAEF00ACDAAFull,
+		    0x6F65136A7F01E2E9ull, 0x43341AB10EB39CA0ull } },
+		{ { 0x368228CE4B6A1226ull, 0x2AF9E9C8AB546539ull,
+		    0x1A073D686468F392ull, 0xC5958EA6D5749993ull },
+		  { 0x1C100688C66961D4ull, 0x96876DBEBA2108B9ull,
+		    0xECBE19719D45BD82ull, 0xA031A882F70F7DD7ull } },
+		{ { 0x6A9C32597E189F07ull, 0x0848C9C516ED80D2ull,
+		    0xDF310940FA30D604ull, 0xDEC3480F5D68A92Eull },
+		  { 0x1BE2EF80B18CA938ull, 0xED5F41F8CF2193E8ull,
+		    0x436ED448431A7960ull, 0x7332D2E4F241E886ull } },
+		{ { 0xE4DE3F85B3713A52ull, 0x25C75B8C683C5417ull,
+		    0xC1FCC0C3C74A5FA0ull, 0x83F07BF82E425CA7ull },
+		  { 0xA111273F9FB0FFB6ull, 0xCAB5B760E1FB45D2ull,
+		    0x049794C912C7D3CFull, 0xF2EC4F10A25B8BB9ull } },
+		{ { 0x627CF469E42F35FDull, 0x27A76BCFB6BAEE4Cull,
+		    0x99FA24688E7AEB37ull, 0x439F864EB2F08528ull },
+		  { 0x3865A5B530C62D57ull, 0xEFA584FC6EA72915ull,
+		    0x7F3AF4671CB58401ull, 0xF56850929086DCCCull } },
+		{ { 0x9AD9A09121BA21B0ull, 0xD855D8D200C26553ull,
+		    0xE6F680686EAE0076ull, 0x938DBA4F9B5A42D4ull },
+		  { 0x374D995E4D5B4325ull, 0xCBF1BBEE3F2B697Cull,
+		    0x6E9AADBDD136B90Bull, 0x48AFC0A89AF75656ull } },
+		{ { 0xE792984F403482FEull, 0xA7BF278FAFD65AA7ull,
+		    0xE70B585390C06D34ull, 0x613483AED9ED08B7ull },
+		  { 0x55DC8A6D37D1055Dull, 0x2BC644B0CABB61A5ull,
+		    0x3E6F5F2B4585AD86ull, 0xEDD7BB3007929C3Bull } },
+		{ { 0xB53E49A63F2B24F1ull, 0xCFAEC64F5FE76BCFull,
+		    0x3A81DAACF3B49779ull, 0x7EFA89B76CA031E7ull },
+		  { 0xD65DC5D4AF8E4B83ull, 0x1DBADF3AC554A455ull,
+		    0x78CED222FC16AB21ull, 0xA99FF3EC61F4AEFFull } },
+	},
+	{	/* 16^28 * G */
+		{ { 0xF0699BF9E2F2B734ull, 0x79C3BB5B5501D267ull,
+		    0x0634A786F1164457ull, 0x224A02299EECC99Aull },
+		  { 0x840F585491EC7FDFull, 0x07B704B673C7AFD0ull,
+		    0x149A08AD871D7FFFull, 0xFA41A8D29B6D22B4ull } },
+		{ { 0xA8DF3DAE1991E607ull, 0xE310D10E196E11DEull,
+		    0x760F78B8AF6B2261ull, 0xAFD35B35BEA5BDA1ull },
+		  { 0x5E0B73BC4308126Full, 0xBAB7D9872155AF41ull,
+		    0x96D8EE266B81EC93ull, 0x03555F48E204E994ull } },
+		{ { 0xC9E92F475D254033ull, 0x78368280C2A4707Aull,
+		    0xFCDADFA688B6F240ull, 0xE63502EE153CEC59ull },
+		  { 0x7E8AA88968F05E3Full, 0x2C915A0C4BFCF360ull,
+		    0xAD74E80F0709CE48ull, 0xA7C5837B1F621E11ull } },
+		{ { 0x7E16CC51F0B9A00Aull, 0x05174DA42F93E68Full,
+		    0xA0C7CC97B56175D5ull, 0xE5CEAC4035EB4955ull },
+		  { 0x157FF80E67984A57ull, 0x8CEDDB7586FE794Full,
+		    0x854A459C3396D1E4ull, 0x660CB9301FCD56B9ull } },
+		{ { 0x2B9609AFE1E08F33ull, 0xB1FD631DCB982CCAull,
+		    0x12AB45C533F000E2ull, 0x5648DEC272EB9687ull },
+		  { 0x26EED9AC4269F1C9ull, 0x3E72BBF2E0117951ull,
+		    0xF478F5C64D77A269ull, 0x95FDDC70708F7043ull } },
+		{ { 0x8DAA3455E8A5C546ull, 0x1F0EA68BA3187B91ull,
+		    0x3E774B6D5268D693ull, 0xA643C538AFC5667Bull },
+		  { 0xEB1E337CD3FFF857ull, 0x4893DB480DC64A7Bull,
+		    0x460033011CFD3519ull, 0xA8D602EA4377DB0Eull } },
+		{ { 0xE3B8200BFAB98C43ull, 0xC5BA57757E3E8AA4ull,
+		    0x95152F8ECBEC8F03ull, 0x1941C19F3380ED26ull },
+		  { 0x8FA210DA22ABE217ull, 0xD8F62D3DB8DF5639ull,
+		    0xE2B6DB2A48FB8C53ull, 0x8E66B834595DB2B6ull } },
+		{ { 0x4F556DB22343750Bull, 0x944995A27D329C76ull,
+		    0x8EC64FD2A2B75F9Cull, 0x0E415C462BE67902ull },
+		  { 0xA6097C15BECD56CCull, 0x6EF691A45FF7EC06ull,
+		    0x27BCA21077F8CDDCull, 0xC3056E7177F984E2ull } },
+		{ { 0xE6670D1042D8C2F4ull, 0xD73321B9F79C0189ull,
+		    0x7FA73BDE364D8A0Bull, 0xFC586431D10B4BD6ull },
+		  { 0x0118C88FFCFD274Aull, 0x29E2CB05EBC338B4ull,
+		    0x4A33C279E6BDB4ABull, 0x99FADE52CE8AD956ull } },
+		{ { 0x830CE044E750B852ull, 0xA172F111C50C5F41ull,
+		    0x3A3B61F117D48ACDull, 0x956D85AC3FCA3E4Full },
+		  { 0x5F09724600EB56D7ull, 0x2DCB5B21ADC5C746ull,
+		    0x8911E9CD3B8293A7ull, 0x371A37CCF6DEEDF9ull } },
+		{ { 0x12B077F1D1FF0F18ull, 0x07E0BCE70549A42Dull,
+		    0xA9BFBACF9AF2D6C2ull, 0xEE993BA6B0C4F1DEull },
+		  { 0x8013876CA50782ADull, 0xB435C80DF70F2CB1ull,
+		    0x1F6C5D58CE85BCFEull, 0xD87FD4D94578DB2Cull } },
+		{ { 0xD77107B51F2CA098ull, 0xE4066263414B9D7Aull,
+		    0x6148A999FE559BF5ull, 0xD9BDB44B1B3520A3ull },
+		  { 0x7406BBD75ABCA6B7ull, 0x0DE0C9740EE3AB32ull,
+		    0xE5E5518457563F01ull, 0x552624FDA1DD30CDull } },
+		{ { 0xE47A7F754FDDE3FCull, 0xE5A8889E05628CC9ull,
+		    0x8DA0DC41A52F31FBull, 0xBA49517AAE9FE242ull },
+		  { 0xA3EFD232EFCB7D01ull, 0xDFDE1C81E3292CAAull,
+		    0x0B4EE4376013359Aull, 0xA88FB6E1CA945595ull } },
+		{ { 0xDC9D02357A6FE7CCull, 0xC365429884F435B7ull,
+		    0x78A0D632207686B5ull, 0x6D354193D97A95B8ull },
+		  { 0xC41AFB5FEEBDBCDEull, 0x5249918F8B53468Cull,
+		    0x3F44255459CDB568ull, 0x6F5D4E0DA0883528ull } },
+		{ { 0x78892A2F7D14DA68ull, 0x4A64C1F84DD20173ull,
+		    0x4DE2CF82737612B5ull, 0xD3398F17422AF1BAull },
+		  { 0x3F07631B55A90E3Dull, 0xAFC7A7922D41453Aull,
+		    0xEB7252D1E8A2B020ull, 0xA34AD4D4D1FD3D60ull } },
+	},
+	{	/* 16^29 * G */
+		{ { 0xEA6065AD7789B84Dull, 0x167D5EE4D1041CE2ull,
+		    0xCDB5D111B56493FEull, 0x4A89A61457374B4Cull },
+		  { 0xEF9B7D7F018E3EA8ull, 0xA72E280634711999ull,
+		    0x08C2EA979FE677E6ull, 0x45B04E87ED480D5Cull } },
+		{ { 0x20049D0364E11F7Eull, 0x3BDBBC488E7CDB08ull,
+		    0x8AA4BBA0AE54DDC7ull, 0x55B66E6DC586296Full },
+		  { 0x04BDDC671C77D076ull, 0xCCFE610621B594F9ull,
+		    0xC386CC04CCA223EBull, 0x9043A91F1DD1419Bull } },
+		{ { 0x6E76B23742E14C34ull, 0x834C5EBE07327593ull,
+		    0xA2A9B30E781377C9ull, 0xCC9F9648A870EF92ull },
+		  { 0x8892157A94BE556Bull, 0x299917F1828C7E05ull,
+		    0x43116633DBE689DBull, 0x829BFF2CB5F8C96Full } },
+		{ { 0x2046400ECC4BB506ull, 0x06614D6A97448F01ull,
+		    0xAB1D0013A1821A0Bull, 0xDB3EBC91CDCB79A8ull },
+		  { 0xCBDD181F49B3E60Aull, 0xB21826F5E8F7D202ull,
+		    0xAF1A685E85539258ull, 0xA95A64538A676683ull } },
+		{ { 0x87DE6C8595DE4837ull, 0x8D4286C82DE5E74Eull,
+		    0xF4F58C1D0AD98A75ull, 0x5C618DA1FAAD041Aull },
+		  { 0xC0B8583B634A7DEEull, 0xECD36649642278CAull,
+		    0x88B80E3849FD9671ull, 0x4C719117BCF3A19Dull } },
+		{ { 0xB6CA448B40DC67C0ull, 0xF08DD2BB64E18D8Cull,
+		    0x67DE7CEE87EEC09Aull, 0x22BDCB12AAE2C57Full },
+		  { 0x8A9A5C843B0E7DDBull, 0x75FCBF3B3B89C774ull,
+		    0xB9987A8F0D909C47ull, 0x53EF0C95AB3E7DD1ull } },
+		{ { 0x2589342656635396ull, 0xF2CAE15A368A6C0Cull,
+		    0xE585E2DDE671C11Eull, 0xAB8A886A915A06A2ull },
+		  { 0x7E38FA6A3FC92C23ull, 0xB9360583F7D2D6ADull,
+		    0x5668FF8248BCD5ABull, 0xE773CF7C7DA84319ull } },
+		{ { 0x4F5C2279ADE5D1B1ull, 0xDDFA9E91C66AB702ull,
+		    0xB92174E3AA64A3BFull, 0xDED37DD152738517ull },
+		  { 0x81CC777712C778BBull, 0xF43B076D59128448ull,
+		    0x2B3CAAB3824544B8ull, 0xB14E3C5A84E78C40ull } },
+		{ { 0xAC243E5881DF49C3ull, 0xA9E890866D069A35ull,
+		    0xDEC664B8B695604Aull, 0x62B7C8514241838Cull },
+		  { 0x9BE3680FF6341C21ull, 0x8FB53B61387CB550ull,
+		    0x594896AE8D4922DBull, 0xA71ED62152AE0335ull } },
+		{ { 0x14AED835CB801E98ull, 0x4107E653812F738Aull,
+		    0x93DB846167F0E960ull, 0x66CBA1D92CD4A26Dull },
+		  { 0x5250D590DEDAA27Dull, 0xD6ADE86959A30E4Aull,
+		    0x66D9066AC3917211ull, 0xFD5EF5E6E6FBF966ull } },
+		{ { 0x3AF146E2E44F47D0ull, 0x1B59F5DE949F002Full,
+		    0xF9751F0869DFC979ull, 0x4897BDBFA45C89C5ull },
+		  { 0x81E501AACE1320BFull, 0x526DA001A8F01195ull,
+		    0x34E8ECA9417B093Full, 0xE77DC20F7AFC138Cull } },
+		{ { 0xFA41E92588E11179ull, 0xCEBB8DFF96C18E27ull,
+		    0xB9E33FE845FA5F29ull, 0x520DCD49ABD6D7A3ull },
+		  { 0x38F2B5ED1F6A40DBull, 0x4175A50FDA6BE47Aull,
+		    0xA20562961F6A5779ull, 0x360604D1B132F797ull } },
+		{ { 0xE61BCE9B71581BD3ull, 0xCBFA318DF6190786ull,
+		    0xC451E07BDA722F2Eull, 0xEB1CFCB556486576ull },
+		  { 0x5BCE8D985CD98A09ull, 0xB39CF319C5BD1A64ull,
+		    0x5044005EBE4D6E3Cull, 0xFD47CE7571F94D20ull } },
+		{ { 0x2781CEC811281711ull, 0x322C52732FA98ED7ull,
+		    0xD5D0927A529D94A4ull, 0x6B087369F3FEEF1Cull },
+		  { 0x04BCD9B5108EC5D1ull, 0x1327BE68971FA79Dull,
+		    0xFCC732C222B78CDFull, 0xCA9DD09CC5BF86D6ull } },
+		{ { 0x90122BDB673A3111ull, 0x18B82E417B4C818Full,
+		    0xC0D54AC2E72576A0ull, 0xA1FD8BBBE48E1E09ull },
+		  { 0xB887E650B8C704EFull, 0xC7EC4945BFD51169ull,
+		    0x9BD77E07BC0916C0ull, 0xAD215D8A34A30856ull } },
+	},
+	{	/* 16^30 * G */
+		{ { 0x3438C84A72BD05A0ull, 0xBA82337D0B1FC80Dull,
+		    0xEDC2F995F36D1F90ull, 0xE5E892363A31885Cull },
+		  { 0xC936DE2BE1A69F5Dull, 0xCA73995B9CD099AEull,
+		    0x1301EB01E79B5C3Eull, 0x77439DE4DA1B87D2ull } },
+		{ { 0x0C665CF973B4DF41ull, 0xFE6784FA0F696A51ull,
+		    0x44D95FECD3177C78ull, 0xC827ED763FFEC8D1ull },
+		  { 0x2E5B6A2380F91F4Aull, 0xBFE9A6106C0047B3ull,
+		    0x60E17D7B66EF3CD3ull, 0x1E4C4475F2DA5ED5ull } },
+		{ { 0x4F09528101467D6Bull, 0x357D712952A24B51ull,
+		    0xD1018611642CF1D8ull, 0x5D2393DF9435CCF5ull },
+		  { 0x07C673C6B1BC5458ull, 0x72A707A7510473A8ull,
+		    0x7ACBD85B2D5AF46Dull, 0xE66E63F263FD0F7Dull } },
+		{ { 0x405904B346340D60ull, 0x8998961B956E7DC2ull,
+		    0x25ED93EEB3C1587Dull, 0xB511001491B74657ull },
+		  { 0x68CD6178653ECAA6ull, 0x8FB582B118594791ull,
+		    0x72AB899EF769F978ull, 0x9C3981F431FE4C46ull } },
+		{ { 0xF0B1E93C9D159F7Aull, 0xECF93A9CF242E590ull,
+		    0x3ADCFB2BD2FF873Full, 0x453657A53AAB893Full },
+		  { 0x99C22B708A02FB78ull, 0x6F949BD4E81DDA5Dull,
+		    0xDA2EF0913A01C728ull, 0xBFB5AEFF88023DC5ull } },
+		{ { 0x973276C64CFB1A94ull, 0xA32F06E363CDCDE9ull,
+		    0xFFC3DDA2E480E645ull, 0x27A0C221B72432F0ull },
+		  { 0xAB98F8C2D4098584ull, 0x91E3B03D78674297ull,
+		    0xF2F2EF8DC1821E9Dull, 0xC3F6AB3EB3A0A792ull } },
+		{ { 0x31EDEDF3D46CB42Aull, 0xBC052853A7239093ull,
+		    0x4D14ADEAA13D73E7ull, 0x435B54CB07B04C46ull },
+		  { 0xB7E24DEDDAF72DD0ull, 0x5EDC4C79433949A6ull,
+		    0x49F4A54CC1E0585Dull, 0xD726C031E4718A1Aull } },
+		{ { 0xC193D479678E27D3ull, 0xC12883ED0E4C688Full,
+		    0x1CB2F03148E4774Eull, 0x60AACAEEC40E8409ull },
+		  { 0xFF7C610228C4D2DEull, 0x46D400783A680F4Bull,
+		    0xDA54F7C803DE04EEull, 0x9677DFFCC5DEF66Dull } },
+		{ { 0xA97D941B1D2FC263ull, 0x89CF813E5B65D57Bull,
+		    0x19FBC47C4E13DA0Eull, 0x1805B819E14EDD7Eull },
+		  { 0x266470B4F0870EC7ull, 0x9C8C1AF8E551ECAFull,
+		    0x5858DAA86BCB3148ull, 0x101F642809438171ull } },
+		{ { 0xCC326B493D9EB773ull, 0x6319C47B85CAE6CFull,
+		    0x612C78017B1C51E3ull, 0x79481A2AAB0F1180ull },
+		  { 0x37D96C11C1162620ull, 0x8CBD8693297F950Bull,
+		    0xC6D9625E70F28A4Bull, 0xDC61463F8555E09Dull } },
+		{ { 0x9A2B1B70C076D1DFull, 0xF41E2081427FA1B3ull,
+		    0x40617A8A2A775F45ull, 0xC73AAF4366D3194Full },
+		  { 0xD279D516E5AD6605ull, 0xF75B57A51D893720ull,
+		    0xF9CE01BE3BBCDCFEull, 0x9201EC69ECCF916Eull } },
+		{ { 0xAF71ACDEB0028FE6ull, 0x3FB37FC78E50F376ull,
+		    0x5A861535E82BCC35ull, 0xE6AC0AD271BAE59Bull },
+		  { 0x6A51064068570FB1ull, 0xC5EF07BC43191AFEull,
+		    0x8B6999AEEFED3475ull, 0x53FBE5579EA7CF60ull } },
+		{ { 0xD3683F7985A745C7ull, 0xBC8A2738C17EAC07ull,
+		    0x77189B6AF61D52C1ull, 0xE3DDEE8F7D5C36D2ull },
+		  { 0xA39F0940778EFCC2ull, 0x7C28C2F17BD027B1ull,
+		    0x1BE51B86AA7BD8F4ull, 0x487199D391932B87ull } },
+		{ { 0x526F51DBD2943E92ull, 0x69BAB975255A517Bull,
+		    0xC0AEDA8052AC58B0ull, 0x2FA496CC907CAE20ull },
+		  { 0xD5264339738A13B6ull, 0xB1507F3E1D1BF694ull,
+		    0x3F6C08ACB28B6433ull, 0xE7BE908162A44887ull } },
+		{ { 0xF4C733E84D4170B3ull, 0x40144156FC3A3587ull,
+		    0xAF68AA1186C0A1D5ull, 0x45C78DDC2035F1E5ull },
+		  { 0x16EFA3ED511FAA1Dull, 0x2CB046606420CC73ull,
+		    0xB0E1A9D144FB3A51ull, 0x11AF9946238D5C0Cull } },
+	},
+	{	/* 16^31 * G */
+		{ { 0x21579992FAB5C2CFull, 0x5312F0C21FB084DEull,
+		    0x71E7474104FA90A4ull, 0xE4107E431E221F50ull },
+		  { 0xD028403F2B955C2Bull, 0x3C7892DCFF7B2410ull,
+		    0x3948C668741C2B32ull, 0x1E5F11E6CF701C9Aull } },
+		{ { 0x510F99B4549E7A36ull, 0xA0654D2666872435ull,
+		    0xA757F11164D63319ull, 0x2D5295DB41E6F839ull },
+		  { 0xDDB68195CE32EB67ull, 0xEA7B44F99730BA3Bull,
+		    0x3AF16CAC763B38C6ull, 0xF98ACF2806807232ull } },
+		{ { 0x5BB5B63C09B67B7Eull, 0x766B7B2B911C3D48ull,
+		    0xAACF9701DEBC1142ull, 0x85DF9A65EE179F7Dull },
+		  { 0x88B3869E830A36E3ull, 0x86FA949D1FBC6EA5ull,
+		    0xBB6B7D5EFF0E2973ull, 0xA6B4B7AA39AF6308ull } },
+		{ { 0xCFED817743A29747ull, 0x32242BC07EB98697ull,
+		    0xFF26EC4601BFFCDAull, 0x3877152E0BBFF37Eull },
+		  { 0xBA573E25F24D4637ull, 0x9FBD1F6ECFFEE641ull,
+		    0xBE16116CB99D3730ull, 0xCC70A7F9014BC61Aull } },
+		{ { 0x127CFDE60B3510D3ull, 0x85D3166704A1D6E4ull,
+		    0xA8D8A1865C2D2928ull, 0x23C493FE7F9FCD08ull },
+		  { 0x13462EC43AE89A47ull, 0xF799E35E26B9DBD7ull,
+		    0x0C275D9E4EFFE6D8ull, 0xADF456A9E4341423ull } },
+		{ { 0x006A447C3B80AB86ull, 0xC86B3488933E6F3Cull,
+		    0x08D114540D125257ull, 0xB8DC9073C673523Cull },
+		  { 0x2F61194F048B4D6Aull, 0xCA4D4599DB3CE9E0ull,
+		    0x4B5DC67E84141863ull, 0xEC7787216FD41E68ull } },
+		{ { 0xACC691808B49A71Full, 0xAC36EB6C64227C39ull,
+		    0xDE5993EBAAF235DDull, 0x94406D0B314DD0EDull },
+		  { 0x471C1944D0B249A9ull, 0xD0E27261CA63CF94ull,
+		    0xCD207C90906FE897ull, 0x61AAE77E864DF179ull } },
+		{ { 0x59469A0606BBA654ull, 0x5E3BFFBD135EA79Full,
+		    0xA67834270A8E1649ull, 0x437A6A6E40D04569ull },
+		  { 0x3755406037A7C0F3ull, 0x14A7C3761938D410ull,
+		    0xAB24825FF34DC5A0ull, 0xC2911E15587F2492ull } },
+		{ { 0xE5CDE33C60E50C32ull, 0x77F10972E8C6873Full,
+		    0x337136DF5BEE8D38ull, 0x3C2EBF43DE886C14ull },
+		  { 0x9E2F8917CA93C124ull, 0xBE2D08C39AE8C998ull,
+		    0x6525B93D202E28E7ull, 0xA703D9A6C5E8399Cull } },
+		{ { 0x05BC04662647394Eull, 0x9CE5A7A96E9E45C8ull,
+		    0x5AC96720BCE3BC61ull, 0xA6CD740BAB120FA0ull },
+		  { 0xC66B62B3F119695Aull, 0xB59355675CCF55F0ull,
+		    0x4FF66A2D4A663C77ull, 0xB9FC0FE7C1B0FB9Full } },
+		{ { 0x7083D9DEC3A2355Aull, 0x99651BF35C604990ull,
+		    0xF391E5B89EC55F12ull, 0x987536D727940EB9ull },
+		  { 0xF0C75C4C1BD05276ull, 0xB85F6C7C683ADCCDull,
+		    0x43E0B1C149E57B48ull, 0x12F19AD674F11172ull } },
+		{ { 0x91F23FE06EB8394Cull, 0xDDD80153CDC93B32ull,
+		    0xCB94CD05CFED4C53ull, 0xC2E65B9DC8BBC43Cull },
+		  { 0x6CAD3E4383F6C688ull, 0x3FEDF8318DBD4924ull,
+		    0x23948C9D2F469724ull, 0x36CB9B541BDF3DC2ull } },
+		{ { 0xB0F0547C52F3EC22ull, 0xD1F86DCF71A8F8A6ull,
+		    0xF19D38B17EF2DDDDull, 0xD515AC409A4C4468ull },
+		  { 0xCA1462EB25A2863Bull, 0x4CD57DF0031B806Eull,
+		    0x1EA5E4840052BD46ull, 0x51C0481422449B2Eull } },
+		{ { 0x3FD1E77F6E5942D2ull, 0xAEA9FF28380169FFull,
+		    0x5E63491ACCA09E20ull, 0xCC99E1F3854D3214ull },
+		  { 0xB3E040022A099464ull, 0x357B613529CF9112ull,
+		    0xD976C9D49E0031B5ull, 0x31E28F89D9A5A4F4ull } },
+		{ { 0xA59A1E9A5971C857ull, 0xDEC99E6DABE6093Full,
+		    0xE2453CC38B61CF3Dull, 0x070B9D4985E5B0BAull },
+		  { 0xFF9CB63DCAC8DFC1ull, 0x33A83DA1EC5461AAull,
+		    0x86B810AE46373CFBull, 0xED80461BFF4B6250ull } },
+	},
+	{	/* 16^32 * G */
+		{ { 0x57C84FC9D789BD85ull, 0xFC35FF7DC297EAC3ull,
+		    0xFB982FD588C6766Eull, 0x447D739BEEDB5E67ull },
+		  { 0x0C7E33C972E25B32ull, 0x3D349B95A7FAE500ull,
+		    0xE12E9D953A4AAFF7ull, 0x2D4825AB834131EEull } },
+		{ { 0xEB0421211A6B665Eull, 0x802F779EA7F6803Aull,
+		    0x47501F2A3C0804C3ull, 0xA263919B4945A1D4ull },
+		  { 0x9EE4040030BCDCFBull, 0xAC3F83DF4C00EFE2ull,
+		    0x2E9D3C9DE60D60C5ull, 0x873200BD2AED20FCull } },
+		{ { 0x73E1998EDEA6DB68ull, 0xDDFAD856082632C2ull,
+		    0x58B14DF965DEF4F6ull, 0xF8B6533E03CA017Full },
+		  { 0x69BD25B0AE760DA9ull, 0x6BBD70DD9C5CA0EDull,
+		    0x2F046DDA50AA3EC6ull, 0xC30F4EF5EC445486ull } },
+		{ { 0xF6F1D3AC4D771F0Cull, 0xACAD16E63BE0AEA8ull,
+		    0x18E63ADD579547F0ull, 0x2890D721E57E1961ull },
+		  { 0x0A5728ECB5890D78ull, 0x7DC0E7F77EF54069ull,
+		    0xAF77E1D1416752ECull, 0x69B5B8159DDC032Aull } },
+		{ { 0x66D5D4EBF924E753ull, 0x5F0173072CF8727Cull,
+		    0x548EF18729EDFB75ull, 0xF35289D35582847Cull },
+		  { 0xAA45B5C2EB13A20Cull, 0xC562FC57292D0F04ull,
+		    0x93DF08A1B50E1BD8ull, 0x75C1781EC5EC13FBull } },
+		{ { 0xF8B6930D2670213Aull, 0x946D1BF2AF7A9DA4ull,
+		    0x5430C3C0595033CBull, 0x929F5CFAEC5BE480ull },
+		  { 0xA53059C5CD486F14ull, 0x1B383964F7F20170ull,
+		    0xC5AC64BB51E39045ull, 0x29CD3692293320C6ull } },
+		{ { 0x2395CB673018017Eull, 0xAF141FFFD6DF23D7ull,
+		    0x4834185FB6734E01ull, 0xCFD06B74DA441716ull },
+		  { 0xA0AE7BE4CE0DFF50ull, 0x003030786B779777ull,
+		    0x8103B39587DA7950ull, 0xB647B7A9B72BA913ull } },
+		{ { 0x4F5822EFAC7E9E44ull, 0xD4E3FF5E71DA1781ull,
+		    0x81690628033DE305ull, 0x7B8B8867DD4D9C6Full },
+		  { 0x0767022AA8CD12C3ull, 0x64057E6DBBD72365ull,
+		    0x2246073C7DD5ADB5ull, 0x8BC6273E511680B4ull } },
+		{ { 0x04C81905792DB860ull, 0x81089288329A247Bull,
+		    0x1512D6D08F15DBE9ull, 0x0755E74C4AD5DCD1ull },
+		  { 0x7D6600DBA0D09849ull, 0xB2937464CFC2777Aull,
+		    0xD249B2D823815BC2ull, 0xFE16AFA753AD9E4Dull } },
+		{ { 0xC6327E20CC2F3082ull, 0x585E6C58DD17AEB9ull,
+		    0x7BBF9038D79BFF6Bull, 0x823C8DE5A5E97DBEull },
+		  { 0xAC1B42A9958BD76Cull, 0xCDF006775A45964Cull,
+		    0x17EDCE97ABBFE885ull, 0x61FBA612A1E936CDull } },
+		{ { 0xA9EF6955EA26BA6Bull, 0xDD2CA2A496DA12C3ull,
+		    0x68A10C0D7EB0BBDEull, 0x88FBA84CC372C969ull },
+		  { 0x80414781E44972F8ull, 0x484A9E28E00CFDCEull,
+		    0xD266DA45B514788Dull, 0x512AEF649D39BE0Full } },
+		{ { 0xEEE143C1F0F870D2ull, 0xCF8A00249E4D1558ull,
+		    0x02FAEA8E759ACD21ull, 0x05F0C3CABE40EDE9ull },
+		  { 0x5F537C956E60E8CCull, 0xC2F725737AEB5F8Aull,
+		    0xBCE7A5998AB1AC23ull, 0x34B55D934F6D2C56ull } },
+		{ { 0x39C48A4294720CABull, 0x1A1EA5D41739B17Eull,
+		    0x8E50F6E7555C6F2Cull, 0xE1A0ACCBEC055BEBull },
+		  { 0xA6D453F574B185C9ull, 0x084A2A71D080254Eull,
+		    0x1836F83077EEBCBFull, 0xE07968FB7E98C854ull } },
+		{ { 0x3A5357FBC1F6B0BAull, 0x8101DEBA1F12354Dull,
+		    0x1FD65B91ABEF8070ull, 0x9211EA4A827801D8ull },
+		  { 0xD91415F9A2B8E349ull, 0x4EE478B7AF28BBB2ull,
+		    0xC74BA7E95899CD44ull, 0xE7E91892E2152AB3ull } },
+		{ { 0x2A828FDFEC26C42Aull, 0x249BFB7E46B11BB6ull,
+		    0x50DB358931E7E6A0ull, 0x0AE93B86E6A73C7Eull },
+		  { 0x91063343B9F808CAull, 0x278A39EEF5AADB64ull,
+		    0xA942E3EDC1E20B37ull, 0x7028F6DD14787E13ull } },
+	},
+	{	/* 16^33 * G */
+		{ { 0x1EBD8BAC137DE736ull, 0xA2F8D5618688CE24ull,
+		    0x8937542B8CDEC18Eull, 0x9022E314949CCF3Eull },
+		  { 0xF4EF5C0844C42ECCull, 0x7F49366C44EA7657ull,
+		    0x66D0BB045226CE08ull, 0x2FAE5E4F2904A394ull } },
+		{ { 0x872E52CF757A603Cull, 0xE130A96964396297ull,
+		    0xC2731F7801B1133Eull, 0xA77663F5FCDF189Cull },
+		  { 0xD91745804CA8E468ull, 0x8AB86C568CBACE48ull,
+		    0xDAE982FA5476A35Aull, 0x4E139CBDADDAFC58ull } },
+		{ { 0x91706CB8D09B01F5ull, 0xF73F35183273C051ull,
+		    0xFB0F2D3F1AF7857Aull, 0x6E5872E3076FE945ull },
+		  { 0xC30758D9ABCD5FDEull, 0xC13179D4E09A85A7ull,
+		    0x80CC1D4AF3BEF0EBull, 0x4213C02EC8D77171ull } },
+		{ { 0xE83E2130461DFFE4ull, 0xA93D696BF79B5582ull,
+		    0x12911D2965F2870Eull, 0x1A7098D2DB889A11ull },
+		  { 0xF3BA5EED161315DAull, 0x68682783DE26B553ull,
+		    0xE5A42C936F76F327ull, 0x39D474F5EE8B69FAull } },
+		{ { 0xB539B747EFE45B1Full, 0x7BD155FB2E6168C2ull,
+		    0x4AFD1E344C17DF82ull, 0x292220B1A5DA3F50ull },
+		  { 0x5FE40B8B534BB026ull, 0xF7C344304CDD4104ull,
+		    0xE37C795FFAE98D7Full, 0xE316A0532BF175AEull } },
+		{ { 0x0493D0686DB76ED9ull, 0x63B807E9A1021509ull,
+		    0xCD6CB74AB4E765C5ull, 0x7DA5F99D3D6C3E86ull },
+		  { 0x80F1CF939752C9F4ull, 0x191CBB6B8C720131ull,
+		    0xE529DD1342C75643ull, 0xDA269AC028102F19ull } },
+		{ { 0x3E850662A3ABD540ull, 0x0E8040654B166DE4ull,
+		    0xC3224F8721093A34ull, 0x3644E14807A44F0Aull },
+		  { 0xE1C6FE1CD55DA631ull, 0x00177CEDA66FA14Dull,
+		    0x11C285309FA1E293ull, 0xEC5A9150DBC27976ull } },
+		{ { 0x84100F6F2472C9AEull, 0x1A078F4B263234F2ull,
+		    0xAC43FF1F15417FE9ull, 0xFFD92260EA330BB7ull },
+		  { 0xA0CEC1D866D03AE4ull, 0x263D2E9C868B8A34ull,
+		    0x5999633225711E5Full, 0xCF4B93B0BA211147ull } },
+		{ { 0x1A2FD21E89142CCBull, 0x4C920A5AC687EDE3ull,
+		    0xE55B38F4993BB482ull, 0xEDFE7DAE17FCD838ull },
+		  { 0xBB951D31AC593D75ull, 0x1DA442B69D51142Eull,
+		    0x61855D2B4F55BEB8ull, 0xC88692122E0DAF21ull } },
+		{ { 0xCD2C725D04DFB784ull, 0xA8239331DB50A97Full,
+		    0x237D162A581B7C63ull, 0x34A8FA8C48884176ull },
+		  { 0x213B4BE5247D5003ull, 0x2E73FC51A1EEBD57ull,
+		    0xCF3EC31A3FE1E53Cull, 0x51D8381001DFDF52ull } },
+		{ { 0xF3DA71C64A41B208ull, 0xE7F7475CDEE27000ull,
+		    0x98714026BCEA0DE8ull, 0x5311968B4059A695ull },
+		  { 0x691E1F9E048E4B69ull, 0x3B3C1DC02436877Full,
+		    0xA6C6581E33B3DA11ull, 0xB78D732B3DC22978ull } },
+		{ { 0xB544B022450CC54Eull, 0xDF180F578C520280ull,
+		    0x968DBD4D1D0D26FAull, 0xA826E880BC8555BAull },
+		  { 0xA463B4D6CCF176DAull, 0x5CB680FAC4C8DED7ull,
+		    0xD8C52F2EE5EC51A2ull, 0xAAF394288CBFA120ull } },
+		{ { 0xB3D01B5C495DAAE7ull, 0xAF46E6EC7C7033BCull,
+		    0xF7A22BF6F560E1D5ull, 0xF65DD1F22FFBA594ull },
+		  { 0x8D4E5A99C2556738ull, 0xEB06180F9EACD9B2ull,
+		    0x20E6FE637CFC4CD0ull, 0x9D71B820CE1B66E8ull } },
+		{ { 0x70862C0C4BF4B3EAull, 0x7126E7F99F8781C2ull,
+		    0x31A9A309315A28FDull, 0x08DC1F3F37AA789Dull },
+		  { 0xC2C42A8650C5E9B8ull, 0x920564232CAE4286ull,
+		    0x164C269569D32F93ull, 0xB1E8B4AE7AFF7442ull } },
+		{ { 0xABEFC15E3AFCF1EEull, 0x0AFAA80472069A11ull,
+		    0xB41BF480AAA807C6ull, 0xA6670E7EDCCAE248ull },
+		  { 0x378870ABE0C67FC8ull, 0x1EF39891C93CF38Aull,
+		    0xA395F72F4957AC13ull, 0xA7FD14C93A51C2F3ull } },
+	},
+	{	/* 16^34 * G */
+		{ { 0x741145C144CD3397ull, 0xDC34C10619515EB5ull,
+		    0x89386CF2B5156DEDull, 0x73BAFF0419EDA723ull },
+		  { 0x41EF2A139ADCB8E4ull, 0x779EF92CF8261349ull,
+		    0x6A00D1E8C18F825Eull, 0x1E97DE634977AC5Full } },
+		{ { 0xACC1FD7CDFD83618ull, 0x140B55DC318D93BCull,
+		    0x36CA35ADA0F4871Eull, 0x6FB5456391BA4305ull },
+		  { 0x3F39F5CB02430626ull, 0x2F1E6499AAE5D33Eull,
+		    0xED3B68C52109DABAull, 0xF663D87766C6B8A3ull } },
+		{ { 0x7EB0F952161FB913ull, 0x3E10246156D31297ull,
+		    0x344388DE44BED04Eull, 0x45F8330C33E60A18ull },
+		  { 0x70D4817C0C15C3BCull, 0xF06D0879F6FC3373ull,
+		    0xF80E8076D8BA7760ull, 0xC212CF6DBFD6906Eull } },
+		{ { 0x357BDB041CBD9A71ull, 0x42D91E70B46EF479ull,
+		    0xA145C7EBDF98E4B9ull, 0xD554DED0B2862113ull },
+		  { 0xA43A4A8B3C8CC32Eull, 0x5F29FEA9A7A61C99ull,
+		    0xFF0F7AD45AC39314ull, 0x74B8F94B6C36708Eull } },
+		{ { 0x5AEF9691EE393654ull, 0x965D4BE1F3EDD7C7ull,
+		    0x65F5A01C8BCD5991ull, 0x5544DC49ACD7BDABull },
+		  { 0x23610BBF8F53206Full, 0x241EFE9703D58E73ull,
+		    0xC04C05B5B8935192ull, 0xED3E85895087FD4Aull } },
+		{ { 0xE8B93F55BAB5593Aull, 0x44CE7343E662A7A0ull,
+		    0x54E17C99D42EB14Full, 0x44130B2CE9E10135ull },
+		  { 0xE3A5763DBF5B8E89ull, 0x776D1BDECDCE2E3Full,
+		    0x31CA51215B0580A1ull, 0x49197FC77907224Full } },
+		{ { 0x13F3599428A15DFDull, 0x741DBAC025FA9E55ull,
+		    0x4B3D2ED55AE2F695ull, 0x2757B790619EE773ull },
+		  { 0xFC8E840CF042C341ull, 0x1768978A3CA7156Dull,
+		    0x5CC975213CD5500Dull, 0xDF46D2D554C2B12Eull } },
+		{ { 0xDE82817F3BE28C8Aull, 0x9F61776622130485ull,
+		    0x63C4E45429625171ull, 0xB889D78BCF05F1C7ull },
+		  { 0x3037FE51EAFDF89Eull, 0xDFF631E5782FB8C3ull,
+		    0x182BE4A975C700EAull, 0xBABB0B07FA511B9Bull } },
+		{ { 0xEFEDF426BF840A5Bull, 0x148CADA5D3AD4984ull,
+		    0xD98421CCC1143CCDull, 0xE872437DE50E2BC8ull },
+		  { 0xB84E58551377E86Aull, 0xAC3A346CF9396464ull,
+		    0x593BC91F66248BF5ull, 0xF984BC8912729616ull } },
+		{ { 0xC95CDD857968488Bull, 0x9BF259AE601FAD6Dull,
+		    0xE090D2DF5125FD3Dull, 0xD8117A991A354EC2ull },
+		  { 0x45B6EED915801A3Bull, 0x1401533AAE5C02D2ull,
+		    0xB0D19E6A01B6EFF5ull, 0x00E4EBB986182AEAull } },
+		{ { 0x4956A9B8B36AFD6Aull, 0x9261FC50A1781E3Dull,
+		    0x392EF6D5E6F3334Aull, 0xC56CDCABA4D775C0ull },
+		  { 0xE6086BEEF3F87C26ull, 0x66F483B2568CC723ull,
+		    0xCD2EDEB17F594EF5ull, 0xD16056E2F386B070ull } },
+		{ { 0x44B05F8625E92803ull, 0xB14F6191E97C17AFull,
+		    0x6CA2519F3A756B62ull, 0x94054F36A1B6BC14ull },
+		  { 0x0E1E9A9B3786F08Dull, 0x9E6E5D1FE37F86AAull,
+		    0x4B0D80D7DDAE8FC9ull, 0xB848D8F95E4C4C07ull } },
+		{ { 0x1DAD980D2CFD2CD0ull, 0x23941334419C0C13ull,
+		    0x9CFD28583E48ABB1ull, 0xD3D6E6738F3FF286ull },
+		  { 0x4C579C77794AE2DCull, 0x001FA568C2F6F8F1ull,
+		    0x536DA8FF737DE59Bull, 0xFF448F5FCD159B68ull } },
+		{ { 0xCD7AEEC0BACBA6E6ull, 0x77DD55EA7721089Dull,
+		    0xB84DB41839070193ull, 0xF99A41F785FEE4D8ull },
+		  { 0xDE6E6D673D26512Aull, 0xEC328C8928E4B570ull,
+		    0xA37757C917F8BE49ull, 0xFB3296AEF4C8145Bull } },
+		{ { 0x09588855DAB7A64Cull, 0x56508D6A3A09AB7Aull,
+		    0xB03132D72237D406ull, 0x88F9778856E45C07ull },
+		  { 0xA05E98E11575F103ull, 0x36C30092216D2673ull,
+		    0x34531AF257969E58ull, 0x4A745CDD46B55C74ull } },
+	},
+	{	/* 16^35 * G */
+		{ { 0x0E2E5FB31FA4E33Cull, 0x2683BEC78B098CB3ull,
+		    0xC974446C2976FB98ull, 0x9CF646B91A4C25BBull },
+		  { 0x19C45E060E0D4563ull, 0x9E205827EBC16032ull,
+		    0x1E408E258B821F31ull, 0x37B0624DC1F65A89ull } },
+		{ { 0x8C496939C224EF48ull, 0x6CAE5469245E15F5ull,
+		    0x35917F8D5547844Full, 0xFE251903A4523298ull },
+		  { 0xAE6960A05136DFA7ull, 0x455AAAA1C321E408ull,
+		    0xD836B9405A1B36A0ull, 0x4FAC9CAC97CA9BE0ull } },
+		{ { 0xE98B618CC6BF1E67ull, 0x4C566749FE5CAF63ull,
+		    0x9D7A653827764E0Full, 0x83CB43DE151B6499ull },
+		  { 0xA27EE8B3099ACC97ull, 0x2874422CBDD1169Eull,
+		    0xEFB1806E624418F8ull, 0xBCE28CA24B98F6F8ull } },
+		{ { 0xBCCF5CB64D405A74ull, 0xCEC29F6BBDD3E7A5ull,
+		    0xE2C3B6C3F6131016ull, 0xCC411E541368F9F2ull },
+		  { 0x645BE6B618D1BDDBull, 0xBE4FC2009F16FB0Dull,
+		    0x571527FC350186D0ull, 0xFECB812FAC774584ull } },
+		{ { 0x230AD748DC0F057Eull, 0x84E8628701D53DD8ull,
+		    0x03340FC15E250224ull, 0x3FF3B3E560CEB08Cull },
+		  { 0x2D41F7DAA817965Eull, 0xA010236EC4701762ull,
+		    0x6F7FD17057867843ull, 0x7F17AD6F3BB6578Full } },
+		{ { 0x74D4780E769EBF5Dull, 0xD64FED987E38C62Bull,
+		    0x80DC73F390D4654Full, 0x84D6E7F91E9D174Full },
+		  { 0xBB0586F1662CC379ull, 0xB14A9F3AA8A268F2ull,
+		    0xE4F7033DE50AD159ull, 0x0555F4E86E407C4Dull } },
+		{ { 0x15114B40325E69F1ull, 0x6367A8F2D422BCB5ull,
+		    0xDDA19DE173D6AF99ull, 0x6E9EDB2DD8FFD83Full },
+		  { 0x720E17E3402B7E9Bull, 0x1C727454799F281Bull,
+		    0xAB3556AB65F3BFF6ull, 0xC0822216CEFF954Eull } },
+		{ { 0x96282910AEE1337Bull, 0x0898022A45C4A1B1ull,
+		    0xCA356EF3EFC35DE1ull, 0x8C6C923CF1A4351Cull },
+		  { 0xCB451D5CD9C84ABEull, 0x845362C1C6DDFA2Aull,
+		    0x5EFBB2319EAA8E84ull, 0xA1256FC84D40FF6Aull } },
+		{ { 0xBF252F66A288F038ull, 0xF0876894EB5FF820ull,
+		    0xEFABC19DE6EC2D32ull, 0x5EE280E804C41C4Bull },
+		  { 0x1C5AAB86B6F1EE6Eull, 0x11D7833A98E6C6F4ull,
+		    0x84C0586FECC9EEC0ull, 0xBCD969F94677E392ull } },
+		{ { 0x39D6C50353E90F60ull, 0x99A2D8E1E5C4A7A1ull,
+		    0x4521668B55DDE953ull, 0x6A2AE3E9C7CD7EB0ull },
+		  { 0x4E349B189A948322ull, 0xF3D4D34082A6F7E6ull,
+		    0x6FAF20A6219EFE23ull, 0x4BF6B287C0264E85ull } },
+		{ { 0xA0BF3256C0C708C8ull, 0x2C34304F2F70A86Aull,
+		    0x6DFE365D91FE288Cull, 0xE1F0166E05C20573ull },
+		  { 0xE718D73B3896ED38ull, 0xFB655F22EFB5A00Aull,
+		    0x0444632BE8A33016ull, 0xE647653E916C3B52ull } },
+		{ { 0x18C8936F8C320512ull, 0x8C3E4465E863C513ull,
+		    0xB0E4F5640B722588ull, 0x4AB0C75E4CC5F45Bull },
+		  { 0x33743AF64F0A792Aull, 0x51C3714292FDA61Aull,
+		    0xE8948891D80D8C09ull, 0xB04DAA0234AE0AF7ull } },
+		{ { 0x7E0F09CA476EDEFBull, 0xDD58BD80100E7D5Dull,
+		    0x7F121AB42979C7BAull, 0x28089687ABF6345Cull },
+		  { 0x2EF457229D1B0AE0ull, 0x4DD31B07BE039212ull,
+		    0xA67E19EBD90541C4ull, 0x5D071CF33D3B3191ull } },
+		{ { 0xB923DC396304C13Full, 0xED79EA8130092A10ull,
+		    0x22824B73D2E6D3E9ull, 0x1F637EF68FA60728ull },
+		  { 0xA69EC6ED13B60200ull, 0x7D98288CBBBB3438ull,
+		    0xDFDBDF045D762E0Aull, 0x8FE2C91F76BDAE23ull } },
+		{ { 0xD12D99BCF344897Aull, 0x7B9ED3075A4C269Dull,
+		    0x70585E852425EDABull, 0xEB15B0DE281904CBull },
+		  { 0xAD9DE83CE5BFE7EEull, 0x814698B2F97D0B82ull,
+		    0x0898AAF8CD732F85ull, 0x096CDD169C266071ull } },
+	},
+	{	/* 16^36 * G */
+		{ { 0x826FADC0523B716Dull, 0x0D238966F74E1A6Bull,
+		    0xE8A5C7938D18DF9Eull, 0xF81F5BE38B8CA534ull },
+		  { 0x464002F512632401ull, 0x660758503A878330ull,
+		    0x1D56D29D380E0328ull, 0xDC7F49329C1F06DFull } },
+		{ { 0x46E0C52790789539ull, 0x0E4E1A713BD05725ull,
+		    0x158EA76280D63182ull, 0x7459E772C29C4C3Full },
+		  { 0x3CDF5A471439D97Full, 0x383AF5E04F7DB391ull,
+		    0xEC7E8E858A2EC1A9ull, 0x892BC7F5183444EAull } },
+		{ { 0x84C5685039D19D8Aull, 0x3B41278951A55215ull,
+		    0x5AF6EC35C16D490Aull, 0xA6008450FB128638ull },
+		  { 0xFD95DBB3590D2C4Full, 0xF0FE008FA726573Dull,
+		    0xC8F6D45E7BE9CA84ull, 0x7B4B79C067A37C72ull } },
+		{ { 0xF4727E8C8EF2DFE7ull, 0x345E4FD95B8881C4ull,
+		    0xC604C9F87D2EFD3Full, 0x2E1C7C383D7F8492ull },
+		  { 0x3F85CCA2C55E5F2Aull, 0xC2D747D667B0C5BDull,
+		    0x6D9F4529FF7EA8F1ull, 0xC629DC2B09F0BE26ull } },
+		{ { 0x26987B39496CAC9Full, 0x59E38CEA5C44DE72ull,
+		    0xC64C09798FEB0E1Cull, 0xDE5382B1967DF354ull },
+		  { 0x7CE082FDAFA473D3ull, 0xC2E3E29473D84115ull,
+		    0x62C3B00991CF9F2Bull, 0x9C47B678B69C9185ull } },
+		{ { 0x3B4C7C0831BF35A9ull, 0xE2ED30366D621C90ull,
+		    0x40CB0798638B5965ull, 0x74DFABECC5345E53ull },
+		  { 0x3615B07B36A268E1ull, 0x3F5FA126C564848Dull,
+		    0x69281E79C517CE99ull, 0x48341B4C8956A770ull } },
+		{ { 0x7CB2963786807A23ull, 0x400020516A25FF3Eull,
+		    0x5344B99D51194EC8ull, 0xA7227B0807F2A908ull },
+		  { 0x1C471983D4115894ull, 0xE7BF8157B728CDC9ull,
+		    0x45DA847920A075ABull, 0xF5507525D45D39E8ull } },
+		{ { 0xACEBE833F2F21873ull, 0x022FC19D8429B019ull,
+		    0xE63138A90228DC28ull, 0x8C86799B36E7D519ull },
+		  { 0x8905B7D7E5159140ull, 0x5DBF4306E861F0ECull,
+		    0x61CE9FE475A272D1ull, 0x5C0C2C12A5A3E85Dull } },
+		{ { 0x5A797FC2044D14C0ull, 0x005CAB5FA1A8F35Eull,
+		    0x465ABE73A3661D39ull, 0xCD2B2E8D42344596ull },
+		  { 0xA560ACF222496315ull, 0xFDDB6F0CB9ACCECEull,
+		    0x4D505EEDDAC0F671ull, 0xF13012DF9B0870A2ull } },
+		{ { 0xA94A60E30F18A7ABull, 0xEAAFC3E392C6CDC9ull,
+		    0x12DE04490CD9BA82ull, 0x183950FDDD7BE0A1ull },
+		  { 0x6AE5DDF8560B4B74ull, 0xCC6E77E9D46108BDull,
+		    0x81CDA4CB3F77A930ull, 0xAA8CBEC079204CC3ull } },
+		{ { 0x66F4EB12399A1566ull, 0xF25C655AFF228F69ull,
+		    0x4CEFBC9B83DF9DD8ull, 0x11B2E84C8F0DF7EBull },
+		  { 0x59A4B3C05C56BB73ull, 0x824B55840CD80968ull,
+		    0xD042D698797405CCull, 0x6103769DBCA23175ull } },
+		{ { 0x5FD577FAB0F2928Cull, 0xF6BC238850E7187Full,
+		    0xA088CF12640A72F1ull, 0x675107E17BC4604Dull },
+		  { 0x8740BE4015174F14ull, 0xB26711D18B114573ull,
+		    0x5D664043D781F304ull, 0x6034E0018EA3F8D3ull } },
+		{ { 0x7D09EB28DBA6F34Aull, 0x31286A0FE245C6F8ull,
+		    0x759DA0A3EF991485ull, 0xFB6D19295F2BA070ull },
+		  { 0x9B5F3C822BCF0452ull, 0xECFCFA2DC9685B1Full,
+		    0x9E388FD4C4A791B9ull, 0xF29B2D29D7BF46DDull } },
+		{ { 0x48FCC264147C34D0ull, 0x26DC449C991C9EB3ull,
+		    0xDDB77E96F0B512ACull, 0xE42B60F34A9E51B9ull },
+		  { 0x6DE84BD897A87EB0ull, 0xBDF8BF104FC3C2F0ull,
+		    0xBE07CB0C7EB81C57ull, 0xFF0CC44F2CD6F0DDull } },
+		{ { 0x74CA2D2A0A435427ull, 0xA690109827E4DB50ull,
+		    0x0AAF67650D906651ull, 0xFF429FCC103C13C1ull },
+		  { 0x8E50450D39853824ull, 0x205BEE534A3A0DA2ull,
+		    0x94D409C856186876ull, 0x2ADDF9668A4ECDB0ull } },
+	},
+	{	/* 16^37 * G */
+		{ { 0x8ED9C7E787354B7Aull, 0x022ECA56C3915C97ull,
+		    0x2397F463E53CDE1Dull, 0x85685474D77E0848ull },
+		  { 0x8954402BD16E04C6ull, 0x06A891DC1FD6FDBDull,
+		    0xEEBC913B2A6F7287ull, 0x20B50EB50BF587B6ull } },
+		{ { 0x186C5AE0464345E7ull, 0x45FAF0843C5344C1ull,
+		    0x691EC77B5AF1694Cull, 0x80ECAB9F02B4CC6Cull },
+		  { 0x97A3DE52E042E3EFull, 0x32E500CA5BCCDBB4ull,
+		    0xFB5FC8F83E19FC84ull, 0xF424148ACA6D55C6ull } },
+		{ { 0xAF6CC7FA7B26165Dull, 0xA713A215F677137Eull,
+		    0x49E9D2092FCC92DEull, 0x617344C752B23E65ull },
+		  { 0xC49BFDCB86B2A286ull, 0x9899AC16E37171A4ull,
+		    0x49B7D10BD18220B2ull, 0xE9901617A437835Aull } },
+		{ { 0x2540306574362BD4ull, 0x5D139A212F6BC03Dull,
+		    0x33F1C0B1843EFF4Full, 0xE15D0F2321CECF44ull },
+		  { 0xBE6ACCDAAFB46FB8ull, 0x23ED4BF8A4468269ull,
+		    0xC1BFE039308BE326ull, 0x9A84CBE2707EC22Eull } },
+		{ { 0x021BF76650442770ull, 0x9018F7A6E101BAD1ull,
+		    0xDA04C1DA9E40FC2Eull, 0xF8AC03EE55FB6A22ull },
+		  { 0x3A2864F11B00C82Dull, 0xA97602BF95041D02ull,
+		    0xA436C751B34E6D17ull, 0x5A358E65599D1E8Eull } },
+		{ { 0xC363877731EFFFE4ull, 0xAA43DBFFE2AAF9DCull,
+		    0x5BAA9060C6A031ABull, 0x0C1E3E83F22961A1ull },
+		  { 0x5CCB48DA896A7824ull, 0x92F7DB6B5625B653ull,
+		    0xE869F22AAF60D216ull, 0x59190DF64DD74B5Dull } },
+		{ { 0xFBE06D86F65460DEull, 0x0C73F8D0AABF77B8ull,
+		    0x6C6CBCBE30CC8EA6ull, 0x8A731FB525BC95C6ull },
+		  { 0xE9859A1DFF8DC207ull, 0x35867E3C52508EE3ull,
+		    0x8F52954BFFB04DC4ull, 0x585855C5E2AB6319ull } },
+		{ { 0xD376B93B369F9C65ull, 0x5B4273B92840CC66ull,
+		    0x58F94187DC6D34DCull, 0xE7A38889DDB5553Dull },
+		  { 0x3B1BE4E0ACA7EE5Cull, 0x58A22B94187D1AB7ull,
+		    0x08E37B26192145BDull, 0x5437B5BAB1219172ull } },
+		{ { 0x642ABADFB51634A5ull, 0x3CF90A7835ED524Eull,
+		    0xBF0A6BA02CD7967Full, 0xA20B606132A8F224ull },
+		  { 0x26C13795F226AFADull, 0xC674757E3CD45EDFull,
+		    0xAD3D5FE8373B315Bull, 0x9C43CE9F697DB99Dull } },
+		{ { 0x2B5994FA8D201492ull, 0x44A87D89F414DC7Eull,
+		    0x768E49CB4DB97033ull, 0x551B5B794A2170C6ull },
+		  { 0x18B42675F7985F33ull, 0x035435F704D353E0ull,
+		    0x9DDF271EA3B6EEF5ull, 0x20F3F82A01775B75ull } },
+		{ { 0x70432244B3BA54A8ull, 0xB58B2635603AA970ull,
+		    0x91438EC34FC5CC0Aull, 0x016F1F93F1256709ull },
+		  { 0xED7C61FA664F2889ull, 0xD93AF27546A3B4E6ull,
+		    0x6F29B11BE49CE658ull, 0x08BCD34115895157ull } },
+		{ { 0x7AE08AE3F41F840Aull, 0x2F63F5B9A8E3ABB3ull,
+		    0x41D3E1D802596F51ull, 0x987F1F01103EB892ull },
+		  { 0x0C5C8E8768861028ull, 0x537D27BE14F7E057ull,
+		    0x8F39B5E4F13AB094ull, 0x0EC349554991F2BCull } },
+		{ { 0xDEEE493CE7C16D94ull, 0xE2581D0AA02845FDull,
+		    0x8C08FD67CCCEC31Full, 0xE61586670BD03478ull },
+		  { 0xFB4ED19AB14810ABull, 0x4E65CD1E47A443BBull,
+		    0x8C5B2B93F4B6F0EEull, 0x65CA03AE9E7124BEull } },
+		{ { 0xDA2481E77083CB30ull, 0x899ECD810D6783E9ull,
+		    0x71C56935CD7F05C2ull, 0x4343DBBF1A2C2BE4ull },
+		  { 0xCC757FFDDEEB4ADAull, 0x0FD47DF55831C8ECull,
+		    0x54E1AAC1696809BEull, 0xC0152534A2591445ull } },
+		{ { 0xCD6DCA6653CE728Dull, 0xF4CD907E2871CD0Bull,
+		    0x555A08A216C85347ull, 0xDCD37F0B38D56A26ull },
+		  { 0x8D7D136997CACBCBull, 0xCAACD346D29DABEBull,
+		    0x72C37B62B3C6D6F3ull, 0x6574DBD77CDA4C18ull } },
+	},
+	{	/* 16^38 * G */
+		{ { 0xDDC6DC1B12378C16ull, 0x9E3607554615622Aull,
+		    0xB319E52D6BF9597Dull, 0x1136B759C12B3B11ull },
+		  { 0x79F59BD0B3488127ull, 0x9614AA28E751CCE3ull,
+		    0x09F0ABC60FE9ECB2ull, 0x7DEC0FCF45168FDDull } },
+		{ { 0xD0E6DAFFF34D3977ull, 0xD95C410A18D0145Full,
+		    0x086F8C11B6445072ull, 0x11F1F5738159984Dull },
+		  { 0x14BC90EA00154B71ull, 0x937E953F3DC68206ull,
+		    0xCB829F87D3A748C7ull, 0xAB98C1B579C0B985ull } },
+		{ { 0x970E6D827B299740ull, 0xF40F467D713DB134ull,
+		    0xCC4AD13793FAAD48ull, 0x53893EB71CDD4336ull },
+		  { 0x51EA6F1B3FFF7509ull, 0xD8A132EF21FDE8CDull,
+		    0x3841CE28EA75DC8Dull, 0x27728A7E9485FBD8ull } },
+		{ { 0xBE840CA84D6A6A96ull, 0x953B9A779A2E613Full,
+		    0x9B8018B75E7D2586ull, 0x934C89B9AA1CDC48ull },
+		  { 0xEBEF148533D838EDull, 0x107D2DF0E2E4CA9Full,
+		    0x4516D6D6B31B2E9Dull, 0x856AF4FFBCCAF40Aull } },
+		{ { 0x30B3C956738000FCull, 0x4E1E27707BF03BC1ull,
+		    0x57E376BAF1FAE560ull, 0xDD64E9DD754CDA27ull },
+		  { 0xBFAA1C50DDF4AC12ull, 0xBE45D022B91E48F8ull,
+		    0x6DF89E3E19CA79FFull, 0x432193EB0C2932C9ull } },
+		{ { 0xFCE56020573AA9B8ull, 0xDF7150B8829ED224ull,
+		    0x5AA3227FB295F467ull, 0xD1BD257B592C6943ull },
+		  { 0xC16568492B51D81Bull, 0x75CE33D784CF7342ull,
+		    0xD0B4922E396A0E41ull, 0x177CC0CC4BC60526ull } },
+		{ { 0xEF82151733878C4Aull, 0xD883D03C8551C055ull,
+		    0xF2C69C60E4A91B21ull, 0xFF9845A87EFFD516ull },
+		  { 0x6BA6847D7488DF68ull, 0xF1F33746B65CFEBCull,
+		    0x8FD8A48EDFF5E8DDull, 0x835B9AF4A4E2428Full } },
+		{ { 0xFEBF5EA4ACC506C8ull, 0xA8030F018D3A3511ull,
+		    0x8F5832665CDA09C3ull, 0x4D00885C9A9DF215ull },
+		  { 0xD4FA660E1835AA2Cull, 0x45D17ACAA56CE133ull,
+		    0x14C0474409FE88A1ull, 0x3F853C3A9671C7F2ull } },
+		{ { 0x8CA9B88140F51524ull, 0x5FAEB6A15BAF86FCull,
+		    0xE8767A30845293DEull, 0x954E13E8BB91609Cull },
+		  { 0xE9FDB3D945E30A69ull, 0xA9EEA431141E7CBDull,
+		    0xD93C6243479ECBCFull, 0xECC8363FF92A4041ull } },
+		{ { 0x340229009CBDF013ull, 0x3E0C430DE7ED9B79ull,
+		    0x5BBFCB81CAF29994ull, 0x2D428C6F64278EAFull },
+		  { 0x76C7CE8DE6AC77FFull, 0x193BA01DB2D89244ull,
+		    0x573A0646BEEC01E3ull, 0x9C1ADE723716641Bull } },
+		{ { 0x1F798D53C4F77287ull, 0x412953C36930D9E3ull,
+		    0xDFCD50C5C1D80497ull, 0xB2217EF6FA41FB93ull },
+		  { 0x97A04A7724E7B5DAull, 0xD709DC739C5E93CBull,
+		    0xB5DFBCF88D38C843ull, 0xFB5153E0CE7CF3A2ull } },
+		{ { 0x4F7B2324CFA9AB07ull, 0xB3F11BDEF5FDC633ull,
+		    0xD12C12E9F5EFB870ull, 0x7AF6DDEC6D18AB02ull },
+		  { 0x55ED240B4999F264ull, 0x32F5B43E1C99ACC9ull,
+		    0xDDC63EECDDD915EBull, 0x304E6E352E694813ull } },
+		{ { 0x8AF5396C85C723E9ull, 0x1F973BAA9AA78171ull,
+		    0x122C6EAE915D5C35ull, 0x3C3950B17B79BDADull },
+		  { 0x5E38775F76834763ull, 0xB01DACB57C4906AEull,
+		    0xB494BB7EA186A8B0ull, 0xB99B7362209110DBull } },
+		{ { 0xACAEE11DBA958F2Bull, 0x252C3490039DD8BAull,
+		    0x096868E27350EB3Dull, 0x1EF57B1FFB961331ull },
+		  { 0x43B9E0339D9C13F0ull, 0x8598F8BDFAEDE849ull,
+		    0x0EEE47F99ECABD30ull, 0xD45B7980D1A9E441ull } },
+		{ { 0x3717D6E23C18ABEBull, 0xD59DCD190725D62Aull,
+		    0xD1DED2F844BAA944ull, 0x803C7A2CCF961CDAull },
+		  { 0x6A439BF0E29BFA78ull, 0xED7C443C2A6721CDull,
+		    0x6B1ACF169C4B4409ull, 0x83FB5040A796E928ull } },
+	},
+	{	/* 16^39 * G */
+		{ { 0x9C762EF1943E832Aull, 0x07E50AB01786DF70ull,
+		    0x90F573A82589F18Eull, 0x0D2BF28BA7C2A51Aull },
+		  { 0x48263AF15B20D37Cull, 0x27EC9DB960551446ull,
+		    0x7087A10A94B4E7EDull, 0x0CAC3F4313BD00ACull } },
+		{ { 0xFE43BD70A38305BDull, 0x0B63F06C8F9B6856ull,
+		    0xFBE9218BF89DB761ull, 0x84FEEDC3620EBAD8ull },
+		  { 0xFFF41FF86073BBA9ull, 0x2568E12DDB32C53Bull,
+		    0x4A3F5B5C17DA3948ull, 0xF199BBD5A9C7C165ull } },
+		{ { 0x61EAC4BC112C9666ull, 0x1CF8C6C365FFCDF3ull,
+		    0xFD9BCC35B7D9531Bull, 0x34E5E85EB967F82Cull },
+		  { 0xB5A1853C992A3666ull, 0x0F47ED63C1E3A526ull,
+		    0x82846575CCBC4633ull, 0xC0CE68313221A36Bull } },
+		{ { 0x582554A2A1FAAF83ull, 0x3C399F34F03E03F0ull,
+		    0x21501871DFD7FDEBull, 0x5D890886CB475BD4ull },
+		  { 0x498413FF2CE31FBAull, 0x755B7179214633D2ull,
+		    0x46B14DEF6CB0616Dull, 0x970938BD84A2F69Aull } },
+		{ { 0xC1652BE351209502ull, 0x5941720025D92665ull,
+		    0xA6C493EF0919E154ull, 0x727362CC59F4D863ull },
+		  { 0xC677D1D3D7042B0Dull, 0xA18D37F9BB2760BBull,
+		    0x9F100B8C2CE91D20ull, 0x17B0F4229BABAB58ull } },
+		{ { 0xC5FA15BA3F891521ull, 0x2065A28C35A2D166ull,
+		    0x2EF73D190A70593Bull, 0xB5AFD1574FD7A904ull },
+		  { 0xAACE31C0F0D1ACF2ull, 0xBDD4F9934E541D61ull,
+		    0x71C573A608E6388Full, 0x7955A0AC880179CBull } },
+		{ { 0x455E7928A447F959ull, 0xF947DABA8271D368ull,
+		    0x973A14C4BB49EEE9ull, 0xA0C3F260054A6CECull },
+		  { 0xB039D248968B671Full, 0xB1B5540258D272C9ull,
+		    0x382F8C10CB628208ull, 0x508C73090E4B2C4Full } },
+		{ { 0x0604C5B8BDFF8874ull, 0x1BC3CAFC1640D35Eull,
+		    0xF5D74845410E1629ull, 0xA6E1C5814699E69Cull },
+		  { 0x1885D8EF93076DAFull, 0xB789999F3812B214ull,
+		    0x24B1E0A9EF5A2EFDull, 0x0C25AE34DFA827E6ull } },
+		{ { 0x021F9F025B37E1D3ull, 0x10761BE13CE4DE23ull,
+		    0x40CB433BE415FD04ull, 0x7E81B231F795CA7Aull },
+		  { 0x3F5FCA264155681Aull, 0x4EC84BF2B1C2E0E0ull,
+		    0x125E896CEE6C7C4Eull, 0xF3855A1B0E9BED13ull } },
+		{ { 0x44ED88DFEAF0A062ull, 0x6002DE365F76D2A9ull,
+		    0x923729BE3DAC09E2ull, 0x67E3D9A5C6F539C6ull },
+		  { 0x392CB84A785188CFull, 0xD54A03D5CA72746Eull,
+		    0xC604BCEFB6ABE481ull, 0xAD17FE9D1670DD21ull } },
+		{ { 0xC497715F56C051A0ull, 0xDCDF29246F5B3E6Dull,
+		    0x4A36D8E6DB0F2ABDull, 0x8035E21C7D8026D8ull },
+		  { 0x601EBB2FB2D0DD12ull, 0xB3E7DC63098B6235ull,
+		    0x375DBE6837BDD318ull, 0x0B8810A44B7A2BEFull } },
+		{ { 0xB60914E6301EF90Bull, 0xF11FEE4341DA301Bull,
+		    0x3935AB93E753A748ull, 0x9FBF99B277DA3D93ull },
+		  { 0x03F839472C9DF49Full, 0x4973193C0A90C384ull,
+		    0xB259A27CC432519Eull, 0x806A00260128CA94ull } },
+		{ { 0xCE00C309FF12C69Eull, 0xAFE5AEF589651963ull,
+		    0x06BAF0010204FCECull, 0x196908DFD618A533ull },
+		  { 0x8D3319041D114831ull, 0xB6B2E3371FFB886Bull,
+		    0x0BEE1DEADD21054Eull, 0x3F65BF6B2F916E04ull } },
+		{ { 0xD6D940287CA2EB91ull, 0xD0260C1D29BE35E3ull,
+		    0xF19D2AFE08B90C48ull, 0x18845229180712B0ull },
+		  { 0x6A917D4A0F091533ull, 0x0FDF00A69598D38Cull,
+		    0xB122BE6C54ED1A9Full, 0xD535A17D0F51D9CAull } },
+		{ { 0xE498E01FCB89C5EDull, 0x77B530CF797A78C7ull,
+		    0x46E6E1D210AD0F35ull, 0xDB77FCEB8961A2AFull },
+		  { 0x59FF1C7EED25B46Eull, 0x1F16C7AB68899AFAull,
+		    0xECF339BE4C99AD41ull, 0x7FD1DC3871CEE5CEull } },
+	},
+	{	/* 16^40 * G */
+		{ { 0xAEE9C75DF7F82F2Aull, 0x9E4C35874AFDF43Aull,
+		    0xF5622DF437371326ull, 0x8A535F566EC73617ull },
+		  { 0xC5F9A0AC223094B7ull, 0xCDE533864C8C7669ull,
+		    0x37E02819085A92BFull, 0x0455C08468B08BD7ull } },
+		{ { 0xE8B043C401CD7F36ull, 0x5799C8F19419149Bull,
+		    0xD36E2C6048BDFA17ull, 0x4EAFA17A88814D84ull },
+		  { 0xC778C64A0B2D1C43ull, 0x5036A58CAD4543D2ull,
+		    0xEE45531527EFC47Bull, 0xA47974D851EC201Full } },
+		{ { 0xFB14F217AB348FA0ull, 0xE0FE2459051541DDull,
+		    0xC2A223236C24B4BCull, 0x86EAC93DDDEB882Dull },
+		  { 0x4EE380954DA51CEEull, 0x6C26D96351CFEE8Aull,
+		    0x5A436F9E8D6F4671ull, 0x948F3853CBBC4D8Dull } },
+		{ { 0xCC319D54B96214FBull, 0x71DC987A8FEBC765ull,
+		    0xCDA9E496CDF1C589ull, 0xC6122FC44FBFDB25ull },
+		  { 0x3702BD8FB7ADFFF7ull, 0x08A6E48C1E271F8Aull,
+		    0x9031C9868877F91Full, 0xEA205BEC8343AC41ull } },
+		{ { 0x7AF41FFC99222C03ull, 0x948CE77E87E5E103ull,
+		    0x3F5E7D784859F407ull, 0x8BF09EBAF9FB3AAEull },
+		  { 0xA145F742EA72BB54ull, 0x9C9EC0E1DE20E1D4ull,
+		    0x3B48B1DBE7E5BA30ull, 0x509CBAAFE2E27A73ull } },
+		{ { 0x1686977A8D215BFDull, 0x8BE074267F1462B7ull,
+		    0x85B6220EA2D65D24ull, 0x8B4FCEBE1F52629Eull },
+		  { 0x06EAF00A475EC26Bull, 0xF9D502D09D21ADD6ull,
+		    0xF96FB1CADA9254FFull, 0x1F3307A9A822157Eull } },
+		{ { 0xB453A2C1D1AE9300ull, 0x5E1C470475C48280ull,
+		    0x19130BADA2F3735Bull, 0xE85E2DCBB7E70FC6ull },
+		  { 0x72A0DFDD1546E25Eull, 0xDEB7E185DF8C31BBull,
+		    0xC7BA7B5B823C2707ull, 0x451AAFA6D51CE0BFull } },
+		{ { 0xE97BE9ED0E9D6B84ull, 0x6F4FFFDDEE86B987ull,
+		    0x24B4042C13019FDAull, 0xB6D94022C1812137ull },
+		  { 0xE1BCAA0FBCA7CB21ull, 0xC23273EAEC4F382Aull,
+		    0x8634478884D77AD3ull, 0x93FF3F4162928723ull } },
+		{ { 0x2525D55605260CB8ull, 0x836F4A80CEB2152Full,
+		    0xA3F027DA1BA7DBF6ull, 0x3F5FB0F228C92F82ull },
+		  { 0x72FB4B441852C964ull, 0xFA3E8751FC5EC332ull,
+		    0x0E38DE15366783F2ull, 0xC55834DADA499987ull } },
+		{ { 0xEC11FC70323BA10Eull, 0xE0D54ADA7C4C386Aull,
+		    0xD92FFC6AAD7E567Eull, 0xC453BFC7281CF5C4ull },
+		  { 0xF2C263A396EE110Aull, 0x67ADB73EBB9E9BA2ull,
+		    0x2DF5245C3FE776CAull, 0xE6FA24418B36635Dull } },
+		{ { 0x4AA44442DA1CD60Full, 0x9F9698A9CC3092EAull,
+		    0x57AED074B4DA002Bull, 0x33685622B18D9996ull },
+		  { 0x4BF737650FD57D67ull, 0x5FEF5A4CBC50B8B2ull,
+		    0xBA858C00DEA7AF17ull, 0xD42F509EF1247CD9ull } },
+		{ { 0x6B96E60EC43E4011ull, 0x657FE995DDBB2E9Dull,
+		    0x8622F79DF3C7D730ull, 0x4C302E77F4602E9Dull },
+		  { 0x991210B65C5D5B0Bull, 0x8349CD4299A3FE76ull,
+		    0xC335017A576B9579ull, 0x776BC24768D62940ull } },
+		{ { 0xF053B6EBB7576342ull, 0x5B2C88833999222Aull,
+		    0xF7D0F9D8960979D9ull, 0x4813EB5C08F00080ull },
+		  { 0x64C155EB97376316ull, 0xCA2DC67D506A904Full,
+		    0xF66016848E33524Aull, 0x00043FD4233A4240ull } },
+		{ { 0x7B65E413A304E88Cull, 0x3173B811BB7F88C6ull,
+		    0x3754CC46FE2BB908ull, 0x871257A6D8FCB31Cull },
+		  { 0x31B8B859F97623C5ull, 0xCEE324D7B43C076Cull,
+		    0x2856CDF59CB86527ull, 0x10C8E34819BAFF2Aull } },
+		{ { 0x9F67171DFF69B2BEull, 0xBA41F74EDC1111C0ull,
+		    0xF1322DBBAE386E56ull, 0x80C3F1F9A5AE997Aull },
+		  { 0x8904B97C4102D2F5ull, 0xF14B74B35CB7A8BFull,
+		    0x2980E2765B1D5A9Bull, 0x0A932140A009DE85ull } },
+	},
+	{	/* 16^41 * G */
+		{ { 0x9C837F4FE476C81Dull, 0xB7A3030E99E53D5Eull,
+		    0x9AF7CD273DA8A366ull, 0xAD6090DFDCB41A01ull },
+		  { 0x818ABC84EE6705DDull, 0x393FDC364F3048DFull,
+		    0xACCD75C2CC5BD8A8ull, 0x77B5D1DD48F4C91Eull } },
+		{ { 0xAD180DC0CAED764Bull, 0x227F1D7586BD4CB5ull,
+		    0x2626F6CA66F6A11Full, 0x7E4573DA81BC84DCull },
+		  { 0x9C83115F17C2F2F7ull, 0x2FEDF3C7D11E7FB4ull,
+		    0xF1BB9FC93651B20Bull, 0x8CBBEFFD96069F25ull } },
+		{ { 0x0A24737CE2725490ull, 0x4AC3240623CB5990ull,
+		    0xA2ADAA533B09863Cull, 0xD90B45BB71AD697Cull },
+		  { 0xB0F84F84AFEB1299ull, 0x0CDC07BFF3C466CCull,
+		    0x09D8B5687378CBD8ull, 0x3326928EC1BB350Full } },
+		{ { 0xB5252B56C3F0E03Eull, 0x1A9C655F50187A3Dull,
+		    0x7977AAC8FC30C25Full, 0xAF13583CBF65021Full },
+		  { 0xBB2F5BFC575CCB22ull, 0xCA20EDFFA3E1DC84ull,
+		    0xDBF60BE46D83D6F8ull, 0xF8FE31F81A9B57B3ull } },
+		{ { 0xA76B3A657E933668ull, 0xFB02D84CF86BABF0ull,
+		    0xAC05393AFA1F06BEull, 0xAC25921731213FC7ull },
+		  { 0x16E77F6732776FB5ull, 0x6F864189C69E1E7Aull,
+		    0x850EC13EEBD8ED7Cull, 0x6C79A03870DBA8BAull } },
+		{ { 0x560B276CB62CA483ull, 0xC3677BFD6DC6CEE6ull,
+		    0x9CD9C99C12311DAFull, 0xD32A0D2C402577AFull },
+		  { 0x4959A5DDFA435B18ull, 0x6D4C582B760D3D17ull,
+		    0x73A262470597D0D9ull, 0x0D17D4AD78A74B30ull } },
+		{ { 0x9A617C12128DE7E3ull, 0x86842AC3ABEA996Dull,
+		    0x87320FBDA7B431BFull, 0x7BC3374AE979F3A8ull },
+		  { 0x67A0B32EAE6E5E29ull, 0x55F2DB39B4C0CCF0ull,
+		    0xE00C77AE6E4BACBDull, 0xB431F02460854E5Dull } },
+		{ { 0x142FBC118FC3FCB9ull, 0xB2A3A6939881B969ull,
+		    0x28E91651ABE7ADD0ull, 0xDA2535F6CDA744D6ull },
+		  { 0x78086193902A869Full, 0xED8DF5246A0960D9ull,
+		    0x24454C68510DCDD3ull, 0xE756083C27486DF2ull } },
+		{ { 0x4ACB2323835E057Dull, 0x29CF10DAF6D89A5Bull,
+		    0x68BC872FC3411193ull, 0xBF9C149453AE02B2ull },
+		  { 0x6F564B282DA20FEAull, 0x440B9E181C5C479Bull,
+		    0xF385313F05C7A542ull, 0x92ACB89F25F23BE0ull } },
+		{ { 0xF427A5ACD29D4728ull, 0x64F93343E10C9845ull,
+		    0x231F27AA78A00B5Aull, 0xAF9B693139850548ull },
+		  { 0x8F765C8F40F23D2Cull, 0x31C02FA3F0FFC37Dull,
+		    0x62DA43171B28C662ull, 0x6BA7497F4EF28276ull } },
+		{ { 0xD2ACD7C2021D6584ull, 0xF2705D6443B3D9E5ull,
+		    0x96E97DA35ADF014Eull, 0x55BF0839B5784F8Aull },
+		  { 0x0D564F428ED744EAull, 0x089E14202AE5A5A8ull,
+		    0x27ACBF6BA8BC7DCFull, 0x3D980733E4B61CCFull } },
+		{ { 0x389F54F13282E42Eull, 0x2ADF34FB31FA1AB6ull,
+		    0x6691F0403B650381ull, 0x4E99A32A4E4ACEE8ull },
+		  { 0x229B297FF15DA3FCull, 0xDD899A3675916797ull,
+		    0x8D3F09F2EB7485D1ull, 0x430039527356C74Eull } },
+		{ { 0xDD69DF6E41068C5Eull, 0x2A45EE6E4BE573D0ull,
+		    0x9F2AE14E7815D487ull, 0xFCF24E1653378D51ull },
+		  { 0x761F453F27C19D75ull, 0xE9176A4B2814855Bull,
+		    0x5C675E21B592E7AEull, 0x186BB0E5336FFFE3ull } },
+		{ { 0xFF3082D81974671Full, 0xB54988A09E08B511ull,
+		    0x9DED0D075B4488F3ull, 0x0DCA86CF66D2C78Eull },
+		  { 0x73C17C649AEC3A03ull, 0xA4980AABF46B6D4Bull,
+		    0x0BE305243BE34A80ull, 0x56750DC1225020E0ull } },
+		{ { 0x8B7D95F0620DA860ull, 0x843451AA4849D100ull,
+		    0xA1FDB65343D91F2Full, 0x7BC280D02F5167ECull },
+		  { 0xBE29104107AAC76Dull, 0xF2E19A2FDCC1632Eull,
+		    0xE2626BFA705EE6E0ull, 0xB33F6D77BBBD31E5ull } },
+	},
+	{	/* 16^42 * G */
+		{ { 0xA52F2C3693C4A205ull, 0xDE1ADF89F510A848ull,
+		    0xE466557075B929FCull, 0xB6E06C516305BBC4ull },
+		  { 0x537F4D865DB36D05ull, 0x63F99419A82A9F87ull,
+		    0xC5E1F126E79ED73Bull, 0xBDB4277C21B323F5ull } },
+		{ { 0x29F315F9FCDCFC44ull, 0xAF3674C6D797EB13ull,
+		    0xE55703A07BEE1E8Dull, 0xA61727A4F5F8DDBFull },
+		  { 0x93B82A7F0EF3D60Eull, 0xC1B9010462F080F3ull,
+		    0xDE692D5A2BBAE158ull, 0x03FD9E4F9B02696Aull } },
+		{ { 0x92F821F6F9E27907ull, 0x771AD4B388D9E4D6ull,
+		    0x6B395D5D6FDFBD68ull, 0x0ED9E43F84241C4Eull },
+		  { 0xF13F4F506E78C4FBull, 0xE9151CFEB8BA1905ull,
+		    0xF5BC0FD8EB120E0Cull, 0xB5AF874AFF6B2347ull } },
+		{ { 0x93FA154A553FAEA4ull, 0x324A7181C96B10C8ull,
+		    0x8C89F34B7CBF6A9Eull, 0x27708F23E8BDB74Full },
+		  { 0xB21ADE75D0802D2Full, 0xFC6D68B3D1965BD1ull,
+		    0x300225D66CC2C973ull, 0x575F186149CAA4A4ull } },
+		{ { 0x36D0572535B38F54ull, 0x2E2A860E5CAF07CEull,
+		    0xC55268DB48FEE1F9ull, 0x57A7E410076D8F7Dull },
+		  { 0x5FA781E6245F2809ull, 0xDFD76E39A907EBA7ull,
+		    0x194C8A23BC82DD21ull, 0xFD7F0F03C8ECAD24ull } },
+		{ { 0xA8C081B7A0F69001ull, 0xCFC99D57B30C8656ull,
+		    0x57DD0CD934B55A4Full, 0x2ED8369AAE243BF7ull },
+		  { 0x616CA32A2DBA519Eull, 0x9E3959C55A9244F9ull,
+		    0xF38A5DBAB4FDD7DEull, 0x8D916D516A90F28Aull } },
+		{ { 0x46FEBBF9A7A79593ull, 0x347A7249D25C4979ull,
+		    0xF52D9B258CCA5CF3ull, 0x24799AE2F3EF5DBEull },
+		  { 0xD6388D75D0920D55ull, 0x9994361F9BEB1398ull,
+		    0x32C3D1A9D363E300ull, 0x9436B5262EC87B7Bull } },
+		{ { 0x7FB5BF4597445FB2ull, 0xB0844AECB2DA6510ull,
+		    0x09BFE97CAB77AE6Cull, 0x7CEE417FAA66DC61ull },
+		  { 0x4FFFCD61A8223A26ull, 0xA667E8569ED0E31Full,
+		    0x96D871E7F9CF0BB3ull, 0x3040EFEBE1E5B9F5ull } },
+		{ { 0x60216EB50BF5ABDCull, 0x456CD3AFBD0B6506ull,
+		    0xED3111CB080D5D60ull, 0xF15017C6884C7026ull },
+		  { 0xB75DE2B8ADEF85B7ull, 0xCBDC675C27B85584ull,
+		    0xECD8341E3FC5E232ull, 0xDEA7EF1C2C5F02A8ull } },
+		{ { 0x37E96DC1176701F6ull, 0x5F9AB4E94444BCB1ull,
+		    0x1DA49D4EFDC21668ull, 0x9C85A7DF8EB3EDD8ull },
+		  { 0x4D817802F1BB52D2ull, 0xAF7A7B000BC3F2ECull,
+		    0xB00356DFECDFC66Aull, 0xE2625F6813BB92B4ull } },
+		{ { 0x69F252B1FE78E9B1ull, 0x8978E6DC4EC141E8ull,
+		    0x6E0F831F7512DFCCull, 0xE196E20F89B4BEAAull },
+		  { 0x4417561FCA77EED7ull, 0x908D0112BEED35F4ull,
+		    0x2A6408BE76B2ED9Aull, 0xA5D66D85F81A85A6ull } },
+		{ { 0x2F2FF3673C5E24DBull, 0x1C66E06D8F71F05Cull,
+		    0x05DFD1ED91C998FAull, 0x9BE2A2F68FAD9F22ull },
+		  { 0xA9FC9C9155E4795Eull, 0x55960AFCD16762B6ull,
+		    0x5A6CFF1C32895908ull, 0x01362FA0B6E4F8C1ull } },
+		{ { 0x76EE33E57B1CB64Bull, 0xD609E525618AC3D5ull,
+		    0xF397FCD71539ED14ull, 0x7779F5DE6C1B0302ull },
+		  { 0xD8E18D1CBABA3AABull, 0xE2A829423CAA9533ull,
+		    0xADFAB134A7A2E3FAull, 0x09A8423F474C3EBEull } },
+		{ { 0x63CAC4AF02E34DD9ull, 0x7F78E95026917BA0ull,
+		    0x3E1397278149A0C5ull, 0x338FDDA9D0F38CC8ull },
+		  { 0x51F7C7EA954D31ACull, 0x1054CDE1654A9D27ull,
+		    0x03385E79E65ECD33ull, 0x8F8FA4F59F5972C2ull } },
+		{ { 0x3ED8587691D1B492ull, 0xDFA0618C2019A6F5ull,
+		    0x1E5F6D9AAEB28CE8ull, 0x8605B94BE423A2F1ull },
+		  { 0x571D77BF78AC6598ull, 0xEE23526D481E925Cull,
+		    0xF3EF6E0C2143D1A8ull, 0xA8E561287DE75758ull } },
+	},
+	{	/* 16^43 * G */
+		{ { 0x3CD5F4E4A9AA52DFull, 0x18C452B1B42A627Full,
+		    0x6DBC4189D991ECE6ull, 0x45A511C97F608BF7ull },
+		  { 0x7B52BD12125EC16Cull, 0x5A919B27D22955CEull,
+		    0x3FE3337FCB625AD2ull, 0x73BE0EC773EA9B6Dull } },
+		{ { 0x13CC521BF003E44Aull, 0x020688B6B3A0E5F2ull,
+		    0x2BF7CA0444AB1B75ull, 0x4CD2A0BAB6ACE28Aull },
+		  { 0x4993ECA97B19C38Dull, 0xBDE2E7D1C97EA5D6ull,
+		    0x6D1310756218D126ull, 0x6ADF08C371D22405ull } },
+		{ { 0x656753EFAE75BC7Full, 0x95C7170DB6F7FB1Full,
+		    0x8EF40F1217CD4C7Bull, 0x0B57AC4FE72B9343ull },
+		  { 0x04F172DD0972E9A9ull, 0xB1F96C0E4049FC62ull,
+		    0xF28C34CFA57E94FAull, 0xCEEDBF8277A9F3B5ull } },
+		{ { 0x7AD039A2F521BA40ull, 0xEDC4E459A0829DB2ull,
+		    0x323357A021C84544ull, 0x7451FE377B24776Bull },
+		  { 0xD0A61CD3E518DCF9ull, 0x36B09EB9985D5439ull,
+		    0xD69002198464EADEull, 0x16396435FCC70940ull } },
+		{ { 0x137433CF833125FFull, 0x354557B05A5A8142ull,
+		    0xCF4682D9CA1CAE99ull, 0x1178B3FB6E4BD148ull },
+		  { 0xE80F9709D8486ABDull, 0x0DC8ADCD08E54D1Bull,
+		    0x382DE637EA310ED1ull, 0xDFD697EA9BABD95Bull } },
+		{ { 0x82155E1DA2152BDFull, 0x008CB862FAE80192ull,
+		    0x1589068F2ACF1870ull, 0xC31F323D127261F9ull },
+		  { 0xEDC121B6CCD2022Dull, 0xBFC9C1BE1030637Dull,
+		    0x9EC96DFD936414F1ull, 0x2689DD48ABBE7580ull } },
+		{ { 0x3B3695CCF662D955ull, 0x8444D685B48CE44Full,
+		    0xF8A83B7E8D275693ull, 0x8AC7A0826F94E907ull },
+		  { 0xBC6A2DBE646B3DAEull, 0xE3F481C5BD6C138Dull,
+		    0xC9D7E5234CB59AD9ull, 0xC80F40920F33231Cull } },
+		{ { 0x6C47A8CBAB3F4576ull, 0xE9D08BAB256A1904ull,
+		    0x24A33A3BB84EF35Eull, 0x058FDC0DFE5DCAA3ull },
+		  { 0x3A45E3E1A0110E9Eull, 0x1E80139260757759ull,
+		    0xC3DF9B4606B8871Eull, 0x90EE3B9E9EA9E0E7ull } },
+		{ { 0x7CD879ADE88803E5ull, 0xCC1AB7CE0D3465CBull,
+		    0x1AB7FA8700569E02ull, 0xC0F48B2859DDF211ull },
+		  { 0xA6932202876619EEull, 0x932E4E070B828EDBull,
+		    0x9C9A64727E60D7D3ull, 0x3D4326B6F883CA36ull } },
+		{ { 0xA2E1D75449E23FE9ull, 0x6101A11756076ED3ull,
+		    0x881E580CE503BA50ull, 0x8D03E705C0BC475Aull },
+		  { 0x9D3C68A567B4D038ull, 0x6601F1086EB5B633ull,
+		    0xDB7C876CFB9453C5ull, 0x6FA65113C3FF4A09ull } },
+		{ { 0xA96D67099E1F515Cull, 0xE2B48A32216539AFull,
+		    0xA019C8E10FF7B8C0ull, 0x2CE8700F0351766Dull },
+		  { 0x95193649852EED6Eull, 0xA7A9DCD3E2C3D52Cull,
+		    0xBACB2F42F7EF5D2Cull, 0x73879F4F3B5EC4A7ull } },
+		{ { 0x043D95A53EAA99AAull, 0xF5EF01BA2FC2E5F0ull,
+		    0xA152C3A612FECD63ull, 0x0A9C1E53EC28889Bull },
+		  { 0xAA396B087E003BDEull, 0x7EA6D315A2B8C8F7ull,
+		    0xF161D8990A6B8FD1ull, 0xD731B36622FD601Aull } },
+		{ { 0x45AA3775E4DCF274ull, 0x807200682CACEA24ull,
+		    0x145E1BB0FD7CCA1Dull, 0xFAC44261DCB7C109ull },
+		  { 0x63698600F12F0472ull, 0x732027C6274594B1ull,
+		    0x7CC723D5D4EE97BDull, 0x9713FDC61566A8A8ull } },
+		{ { 0x2410978C33DBFEC6ull, 0x4435DE4E901F72DDull,
+		    0x187025DDF8E690A8ull, 0x9FB68EBE1B8A3C0Bull },
+		  { 0x3A92902EC95D4948ull, 0xC715AC677DE20383ull,
+		    0x1FECA8EF55D4709Aull, 0xCDC87FCBB7891DC9ull } },
+		{ { 0x2B5E4B6ABDC39D21ull, 0x68373EBD409ADC68ull,
+		    0x46591E43A1992813ull, 0xF891E6165B403E00ull },
+		  { 0xD5908E17C5CA579Full, 0x73A97EC4F5460254ull,
+		    0x18AEB8A8E2DBC43Bull, 0x129F53B12BBDFCEDull } },
+	},
+	{	/* 16^44 * G */
+		{ { 0x28CF1AB99076F57Bull, 0x030B86E3CECAC607ull,
+		    0xB927E3501CF2A53Full, 0x20E118564880C79Cull },
+		  { 0x8583BEDBADA7AFE6ull, 0x9FE0DC9B40E1B71Eull,
+		    0x31BDC3E3FB6DE997ull, 0xFF67B352AC437EF7ull } },
+		{ { 0x9E849544D4C20855ull, 0x62DF6C0F0BA0405Bull,
+		    0x3FEFE10D9289D72Bull, 0x4EED0B4DFBB5C307ull },
+		  { 0x4C087A3F8BDFFD1Full, 0x1136CCD32D34FE3Full,
+		    0x1941D3287FC115C8ull, 0xACE0FB288A56693Aull } },
+		{ { 0x849E3AED4B661DA4ull, 0x940A51AC64A84A5Cull,
+		    0x8F7C7FD903061A21ull, 0xFFCA2A5BB86606CEull },
+		  { 0x8984835EAF9B8A5Aull, 0x478F87ADE5687F6Full,
+		    0xA53CC9A148F46C8Cull, 0xCE1CB0E32B71CDC8ull } },
+		{ { 0x83D637E60524722Bull, 0xFEB99F12E6A12DE7ull,
+		    0x0A45B1168ED12D20ull, 0x42E0437C7ACA84F7ull },
+		  { 0x766939C81FEA76C6ull, 0xDBEA2A6DAF54265Aull,
+		    0xBAFD84CCC9B4EA3Eull, 0x2DE1DA0901D920EEull } },
+		{ { 0x3CAC1E139C8CFD22ull, 0x4E2B0671B636BE58ull,
+		    0x636535150DAD354Aull, 0xFF209CEDFFC116ABull },
+		  { 0x2389B14E93BC5535ull, 0x0D4F4B92C9684B94ull,
+		    0x207D41D24CCFF1C8ull, 0xAD79F397469D0F7Eull } },
+		{ { 0xC4AD7478ECDC9426ull, 0x0E411D07935382A4ull,
+		    0x9025F8240670DFDEull, 0xB30DDEFBC268D865ull },
+		  { 0xF33E104B29C7275Eull, 0x5B93309CAEC0238Full,
+		    0x4AB3871BC983D48Bull, 0x7DBF4FD5C014C153ull } },
+		{ { 0xE807E5858F4E983Eull, 0x6D9E6EC87017F77Cull,
+		    0x58604080D33B4B15ull, 0x33D5F02D0B079BA9ull },
+		  { 0x6D70DB8791EA37A9ull, 0x7A71AA9259630C95ull,
+		    0x73C3D61655BBA1EBull, 0x01EB5A76D39C4784ull } },
+		{ { 0xC6F24FC37BCEC904ull, 0x49A7CBF2445CC228ull,
+		    0xC499EA8FC2EF48C9ull, 0x070D96CCC51AFB00ull },
+		  { 0xF62F4DB2A3AB316Full, 0x53BDEC7B34681BACull,
+		    0xFC61582D55F0E977ull, 0x9B915EF5FF0ABC21ull } },
+		{ { 0xB695A79F61E52A73ull, 0xD0E3116C9705A1BCull,
+		    0xA9E974D9ADBB5E65ull, 0x8F1BD23DA6261690ull },
+		  { 0x57DA1451EBEA8F2Eull, 0x590502E64B1850A8ull,
+		    0xB8769E430743EADEull, 0x4C7A8F6393ADA8B8ull } },
+		{ { 0xB99A48999B3AC988ull, 0x422A103D58FB12CAull,
+		    0x90F30CFF81CF63F0ull, 0x7A8222EF9E8BB711ull },
+		  { 0x3030280DC665B755ull, 0x881FF21F1A211557ull,
+		    0x0E7BFF3ACDBD84F2ull, 0xD24A183E19EA8E1Aull } },
+		{ { 0x5842FEC2FD2BC078ull, 0xC4A0760529F3EF5Aull,
+		    0xEE6298B7DAD880AEull, 0x963BC9FEF7B637F3ull },
+		  { 0x7DDB231F5AFB8657ull, 0xC5EC0428F443A3C2ull,
+		    0x80A3E5092980A4F1ull, 0x7ED3383FCD1E7622ull } },
+		{ { 0xFA281F3FA8A4D326ull, 0xD1AE0C830C4719F5ull,
+		    0x8B8BCD87E4A8D86Cull, 0xE9A4D09A8DC935ECull },
+		  { 0xE6A8C7887D9DDAB1ull, 0x618EFF0672AAC13Full,
+		    0x5EDD81C41E336F77ull, 0x89B4E59EC839F9C0ull } },
+		{ { 0x6871E76EAFB608ADull, 0x74805654D88FD93Aull,
+		    0xE631ADDCB7C8BC49ull, 0x89FE6DAD861DA844ull },
+		  { 0x601406E7864D4DADull, 0xAEA9D513E0F0A87Bull,
+		    0x87B57DFFB725DF39ull, 0x2898278231F4E8FCull } },
+		{ { 0xE4F5F21825B6E7FAull, 0x3C72E26A6E9500FCull,
+		    0x5ECDAB57B08BDB17ull, 0xEB150E2E8D4E7C3Eull },
+		  { 0xF7135CA79C00DD1Full, 0xD2013CD9C6155901ull,
+		    0xF2006D1494C959D6ull, 0xEF367C87DE05B875ull } },
+		{ { 0x0718981B19AE4A29ull, 0xDF2FDA6EA2232A0Bull,
+		    0x510D7AC4E1166984ull, 0xC348047F3BD79759ull },
+		  { 0x34959AC4CEB09235ull, 0x8422E99F0549AEBFull,
+		    0x13DA8DD20E0DAE9Aull, 0x584781F2056A1C56ull } },
+	},
+	{	/* 16^45 * G */
+		{ { 0xDD1452E899273A8Full, 0x3FDD478E694FD54Aull,
+		    0x0318EC7FDFD7DAC9ull, 0x5C9CC4F8723A027Bull },
+		  { 0xADDACA695CE80D6Eull, 0x4F003675A11ACAB5ull,
+		    0xA827589D3708AF96ull, 0x84EFE07A1DFED259ull } },
+		{ { 0x0F2E4327BCFC91DEull, 0x8BD467275C0F80D4ull,
+		    0xA824A072E4C20A4Bull, 0x0E3EA757DEB82767ull },
+		  { 0x145E8C5DF582F54Cull, 0xBFAF0850149C5383ull,
+		    0x23F2ABF6056AAAB3ull, 0x13F2BF92FFAE2156ull } },
+		{ { 0x8C8C98544883E382ull, 0xD0604FCEF55536F3ull,
+		    0x5BE2403952007431ull, 0x5AC8E192BBDFD85Cull },
+		  { 0x51373D9BDDFEAADCull, 0xDE76ECA13D4D9D2Eull,
+		    0x39C8FFF2F0963976ull, 0xFCB7E5004C7A8C80ull } },
+		{ { 0xC5F483AAA556ED7Aull, 0xF6BADA2932F50E57ull,
+		    0x154A04034F63C34Aull, 0x9A6CABE1F8C78B4Full },
+		  { 0x2521483EA054A72Eull, 0xFEB87EAFD1220716ull,
+		    0x1DE544FB7D555740ull, 0xED9F5029FAD50045ull } },
+		{ { 0xBCA43077EF01A3E8ull, 0xC6EB65432E48094Eull,
+		    0x2D515D44E0D67362ull, 0x99DC0698B7912118ull },
+		  { 0x528645FE40F61114ull, 0xB7A67034D7F8F294ull,
+		    0x697AC71171D80044ull, 0x67C69CDD23B982BCull } },
+		{ { 0xE73B8EC1FC74D145ull, 0xB9C96BD28139B2BCull,
+		    0xA5DDB4E150CB2609ull, 0x9CD44DC242811D04ull },
+		  { 0x5C6C406240D456F7ull, 0x3339B8FBFE816E5Dull,
+		    0x045AD0BADD8443A3ull, 0x86ADCADAFC464E33ull } },
+		{ { 0x383F7B004CD535ABull, 0x7724D883E8764DC3ull,
+		    0x44024357CFCFB9F3ull, 0xABE2F3618E040616ull },
+		  { 0x90711B34517B9C1Aull, 0x7FDE7A18C3AC8DD9ull,
+		    0xDE0DBF2B202DF795ull, 0x4F02D64CB755B293ull } },
+		{ { 0xBCC2887A735A8087ull, 0xF318DE811D6A8871ull,
+		    0xD880F08099A2E4DCull, 0xED19A56A1B59CF5Cull },
+		  { 0xE56CA0873A9FE557ull, 0xA98CFD5AAE96DA46ull,
+		    0x30254512AB54AFE1ull, 0xCFBE683E6C3B56B6ull } },
+		{ { 0xDB4B66B36909970Cull, 0x4518DBA599E6E4E0ull,
+		    0x37C6FB1F77E6099Eull, 0x227CD0D78C39E721ull },
+		  { 0x285A4AE31F809727ull, 0xA210EC3F7EB99EC4ull,
+		    0x87D6C8741CFF5DEFull, 0x2225E771C819391Dull } },
+		{ { 0xBC64DBAB7E6325F2ull, 0xA68A7F0CDF05D32Aull,
+		    0xAA73845640C50EAFull, 0x7318F2CC7AC20E1Aull },
+		  { 0x726271EFB0013899ull, 0x2FF956ECE9FD3F10ull,
+		    0x0D2B1BD53182A770ull, 0x65746B8246E7281Cull } },
+		{ { 0xCD9ADFC989E65B59ull, 0x7A41022F7D44FF77ull,
+		    0x827EE930A8CD053Bull, 0x363146820AEDC5B6ull },
+		  { 0xC80A164269B4C2CFull, 0xC143C903B5C5B6E9ull,
+		    0x8E8278F920227FC1ull, 0x1D87DB6217897292ull } },
+		{ { 0xBBCD5A4DF85FA6CCull, 0x83BEFEEFFA594C92ull,
+		    0xA8B9841059328BE6ull, 0x4A247BCE25C45963ull },
+		  { 0x53337B0F8E2BC2D7ull, 0x2CD38DC8EF4D6467ull,
+		    0x0C92B3080F221CDDull, 0x8B4487F1D473B4F3ull } },
+		{ { 0x017B158BCD4C2506ull, 0x5B6C5DC7F19E9FAFull,
+		    0xE74A68CE189D1FECull, 0xF65ED6B6686B18A3ull },
+		  { 0xCC52DC253913DFACull, 0x4128EFC34CD6542Bull,
+		    0x5255DC2FD376E7BDull, 0xD6D0BC68328BAAE8ull } },
+		{ { 0x59544A87AECE4A11ull, 0xEADA9AF5476A97E1ull,
+		    0x7DE4BD6144ABC201ull, 0x87D600FD202009C1ull },
+		  { 0xD019658F9A4D4876ull, 0x5CABB39652A3BC0Dull,
+		    0x8DD72D4431473F9Eull, 0xF2D9FAC94931E5E5ull } },
+		{ { 0x81E4F9753B47A80Bull, 0xFF97C5A664249757ull,
+		    0x29DD9C276FABDBA8ull, 0x66A0DEFA11F61357ull },
+		  { 0x0F7195F8FF795E8Bull, 0xC230A428526EDD20ull,
+		    0xCAD8DF2561AEF474ull, 0x3E24AA6DE37ACA41ull } },
+	},
+	{	/* 16^46 * G */
+		{ { 0xE7DD9AB328523EB3ull, 0x351A3A75556C6C4Aull,
+		    0x46AC18444F3DCDE3ull, 0xBAFFD4EBF8A8B5ABull },
+		  { 0x1978300CD5ACF387ull, 0x24511CCFBF48B6EEull,
+		    0x003A8EB3795AC09Cull, 0x0FA93DC5DBC95E83ull } },
+		{ { 0xAE03AD0F9D2157FFull, 0xE9817B137D07F1EEull,
+		    0x751A418AE4EB8EEEull, 0xCAFB6C8657874A09ull },
+		  { 0x16CEC08173CE8988ull, 0x9C6AB445913B9E0Eull,
+		    0x01A1CBB99AB4E2E0ull, 0x2ADAFB1ED5C5C67Aull } },
+		{ { 0xD0099B4EF4737641ull, 0x1AFAC0C166C2E13Aull,
+		    0x7778B51236563FB7ull, 0x91B44522441C89EDull },
+		  { 0xF2512B29E101BBE0ull, 0xC9D7DC666E077D03ull,
+		    0x2C13235AB02FB428ull, 0x3F4463BD37FDA976ull } },
+		{ { 0x4700EB8CE51B2CF9ull, 0x37D28A48A4BF795Cull,
+		    0x9A879A27CF8EA9A3ull, 0x894890B2FAD37CCBull },
+		  { 0x0D187AC835979D3Bull, 0x498E7116A3BC2ECBull,
+		    0x88A0ABFDFD48E438ull, 0xD46800FF7C5B3011ull } },
+		{ { 0xC6A2BAB826DD01DFull, 0x743EFF76538FEFB9ull,
+		    0xA37EA6C7C8689165ull, 0x296D135DE82DB07Aull },
+		  { 0x4950D320AA3A0DC8ull, 0xDFFAF618E5E66F60ull,
+		    0x2B87129776C777CAull, 0x14054EDD92E145E4ull } },
+		{ { 0x427ABB1CCFE63974ull, 0xD15F33ED2466A2DFull,
+		    0xB7C5E38255F2BDC5ull, 0x9B46D393AB8E7935ull },
+		  { 0xABEDD0A2FCFB2502ull, 0xBF7EED5FF5415950ull,
+		    0x0554F01E26B9C5D6ull, 0xF3CCEFE1918B71A2ull } },
+		{ { 0xC67E6F06D650F5DDull, 0x54FFE1242191B2C8ull,
+		    0x8F13C2F1F19E4A96ull, 0x4B0942F391367A31ull },
+		  { 0xC2EA5BCC7AEDDC6Dull, 0x023C6782E4E73A62ull,
+		    0xE055C1015613C25Full, 0x7432AAA6366CABC0ull } },
+		{ { 0xBCFF60267E460D62ull, 0xA26E2A1E94139936ull,
+		    0xA1697678F8B8C55Bull, 0x463D8E29E481AACDull },
+		  { 0x226650888C11217Full, 0x8F9EAC14DA469B0Aull,
+		    0xF1FD6C6724F85296ull, 0x400F734B7AE2A66Eull } },
+		{ { 0x7A375E8F04E4A96Full, 0x188862B435655B14ull,
+		    0x833EDB8FC4D2E4AFull, 0x036377A62FECC11Aull },
+		  { 0x8BAFB7E051E08CDBull, 0x84098C2143091326ull,
+		    0x8D930C5578546263ull, 0xA1DE191D354FDF83ull } },
+		{ { 0x289D10A1D758DDCAull, 0x7B75FF75817D1EE6ull,
+		    0x1DC6AC386974ADFBull, 0x65ED3E3318FCA1FFull },
+		  { 0x55C81F702574BBABull, 0xAD540A47E7503800ull,
+		    0x53E5B3E2C50170DBull, 0xA0AF48F26663B83Eull } },
+		{ { 0x141FD3E1679B5A59ull, 0xC621E89EB269E62Aull,
+		    0xBCBBED5709D83251ull, 0xA1041AF730F5E162ull },
+		  { 0xD8D2B4022C5514A3ull, 0xFB30690E1EAC66D9ull,
+		    0x422650D873BC2AFBull, 0xAD42176AA8F58B19ull } },
+		{ { 0x85F694280F703588ull, 0xAB6187B010F996C8ull,
+		    0x8366893255833B9Eull, 0xDBBD8F0C432DB2ACull },
+		  { 0x66DC602DAE9E6EFCull, 0x9FB66F2B251D8A28ull,
+		    0xB5FAF53DCFE82B72ull, 0x1DFA800172BDF452ull } },
+		{ { 0xEAE8DB06CDDD597Bull, 0xD8893170CC85758Dull,
+		    0x03371AD0F9E92007ull, 0xDA2167AD0B1E5647ull },
+		  { 0x2681727E3DE7FA04ull, 0xCDDE2A52144F9F46ull,
+		    0x1FF6700EA798EBF6ull, 0xA21992B62546ED36ull } },
+		{ { 0x67A40AD1D98B4CD9ull, 0x90CFCE38B355F320ull,
+		    0xCEFD61B7ED7B5C63ull, 0xBBC1DFE363857973ull },
+		  { 0x30F0AB4A081C5F2Aull, 0x4D091E6872F5B002ull,
+		    0x97E6EBC2A186BC8Dull, 0x2FBE210034C2E5C8ull } },
+		{ { 0x9934A222B3F7DBB0ull, 0xF4EE23DC26BF29C0ull,
+		    0xBC863B872164F29Dull, 0x1C3FDBC237F6C678ull },
+		  { 0xD64CBDC972E16D32ull, 0x1F0646380020F8ADull,
+		    0xF0AEA5394A4B18D4ull, 0x39260F1037929813ull } },
+	},
+	{	/* 16^47 * G */
+		{ { 0x835208D8BA111101ull, 0x479F0B1A76DB3C5Full,
+		    0xED22A34D257E4C96ull, 0x06AD2A098FCED766ull },
+		  { 0xC1A7BA9D5FB37EF4ull, 0xDE429D82B70E89AEull,
+		    0x59A4C01BB9EB62A0ull, 0x2D5B8B1C58F85E35ull } },
+		{ { 0x2B1F0BD0F65BB830ull, 0x08FE3CDA3B36A5DCull,
+		    0xEB9ACB6EBFE5941Aull, 0xF657E9015F9855A5ull },
+		  { 0xC3B9A74D87B193FBull, 0xC2ABBA9CF2C8E35Aull,
+		    0x6DC83CD25DA0E7FFull, 0x8077A8BB3BCAAC49ull } },
+		{ { 0x76FC3847702BEF6Full, 0xBBAE4F184531EE43ull,
+		    0x04F78BD66BD8D475ull, 0xF1A2CA556C3BCD72ull },
+		  { 0x11B2D1FD8F6C1CA3ull, 0xB0B47EA81FD52B40ull,
+		    0xDF455417DC020168ull, 0xB39B59AF0488313Eull } },
+		{ { 0xDB47FFCEEB3FA150ull, 0x855719520EC5A6E7ull,
+		    0xF0EF002C94979625ull, 0xE46EABC9F8E2F20Cull },
+		  { 0xB934894C4A0B139Full, 0x50F68CC24C227E4Bull,
+		    0xADB002810C09FC3Aull, 0x2532CFC894C18963ull } },
+		{ { 0x806028FCA0455367ull, 0xE6C4F2C824D613E0ull,
+		    0xEE1901658EBF1851ull, 0xE924AD49FE3B8030ull },
+		  { 0x5FD18CF828257E92ull, 0x52DA31AA4FA6752Bull,
+		    0x752085393D6FBB6Full, 0xFCC97D979A143ED5ull } },
+		{ { 0xE0F0BCEA876AB854ull, 0xA0ACB88E2294AF94ull,
+		    0xDFCB04E096395097ull, 0x38136959C7525F69ull },
+		  { 0xF615B5AADFEF276Bull, 0x5AA59636DE810FE6ull,
+		    0x39E0257CFAC06A9Eull, 0x20136AC6A0B18411ull } },
+		{ { 0xE91F093942F8F1E7ull, 0x8DD4AA5D4DD1F9E2ull,
+		    0xA00B935105FB22F6ull, 0xF49D9C7DC5F7026Full },
+		  { 0x92228AB1914D9972ull, 0x01B0013C4E4D7A83ull,
+		    0x6AE5D3B3B994F679ull, 0xF5585D4203E3ACAEull } },
+		{ { 0x7724967E5833C4BEull, 0xE06A970759ACDC14ull,
+		    0x14BB5AF4516750F0ull, 0x107A4485AA07FE2Eull },
+		  { 0x6566EC48C87C80DCull, 0x4D3A4FC91D760C4Aull,
+		    0x813794EC48E68007ull, 0x6EA22142B8E4D7CDull } },
+		{ { 0x7B3A9677FB219A79ull, 0x5C4CD4417E9827A7ull,
+		    0xB0E3C355755189E6ull, 0x28B04D03E46A9D48ull },
+		  { 0xF8BF7CD9102DBE24ull, 0x86166CCF86004BE5ull,
+		    0x59CFE572183E206Bull, 0xF658DA9E5A14CF14ull } },
+		{ { 0x59E7401EA3B1C126ull, 0x85FE50C9767FD95Cull,
+		    0xFB9A11D7D914D222ull, 0x8618E592D6036FE6ull },
+		  { 0x789204CB07684433ull, 0x1B3C5B73377E9AECull,
+		    0xC3318EC138256E9Bull, 0x3211A2188797809Eull } },
+		{ { 0xB2822D9C57774AF9ull, 0x4C16BA6511460AD8ull,
+		    0xD6850392886AEFB5ull, 0x3F4766BE7CC1FE93ull },
+		  { 0xF7CD7F64DD4DE990ull, 0x1CA94CFDF9B7326Full,
+		    0x3AB178906E6E5F51ull, 0xCC810DD6A7331CBAull } },
+		{ { 0xE9D749FA0C2C179Full, 0xA178AEDDEF98026Eull,
+		    0x935EE6A977B1486Eull, 0x9B9692B014D724FCull },
+		  { 0x60A1C2357614FCB3ull, 0xB246C044118849D2ull,
+		    0xBF262AE1E166E909ull, 0x4C935CAF2FA8D161ull } },
+		{ { 0x78419F1E48E57705ull, 0x21CEB7FAC84D598Eull,
+		    0x1F2ADAB41D6F3617ull, 0xE3249E02C0F8EE79ull },
+		  { 0x094B19E838CAEC0Cull, 0x501945D716738422ull,
+		    0xDCB778C1F2486B5Aull, 0xA666658701369507ull } },
+		{ { 0xD4DC6CD7ADBD5D6Aull, 0xA6067CF27DF32BDDull,
+		    0xC7C45723D596A802ull, 0xC9DCDEB8F6B27A1Aull },
+		  { 0xE53282AB633F2165ull, 0x3E54815436800FB5ull,
+		    0xC1335F1607345B22ull, 0xC6A1767DD5F26757ull } },
+		{ { 0xC78BCEAFB25B93ACull, 0x17E202510587F8D2ull,
+		    0xBDF9E7693DFBB4E9ull, 0xA689580BDFB7961Cull },
+		  { 0xEA3D1C4D6F589AABull, 0xFCF1F817D9C4FD3Aull,
+		    0xAA7F2F015F059FF2ull, 0x4657CA94B4F0783Eull } },
+	},
+	{	/* 16^48 * G */
+		{ { 0x6CF20FFB313728BEull, 0x96439591A3C6B94Aull,
+		    0x2736FF8344315FC5ull, 0xA6D39677A7849276ull },
+		  { 0xF2BAB833C357F5F4ull, 0x824A920C2284059Bull,
+		    0x66B8BABD2D27ECDFull, 0x674F84749B0B8816ull } },
+		{ { 0x1583948C5974BB08ull, 0x75F3B0CAAEEADD25ull,
+		    0x4A661CAA2D2A1086ull, 0x3F06DCD2CE62E80Dull },
+		  { 0x89655DA995083C99ull, 0x831606905E88F53Eull,
+		    0x985807BE931D9B2Eull, 0x08BC2550CE1922DBull } },
+		{ { 0xC054B569CF15D864ull, 0x2406FDC6A1CC8D3Cull,
+		    0xAFC8ECE7BE26CF35ull, 0x07EF66D7C5DEDB0Dull },
+		  { 0x54625427740907FEull, 0x9F470E3B1CCE4A8Bull,
+		    0x06D40C5221FD505Eull, 0x2DB3325DB89DE6A5ull } },
+		{ { 0x1C101B8FD5C7C27Cull, 0xEB3228B94BDC794Cull,
+		    0xE0C05B31527E97B7ull, 0xEC61FF29918A1D05ull },
+		  { 0xADF01167D9DDFE51ull, 0xFE3C46C47690233Dull,
+		    0xD0960F82C7759298ull, 0x02FA1D3DC1B257A1ull } },
+		{ { 0xC695143C17C7C05Eull, 0xB283CB952CE5416Aull,
+		    0x14F3A72F75F28C0Bull, 0x82DF4E5FC06DC460ull },
+		  { 0xB9613D02D8FFF26Bull, 0xCF15D946842DB300ull,
+		    0x275216211217CBD1ull, 0xE4E188C98C96420Aull } },
+		{ { 0xC23E42E21D7DD05Cull, 0xC54F84D4C1B00E1Aull,
+		    0x69A3FB20E7D116D1ull, 0x5BB18BCDFF791761ull },
+		  { 0x56C549F2CB96A309ull, 0x95187587A4D2A416ull,
+		    0xF81B6DD5D7F58215ull, 0x42AD92172DEA4874ull } },
+		{ { 0x80AE1D41540368B0ull, 0x1324C22F8FEE949Dull,
+		    0x7D9E5B8D38E47A62ull, 0x261EFC9BC12B0C6Aull },
+		  { 0x13AD2559BDEB011Full, 0x7E340BE1E39B5D30ull,
+		    0xFDC8852CD64FFF79ull, 0x8A9D2ADBE386FCE9ull } },
+		{ { 0xC409332DE46E2050ull, 0xF5AC2A3900F5ABF0ull,
+		    0x4D6C6698316797E2ull, 0x9A79BFBFE71E347Full },
+		  { 0x7A3F4781926250D2ull, 0xCA94FACCB6DFDE31ull,
+		    0xB6F671F3B224EFA9ull, 0xE98B4DE6D316E200ull } },
+		{ { 0xF1033E9515EB8034ull, 0xF30B335F56E8CA4Aull,
+		    0x49AA7E59D9E7692Dull, 0x6D48DFD77A2C2791ull },
+		  { 0xE873087A5AB0CE30ull, 0x080210EA2A3E8961ull,
+		    0x3D5E79649E054763ull, 0x3CB47245165DD12Full } },
+		{ { 0x856EF847D4598089ull, 0x0E867737AA8D3616ull,
+		    0x552F2572BDF5A5BAull, 0x1F3FA7C10B9878CFull },
+		  { 0xED4B37C59825D989ull, 0x1DE1B2E886E5A500ull,
+		    0xC7CAE5B3F6CD1D1Eull, 0x7C27C1D9DB7B9E55ull } },
+		{ { 0xB5143DFC540535C8ull, 0x65F0A5630C8DB13Eull,
+		    0xA49123FB4FC54E6Full, 0x93A5C01E7BB98923ull },
+		  { 0xC49574083D59B844ull, 0x66A16204935BEDFFull,
+		    0xC16A84358E15A5C1ull, 0x2D440E904980C2F4ull } },
+		{ { 0x50AE677014BFC0D8ull, 0x71E2C88697A4800Eull,
+		    0xD2A4B4298373D400ull, 0xFB9198671B7EBB21ull },
+		  { 0x775250F36A805701ull, 0x07E90760D5C244B5ull,
+		    0x041E4E90FE1E9D28ull, 0x17FC6939A5FF362Bull } },
+		{ { 0xA261A5669E2047BAull, 0xE54704996BB0F652ull,
+		    0xB35DA0E017D67031ull, 0x3FB0B929161272BBull },
+		  { 0x57FECD4EDDB24158ull, 0x6C420AE7717009D3ull,
+		    0xCA72621C99666DC8ull, 0x9D467AE68217DF94ull } },
+		{ { 0xA9B77255B15D3AC8ull, 0x871E4ED9D99444EEull,
+		    0x5686DB122EC8AD7Full, 0xC8817E631BFDB29Cull },
+		  { 0xBF2C496232B9A312ull, 0xF5107BFE96DD8358ull,
+		    0xC293C342158697C4ull, 0xD157CC02D749CFD4ull } },
+		{ { 0x00BDBDBAE2DF71C1ull, 0x1C3186BEAFBB723Aull,
+		    0xD0763BA9DE33E438ull, 0xDAB09439E08E83D5ull },
+		  { 0xB873484124C3A1E3ull, 0x6E96330CA4B44E3Bull,
+		    0x385AE86F20D20B3Dull, 0x763CBC1E544E1CEFull } },
+	},
+	{	/* 16^49 * G */
+		{ { 0x6EEF62FF4514C6FDull, 0xFD683B4D0DAB013Eull,
+		    0x33D4DB5710FF5936ull, 0xAC25DA80089CF4E0ull },
+		  { 0x60B5397705830541ull, 0x810983E8243BF37Aull,
+		    0x883DA9312A1B338Cull, 0xEBC69D985CB44C7Bull } },
+		{ { 0xB456511069962F3Cull, 0xC1E6B5EA71A0D289ull,
+		    0x4AEC42B5296BC037ull, 0xB467CD65660C13B8ull },
+		  { 0xF75584CB22877596ull, 0x3CB212DF6CBDA472ull,
+		    0xBB3F5D2A011664ACull, 0xDC91B9BC4D36FFEAull } },
+		{ { 0x81941C7E32FD0E3Dull, 0xE631E4DC5427AD60ull,
+		    0xB4D748671E165547ull, 0xEEA7E66C49BA3C8Bull },
+		  { 0x10411F68D91D5868ull, 0x5ACBADA23019E3CCull,
+		    0x28843F27BE9B7D98ull, 0x83FED45B9F889261ull } },
+		{ { 0x919B1597B43C7E8Dull, 0x08533ABEEF2160F4ull,
+		    0x979280DE26DA6CDEull, 0x92F9A6F93FA37761ull },
+		  { 0x7746055552BF1285ull, 0x7309284ECEA31289ull,
+		    0xED41D3A6F5E542DFull, 0xBF618D715147AFE8ull } },
+		{ { 0x119F14F26CCB63B3ull, 0x7DDFFE6C44408E5Dull,
+		    0xBAD194B35403C67Bull, 0x9A3DE2D3E93E21BDull },
+		  { 0x01C532977DF93FCFull, 0x49C01D9FEF582260ull,
+		    0x809F2736EE813C4Cull, 0x2F809B90611112C8ull } },
+		{ { 0xB5CD34F827D3C9FFull, 0x7DB4BA1F065935FBull,
+		    0x65FBB469F6E48D44ull, 0x3CC4767A06772486ull },
+		  { 0x3016C53CC5AA7383ull, 0x772241168378473Aull,
+		    0x94F22765E37B7EDFull, 0x557C538D8CD381ADull } },
+		{ { 0xE4ECA34DD63F1117ull, 0x34896F70BA7F6D8Bull,
+		    0x05100D30123FADAFull, 0xA7C382F4B53B92DBull },
+		  { 0xC1220C5E1934CB9Aull, 0xAE4EB76ED3C4A68Cull,
+		    0x0459F777705DCFB5ull, 0x1B91E5116761BF88ull } },
+		{ { 0xD79A7081AFAEFC6Aull, 0xFD7516A5B209D887ull,
+		    0xA1623065BCE83B11ull, 0x5CE4FD836044BAF3ull },
+		  { 0x38606DFBBF9DB9A6ull, 0x4ABFBD4AB9E4ACCEull,
+		    0x1E31BC1EA832C714ull, 0x61042108AA50F368ull } },
+		{ { 0x50BC81C5A6774A96ull, 0xE8231FD91838E3E8ull,
+		    0x87143BFC83A6F497ull, 0x555AA998CD861213ull },
+		  { 0x9D40972D86DB0E34ull, 0x9A0D5D4BC8E26FA6ull,
+		    0x99D441E71350BBB8ull, 0xB0532868D207BC69ull } },
+		{ { 0x9BBD7FA90E22477Dull, 0xBBC69E0D4FF63D75ull,
+		    0x3057718FB12DB4EEull, 0xD3E5FC623EBDE538ull },
+		  { 0x8191F5C6DA5F613Dull, 0xE62D7ECCD5FD57D7ull,
+		    0xEEE497A64CD139A3ull, 0x7B9CF2B9DDF57FCEull } },
+		{ { 0x32F7EEF3AF7DAC7Dull, 0x16572B9211241212ull,
+		    0xB58CD78F8D77C369ull, 0x01A42F5B348A7AD7ull },
+		  { 0x27894A318195E46Eull, 0x172AF29328CEA96Bull,
+		    0x3497F954B8BF9216ull, 0x957A9C3855207781ull } },
+		{ { 0xB3868678B914B225ull, 0x71CD9EDE1D889C4Eull,
+		    0xDBACEC2A8CF6ECA6ull, 0x84B8CBAF6945C266ull },
+		  { 0xA0A42D0D04B5EA85ull, 0xCE62A2BEBC8F14ACull,
+		    0x34D5AC01C492104Dull, 0x40A6EEE647C236FFull } },
+		{ { 0xE02BA1D4202AFC36ull, 0x134DEED5143071D3ull,
+		    0x3A5B09EF1B45D3A3ull, 0x4B47F537EB05CE3Dull },
+		  { 0x4E89F76A6F8133FFull, 0x345ACBE9B25FBDA3ull,
+		    0x2DCB06FA0E8DF573ull, 0xF2FC450399C85F0Cull } },
+		{ { 0x4BB15C4A67551756ull, 0x4F37060F7513EF50ull,
+		    0xC1A61BA35D6178B6ull, 0x53CAFAE5DF3D6BB0ull },
+		  { 0x52377138A941E0FEull, 0x1446972C93FFAD4Bull,
+		    0xD3718A7B00221A28ull, 0x1B39E92FFE9F693Aull } },
+		{ { 0xAABF2E3C77D17F68ull, 0x7915A1DFCB8BAD86ull,
+		    0xD56516F536AE418Full, 0x6B3DEC9CC524E8CEull },
+		  { 0xCFAE7A20C9232402ull, 0x47F2A96AA6DCCB68ull,
+		    0x050981B416CD5D47ull, 0xB8653937FDEFD9EFull } },
+	},
+	{	/* 16^50 * G */
+		{ { 0x55D4E37A2FD20BAEull, 0x26035672D5B4A811ull,
+		    0x027BBA12176D343Aull, 0x285250EDC3BCFCD9ull },
+		  { 0xF9DE455A54E0AB97ull, 0x6E9B1A2CF1EFF323ull,
+		    0x3F7284AD1046C171ull, 0x7866C086F4AD7EA8ull } },
+		{ { 0xF0F2EFDB220CA9A7ull, 0x3840E563817C6662ull,
+		    0xB651D0CC325161C0ull, 0xDBC091D89944B44Eull },
+		  { 0x4D20588316C8E76Bull, 0x6367309FE96192C8ull,
+		    0x2D57926D1E4AA5FCull, 0x092D80EAAE856795ull } },
+		{ { 0xCC8876ABA636A50Bull, 0x5D2EF616ABB75196ull,
+		    0x5836FA12FC78BAF6ull, 0xF1E3C56545D5A75Cull },
+		  { 0xDF77914EAB3128B6ull, 0x6B7FA576D22D7A6Eull,
+		    0x6C736A67F6A5F313ull, 0x12B8847A6E1EFCE7ull } },
+		{ { 0xD6BE4FD07EF7D72Dull, 0xAD3A6DD5F518E8D7ull,
+		    0xB322489C6EE06D88ull, 0x9018BAA11E938F23ull },
+		  { 0x1267044FC036CE68ull, 0x4EB56D8002736AEBull,
+		    0xE8C147F743BF00B7ull, 0xC9C382D871F9C6C9ull } },
+		{ { 0x517F13214E583340ull, 0xF45C1B6B5D34F3B2ull,
+		    0x6D87CDABFA9B228Cull, 0x584D729C81E134A7ull },
+		  { 0x72F6E5E974FB24B9ull, 0x8F1770A66494C070ull,
+		    0xCD307C593030AFFAull, 0x2FDD80A4560D80ABull } },
+		{ { 0x08E24680B5182E0Full, 0x86C0E6EEB2AD008Bull,
+		    0x28A8842DDE8AD36Cull, 0xA77F7298D5478DDEull },
+		  { 0xA2B37F28C4B82D57ull, 0x3368AC6E2475B42Cull,
+		    0x0F1E64BBCA515F6Aull, 0xFA48A69C911B4FCBull } },
+		{ { 0x92C83EDE0235809Bull, 0x3C572DF0B5EB8173ull,
+		    0x1E2E028DC2383C45ull, 0xBAAEAE00C837DF7Dull },
+		  { 0xCD61D8A5C154FD62ull, 0x835C3C42A1D2E7E5ull,
+		    0xB4A2307BCB49F299ull, 0x325788833F324B80ull } },
+		{ { 0x07596C1F536BA602ull, 0xDD2F1E9BFF60A8A6ull,
+		    0x63336038135004A3ull, 0xEDD513BBFEF3FB24ull },
+		  { 0x3B8086F945DBF993ull, 0x61854D442DA5DCACull,
+		    0x7C592CA290F0188Bull, 0x257B598C3BB3F7A9ull } },
+		{ { 0xF60042C40D612268ull, 0x06CF59DF0A5ED016ull,
+		    0x65139EFA4394B8B9ull, 0x06C7E46360C2131Aull },
+		  { 0xBCB4B601260166A0ull, 0x238D8A5A782E7098ull,
+		    0x747FC75CE2F453CAull, 0xCB6AD55DF72DD8CDull } },
+		{ { 0x8C38D2FA8A4B89B6ull, 0xEC2227152243BDA3ull,
+		    0x8A5950D20F3E933Aull, 0x7EFD4F7497F886CBull },
+		  { 0x6F90F9762499522Cull, 0x2004F637C692E8DFull,
+		    0x4E0990488B16813Bull, 0x1874DE017416A66Full } },
+		{ { 0xBD43A35B812FBDC8ull, 0xB89E20CAA2C0E2A3ull,
+		    0x5BC2ECC7B711A36Dull, 0x064131DEABD6643Eull },
+		  { 0x5D3FF309A9F99380ull, 0x603AE268B1FB020Aull,
+		    0xF2B380D934957598ull, 0x882C7FAC32D67028ull } },
+		{ { 0xF4B795195E411DDFull, 0x32480A1AD7B6DB4Bull,
+		    0xD7B0D40606B76F34ull, 0xC0043B2547AB787Dull },
+		  { 0xAFD7CD7E02D2D212ull, 0x4EB9FDACE24C28F2ull,
+		    0xA435FFCDD3F79D61ull, 0x0BB75A0A9297157Dull } },
+		{ { 0x75EB00064BAC9F32ull, 0x443821CC59689B06ull,
+		    0x8A16416FE19B6400ull, 0x366BB7ACC275C237ull },
+		  { 0x42F0E5CFBC85D47Dull, 0x1FDCE50C07F0268Aull,
+		    0x4F0783AB8D61CFC0ull, 0x7D107B708785AF06ull } },
+		{ { 0x1426640292892C6Dull, 0xB2A424B9FF5F946Full,
+		    0x169D47D406C94C46ull, 0xBFEE7CB9EA3B7BEDull },
+		  { 0xBD8FF6B896F7DAADull, 0x805488897F61A685ull,
+		    0x26DE1D1626EE1537ull, 0x403EAA5228613CACull } },
+		{ { 0x03CB525286DD27EBull, 0xB98C55C37B3B5623ull,
+		    0x6B27D0E39BBE32ECull, 0xB767DB257CC73C00ull },
+		  { 0x15521A47CF65DAC4ull, 0x64B700B448600ED4ull,
+		    0x5CEACB816B99D85Bull, 0xDC1308C3261229CBull } },
+	},
+	{	/* 16^51 * G */
+		{ { 0x171F3A2A3E07E4F1ull, 0x1FC5147DD0DC267Cull,
+		    0x818DEBC07EF8890Eull, 0xC472C1062ED0366Full },
+		  { 0x571C683D86B0DAA9ull, 0x85F3B7B1E22B5D8Aull,
+		    0x6432AB5A84D667D8ull, 0x41820E01945F70E9ull } },
+		{ { 0xC0512999FA863437ull, 0xF8C49096987F88EFull,
+		    0x42CDDF6FBA29971Eull, 0x454E27CBFA01CBE5ull },
+		  { 0x179B00E551A6BBE6ull, 0x6B8D88D5C651B986ull,
+		    0x9E7E5F8F2F81017Cull, 0x134A4B214CF01E9Eull } },
+		{ { 0x4369534AA2F8ACB1ull, 0xB39D6554613F053Full,
+		    0x85E1B7A4B8ECC31Eull, 0x86F88F399545E3D6ull },
+		  { 0x14B042D105098A19ull, 0x4EEA62BEE9165271ull,
+		    0xB37C978FB591B121ull, 0x2CCFDD69A68238D6ull } },
+		{ { 0x3828179C8084A599ull, 0xB94130623C2C0317ull,
+		    0x06226D5629C51FFFull, 0x0ECFEF25FBC3698Cull },
+		  { 0x3DCB4C13D520E922ull, 0xEE9D57DF992F62B2ull,
+		    0xB2471C839F9A7982ull, 0x8132B98BF295F2C0ull } },
+		{ { 0xD88377B6FCADAB66ull, 0xE1C6A33C3DD35602ull,
+		    0x7DF7669660D9F9A0ull, 0xA2A3BE1FC9948E74ull },
+		  { 0xEF4A12484C1AEB12ull, 0xFB2DE8A53480AD25ull,
+		    0x06507ED74D235EE1ull, 0xA93BD8E6B524BE67ull } },
+		{ { 0x5CB709DEE63E9E1Dull, 0x896DEC1320EB0A98ull,
+		    0xCC8936952B904BBFull, 0x4366CD148FD0C312ull },
+		  { 0x6A57ED87DB364BF4ull, 0xFBE7CC19E0DF4045ull,
+		    0xE86995697BB39803ull, 0x2BA2AD81E31075C1ull } },
+		{ { 0xB89D2213207C25BFull, 0x82FBC777BE2D8097ull,
+		    0x367E124677C080BEull, 0x354E7CED56E78DB9ull },
+		  { 0x5123A3995A864211ull, 0x5FD756CB05A0AA21ull,
+		    0xE6EBD824A5CFE558ull, 0x629D62E9BB994070ull } },
+		{ { 0x644630BA41330C21ull, 0x075969944B3B7EDBull,
+		    0x9EC2C0FECC2F9B18ull, 0xF11F5D1DDCBBE346ull },
+		  { 0x54E06C7749EE7AE0ull, 0x0CAF2CBD57927715ull,
+		    0xB3E3750F78871661ull, 0xD20045D6570278C2ull } },
+		{ { 0x4A7D82E075E1DAD8ull, 0x8B80A78586C4BD2Eull,
+		    0x79B5CF720C099F49ull, 0xC751C9AAF5DE805Bull },
+		  { 0xD136B3612E4AFC8Bull, 0xE6F8970A3A0A8C02ull,
+		    0xBEB4C1FD6DC9A4FFull, 0xCB986437FC799DE2ull } },
+		{ { 0x96F264D366F70126ull, 0xFAD4302C3E7BC9E1ull,
+		    0x4B887223FE0B3FD9ull, 0x22FB2ECF815E2681ull },
+		  { 0x803F991F610B811Cull, 0xE2A4413C312B6E56ull,
+		    0x01D3E2D7FDA5DC66ull, 0x05C41F0179851334ull } },
+		{ { 0xD3121B21099D9BA2ull, 0x0CF657D697AAA757ull,
+		    0x78AB5286B50F9CA8ull, 0xAEE9CC41B9D1D021ull },
+		  { 0x78D60483BED2AD58ull, 0x312E68E26A17490Eull,
+		    0x7BE97BFB00C6B1F5ull, 0xB72CF302DB52A36Full } },
+		{ { 0xE38D54E8FEDA2A97ull, 0xADC53ADF247962EBull,
+		    0xE13EE8C1C102A021ull, 0xE6C92B5A52D770DFull },
+		  { 0x403F3E7FC8F8A8DFull, 0x0E74911C82171670ull,
+		    0x2752676CC984E02Aull, 0xE280E93CD7241796ull } },
+		{ { 0x63FF0824894D208Dull, 0xFB0DA8FF0FF391A4ull,
+		    0x6BFF60AF2B1FF0CEull, 0x0D0D3F46A7912EC5ull },
+		  { 0xD62F53F79D45D1B1ull, 0xB213C0D1A71DDABFull,
+		    0xB0474DA65F909FF0ull, 0xDC371B80AE1F7169ull } },
+		{ { 0xCD3240AC19C24451ull, 0x2AD9381AB187CDD2ull,
+		    0x3D483896BE3FFBE5ull, 0x6C21A0C6D8702797ull },
+		  { 0xFA43DFE9236F3116ull, 0xA04BE5EAAAECCEECull,
+		    0x343A31D7EF641EECull, 0x15E1E64E69B11A88ull } },
+		{ { 0xC6E822C819CFD890ull, 0xCB36C3737C071145ull,
+		    0xF47CD8387E5441E1ull, 0x778D146B44137535ull },
+		  { 0xC9A87FA7D6F057F2ull, 0x96CA45488ED20ACAull,
+		    0x2A52718D9786CD37ull, 0x3C85BA133B011AF7ull } },
+	},
+	{	/* 16^52 * G */
+		{ { 0x320F09C3839BB85Full, 0x0101FB06A050E62Cull,
+		    0x557582C99AD53458ull, 0x55D5398D1666432Bull },
+		  { 0xF7F631184FED936Full, 0xD90D6A7F1833D9E1ull,
+		    0x059C6A9E8EBAA72Aull, 0x576E229049FF8E2Dull } },
+		{ { 0xF642E95B4F491155ull, 0x28B1EB93FFF3C118ull,
+		    0xFD23639585D56F8Dull, 0x419A4F03AE7617CCull },
+		  { 0x4B91BA6AD489BBC7ull, 0xC7AB4A22074C6889ull,
+		    0x2E334B1484804545ull, 0x237C2D343A6E835Bull } },
+		{ { 0xC07E2B9212EA285Aull, 0x9F01C1E6F7B910D1ull,
+		    0x7858058DDDC0A7A3ull, 0x1BB46408814F888Bull },
+		  { 0xDC0C8A79907DC702ull, 0x1E52A34B992FA94Eull,
+		    0xA40FD9B892B4A4FCull, 0x8A3016BFAFAE1125ull } },
+		{ { 0xC0841BA9E49E8F34ull, 0xC3E61DAE0B35D0FCull,
+		    0x372304AD31ABF75Eull, 0xA2157EB3DADF2828ull },
+		  { 0x1A8E983289EEBEF3ull, 0x064BBBA35B187F4Eull,
+		    0x0FB42577CCFBE5A2ull, 0x0817697DA70DF31Dull } },
+		{ { 0x45012900D539785Aull, 0x8C88D076B8297F01ull,
+		    0xE0973E2678627A54ull, 0x04BC4E70E02FA14Eull },
+		  { 0x53990475CA62E3BBull, 0x877017727A3275C3ull,
+		    0xA5F5A1CF3F3DFB4Full, 0x5729F224B8CB4CC3ull } },
+		{ { 0x4E9C6714B80F772Aull, 0x4C3758A2B96EE4B2ull,
+		    0x7E54F059669A910Eull, 0xB76F40233E918CE5ull },
+		  { 0x2B481D7C72EEFF74ull, 0x56BA24196B16AE25ull,
+		    0x9618F274CEB09998ull, 0x05197211A7AED93Cull } },
+		{ { 0x112D4BB1E114CFB5ull, 0xD136189AA3D5A6A3ull,
+		    0x587739E1B7DF0876ull, 0xD3E492FDC1F88173ull },
+		  { 0xBCEB9AA5697F7045ull, 0x9C88F06E46754EEFull,
+		    0x1FEE2676BF15FEA3ull, 0x3604A70A73F8C48Bull } },
+		{ { 0xD4EB281C2D5C502Eull, 0x27FCE62D1DF14515ull,
+		    0xFB28652A88C376D2ull, 0xDC386DB7F409D9E0ull },
+		  { 0x23B47A257BFC1E4Full, 0x372C3DB3CC760B7Bull,
+		    0xE7E69C459D7AD72Bull, 0x526C6376CF20188Aull } },
+		{ { 0x1A2674BBAC55DDFFull, 0x1DAD1B3F64D4B787ull,
+		    0x8A4E52310FCDC179ull, 0xBEBFC25586284253ull },
+		  { 0x6D4DB0CA3EA2F303ull, 0x3CCA822D650BAA70ull,
+		    0x8A3A11C4B776576Cull, 0x850DE265C09604CEull } },
+		{ { 0xE49E72F50E08EF14ull, 0x81EC6EEDB69003FDull,
+		    0x0A8DA901C55D8F91ull, 0xEF938FBA5E02418Aull },
+		  { 0x84D5FFB0CAC193C7ull, 0x6F667F2A4FCD01B8ull,
+		    0x0DAB07948E47B80Eull, 0x824400400839F5DAull } },
+		{ { 0x91AF41E4C99EAD51ull, 0x5DA3543A21D9224Eull,
+		    0x2FB2931D16078471ull, 0x36E984DC73D20D60ull },
+		  { 0xC6FB9D426E0E5E3Eull, 0x3BABBEC1704280AFull,
+		    0x4BFBDFC9ACE32B20ull, 0x1437714721BF485Full } },
+		{ { 0x68119A550BDEB2CBull, 0x2C0CB5078F86A05Bull,
+		    0x4C9AF29039895A09ull, 0x2EE47B1E63B15D11ull },
+		  { 0x53ED9C7E453AD96Dull, 0x23B9D3B2811F1749ull,
+		    0x4EFD69719DD7C79Bull, 0x6ED220B6C3014A34ull } },
+		{ { 0x7A8B77BB23093DF0ull, 0x785E24816776464Dull,
+		    0xF315147954D793AFull, 0x91B6750043F604AEull },
+		  { 0x5CDE8C37D2CC9F14ull, 0x933685F8F9CAF67Full,
+		    0x477C7ADA96E21C5Dull, 0x07FEDB1E5824A00Dull } },
+		{ { 0x1688A672861140A8ull, 0x0A071EB5C5296EA6ull,
+		    0x8F231CA3C63AFEB7ull, 0x2530F0D5FD4F42A5ull },
+		  { 0x71EA3723A918D4BCull, 0x40CB6D19BEF1B4D5ull,
+		    0xBB07D89392CFF663ull, 0xADCBE6A85CB4C684ull } },
+		{ { 0xA2367B86FB7B8DC4ull, 0x5B3493028A9B3848ull,
+		    0x7C497E1A03602FACull, 0xC5D9C3C7A1C4883Eull },
+		  { 0xED64978D1B2DF0EAull, 0xD0D8F72FD1FD4936ull,
+		    0x5808C38605C50AF3ull, 0x3E59B9E25CFDB79Eull } },
+	},
+	{	/* 16^53 * G */
+		{ { 0xC62DBC9C32513926ull, 0xCC268940EFEC85ECull,
+		    0x94FEBAB24BFC3383ull, 0x884286463CA08726ull },
+		  { 0x0EE4282AAFB8A54Dull, 0xCE0EB122EBDBC15Aull,
+		    0x69660DB365D81207ull, 0xF778429C01C2DD5Aull } },
+		{ { 0x005791EA7C2AE635ull, 0x0F3D27B94CD4417Full,
+		    0xB48C9AD4808A2E9Full, 0x789BBEB0199B2C38ull },
+		  { 0xB781DFECBFE96DB6ull, 0x7FEF5A9C2CA1550Full,
+		    0x8680B79F62F1217Aull, 0x14357E6199189BC6ull } },
+		{ { 0xED2BAC196520F1F1ull, 0xD7F1B49E647F7DA4ull,
+		    0xD5A5FD168CCF6F4Aull, 0x3BAD9D36F76F0819ull },
+		  { 0x6A1970725698DF4Dull, 0x499981A24EB67258ull,
+		    0xBCD9FA7D9DEC0E80ull, 0x49F99DE33E24E659ull } },
+		{ { 0xB1F11F16F529B1CCull, 0x5156B3FD89B84639ull,
+		    0x2CBC4A513A0A9BBDull, 0x87C1D99C5EAD72DEull },
+		  { 0xCF26978DD5A94D6Cull, 0xBB0D0EB2C5B275E3ull,
+		    0xB8617A6CA55EF683ull, 0x7E1654C6985D0BCDull } },
+		{ { 0x0B1E44A8B185AE66ull, 0xA6EC16DBEFA783DFull,
+		    0x67A7DF53D124118Bull, 0xA6B3A4B1ADB0C46Dull },
+		  { 0x7BEB553F8BFBF21Bull, 0xBCBF0A5DF5B248DDull,
+		    0x1361A91CD969E8D8ull, 0x0CB6E8D763889623ull } },
+		{ { 0x201391BC2FA4E24Full, 0x5DC7FC279D6F25A3ull,
+		    0x550651821D38468Full, 0x1EC07B834F2A5EE0ull },
+		  { 0x318910FD4D270725ull, 0xECCD3C9377755DFCull,
+		    0xF73485CF787EDC58ull, 0x83FC544920187511ull } },
+		{ { 0xA9684CE4EC630E3Aull, 0xF61060C17FF3F1C2ull,
+		    0xE227E3A7D87F10C1ull, 0x1F848F5A6C9114A4ull },
+		  { 0xAEED9FF686CA610Aull, 0x4BA3926BFE359724ull,
+		    0x8629C83D1A9DA426ull, 0xA028552CCD06F963ull } },
+		{ { 0xF0F679F10B79847Dull, 0x3719A8B66BB19BE6ull,
+		    0x2DDB6C3DDC7F43D5ull, 0x2800043ADA0982E2ull },
+		  { 0xFE5B0083908D9EDAull, 0xA87058DBB8513AE9ull,
+		    0xB6C0796584A4DC3Bull, 0x0F99174667E82909ull } },
+		{ { 0x4DFEF3CDC41BCD10ull, 0x11B9557645B44E15ull,
+		    0x8B1A2677C6CA2EB2ull, 0xCFD1E54BE949C358ull },
+		  { 0xAC015EB9AA62E732ull, 0xACD9915D08553965ull,
+		    0x9C5751BD5B052FAFull, 0xF4E31F5F600958BBull } },
+		{ { 0x16C8DCDDF4AF9B61ull, 0x8E079636BF00E320ull,
+		    0xCF9BE92A49EC4B56ull, 0xE3AB7E11A14FF415ull },
+		  { 0xDBC29B8D92E40C9Full, 0xD03DB05CF3EFC38Full,
+		    0x91FD72E6C5750431ull, 0x5D946BFA1E316EDDull } },
+		{ { 0x4FA61D92228DA5FBull, 0x90E4BF5E2A870E72ull,
+		    0x12C795E3E771291Bull, 0x4B3E730C046C9E55ull },
+		  { 0xBFF0A638BC169E48ull, 0x65A3A11C9C23472Bull,
+		    0xE80CBA07B8E0B48Cull, 0x8C40964DA23660E9ull } },
+		{ { 0x3BBEB943D64C5C17ull, 0x736ED099F5F128C9ull,
+		    0x754324EAB9DFD896ull, 0x496CA72C0A9F844Cull },
+		  { 0xD9672E3CCB0E98A6ull, 0x2578F2A97237FF73ull,
+		    0x11129AC79F4E5E56ull, 0xB619B92668FECE3Dull } },
+		{ { 0xB8E91A589F894780ull, 0x37E9CCA3589AEC5Dull,
+		    0x1D54B8A54B42D8F7ull, 0xAFE915DF74438FE7ull },
+		  { 0x2F969553D511D444ull, 0x909E8BE73AC0AF45ull,
+		    0xA94B4342333F2E36ull, 0x3CAEC3408D204686ull } },
+		{ { 0x9298988AC2CAE99Dull, 0x410BEAACF463FCA1ull,
+		    0xE160BCF6D078BE95ull, 0xF064D13B5447A158ull },
+		  { 0xC66E8F8ED4682815ull, 0x2228C721F2335BF7ull,
+		    0x7B090C25BD2DDC8Dull, 0x91295B62FAFB0E0Cull } },
+		{ { 0xF5A31FCBD182FA6Eull, 0xC0A632DD6981C8AFull,
+		    0x5866A3A36D35C9E7ull, 0x0C05482810FFAC85ull },
+		  { 0x6EBCFEAB661CD145ull, 0xF5E664584B76D01Full,
+		    0xD1AA8B89465D602Bull, 0x2F9CD2CAD0F1F533ull } },
+	},
+	{	/* 16^54 * G */
+		{ { 0x3E0B5D5AD4441FBBull, 0x9EAA8520A5ED115Eull,
+		    0x7FB60C55EDB92555ull, 0xB4958C4E21DE21D4ull },
+		  { 0x4C7E3C9F4ADD7118ull, 0x2DB9F6132D463841ull,
+		    0xE5C041FBC38CB7E1ull, 0xFCD6E7BF996640EFull } },
+		{ { 0xFC4DA1176BD00B59ull, 0x2CDD704DBC1A71C7ull,
+		    0xE77CEB19F84DF258ull, 0xA41E9E9ED5876481ull },
+		  { 0xE8DD28CDCF2E6F15ull, 0x5CD253563DD4359Full,
+		    0xDA4E1ED1EFC739B8ull, 0x50DC31723B30F2B6ull } },
+		{ { 0x5AED684C371F07F1ull, 0x878CEDB730D70C4Aull,
+		    0x232EA0B64606684Bull, 0xB3A43F5E7B20444Dull },
+		  { 0x53CD22F4E01DFDA5ull, 0xEC7877A0CDCB0ECCull,
+		    0x4183227369975EE7ull, 0x34C64F5B248FD6B8ull } },
+		{ { 0xAB0C96EF401403F9ull, 0x32A6D94EBF58E793ull,
+		    0x2C5F09A87D6886DFull, 0xC02A0F2E94CC35ACull },
+		  { 0x21F59639A7ED80B0ull, 0xABB913066000ADB5ull,
+		    0x0F716D457C5CD473ull, 0x8EBAA8A18E491AAEull } },
+		{ { 0xFF7C97A46B559D49ull, 0x48E1B4690DDC9B44ull,
+		    0xC2662FFD84C008B1ull, 0x452E9869A46BE14Aull },
+		  { 0x747C6046DA0D6BA7ull, 0x5982856C3B1EE425ull,
+		    0xF5C0057B6761EE52ull, 0x8C5E8A8F195F80D0ull } },
+		{ { 0xFEE1FA912975566Aull, 0x6AF2B72D39C2B06Full,
+		    0x276C8D6312B7D65Full, 0x9F170A79D27219B8ull },
+		  { 0x5A576C88ECF3E6D8ull, 0xA0A6A793F5DB695Full,
+		    0xC799B0077D4E8578ull, 0x54A6AA2DE8864A0Cull } },
+		{ { 0x537A67EB53CE94DAull, 0x8BB24F4256829E60ull,
+		    0x51CDE0DC3AC474EEull, 0x19A7F5D48C6D62BBull },
+		  { 0x730447163025E7BBull, 0xFB625306AE25EB03ull,
+		    0x2F6A51D44200A2E8ull, 0xA2504BA7A93075C3ull } },
+		{ { 0xA69173875F7A8D33ull, 0x9A6C22E3ECA47658ull,
+		    0x1A765DE14913E26Bull, 0xB8D550A10D926557ull },
+		  { 0x1777B77BFEC3ABEEull, 0x541C3AAF586F670Dull,
+		    0x7D1790C97073E188ull, 0xDED908E0ED161C30ull } },
+		{ { 0xB9696CC6D47DC697ull, 0x17EE18AFB5E15B9Bull,
+		    0x011EB0B2B5FC6FA4ull, 0xBDAF5B020A4F34DCull },
+		  { 0xB911CBE786A479E2ull, 0x55122E7885B7A477ull,
+		    0x8CF575E47B57AA08ull, 0x3CEC0C6CBDFA836Cull } },
+		{ { 0x0F0F0DED60106D8Dull, 0x9AC1B330802AA4D8ull,
+		    0x70090E18F245626Bull, 0x39FEE9FD2D627675ull },
+		  { 0xBA2715CC8FAC1771ull, 0xC5F7E608422BBC8Full,
+		    0x414F1238A7434B81ull, 0xA4ED4A25730AD5B3ull } },
+		{ { 0x2A00B91B6CE05E10ull, 0x8AEF7C9F43E10620ull,
+		    0xAB84B7FE84CE70DBull, 0x265DBAE95F39D15Dull },
+		  { 0xFF7F018B171324F4ull, 0x0663F3933D64C67Full,
+		    0xF3B3CE8B56CB5DCBull, 0x58DF63D09A3037ADull } },
+		{ { 0xE7EFD2361161BAB2ull, 0x3A45062DAE0E6F28ull,
+		    0x38809B87C78CF13Aull, 0x14BE9987B11D1480ull },
+		  { 0x6BAE9A3E4700A3F1ull, 0x060C9FF44E4BB74Bull,
+		    0x4AF646E95E96CD34ull, 0xB1009F268E95F845ull } },
+		{ { 0xED15BC55B3FE5938ull, 0x9EC8303DB636D7CDull,
+		    0x89F749D53A566866ull, 0xC43E083F17E66396ull },
+		  { 0x7679756ED83732F3ull, 0xAB62307162440747ull,
+		    0x35090303ABC4402Eull, 0x54C6029239FBCC58ull } },
+		{ { 0xB05A78AB6A03780Bull, 0x91A6A55184A5C130ull,
+		    0x59CAD484D81501D9ull, 0xDB85215D2E0E93CDull },
+		  { 0xEAF21F928E7C4786ull, 0xDF8F56684DD531BFull,
+		    0xF9BDB3A11D663C6Dull, 0x2511CD6B26FD9A07ull } },
+		{ { 0xC31C70F79DD52975ull, 0x2BCF0FD306B44180ull,
+		    0x65AC50DA77B266BAull, 0x7868F1700A3F8486ull },
+		  { 0x3016ED503C626FACull, 0x68F6F9ECA6969044ull,
+		    0x113FA1C6DB11276Cull, 0xE89097CF31217EE1ull } },
+	},
+	{	/* 16^55 * G */
+		{ { 0xAC24E6436E12E1DFull, 0xD8A7FD0B7D761D04ull,
+		    0x4134BF13B346027Cull, 0xD0E0919688E932B6ull },
+		  { 0x6A6544DB9FD28FBEull, 0x544CC4BD9846B8DFull,
+		    0xB4EB60B691DBF867ull, 0x069C9A59FE7D1452ull } },
+		{ { 0xE27B29CC18DAC2D8ull, 0x8F7137DDF287BE11ull,
+		    0x66D8C6BE3C064ABEull, 0x49C696AD84A3A2CCull },
+		  { 0xBA5CF21DE3A6AEE8ull, 0x4D0FEC2ACFC3E019ull,
+		    0x578962C7088DDE4Bull, 0xFB7CBEDAE854B6DFull } },
+		{ { 0xBB0D8510084AA098ull, 0x09C10140A96E3E02ull,
+		    0x398A7DACBFC1FA85ull, 0xB517A454A13308EBull },
+		  { 0x6004B59F4540EFBFull, 0xA4D48B54692447FDull,
+		    0x60EA3E2FB0F26FA3ull, 0x0A3D877D0C1F879Aull } },
+		{ { 0x8EB8B6730050F080ull, 0x95F5BBF94BF15388ull,
+		    0x1C42027371D3AC47ull, 0xE7FE1A77506AEBC7ull },
+		  { 0x48C989DA99E9E32Bull, 0xF8EDFB37676496A8ull,
+		    0x1DE51E7893CB5838ull, 0x6A87C46D10E65DAFull } },
+		{ { 0x6D95ACAA4744BFA1ull, 0xCC26D27CE093643Dull,
+		    0x7BC22712D8F3E387ull, 0xF8EC14384B5166F6ull },
+		  { 0xC6924E6332B65F6Dull, 0x0A637AC5C3900060ull,
+		    0x32368FB269D60F61ull, 0x761134B2113FB9A6ull } },
+		{ { 0xC11746E5260AAFF5ull, 0xB71B993348271EF1ull,
+		    0x9B684BEED1B4BC5Eull, 0xA019B49AB61C6802ull },
+		  { 0x95C6DD62D5027088ull, 0xC2226B31F87A0193ull,
+		    0xAD17385454F78688ull, 0x5CF47CC5D82A6289ull } },
+		{ { 0xF62C3BE93227A4BBull, 0x4BE6B1F00F8D99F2ull,
+		    0x94E74EAD21D4F2E6ull, 0x320CFF78DB7BFAE7ull },
+		  { 0x581CC906B0F3D2D4ull, 0x6047237409E2F970ull,
+		    0xAB7796A254FF6299ull, 0xAF9FE8D4072A8692ull } },
+		{ { 0x05EC3921FA72672Full, 0x5A47FD7BFA47B095ull,
+		    0x069F16F419B12308ull, 0x9E02FB86B5061741ull },
+		  { 0xB24F5D49F4B7502Dull, 0x11741A026ED5C3DEull,
+		    0x265AB8CE550B0C1Eull, 0xD622305FEEA9F183ull } },
+		{ { 0x3B5B5A5E5C2CA683ull, 0x206CF35E0A95A737ull,
+		    0x17EDDDCCB543426Aull, 0x0C08DE7C6A7AED85ull },
+		  { 0x92406DB57DB5F259ull, 0xC3C8D7B7E0EA68C6ull,
+		    0xB7C8299CDFCE0E79ull, 0xDDB76D855EA16E19ull } },
+		{ { 0xB8CDB44097BBEDD0ull, 0xF9A1355D00BC321Full,
+		    0xA2CD693B4230F6CBull, 0x2A32684A8423A6DBull },
+		  { 0x73AEC28625CDDF15ull, 0xBE4A953740265C9Dull,
+		    0x80007DC929D2B089ull, 0x28BF4A6AE88B1279ull } },
+		{ { 0x1C67ACF8252AE5CDull, 0x95B652FAF4FDD786ull,
+		    0x18E6F7A44CE43909ull, 0xD1F8C76AD0C47C3Dull },
+		  { 0x7EB97BC3FE6D2DDAull, 0x39BAE8156989F4FCull,
+		    0xAC7997B01F612032ull, 0x74D45DC66120E802ull } },
+		{ { 0x0B8B20B43B7950FCull, 0xF1E91751624D3C8Eull,
+		    0xEC85EA796FDB9B69ull, 0x4E2E5A2A0E8219DDull },
+		  { 0x2608FD2A727056D2ull, 0x3DA949DBD9403F58ull,
+		    0xC621ED2D3E97D04Bull, 0xF8575FCA385C8A95ull } },
+		{ { 0xB790066AABDC603Full, 0xC96D65CD67DFFE5Aull,
+		    0x93E33EC6267620D8ull, 0xA6CB83693F3890C0ull },
+		  { 0xCACE03E0C96BEFCCull, 0xFB1EC16A4C661735ull,
+		    0x8F2D9BDA4C510B72ull, 0xD823C8E461F3CAFCull } },
+		{ { 0x09E7E0B414A892D0ull, 0x4A57D6B825DE9F42ull,
+		    0x16CB34DCED59C1BEull, 0xF6E4088BF8CDA642ull },
+		  { 0x5F6A08EC6A60300Aull, 0xF4CDC6F676026777ull,
+		    0x1B4D764D9952DD7Eull, 0x08A6DF7D6DE27770ull } },
+		{ { 0x29E3A612E2C374B0ull, 0xBF5B3598B570DB4Aull,
+		    0x36BEC97152424EF0ull, 0x8A6C9C91EA6C3321ull },
+		  { 0x3BF7CF8DB78C08BDull, 0x461534F4340F4D58ull,
+		    0x79A7885DC90132A0ull, 0xE4BC7F4F65CDFFAFull } },
+	},
+	{	/* 16^56 * G */
+		{ { 0x6A703F10E895DF07ull, 0xFD75F3FA01876BD8ull,
+		    0xEB5B06E70CE08FFEull, 0x68F6B8542783DFEEull },
+		  { 0x90C76F8A78712655ull, 0xCF5293D2F310BF7Full,
+		    0xFBC8044DFDA45028ull, 0xCBE1FEBA92E40CE6ull } },
+		{ { 0x9D10531D80C15FC7ull, 0x666623F172E99258ull,
+		    0xF3CF09CD0E55E541ull, 0xE1B40C548C1C0D5Full },
+		  { 0x17CA84682A318024ull, 0x00924520DE9BB624ull,
+		    0xF47D811207F4708Full, 0x1EA8AAAC3F384FF9ull } },
+		{ { 0xE418FA233AA89692ull, 0x713B08D6F94C2308ull,
+		    0xE996E6412418A776ull, 0x3BDFCA7181668F4Dull },
+		  { 0x93DBDB431A510308ull, 0xC7DC0C6345E2EF13ull,
+		    0x49426151AEDA5333ull, 0x0A721F68565167B8ull } },
+		{ { 0xA25B597E831EBA7Eull, 0xF1E49C2570989E56ull,
+		    0x4201BBA7BC72A37Eull, 0x963E315DBA2A02DFull },
+		  { 0x3DFA4B328E7C79C0ull, 0x869D0AE5C0D5F13Cull,
+		    0xA2A3CB7C52167E11ull, 0x5C02BA13C84A3935ull } },
+		{ { 0x079B2342C37EA1D7ull, 0xB2393658F89AAE4Dull,
+		    0x35328552518D9E4Full, 0xACA8AC95B7521056ull },
+		  { 0xDDEFB1049BA973A2ull, 0xE1EDBFDC413935E9ull,
+		    0x94304C4B92872189ull, 0x7F12C567DD75CC20ull } },
+		{ { 0x02D58A93ED8D3763ull, 0x163C1B41B3D25D44ull,
+		    0x8C0821207C82521Eull, 0x79CC32165D5941A2ull },
+		  { 0x36AAB0F0BC5F6BFCull, 0xADABC17581D3626Bull,
+		    0x27CC1D59942FFC3Eull, 0x9CF893E8073053D0ull } },
+		{ { 0x5DB2781CD3245B7Full, 0xA37D669690597FBFull,
+		    0x206C21AF98D85311ull, 0xFA904704DB667C0Eull },
+		  { 0xEF833DF14DDF6BEFull, 0xCB9EECD2624F1D47ull,
+		    0x2D6FA3ED40F1C189ull, 0x1A1C8C3674A836A4ull } },
+		{ { 0x6C38BA21348560A9ull, 0xB3E960FD626F217Cull,
+		    0x7BE369478640DA20ull, 0x6FA2D99005994393ull },
+		  { 0xB9609377BAE52757ull, 0xFE39CDABC551C5EEull,
+		    0x3754A352A6985C3Aull, 0x9EBA0CC3915AC7E8ull } },
+		{ { 0xB61F78FD77F0953Aull, 0x18491483FF15439Aull,
+		    0xD672B8E1D2FA92A8ull, 0x1D431AAB91F57D8Cull },
+		  { 0x17C59D769D68F260ull, 0xF48E29A908707E7Cull,
+		    0xBC530C83CE15FAE0ull, 0x08D667C3BF19121Eull } },
+		{ { 0x590DA9836039279Aull, 0xE6E4C087B13DB4A8ull,
+		    0x8275247200D57597ull, 0xB7BDFAA7FC579C88ull },
+		  { 0xDBBD0AAB42152AE1ull, 0xA7E6E36988BAFC31ull,
+		    0x4BD23C461E4585F6ull, 0x1D2FA9F7C76FD5D1ull } },
+		{ { 0x5A31171365227C70ull, 0xF32BEAB333A3EA70ull,
+		    0xDDA4B35B2E31C60Full, 0x6DEEEA0D5A3E1137ull },
+		  { 0xAD6DA3810369B9B7ull, 0x287AEC1E569083DBull,
+		    0x0014CBAFEF6ACC84ull, 0xCBB93F0FC7443E40ull } },
+		{ { 0x69B6093AE31413A4ull, 0x07E015CE6891E8CDull,
+		    0x8BD75F71B68BA4B7ull, 0x9504E87A52E6A510ull },
+		  { 0x5A297AF9DF51C38Aull, 0x261F8470D70DD9C3ull,
+		    0x66BC455D63C7F186ull, 0xB6071D8FE3047CBFull } },
+		{ { 0xFB5FD5E88421B54Dull, 0x579B2B83A5564A4Full,
+		    0xD4AC9D2BB1FA9DCAull, 0x28135C10635578D8ull },
+		  { 0xADCCF09B8EE5D868ull, 0xEF0494CC91E310D8ull,
+		    0x06FA9D74107F8C15ull, 0x9ED84ABE3851BE15ull } },
+		{ { 0x5F4B8C276064184Eull, 0x73A39F9F9B819758ull,
+		    0x4A29A5793EC07948ull, 0xCB7B973AA8BF19F0ull },
+		  { 0xA21A6AA9735BF117ull, 0x1599EC23C2586640ull,
+		    0xD5FA500FDA87860Aull, 0x349AEF9136DD9245ull } },
+		{ { 0x917E5591E8E4AC10ull, 0x7996A812ACE24A9Aull,
+		    0xD6C3CC5A09FFB568ull, 0x339A057620B1077Bull },
+		  { 0xF76DA8644D1312A0ull, 0x5039E788F41CC66Eull,
+		    0x43854DF78ACF553Eull, 0xCA985FBEDD6A947Full } },
+	},
+	{	/* 16^57 * G */
+		{ { 0xD34DAB1767EA1F34ull, 0x646BD35404739E0Dull,
+		    0xC3B41D1793B353D6ull, 0x7F9460A23D474B66ull },
+		  { 0x58BEC2CACD9063ECull, 0xC6FF815124E34FFCull,
+		    0x69F1F2BF8F076661ull, 0xD0D516778FB06187ull } },
+		{ { 0x2E45A0052B8C5BDBull, 0x800D59722771BC76ull,
+		    0x9F796A57E0321EFCull, 0x02292B0887DB3C97ull },
+		  { 0x4BCFE7B5207256F2ull, 0x34C8F01116662D89ull,
+		    0x70CF0501CF4185F6ull, 0x10B668847507E382ull } },
+		{ { 0xDC5B74C9BDFC0A9Dull, 0xDE44235B14F77AA0ull,
+		    0x2A60E3646AE0A2A2ull, 0xDB43E7F84C329E02ull },
+		  { 0xF0B1093A9E9AD713ull, 0x8839047356D2F054ull,
+		    0xB8A56C814CEF9FA4ull, 0xB0168DA2BE36B591ull } },
+		{ { 0x7BCFFB0D1840A484ull, 0xEAF7DEB95DAE05A0ull,
+		    0xE01EFCE48208425Eull, 0xF6A16B6054BF7AC1ull },
+		  { 0x87DC4E6E638F9111ull, 0xACDC817C6FE7AE35ull,
+		    0x59CF3E324C399409ull, 0x716C92116B36D291ull } },
+		{ { 0x30BCB1774283808Dull, 0x0F8F07CE35643A89ull,
+		    0xB8515E9121FA7898ull, 0xE9AF3081EE0D21AEull },
+		  { 0x966C2F8E39B39D33ull, 0x976B925115136D19ull,
+		    0x85AF26550FEF4971ull, 0xA976C8489C471260ull } },
+		{ { 0x1495C285FFCD7198ull, 0xA45D77FD9B76F496ull,
+		    0x995B8A7F7ABCE4BBull, 0x3AFFA9B5CB5E8730ull },
+		  { 0x029F302430EB6635ull, 0x10A58F03876B2F02ull,
+		    0x75C98089BF7859CDull, 0x2D4D554F8EAC633Dull } },
+		{ { 0x2692F42CAD8426DFull, 0x0F41395A4E6F8A0Aull,
+		    0x703AC9383BF88359ull, 0x6EB733632C806980ull },
+		  { 0x3FF759EE200B4267ull, 0x9252E97C83FE1B83ull,
+		    0x030E4B2CECC08E8Dull, 0x96C56EC117307A9Aull } },
+		{ { 0x1617ACDCDBC10BA4ull, 0xBC7C0ED17FF78B36ull,
+		    0x6A3EFDD5AD2652C1ull, 0x948F395D3E845445ull },
+		  { 0x1A6B40CA6DA2BE0Full, 0x5A63D297FFD0987Cull,
+		    0x72A41300A1B5A9EFull, 0x98BA0006D11AE9B5ull } },
+		{ { 0xF7D16D7C1A16453Dull, 0x8B7E87BE761033DBull,
+		    0xE1741B91F8B4D0E6ull, 0xD3979D5E079D5F45ull },
+		  { 0xF3CBB83167B6D737ull, 0x17DDF6628A6961A4ull,
+		    0xA4D0925753724569ull, 0xC55F9335D799ADB9ull } },
+		{ { 0x7C533B16225A4E3Dull, 0x3C9B5FD6837E27B1ull,
+		    0x406D776727E41697ull, 0x5C11FBA94FB7606Aull },
+		  { 0xC52DF5EF6569163Dull, 0x14B271F8C9958360ull,
+		    0x19EB94D54CAB3CCBull, 0x26A6C35DE3216A9Cull } },
+		{ { 0xCEA199A5ED326504ull, 0xF65A9B4627B5202Cull,
+		    0x2C383B88C1AEFC12ull, 0x54C3929CE5B8C234ull },
+		  { 0x8BF011FA7EC9E107ull, 0x47A53D9E608A6726ull,
+		    0xC489AA284914AB44ull, 0x4696302560EA16D0ull } },
+		{ { 0x293BE10F4BEBF743ull, 0x99B84DA4FF66EBC4ull,
+		    0xFDB8F62B67116CBFull, 0xEB9C78A6CF98B900ull },
+		  { 0xF768A159F142E6E7ull, 0x85A7AF8E430FDE3Bull,
+		    0x75FB6E9D80F3BBD3ull, 0x42E03D6CC97964A0ull } },
+		{ { 0x3044F576BB5ECCE7ull, 0x7328158B0C0D2135ull,
+		    0xB84E8E83C19659C8ull, 0x3744E9B28666D6C5ull },
+		  { 0x201321416A247721ull, 0x28E8B5F052A6F839ull,
+		    0x0E0E6956EB29EC3Cull, 0x9546E0F8D99047AAull } },
+		{ { 0x209343292DA66409ull, 0x0CE5984677788EF9ull,
+		    0x0D29F157B4C41597ull, 0x371DA99FC1142416ull },
+		  { 0x43FC5230D298657Full, 0x3BF17374E766DF81ull,
+		    0x65DBB44552523BF8ull, 0xE697CC8D4BBC1435ull } },
+		{ { 0x50C928DE45FEF996ull, 0x14068F6394425351ull,
+		    0x324CD0A41EF3F2DEull, 0x11343E17E3656D53ull },
+		  { 0x40150AE75792ADEDull, 0xD0CE4D65A086F18Eull,
+		    0xB04DDF9306273765ull, 0x4A9E8480DEBA8EEEull } },
+	},
+	{	/* 16^58 * G */
+		{ { 0xCEC9B4D78E6D8483ull, 0x82F2D7A846967F0Dull,
+		    0x2958F49F1B6EE945ull, 0x9C39CB60A33D563Dull },
+		  { 0x94B3356F6B2C50FBull, 0xBBADE52F3DBE4368ull,
+		    0x03D196B7BCA16546ull, 0xF097BF1EE493E510ull } },
+		{ { 0x1363784B6C7F27BFull, 0x41067A6336FE96A7ull,
+		    0x33E8A4EB3B323ED1ull, 0xCBC809AE94D7802Full },
+		  { 0xECC69D63CAA30FA6ull, 0x07AD4DD8903DAA9Aull,
+		    0xD7AACEB5DFDCDB05ull, 0xBD9CBB0E18115C85ull } },
+		{ { 0xF55C31F847A14DDAull, 0x606D0429674B4DF3ull,
+		    0x443768F724013083ull, 0x18F37ACC90EADAD7ull },
+		  { 0xE22FCDC325AC8364ull, 0x77D8F7C78A8536CBull,
+		    0xD7BBFFECEE1BCD0Bull, 0x2F944BBAAA092C26ull } },
+		{ { 0xBE5CC18760A81CADull, 0x822C3C1CB43B223Bull,
+		    0x37151EF349506CF4ull, 0x8BFBEE24C6E52618ull },
+		  { 0x6986B9515FF0013Eull, 0x8D9FC8ECACFD2376ull,
+		    0x0CFD289FE71BE151ull, 0xD75127CAA3409B59ull } },
+		{ { 0x5674E8E8CC7D59BEull, 0x98EA18588E0932FBull,
+		    0x4EC5FFEE4772736Bull, 0x5413358C281E79DAull },
+		  { 0x2D7EA1F6E4F80590ull, 0x53E25B15C900B367ull,
+		    0xE7C48FD20164515Aull, 0x680FD4DE969CB024ull } },
+		{ { 0xC22849804F58B08Eull, 0xDC769CED171B57DDull,
+		    0xFEB5C7E72FD64CACull, 0x0B1C1B0327FFEC73ull },
+		  { 0x0F1C83ACF5023AB2ull, 0x0D8BEB6CF7B955AAull,
+		    0x95A16812870A6A7Cull, 0x6E8FB87A8D354127ull } },
+		{ { 0x8EB80C9F876051A8ull, 0xBED773963A457EA5ull,
+		    0x5DCFC1A3C1B85280ull, 0x4E2FD12691B194F0ull },
+		  { 0x6AFEC74FE9CC9005ull, 0xEBB8BAA592C4FE2Eull,
+		    0x371B35A1508A31BCull, 0x122ABBDBF5F4FBB2ull } },
+		{ { 0xC21115782FB33B93ull, 0x76B07B2BD63AFC5Cull,
+		    0xC07879421041E8F1ull, 0xB8181BC6BADBE124ull },
+		  { 0x911A5E167A54EAD6ull, 0xF9ACC5B14BF627DCull,
+		    0xDEEF104BE967DD75ull, 0xBB012F5118CCE7CAull } },
+		{ { 0x367CA8FA56A80E09ull, 0xA275F0F76625F5FEull,
+		    0x2004F56813C08FA0ull, 0x2DE758D4BEFF1B59ull },
+		  { 0x9D62EDF5436A1CD3ull, 0x7A1ADC6695DAD6C9ull,
+		    0xD7C032B0265E64A0ull, 0xDD9ACF3177D8EE67ull } },
+		{ { 0xF24498DAA2720307ull, 0xEF1E169EB30AA255ull,
+		    0x0ED9922D448A6990ull, 0x7838321620DB08B9ull },
+		  { 0x82A85BD18DB7CFD7ull, 0xF3F68F9E7F9ACDADull,
+		    0xB51F0760F456EDE9ull, 0xA2821B13A3192358ull } },
+		{ { 0xC25035B2FA3628ACull, 0x568BBA2CDF5B564Eull,
+		    0x28C5A173C6EE12A4ull, 0xF597A0ACDC1D4A57ull },
+		  { 0x7EA0310D6CD3550Full, 0x772ECF91D412106Eull,
+		    0x7BB1BB7289622CC0ull, 0x0DB9168E332BD455ull } },
+		{ { 0x8EFDB312B83B6500ull, 0x4F1E86B7E98FAC90ull,
+		    0x41901DDA1C9671CBull, 0x69C0A197952BD5D9ull },
+		  { 0xEFDFC2C9D3846B42ull, 0xE0AFEA3AB84C8CC8ull,
+		    0x66C43D425CC76F2Full, 0x024F0D0DF9FE8C11ull } },
+		{ { 0x78D683D4AB75D6C3ull, 0xC42A5457D53A2856ull,
+		    0x08A1071821BE40F3ull, 0xAA222A86D6F44FB9ull },
+		  { 0x13265A4E644CB028ull, 0x6071FC94B5A8C8F6ull,
+		    0xCE448A25AEE2DF42ull, 0x56378793001A8E76ull } },
+		{ { 0xF130159794CE1A37ull, 0x9DDA5BC91EA695D5ull,
+		    0x5C7073426C00051Aull, 0x6F27AA1BFEBAB967ull },
+		  { 0x72F75EA0D1F12AFBull, 0x97321E5B3092268Cull,
+		    0xEF2FAFB59F0A0FC8ull, 0x90DBB8E8337893C0ull } },
+		{ { 0x7FA85739235790C9ull, 0x9E01B91773F3C503ull,
+		    0x56F0C64392F35E2Eull, 0x8568B26BCD9715B7ull },
+		  { 0xDD3F553826B1F5ACull, 0x0145E5F8FB85479Full,
+		    0xE9078E0AE4363CE8ull, 0xD3F2261A584DD2ADull } },
+	},
+	{	/* 16^59 * G */
+		{ { 0x7DDA97C55C38D4E4ull, 0xE2FD65F1B1B17374ull,
+		    0x97566E7430181E25ull, 0x3D92852611229938ull },
+		  { 0x6FAAEF00C0CCF0D3ull, 0xCC0AB138197ABC7Full,
+		    0x3FF057035C2869EAull, 0xD32CA0A5D468EAB5ull } },
+		{ { 0xD9DE4A8BD4904297ull, 0x0D23B7FE32845DC2ull,
+		    0xE3FEDCFBD314C30Full, 0x5551C1B53B0878EAull },
+		  { 0xDDBDEC1A85153809ull, 0xF2BE7383DB6967A6ull,
+		    0x2DC6F85E00E65A5Cull, 0x2FAAF850DEF03FFAull } },
+		{ { 0xD07232580DD7718Aull, 0x91C81B6519BE4E4Eull,
+		    0xF7C159A25E76DFF8ull, 0x3B180E372B902FC3ull },
+		  { 0x726626299AFD82DBull, 0x58491156702D14D0ull,
+		    0xFAA4BC9D2905211Eull, 0xF2B6B117F36B58AAull } },
+		{ { 0xB1488FE58E2058C2ull, 0x274B136A6BEB56C9ull,
+		    0x6BF7491E6EF96A09ull, 0x6A9CB41F4E7D95CDull },
+		  { 0xEA95AB2BC86B1495ull, 0x050886AA9AA7F367ull,
+		    0x02B907A608A21208ull, 0xEDD93D45EC97A966ull } },
+		{ { 0xFA81A51193D3653Dull, 0x134EC4B274E467D5ull,
+		    0x45EF4F4098A83EB2ull, 0xF352FF0391D69C9Full },
+		  { 0x79E6678C8A44F28Eull, 0x5C1995F972C582D0ull,
+		    0x020BD73DFDA6D505ull, 0x4472626CCB6C5EBDull } },
+		{ { 0x78D15204D94B75A2ull, 0x911CDE8A1D8392DFull,
+		    0x8EABD472366F4340ull, 0xE46AE49AAC77CFBBull },
+		  { 0x4799FD908A81C0D6ull, 0x816766C987D4A6F4ull,
+		    0x845017EFFE90F85Bull, 0x9AA6EBEBE5F5335Eull } },
+		{ { 0xD661DF1AED4478DAull, 0xF15CF6C2240E0154ull,
+		    0x0AFB45CDBF793CA1ull, 0x670EE471034D8C23ull },
+		  { 0x628FFE4FF4F563F0ull, 0x1CC3B8160FF24770ull,
+		    0x2546605B138750E8ull, 0x5CA0C7425BA022CAull } },
+		{ { 0x245CDFD17A53CBF5ull, 0x378C76B944D45159ull,
+		    0xB6AC29ED3F203ADDull, 0xDAB5FC7FE5706D90ull },
+		  { 0xBF8C1D4B3052FB1Aull, 0x87B15173C166C997ull,
+		    0x5039598FD8B49197ull, 0x97F6CC216D0557B4ull } },
+		{ { 0xAC4E290443DBD581ull, 0x3CFEB38828D6B35Bull,
+		    0xEFBBFA30ACEC6FA9ull, 0x96F2E354349D9BDBull },
+		  { 0x4D9A4FFEE8F59952ull, 0x35A18F1D504F5D45ull,
+		    0x4FE5D8E3960DBAF4ull, 0x09FCD80885D526CFull } },
+		{ { 0x41275B1AC38B82C2ull, 0x3860883EEE9CD107ull,
+		    0x176180985E55AFB7ull, 0xD981830A1604C171ull },
+		  { 0xAFFD9DDBEF8CC058ull, 0xE0271F012581E9FAull,
+		    0x1978D1D254BF33C0ull, 0x2422711875E196B1ull } },
+		{ { 0x1EB34324A4E9C2FCull, 0xE72CF0CF2FBD706Aull,
+		    0x8041820B14609A35ull, 0xC4946E517E8399ACull },
+		  { 0x3434763766398CE8ull, 0xE48BF38ED1462312ull,
+		    0xE99A0F68F47B8237ull, 0x74890120B1858A4Cull } },
+		{ { 0x28CD6584CE8A0471ull, 0xA33C738B2DAF49CEull,
+		    0x47F7CAD9CBC69708ull, 0x002B1C7861CB06BBull },
+		  { 0xBD2D39266390366Full, 0x39BE7C26E7C2A835ull,
+		    0xC0E8304C48234416ull, 0xED035874EBF5B517ull } },
+		{ { 0x5CB9173E84960B03ull, 0xB6AC3AB0C8808E8Full,
+		    0xFA48C8C578094D8Full, 0x1653B64DA9BE33DBull },
+		  { 0xF806A54EB0F73C69ull, 0x8B38E0E4A1B564E7ull,
+		    0x9F4B2BD83E95A894ull, 0xA583708169E5D560ull } },
+		{ { 0xB9713128037AED26ull, 0x5D1E99D5EB79EC9Aull,
+		    0x90A76EFD37A5D13Aull, 0xA069C9743A7CF65Cull },
+		  { 0x49757A5AFD297CDCull, 0x502FFE99DB84FB9Eull,
+		    0xD8190F9E0E972DEBull, 0xBFA8BD1F061877D8ull } },
+		{ { 0xC5577E31BB63640Eull, 0x979BB7F290C72DF2ull,
+		    0x500C679CA685CBF4ull, 0x51076DD7ED2F153Full },
+		  { 0x1F69728782E4476Cull, 0xC8BEA4E9E720EF02ull,
+		    0xAEBE650172E0FDA6ull, 0xB397274A2D6DDF76ull } },
+	},
+	{	/* 16^60 * G */
+		{ { 0x606304B1A44E8DE3ull, 0x5C08966A2ECC1E07ull,
+		    0x3A5A7DCF08BD1791ull, 0xF50B99B7468810B7ull },
+		  { 0x4A3F3BA6DB7F3588ull, 0xE975F18D21721E85ull,
+		    0x8789973A2DEDCEBBull, 0xE2B5061E55F18F0Cull } },
+		{ { 0xA9103A2D60DC749Cull, 0xD83321FBA27AD800ull,
+		    0xB09C743020A46E97ull, 0x2A148954227198C9ull },
+		  { 0xF2E1F28FF0FA3CF2ull, 0xBEF92DCDC39B6F01ull,
+		    0xEA3C2440A37608C4ull, 0xAA215A188974E422ull } },
+		{ { 0xDDDC6B6B82ACCF8Bull, 0x81D2999182816FA7ull,
+		    0x645F30E251394304ull, 0x598D7F61A5505770ull },
+		  { 0x1B84673C0F6CB808ull, 0xD2289A8F353540B9ull,
+		    0x546C5162B273EBCAull, 0x9F3121F74F8F2609ull } },
+		{ { 0x1E0CC372DD962ABCull, 0x1EBB7D208E87BDCCull,
+		    0xCC7A3EC58A642C87ull, 0x0A5A4878F4CC4453ull },
+		  { 0xE85DAABC9E2CC3FAull, 0x5832A64C8E50A9FAull,
+		    0x4D72B14DF2903017ull, 0xF7148B2288B0DC57ull } },
+		{ { 0x9FB39A5464AA7B3Eull, 0x13C4EF1B056C9CEAull,
+		    0x64FD2091541C5810ull, 0x715A2012F49F4C4Dull },
+		  { 0xD9A33944BC7D081Dull, 0x421BC588A88B47D0ull,
+		    0x1F79288F8A913B62ull, 0x5922B3B1AA606C0Aull } },
+		{ { 0x85C3FA7018AE2298ull, 0xCB07ADEF81B3E0D6ull,
+		    0xAA74356789578652ull, 0xF8093CA11AC87D03ull },
+		  { 0x06C36192D35C93B0ull, 0xE4509A0F6DB6006Full,
+		    0xB16129EC307E9CF3ull, 0x32074F216EF49C10ull } },
+		{ { 0xD1BDB697620DB220ull, 0xC71CCB101687ACE4ull,
+		    0xC409CE897FB87876ull, 0x49EC8C5E6AA9B125ull },
+		  { 0x99B8ACA0677338C2ull, 0x842C3073E53B9CCEull,
+		    0x3DA9CC34865F5429ull, 0x99A97D4FE5EA629Bull } },
+		{ { 0x93925B40128AA5CDull, 0xCECEAF38ED9768E7ull,
+		    0x20FEB9FBDD6C93FCull, 0xF5E3EFCB5A92F1B3ull },
+		  { 0xAB2799C7CEAA0FB4ull, 0x84E0A6F4B110CEC9ull,
+		    0x4E51E2DFEB07BD2Bull, 0x76CFA2899BF3DE05ull } },
+		{ { 0x51EBCA315E771268ull, 0x2F4F14A7D90A6568ull,
+		    0x3E6F190E05E07B7Aull, 0x1F8FB70D4850B448ull },
+		  { 0x1AFD3010C909C8DDull, 0x4E1D3C311C92B3ABull,
+		    0x12C2ED74726192A1ull, 0xF53E7ADB461BA2BFull } },
+		{ { 0xA2C15B625A3BA4EEull, 0x800F385ADE168FF2ull,
+		    0xB1C320078C03D084ull, 0xDF8B2BE9C62045ACull },
+		  { 0x40EAD285431A9955ull, 0xD0A8A06C08D307E7ull,
+		    0xD1955020049F17EBull, 0xD8835D9003CFD523ull } },
+		{ { 0x55EC0F2B28D9819Eull, 0xD606792F742DAB1Aull,
+		    0xDD5D142BA678732Cull, 0xB8D5C71A6497F61Full },
+		  { 0xDC78BE8EA9138AC4ull, 0xE2F49F1361D45C3Cull,
+		    0x3B6EE4359B63DC79ull, 0x1CD14EF132137F82ull } },
+		{ { 0x1AE9A5558C3B3D61ull, 0x53B60AA6BD66C3E9ull,
+		    0x6595FFC144469D82ull, 0x30128814F6AC0487ull },
+		  { 0x772B5E6C8F2DBB38ull, 0xAC30F673875ADC53ull,
+		    0x12C4C890B81F7E14ull, 0x5D57C66104D3C4ECull } },
+		{ { 0x6A93DBE660BCA3F3ull, 0xECB3435145600490ull,
+		    0xDD63EB61C880D8C4ull, 0x2265B5AC65BAAE3Dull },
+		  { 0x25829C6C517409FFull, 0x3C80A612D2393D5Aull,
+		    0x61A313A3B1096498ull, 0x97A198BF5CACFE0Full } },
+		{ { 0xE79C12B6916E8A30ull, 0xFC7AF0C38C1CB896ull,
+		    0x24AF7E03F4371BA5ull, 0x64D0C4F5A46437FAull },
+		  { 0xD81D912650BFEB69ull, 0x7CFCF2050F1FDCE5ull,
+		    0x6D03198DE496A8C5ull, 0x86654D5973B6ABE3ull } },
+		{ { 0x372D23FF45BAC36Eull, 0x599899459975DCD0ull,
+		    0x21FD8A9F5FC9ABCBull, 0xAF381CD103584925ull },
+		  { 0xFF3D887AB1B119A9ull, 0x589B82F1EF4D4A90ull,
+		    0xC9457F22951A2648ull, 0x681A087FB7DF0FBDull } },
+	},
+	{	/* 16^61 * G */
+		{ { 0x9E1994056037CFB4ull, 0x7400F246C3CDAA85ull,
+		    0x0D77F4880DA0B0E0ull, 0x042531823FF5ED0Bull },
+		  { 0x00B7325ED8775D23ull, 0xEEA3E4F534EC5DD4ull,
+		    0x628CA4D0C8661FACull, 0xC90E8BCCFAE00F7Eull } },
+		{ { 0xFD6E1483E66B5A8Bull, 0x37385A1378241662ull,
+		    0xDBAA6C128D47DF66ull, 0xB0D7A6DBED426D40ull },
+		  { 0xF6C4FB12CC550AE3ull, 0x239B77371572068Bull,
+		    0xFD1C0D687EF4A316ull, 0xF652634815ABF316ull } },
+		{ { 0x784F673546C34577ull, 0xE6409EC8E6A52AF7ull,
+		    0xB1F5E308E8C0E4BDull, 0x27557AA0E30BCA48ull },
+		  { 0xADFEB9B80416193Cull, 0x18A2CA7374C4380Bull,
+		    0x77C8D75A49FD34F3ull, 0x8399C75846105B3Bull } },
+		{ { 0x9C1A74B282375988ull, 0x68723275964AA5EBull,
+		    0x4542CB5C539A534Cull, 0x040BF36BDEA2DE0Aull },
+		  { 0x80D2A3D4793301CBull, 0x977ABE33AE04F7F0ull,
+		    0x37D16867767EE3C5ull, 0xE8B5B2B681DAD753ull } },
+		{ { 0xEE58FDB6A401F4D3ull, 0xCF6C2E50EA95B301ull,
+		    0x8E50783BF561D7DEull, 0x8E687817D2587364ull },
+		  { 0x90281E944294D86Bull, 0x900B96F12EA19128ull,
+		    0x62F809A0506D3CAEull, 0x989CAB886E2C9BFAull } },
+		{ { 0xED413AA6D4D4EE9Cull, 0x496DF469A485672Bull,
+		    0xA2F5127CCEE442F3ull, 0xAE3648928593BC5Dull },
+		  { 0xCD0ACCCEF9A54FFFull, 0xED5BCC4A2D7F35E7ull,
+		    0xB736B39D4B8D57B7ull, 0xBA85F10C8713F5ADull } },
+		{ { 0xC5963DE26D2AA8E6ull, 0x205359FC40EFFE2Dull,
+		    0xD1036803CA67DBEEull, 0x98A41746253E5CF6ull },
+		  { 0x69740BED606CF75Bull, 0xE30217FAAB7ED219ull,
+		    0xB11542F5A2F5CEC9ull, 0x579AC6947E3463D6ull } },
+		{ { 0x0E789E3FF0CDB59Dull, 0x8BE44E3392EB68E1ull,
+		    0x3D70139BFCD5CE69ull, 0x3754E99F0786E2E1ull },
+		  { 0x4239C0FFEB6A8499ull, 0x61019B6F632734F0ull,
+		    0x012F3C27206480DBull, 0x24C2F87496ADDCBEull } },
+		{ { 0x7CA2CC8F752C2D31ull, 0x1800ABB08C61EECDull,
+		    0x92216E443E21A946ull, 0xE1685442230540FDull },
+		  { 0x1CB8836824A50FECull, 0x3E76192BF8998394ull,
+		    0x2FB2E642D02BC934ull, 0x0700855C928E7214ull } },
+		{ { 0x49E9C05CF9E01D27ull, 0x672E0841205789FBull,
+		    0x3E6F9F583214CEF0ull, 0x675B60BCB5E1E7C4ull },
+		  { 0xA02ED91C5C80BCA3ull, 0xB563DDDE73F08822ull,
+		    0xE011B62A9CB6C72Cull, 0x77108626B5227B4Dull } },
+		{ { 0x4A33BAE373A7CDADull, 0x3CAD83D2E50BCFAFull,
+		    0x1CA2A2E5338951A5ull, 0xBFA6314B09D513EAull },
+		  { 0xC5F88930295CB953ull, 0x261190F8C84047A1ull,
+		    0x2A5F85BBB1EED1A7ull, 0xB452E8194C802C78ull } },
+		{ { 0xC1D5C120B853417Bull, 0xCC82E7626D76AD40ull,
+		    0x314124EBC2BC75E2ull, 0xC93C33CCF68CE434ull },
+		  { 0x29E94D9B0F7F0362ull, 0xCFE2F63A9D1E1C7Dull,
+		    0x20F2C2E2F575DDF3ull, 0x6F042C8B50622BD7ull } },
+		{ { 0xEDBCC8500ADE0FB7ull, 0x0C6DC74DEA6518D8ull,
+		    0xECF0975E6DD98E20ull, 0xE687082D0A961CD3ull },
+		  { 0x9179E0F31D4D6ECEull, 0x17C1E85EF88C2259ull,
+		    0x5E5F0E5321D1A721ull, 0x2135A448684C9555ull } },
+		{ { 0x95526EE5ADEB22DCull, 0xF7BDF0D378B5C674ull,
+		    0x04261E46AF00A271ull, 0x13025FAD6C16B0BBull },
+		  { 0xB54046CE8388AA81ull, 0xA60AA874A2AE76D2ull,
+		    0x5CA9DF2D3EC4A2BEull, 0x6EEB1B119C216B63ull } },
+		{ { 0xC83CB5F0CE432DAFull, 0xF3BEDA08AA827AC9ull,
+		    0x4BFC28D795074975ull, 0x7AB16EF862A9A9E9ull },
+		  { 0x3117588AA71BDC48ull, 0xC7E9CE3AE74FDB01ull,
+		    0xA359183E28DBA7C5ull, 0x584E0E0A97C328B1ull } },
+	},
+	{	/* 16^62 * G */
+		{ { 0xC0747129885FBD44ull, 0x89C2CAA39F26267Aull,
+		    0xE05471CE16D5222Cull, 0x9BBF06DAD9AB5905ull },
+		  { 0xA3447DFA7A1D3E88ull, 0xC0D4BDDC15036ED2ull,
+		    0x6755DAF30A6F47E8ull, 0x1BCC7FA84DE120A3ull } },
+		{ { 0x3CE59840D8490005ull, 0x90599D29A4C5181Full,
+		    0x4ADAAB192FBFB78Cull, 0xF8EF49B4BBEDF416ull },
+		  { 0x1A462E83BD62AFDEull, 0x58F2128837DEEE67ull,
+		    0x02BBD77665A4B73Aull, 0x979E67A7EE972164ull } },
+		{ { 0x8B7AE792B4A7B506ull, 0x22758BBAE7860BE0ull,
+		    0x429CFB2AE7500EE9ull, 0x646FF7F65B3B5BD3ull },
+		  { 0xC979C1252B36F946ull, 0x492DFC4FC08E6995ull,
+		    0x5A61E331804A8FE8ull, 0xBC112A9D064A18A5ull } },
+		{ { 0xEDDEEA19F87B338Bull, 0xFE44D4FC2E04EBA7ull,
+		    0x1B3A9B22D66D9101ull, 0xBE63AB41D2C743F0ull },
+		  { 0x9D212F2591B00A85ull, 0x7053CB7E45930DAFull,
+		    0x8D3021BBB90B353Bull, 0x1F125F145E22F475ull } },
+		{ { 0x154B71C9C103B553ull, 0xBE60EA2783385A80ull,
+		    0x9D0C1000B27E507Eull, 0x7CC0547AA617D39Aull },
+		  { 0x5799CBA3CD45A526ull, 0x00185A0AAC228B7Dull,
+		    0xBDD728CB39FC94C4ull, 0x7B329EBD2328045Aull } },
+		{ { 0x9890459558583600ull, 0x6BEB2FFE723B5310ull,
+		    0xE62280C7EBC5FD4Aull, 0x1516534B9EFE26DEull },
+		  { 0x08428E0CC3A0131Bull, 0x2BAB43C9E74E0C09ull,
+		    0xB0E74299ECAA5C59ull, 0x60E343B6A7CE88EAull } },
+		{ { 0xAC2EF45419E717A4ull, 0x68DA2BDAACF01B81ull,
+		    0x0563ED536DAEE154ull, 0x946851990BC1DB4Eull },
+		  { 0xA75F0FD1B526DEA3ull, 0x57999590F70ACD9Cull,
+		    0xB3B8D0E6B2667DC0ull, 0xCA5C78420DC591A8ull } },
+		{ { 0x44342466113BD81Eull, 0x578042F6CAEBE721ull,
+		    0xAEDA82DF286EB6E2ull, 0xFC1D6F42B05D00E6ull },
+		  { 0x41E3D4415D7EE1EAull, 0x3976B531546DC8DCull,
+		    0x93D74BD97FD76CE6ull, 0x6D2CDF43AC02382Aull } },
+		{ { 0xDF82C36F08362735ull, 0xDFF8B37EF12B327Bull,
+		    0xB1258F8EA452D1F5ull, 0xE1B98F1BE7E0E8FAull },
+		  { 0xF96138C9CECB11B7ull, 0x7E19EE33DF74090Aull,
+		    0x7E05B49A83BB2BA2ull, 0xCA83E9AD9A976A0Bull } },
+		{ { 0xD620A694FD0C3B70ull, 0xB711C812896E4022ull,
+		    0xBECAB66324C6E71Cull, 0x0C65B97EA03F9316ull },
+		  { 0x89C1245DDE69E081ull, 0xC78B02D429450BE0ull,
+		    0x753842A68D37B860ull, 0x010D89E893681FC2ull } },
+		{ { 0x3B40BBD839046346ull, 0x56A58DE730144008ull,
+		    0x6D08A06BD967962Dull, 0x3536F25C8FD607EFull },
+		  { 0x9401062BCC14FEA6ull, 0x9E6C3D1EA2D9B3E2ull,
+		    0x73BA16A1A529E1C3ull, 0x1E271FE17DE3509Eull } },
+		{ { 0x343779A00EFEA3F0ull, 0x1B200BDFE2961065ull,
+		    0xE27388B02D1ED1A4ull, 0xCD518F0C66805279ull },
+		  { 0xD1F27741670E9CC9ull, 0x6C63A31962831EBCull,
+		    0x4D1103E38C05DF53ull, 0x0764705D02013D1Eull } },
+		{ { 0x0FFF83ED6847F6F8ull, 0x1029B51FBD40EF53ull,
+		    0x690151F34B7F8C3Cull, 0x0DF50246BE23D4DEull },
+		  { 0xB4CCA8A6BB1633A6ull, 0x4C6E166689DF3449ull,
+		    0x2B232C4FBC2174ABull, 0x2107047F29DAF1CAull } },
+		{ { 0xE4C445C10D3BE344ull, 0x6D45B8604229F9EFull,
+		    0xCDC6E0C09F4FBD12ull, 0x609907F31AB90DBAull },
+		  { 0xF28B06AC098459F0ull, 0xD8F618E7C36CC0E5ull,
+		    0x3C3CE2C80A98A2DCull, 0x273A561A693CDF6Bull } },
+		{ { 0x185CEAEDFD4F1B81ull, 0xAD69A7A48CF4BB15ull,
+		    0xF69DE3B336529330ull, 0xCA9DD5D44CF53398ull },
+		  { 0x8CC62CAE42B7C8BDull, 0x66C9760BFAADA10Full,
+		    0x402471FB44467B3Eull, 0x6E4B988651BE2C56ull } },
+	},
+	{	/* 16^63 * G */
+		{ { 0x1EAD3233444C0448ull, 0x96357686C10319E3ull,
+		    0x4943FCCB3B7893E7ull, 0xB12FADF52943DFA5ull },
+		  { 0x96575E76B369DE57ull, 0x1D05E70332FC4DF2ull,
+		    0xE96F8F6677B2A6A7ull, 0x02E2459599B0F4ACull } },
+		{ { 0x58627E5E8B47E27Bull, 0x3BF2D82D8D98B368ull,
+		    0xBE2DF29F6CEA3B79ull, 0x6054B2225E75B6A4ull },
+		  { 0x001829E764AE4B62ull, 0x1D789CF5AFAD1987ull,
+		    0xB0760CD1F574E0F8ull, 0x6E7106F3B190D8EDull } },
+		{ { 0xF536C45464E9151Full, 0x67EA3399C80D8418ull,
+		    0x43255DDA91D8FB3Eull, 0x48388E34F1C50568ull },
+		  { 0x1BEE49EDCD7A9434ull, 0x99B1411153DE8310ull,
+		    0x6A25339315482BCCull, 0xB0EC63ABF4E44E9Eull } },
+		{ { 0x8D93CA698EB99805ull, 0xAD086D4CE99A11E3ull,
+		    0xB0C2BF930BF33A68ull, 0x01EE7FC202708CFEull },
+		  { 0x09FD5F4E10EECCAFull, 0x811836EA35BE799Bull,
+		    0x124BE02EF3455711ull, 0x9655CEF01B024882ull } },
+		{ { 0xD7DFB4A58E5B833Dull, 0x593A0073CA0B2419ull,
+		    0x5E65DF81050109C9ull, 0xDE8E6447AE1453DAull },
+		  { 0xF0FCC19AA14C5CC7ull, 0x987E03132901C6C9ull,
+		    0xE332288CBD6DE265ull, 0x05E1463C150913D8ull } },
+		{ { 0x754205712BF6F44Eull, 0x4A403A59C9330E24ull,
+		    0xCED279A2FDD4B0E9ull, 0x016CF2EEE40A0EE4ull },
+		  { 0x53225C3F611603A8ull, 0xAFCF53E490868B9Bull,
+		    0xB52E38390DCE53BDull, 0xB8E9CF624EA7D5A8ull } },
+		{ { 0x3E2593EAC1F7DF48ull, 0xB267473EB871317Bull,
+		    0x8E555B4E4E58F385ull, 0xB18B12D0A4EC7E9Eull },
+		  { 0x91B3D590E846B546ull, 0x3C83F7E483D1E559ull,
+		    0x5CEC426BC5ACC33Bull, 0xFF531922A359FB44ull } },
+		{ { 0xB52DEC8F375F2B54ull, 0x4EFE3560E3E92350ull,
+		    0x5066E911891524BCull, 0x77B20A912E6B2313ull },
+		  { 0xCAA801FCD6CC67FFull, 0xDF623DA1E850E0F1ull,
+		    0xF7B10BFCDD038A72ull, 0xA3DC291825CEA3F7ull } },
+		{ { 0xF253ADC699C9FD24ull, 0x02CDD89845211E0Dull,
+		    0xC7C1CAA4C7286944ull, 0x5F51AD71C8DC9433ull },
+		  { 0x9C3BAE886D2FFD3Aull, 0x8721F6244624A996ull,
+		    0x0CD305FBCC2E4D03ull, 0x2BBBEF11DF7E714Aull } },
+		{ { 0xEA6A3D9C467B9766ull, 0x9F02F864CB7C7CD3ull,
+		    0x9F79CFA01EB3A0F6ull, 0xC1E164748D9C4ECBull },
+		  { 0x0FFD437EFD6E8F30ull, 0x6254DCB278D2FB65ull,
+		    0x46A9A2E228CA25C4ull, 0x104E006A2E19BA8Bull } },
+		{ { 0xE3C4063FD7CEC42Eull, 0x6F3DC933EEE3BDB7ull,
+		    0xFA5822EE4346D855ull, 0xFDF340D937301EBBull },
+		  { 0x38F634B7CDB6908Bull, 0x456E6ABF50DE30C8ull,
+		    0xD70C1FE738CAD2C4ull, 0xA3E59A63968CC6E1ull } },
+		{ { 0xE51CDF4FED6741CBull, 0xD1D983EA87C3EA8Full,
+		    0x0CD84489C68F7B4Bull, 0x510869F66298A7CFull },
+		  { 0x57252B046FC4AC9Dull, 0x30380A05E0A5C278ull,
+		    0xBA412433BBA63CE9ull, 0xCEE1AB93A5B40CC2ull } },
+		{ { 0xFC189454E1DC4FE8ull, 0xF9E8A13A96072415ull,
+		    0xEC6452917B7DC983ull, 0xE3CAEBC8B9EA5D79ull },
+		  { 0x16B60B721307B403ull, 0x51300365A14F86A1ull,
+		    0xD22035CB8B01F976ull, 0x97F093D27BF05928ull } },
+		{ { 0x5C0C0E3DF00D264Cull, 0x1455EA638F8FF5DAull,
+		    0x00E419E6F78DCAE1ull, 0x6E83C3A6B43FDCD3ull },
+		  { 0x8E70F5A400603714ull, 0x5BC0DBF6915FE849ull,
+		    0xB257110A49AF6412ull, 0xCD3DA4CF0228E56Cull } },
+		{ { 0x6414D65D3C119EFFull, 0x39902E0C0A9F9B84ull,
+		    0x9AF41A5CE58FA003ull, 0x03312DB942A865B8ull },
+		  { 0xFE95A3A9F8B1B950ull, 0x0AEC59DB5F515585ull,
+		    0x104EEA317809E86Full, 0x6E3EDA646B3724DFull } },
+	},
+};
@@ -39,13 +39,6 @@ typedef struct {
 #define CURVE_P_32 {	0xFFFFFFFFFFFFFFFFull, 0x00000000FFFFFFFFull, \
 			0x0000000000000000ull, 0xFFFFFFFF00000001ull }
 
-#define CURVE_G_32 { \
-		{	0xF4A13945D898C296ull, 0x77037D812DEB33A0ull,	\
-			0xF8BCE6E563A440F2ull, 0x6B17D1F2E12C4247ull }, \
-		{	0xCBB6406837BF51F5ull, 0x2BCE33576B315ECEull,	\
-			0x8EE7EB4A7C0F9E16ull, 0x4FE342E2FE1A7F9Bull }	\
-}
-
 #define CURVE_N_32 {	0xF3B9CAC2FC632551ull, 0xBCE6FAADA7179E84ull,	\
 			0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFF00000000ull }
 
@@ -53,7 +46,6 @@ typedef struct {
 			0xB3EBBD55769886BCull, 0x5AC635D8AA3A93E7ull }
 
 static uint64_t curve_p[NUM_ECC_DIGITS] = CURVE_P_32;
-static struct ecc_point curve_g = CURVE_G_32;
 static uint64_t curve_n[NUM_ECC_DIGITS] = CURVE_N_32;
 static uint64_t curve_b[NUM_ECC_DIGITS] = CURVE_B_32;
 
@@ -115,36 +107,6 @@ static uint64_t vli_test_bit(const uint64_t *vli, unsigned int bit)
 	return (vli[bit / 64] & ((uint64_t) 1 << (bit % 64)));
 }
 
-/* Counts the number of 64-bit "digits" in vli. */
-static unsigned int vli_num_digits(const uint64_t *vli)
-{
-	int i;
-
-	/* Search from the end until we find a non-zero digit.
-	 * We do it in reverse because we expect that most digits will
-	 * be nonzero.
-	 */
-	for (i = NUM_ECC_DIGITS - 1; i >= 0 && vli[i] == 0; i--);
-
-	return (i + 1);
-}
-
-/* Counts the number of bits required for vli. */
-static unsigned int vli_num_bits(const uint64_t *vli)
-{
-	unsigned int i, num_digits;
-	uint64_t digit;
-
-	num_digits = vli_num_digits(vli);
-	if (num_digits == 0)
-		return 0;
-
-	digit = vli[num_digits - 1];
-	for (i = 0; digit; i++)
-		digit >>= 1;
-
-	return ((num_digits - 1) * 64 + i);
-}
 
 /* Sets dest = src. */
 static void vli_set(uint64_t *dest, const uint64_t *src)
@@ -183,24 +145,6 @@ static bool vli_equal(const uint64_t *left, const uint64_t *right)
 	return (diff == 0);
 }
 
-/* Computes result = in << c, returning carry. Can modify in place
- * (if result == in). 0 < shift < 64.
- */
-static uint64_t vli_lshift(uint64_t *result, const uint64_t *in,
-							unsigned int shift)
-{
-	uint64_t carry = 0;
-	int i;
-
-	for (i = 0; i < NUM_ECC_DIGITS; i++) {
-		uint64_t temp = in[i];
-
-		result[i] = (temp << shift) | carry;
-		carry = temp >> (64 - shift);
-	}
-
-	return carry;
-}
 
 /* Computes vli = vli >> 1. */
 static void vli_rshift1(uint64_t *vli)
@@ -225,11 +169,11 @@ static uint64_t vli_add(uint64_t *result, const uint64_t *left,
 	int i;
 
 	for (i = 0; i < NUM_ECC_DIGITS; i++) {
-		uint64_t sum;
+		uint64_t sum = left[i] + carry;
 
-		sum = left[i] + right[i] + carry;
-		if (sum != left[i])
-			carry = (sum < left[i]);
+		carry = (sum < carry);
+		sum += right[i];
+		carry |= (sum < right[i]);
 
 		result[i] = sum;
 	}
@@ -245,18 +189,101 @@ static uint64_t vli_sub(uint64_t *result, const uint64_t *left,
 	int i;
 
 	for (i = 0; i < NUM_ECC_DIGITS; i++) {
-		uint64_t diff;
-
-		diff = left[i] - right[i] - borrow;
-		if (diff != left[i])
-			borrow = (diff > left[i]);
+		uint64_t diff = left[i] - right[i];
+		uint64_t next = (left[i] < right[i]) | (diff < borrow);
 
-		result[i] = diff;
+		result[i] = diff - borrow;
+		borrow = next;
 	}
 
 	return borrow;
 }
 
+/* Sets result = cond ? left : right without branching on cond, which must
+ * be either 0 or 1. Can modify in place.
+ */
+static void vli_select(uint64_t *result, const uint64_t *left,
+				const uint64_t *right, uint64_t cond)
+{
+	uint64_t mask = 0 - cond;
+	int i;
+
+	for (i = 0; i < NUM_ECC_DIGITS; i++)
+		result[i] = (left[i] & mask) | (right[i] & ~mask);
+}
+
+#ifdef __SIZEOF_INT128__
+/* Schoolbook multiplication using the compiler's native 128-bit type, which
+ * maps to a single widening multiply on 64-bit targets.
+ */
+static void vli_mult(uint64_t *result, const uint64_t *left,
+							const uint64_t *right)
+{
+	unsigned __int128 t;
+	uint64_t carry;
+	int i, j;
+
+	for (i = 0; i < NUM_ECC_DIGITS * 2; i++)
+		result[i] = 0;
+
+	for (i = 0; i < NUM_ECC_DIGITS; i++) {
+		carry = 0;
+
+		for (j = 0; j < NUM_ECC_DIGITS; j++) {
+			t = (unsigned __int128) left[i] * right[j] +
+						result[i + j] + carry;
+			result[i + j] = t;
+			carry = t >> 64;
+		}
+
+		result[i + NUM_ECC_DIGITS] = carry;
+	}
+}
+
+static void vli_square(uint64_t *result, const uint64_t *left)
+{
+	unsigned __int128 t;
+	uint64_t carry;
+	int i, j;
+
+	for (i = 0; i < NUM_ECC_DIGITS * 2; i++)
+		result[i] = 0;
+
+	/* Off-diagonal products are computed once and then doubled */
+	for (i = 0; i < NUM_ECC_DIGITS; i++) {
+		carry = 0;
+
+		for (j = i + 1; j < NUM_ECC_DIGITS; j++) {
+			t = (unsigned __int128) left[i] * left[j] +
+						result[i + j] + carry;
+			result[i + j] = t;
+			carry = t >> 64;
+		}
+
+		result[i + NUM_ECC_DIGITS] = carry;
+	}
+
+	carry = 0;
+
+	for (i = 0; i < NUM_ECC_DIGITS * 2; i++) {
+		uint64_t digit = result[i];
+
+		result[i] = (digit << 1) | carry;
+		carry = digit >> 63;
+	}
+
+	carry = 0;
+
+	for (i = 0; i < NUM_ECC_DIGITS; i++) {
+		t = (unsigned __int128) left[i] * left[i] +
+						result[2 * i] + carry;
+		result[2 * i] = t;
+		t = (t >> 64) + result[2 * i + 1];
+		result[2 * i + 1] = t;
+		carry = t >> 64;
+	}
+}
+#else
 static uint128_t mul_64_64(uint64_t left, uint64_t right)
 {
 	uint64_t a0 = left & 0xffffffffull;
@@ -366,6 +393,7 @@ static void vli_square(uint64_t *result, const uint64_t *left)
 
 	result[NUM_ECC_DIGITS * 2 - 1] = r01.m_low;
 }
+#endif
 
 /* Computes result = (left + right) % mod.
  * Assumes that left < mod and right < mod, result != mod.
@@ -373,15 +401,16 @@ static void vli_square(uint64_t *result, const uint64_t *left)
 static void vli_mod_add(uint64_t *result, const uint64_t *left,
 				const uint64_t *right, const uint64_t *mod)
 {
-	uint64_t carry;
+	uint64_t tmp[NUM_ECC_DIGITS];
+	uint64_t carry, borrow;
 
 	carry = vli_add(result, left, right);
+	borrow = vli_sub(tmp, result, mod);
 
-	/* result > mod (result = mod + remainder), so subtract mod to
-	 * get remainder.
+	/* result > mod (result = mod + remainder), so keep the difference
+	 * to get remainder.
 	 */
-	if (carry || vli_cmp(result, mod) >= 0)
-		vli_sub(result, result, mod);
+	vli_select(result, tmp, result, carry | !borrow);
 }
 
 /* Computes result = (left - right) % mod.
@@ -390,91 +419,75 @@ static void vli_mod_add(uint64_t *result, const uint64_t *left,
 static void vli_mod_sub(uint64_t *result, const uint64_t *left,
 				const uint64_t *right, const uint64_t *mod)
 {
-	uint64_t borrow = vli_sub(result, left, right);
+	uint64_t tmp[NUM_ECC_DIGITS];
+	uint64_t borrow;
+	int i;
+
+	borrow = vli_sub(result, left, right);
 
 	/* In this case, p_result == -diff == (max int) - diff.
 	 * Since -x % d == d - x, we can get the correct result from
 	 * result + mod (with overflow).
 	 */
-	if (borrow)
-		vli_add(result, result, mod);
+	for (i = 0; i < NUM_ECC_DIGITS; i++)
+		tmp[i] = mod[i] & (0 - borrow);
+
+	vli_add(result, result, tmp);
 }
 
 /* Computes result = product % curve_p
-   from http://www.nsa.gov/ia/_files/nist-routines.pdf */
+ * from http://www.nsa.gov/ia/_files/nist-routines.pdf
+ *
+ * The sum is accumulated on signed 32-bit words so the carry out of the top
+ * word can be folded back using 2^256 = 2^224 - 2^192 - 2^96 + 1 (mod p)
+ * instead of a data dependent number of additions or subtractions of p.
+ */
 static void vli_mmod_fast(uint64_t *result, const uint64_t *product)
 {
 	uint64_t tmp[NUM_ECC_DIGITS];
-	int carry;
-
-	/* t */
-	vli_set(result, product);
-
-	/* s1 */
-	tmp[0] = 0;
-	tmp[1] = product[5] & 0xffffffff00000000ull;
-	tmp[2] = product[6];
-	tmp[3] = product[7];
-	carry = vli_lshift(tmp, tmp, 1);
-	carry += vli_add(result, result, tmp);
-
-	/* s2 */
-	tmp[1] = product[6] << 32;
-	tmp[2] = (product[6] >> 32) | (product[7] << 32);
-	tmp[3] = product[7] >> 32;
-	carry += vli_lshift(tmp, tmp, 1);
-	carry += vli_add(result, result, tmp);
-
-	/* s3 */
-	tmp[0] = product[4];
-	tmp[1] = product[5] & 0xffffffff;
-	tmp[2] = 0;
-	tmp[3] = product[7];
-	carry += vli_add(result, result, tmp);
-
-	/* s4 */
-	tmp[0] = (product[4] >> 32) | (product[5] << 32);
-	tmp[1] = (product[5] >> 32) | (product[6] & 0xffffffff00000000ull);
-	tmp[2] = product[7];
-	tmp[3] = (product[6] >> 32) | (product[4] << 32);
-	carry += vli_add(result, result, tmp);
-
-	/* d1 */
-	tmp[0] = (product[5] >> 32) | (product[6] << 32);
-	tmp[1] = (product[6] >> 32);
-	tmp[2] = 0;
-	tmp[3] = (product[4] & 0xffffffff) | (product[5] << 32);
-	carry -= vli_sub(result, result, tmp);
-
-	/* d2 */
-	tmp[0] = product[6];
-	tmp[1] = product[7];
-	tmp[2] = 0;
-	tmp[3] = (product[4] >> 32) | (product[5] & 0xffffffff00000000ull);
-	carry -= vli_sub(result, result, tmp);
-
-	/* d3 */
-	tmp[0] = (product[6] >> 32) | (product[7] << 32);
-	tmp[1] = (product[7] >> 32) | (product[4] << 32);
-	tmp[2] = (product[4] >> 32) | (product[5] << 32);
-	tmp[3] = (product[6] << 32);
-	carry -= vli_sub(result, result, tmp);
-
-	/* d4 */
-	tmp[0] = product[7];
-	tmp[1] = product[4] & 0xffffffff00000000ull;
-	tmp[2] = product[5];
-	tmp[3] = product[6] & 0xffffffff00000000ull;
-	carry -= vli_sub(result, result, tmp);
-
-	if (carry < 0) {
-		do {
-			carry += vli_add(result, result, curve_p);
-		} while (carry < 0);
-	} else {
-		while (carry || vli_cmp(curve_p, result) != 1)
-			carry -= vli_sub(result, result, curve_p);
+	int64_t a[16], w[8], carry;
+	uint64_t borrow;
+	int i, j;
+
+	for (i = 0; i < 16; i++)
+		a[i] = (product[i / 2] >> (32 * (i % 2))) & 0xffffffff;
+
+	/* t + 2 * s1 + 2 * s2 + s3 + s4 - d1 - d2 - d3 - d4 */
+	w[0] = a[0] + a[8] + a[9] - a[11] - a[12] - a[13] - a[14];
+	w[1] = a[1] + a[9] + a[10] - a[12] - a[13] - a[14] - a[15];
+	w[2] = a[2] + a[10] + a[11] - a[13] - a[14] - a[15];
+	w[3] = a[3] + 2 * a[11] + 2 * a[12] + a[13] - a[15] - a[8] - a[9];
+	w[4] = a[4] + 2 * a[12] + 2 * a[13] + a[14] - a[9] - a[10];
+	w[5] = a[5] + 2 * a[13] + 2 * a[14] + a[15] - a[10] - a[11];
+	w[6] = a[6] + a[13] + 3 * a[14] + 2 * a[15] - a[8] - a[9];
+	w[7] = a[7] + a[8] + 3 * a[15] - a[10] - a[11] - a[12] - a[13];
+
+	/* The first pass leaves a carry within [-4, 6], the second one within
+	 * [-1, 1] and the third one always ends with zero.
+	 */
+	carry = 0;
+
+	for (j = 0; j < 3; j++) {
+		w[0] += carry;
+		w[3] -= carry;
+		w[6] -= carry;
+		w[7] += carry;
+
+		carry = 0;
+
+		for (i = 0; i < 8; i++) {
+			carry += w[i];
+			w[i] = carry & 0xffffffff;
+			carry >>= 32;
+		}
 	}
+
+	for (i = 0; i < NUM_ECC_DIGITS; i++)
+		result[i] = (uint64_t) w[2 * i] | ((uint64_t) w[2 * i + 1] << 32);
+
+	/* result < 2^256 < 2 * p, so a single subtraction is enough */
+	borrow = vli_sub(tmp, result, curve_p);
+	vli_select(result, result, tmp, borrow);
 }
 
 /* Computes result = (left * right) % curve_p. */
@@ -496,83 +509,29 @@ static void vli_mod_square_fast(uint64_t *result, const uint64_t *left)
 	vli_mmod_fast(result, product);
 }
 
-#define EVEN(vli) (!(vli[0] & 1))
-/* Computes result = (1 / p_input) % mod. All VLIs are the same size.
- * See "From Euclid's GCD to Montgomery Multiplication to the Great Divide"
- * https://labs.oracle.com/techrep/2001/smli_tr-2001-95.pdf
+/* Computes result = (1 / input) % curve_p as input^(p - 2). The exponent is
+ * public, so unlike a binary GCD the sequence of operations does not depend
+ * on the (secret) input.
  */
-static void vli_mod_inv(uint64_t *result, const uint64_t *input,
-							const uint64_t *mod)
+static void vli_mod_inv(uint64_t *result, const uint64_t *input)
 {
-	uint64_t a[NUM_ECC_DIGITS], b[NUM_ECC_DIGITS];
-	uint64_t u[NUM_ECC_DIGITS], v[NUM_ECC_DIGITS];
-	uint64_t carry;
-	int cmp_result;
-
-	if (vli_is_zero(input)) {
-		vli_clear(result);
-		return;
-	}
-
-	vli_set(a, input);
-	vli_set(b, mod);
-	vli_clear(u);
-	u[0] = 1;
-	vli_clear(v);
-
-	while ((cmp_result = vli_cmp(a, b)) != 0) {
-		carry = 0;
-
-		if (EVEN(a)) {
-			vli_rshift1(a);
-
-			if (!EVEN(u))
-				carry = vli_add(u, u, mod);
-
-			vli_rshift1(u);
-			if (carry)
-				u[NUM_ECC_DIGITS - 1] |= 0x8000000000000000ull;
-		} else if (EVEN(b)) {
-			vli_rshift1(b);
-
-			if (!EVEN(v))
-				carry = vli_add(v, v, mod);
-
-			vli_rshift1(v);
-			if (carry)
-				v[NUM_ECC_DIGITS - 1] |= 0x8000000000000000ull;
-		} else if (cmp_result > 0) {
-			vli_sub(a, a, b);
-			vli_rshift1(a);
-
-			if (vli_cmp(u, v) < 0)
-				vli_add(u, u, mod);
-
-			vli_sub(u, u, v);
-			if (!EVEN(u))
-				carry = vli_add(u, u, mod);
+	uint64_t exp[NUM_ECC_DIGITS];
+	uint64_t base[NUM_ECC_DIGITS];
+	int i;
 
-			vli_rshift1(u);
-			if (carry)
-				u[NUM_ECC_DIGITS - 1] |= 0x8000000000000000ull;
-		} else {
-			vli_sub(b, b, a);
-			vli_rshift1(b);
+	vli_set(exp, curve_p);
+	exp[0] -= 2;
 
-			if (vli_cmp(v, u) < 0)
-				vli_add(v, v, mod);
+	vli_set(base, input);
+	vli_clear(result);
+	result[0] = 1;
 
-			vli_sub(v, v, u);
-			if (!EVEN(v))
-				carry = vli_add(v, v, mod);
+	for (i = ECC_BYTES * 8 - 1; i >= 0; i--) {
+		vli_mod_square_fast(result, result);
 
-			vli_rshift1(v);
-			if (carry)
-				v[NUM_ECC_DIGITS - 1] |= 0x8000000000000000ull;
-		}
+		if (vli_test_bit(exp, i))
+			vli_mod_mult_fast(result, result, base);
 	}
-
-	vli_set(result, u);
 }
 
 /* ------ Point operations ------ */
@@ -593,6 +552,9 @@ static void ecc_point_double_jacobian(uint64_t *x1, uint64_t *y1, uint64_t *z1)
 	/* t1 = x, t2 = y, t3 = z */
 	uint64_t t4[NUM_ECC_DIGITS];
 	uint64_t t5[NUM_ECC_DIGITS];
+	uint64_t t6[NUM_ECC_DIGITS];
+	uint64_t carry;
+	int i;
 
 	if (vli_is_zero(z1))
 		return;
@@ -610,13 +572,11 @@ static void ecc_point_double_jacobian(uint64_t *x1, uint64_t *y1, uint64_t *z1)
 
 	vli_mod_add(z1, x1, x1, curve_p); /* t3 = 2*(x1^2 - z1^4) */
 	vli_mod_add(x1, x1, z1, curve_p); /* t1 = 3*(x1^2 - z1^4) */
-	if (vli_test_bit(x1, 0)) {
-		uint64_t carry = vli_add(x1, x1, curve_p);
-		vli_rshift1(x1);
-		x1[NUM_ECC_DIGITS - 1] |= carry << 63;
-	} else {
-		vli_rshift1(x1);
-	}
+	for (i = 0; i < NUM_ECC_DIGITS; i++)
+		t6[i] = curve_p[i] & (0 - (x1[0] & 1));
+	carry = vli_add(x1, x1, t6);
+	vli_rshift1(x1);
+	x1[NUM_ECC_DIGITS - 1] |= carry << 63;
 	/* t1 = 3/2*(x1^2 - z1^4) = B */
 
 	vli_mod_square_fast(z1, x1);      /* t3 = B^2 */
@@ -728,48 +688,249 @@ static void xycz_add_c(uint64_t *x1, uint64_t *y1, uint64_t *x2, uint64_t *y2)
 	vli_set(x1, t7);
 }
 
+/* Swaps the points (x0, y0) and (x1, y1) if cond is 1, without branching
+ * on or indexing by cond.
+ */
+static void ecc_point_cswap(uint64_t *x0, uint64_t *y0, uint64_t *x1,
+						uint64_t *y1, uint64_t cond)
+{
+	uint64_t mask = 0 - cond;
+	uint64_t t;
+	int i;
+
+	for (i = 0; i < NUM_ECC_DIGITS; i++) {
+		t = (x0[i] ^ x1[i]) & mask;
+		x0[i] ^= t;
+		x1[i] ^= t;
+
+		t = (y0[i] ^ y1[i]) & mask;
+		y0[i] ^= t;
+		y1[i] ^= t;
+	}
+}
+
 static void ecc_point_mult(struct ecc_point *result,
 				const struct ecc_point *point,
-				uint64_t *scalar, uint64_t *initial_z,
-				int num_bits)
+				const uint64_t *scalar, uint64_t *initial_z)
 {
 	/* R0 and R1 */
 	uint64_t rx[2][NUM_ECC_DIGITS];
 	uint64_t ry[2][NUM_ECC_DIGITS];
+	uint64_t k[2][NUM_ECC_DIGITS];
 	uint64_t z[NUM_ECC_DIGITS];
-	int i, nb;
+	uint64_t tmp[NUM_ECC_DIGITS];
+	uint64_t carry, neg, swap, nb;
+	int i;
+
+	/* The co-Z formulas cannot add a point to itself or to its inverse.
+	 * The ladder would hit that in its last steps for k = n - 2, so run
+	 * it on n - k instead whenever k > (n - 1) / 2 and negate the result.
+	 */
+	vli_set(tmp, curve_n);
+	vli_rshift1(tmp);
+	neg = vli_sub(tmp, tmp, scalar);
+	vli_sub(tmp, curve_n, scalar);
+	vli_select(k[0], tmp, scalar, neg);
+
+	/* Run the ladder over a fixed number of bits regardless of the
+	 * length of the scalar: k + n and k + 2n are congruent to k, and one
+	 * of them always has bit 256 set, which is implied below.
+	 */
+	carry = vli_add(k[0], k[0], curve_n);
+	vli_add(k[1], k[0], curve_n);
+	vli_select(k[0], k[0], k[1], carry);
 
 	vli_set(rx[1], point->x);
 	vli_set(ry[1], point->y);
 
 	xycz_initial_double(rx[1], ry[1], rx[0], ry[0], initial_z);
 
-	for (i = num_bits - 2; i > 0; i--) {
-		nb = !vli_test_bit(scalar, i);
-		xycz_add_c(rx[1 - nb], ry[1 - nb], rx[nb], ry[nb]);
-		xycz_add(rx[nb], ry[nb], rx[1 - nb], ry[1 - nb]);
+	/* Instead of indexing R0 and R1 by the scalar bit, the slots are
+	 * swapped so that slot 1 always holds R(b) and slot 0 R(1 - b).
+	 */
+	swap = 0;
+
+	for (i = ECC_BYTES * 8 - 1; i > 0; i--) {
+		nb = !vli_test_bit(k[0], i);
+		ecc_point_cswap(rx[0], ry[0], rx[1], ry[1], swap ^ nb);
+		swap = nb;
+
+		xycz_add_c(rx[1], ry[1], rx[0], ry[0]);
+		xycz_add(rx[0], ry[0], rx[1], ry[1]);
 	}
 
-	nb = !vli_test_bit(scalar, 0);
-	xycz_add_c(rx[1 - nb], ry[1 - nb], rx[nb], ry[nb]);
+	nb = !vli_test_bit(k[0], 0);
+	ecc_point_cswap(rx[0], ry[0], rx[1], ry[1], swap ^ nb);
+
+	xycz_add_c(rx[1], ry[1], rx[0], ry[0]);
 
 	/* Find final 1/Z value. */
 	vli_mod_sub(z, rx[1], rx[0], curve_p); /* X1 - X0 */
-	vli_mod_mult_fast(z, z, ry[1 - nb]); /* Yb * (X1 - X0) */
+	vli_mod_sub(tmp, rx[0], rx[1], curve_p);
+	vli_select(z, tmp, z, nb);           /* in unswapped order */
+	vli_mod_mult_fast(z, z, ry[1]);      /* Yb * (X1 - X0) */
 	vli_mod_mult_fast(z, z, point->x);   /* xP * Yb * (X1 - X0) */
-	vli_mod_inv(z, z, curve_p);          /* 1 / (xP * Yb * (X1 - X0)) */
+	vli_mod_inv(z, z);                   /* 1 / (xP * Yb * (X1 - X0)) */
 	vli_mod_mult_fast(z, z, point->y);   /* yP / (xP * Yb * (X1 - X0)) */
-	vli_mod_mult_fast(z, z, rx[1 - nb]); /* Xb * yP / (xP * Yb * (X1 - X0)) */
+	vli_mod_mult_fast(z, z, rx[1]);      /* Xb * yP / (xP * Yb * (X1 - X0)) */
 	/* End 1/Z calculation */
 
-	xycz_add(rx[nb], ry[nb], rx[1 - nb], ry[1 - nb]);
+	xycz_add(rx[0], ry[0], rx[1], ry[1]);
+
+	ecc_point_cswap(rx[0], ry[0], rx[1], ry[1], nb);
 
 	apply_z(rx[0], ry[0], z);
 
+	/* Undo the negation of the scalar */
+	vli_clear(tmp);
+	vli_mod_sub(tmp, tmp, ry[0], curve_p);
+	vli_select(ry[0], tmp, ry[0], neg);
+
 	vli_set(result->x, rx[0]);
 	vli_set(result->y, ry[0]);
 }
 
+/* ------ Fixed-base multiplication ------ */
+
+/* Homogeneous projective coordinates, (x, y) = (X / Z, Y / Z) */
+struct ecc_point_proj {
+	uint64_t x[NUM_ECC_DIGITS];
+	uint64_t y[NUM_ECC_DIGITS];
+	uint64_t z[NUM_ECC_DIGITS];
+};
+
+/* Complete addition for a = -3 (Algorithm 4 of "Complete addition formulas
+ * for prime order elliptic curves", https://eprint.iacr.org/2015/1060.pdf).
+ * Valid for all inputs including doubling and the point at infinity, so no
+ * branches are needed. result may alias either input.
+ */
+static void ecc_point_add_proj(struct ecc_point_proj *result,
+				const struct ecc_point_proj *p,
+				const struct ecc_point_proj *q)
+{
+	uint64_t t0[NUM_ECC_DIGITS], t1[NUM_ECC_DIGITS], t2[NUM_ECC_DIGITS];
+	uint64_t t3[NUM_ECC_DIGITS], t4[NUM_ECC_DIGITS];
+	uint64_t x3[NUM_ECC_DIGITS], y3[NUM_ECC_DIGITS], z3[NUM_ECC_DIGITS];
+
+	vli_mod_mult_fast(t0, p->x, q->x);
+	vli_mod_mult_fast(t1, p->y, q->y);
+	vli_mod_mult_fast(t2, p->z, q->z);
+	vli_mod_add(t3, p->x, p->y, curve_p);
+	vli_mod_add(t4, q->x, q->y, curve_p);
+	vli_mod_mult_fast(t3, t3, t4);
+	vli_mod_add(t4, t0, t1, curve_p);
+	vli_mod_sub(t3, t3, t4, curve_p);
+	vli_mod_add(t4, p->y, p->z, curve_p);
+	vli_mod_add(x3, q->y, q->z, curve_p);
+	vli_mod_mult_fast(t4, t4, x3);
+	vli_mod_add(x3, t1, t2, curve_p);
+	vli_mod_sub(t4, t4, x3, curve_p);
+	vli_mod_add(x3, p->x, p->z, curve_p);
+	vli_mod_add(y3, q->x, q->z, curve_p);
+	vli_mod_mult_fast(x3, x3, y3);
+	vli_mod_add(y3, t0, t2, curve_p);
+	vli_mod_sub(y3, x3, y3, curve_p);
+	vli_mod_mult_fast(z3, curve_b, t2);
+	vli_mod_sub(x3, y3, z3, curve_p);
+	vli_mod_add(z3, x3, x3, curve_p);
+	vli_mod_add(x3, x3, z3, curve_p);
+	vli_mod_sub(z3, t1, x3, curve_p);
+	vli_mod_add(x3, t1, x3, curve_p);
+	vli_mod_mult_fast(y3, curve_b, y3);
+	vli_mod_add(t1, t2, t2, curve_p);
+	vli_mod_add(t2, t1, t2, curve_p);
+	vli_mod_sub(y3, y3, t2, curve_p);
+	vli_mod_sub(y3, y3, t0, curve_p);
+	vli_mod_add(t1, y3, y3, curve_p);
+	vli_mod_add(y3, t1, y3, curve_p);
+	vli_mod_add(t1, t0, t0, curve_p);
+	vli_mod_add(t0, t1, t0, curve_p);
+	vli_mod_sub(t0, t0, t2, curve_p);
+	vli_mod_mult_fast(t1, t4, y3);
+	vli_mod_mult_fast(t2, t0, y3);
+	vli_mod_mult_fast(y3, x3, z3);
+	vli_mod_add(y3, y3, t2, curve_p);
+	vli_mod_mult_fast(x3, t3, x3);
+	vli_mod_sub(x3, x3, t1, curve_p);
+	vli_mod_mult_fast(z3, t4, z3);
+	vli_mod_mult_fast(t1, t3, t0);
+	vli_mod_add(z3, z3, t1, curve_p);
+
+	vli_set(result->x, x3);
+	vli_set(result->y, y3);
+	vli_set(result->z, z3);
+}
+
+/* The scalar is split into 64 windows of 4 bits. Row i of the table holds
+ * the affine points j * 16^i * G for j = 1..15, so k * G is the sum of one
+ * entry per row and needs no doublings at all. The table (60 KiB) is
+ * generated into ecc-table.h by tools/gen-ecc-table.py so it is read-only
+ * and needs no initialization.
+ */
+#define BASE_WINDOW_BITS	4
+#define BASE_WINDOWS		(ECC_BYTES * 8 / BASE_WINDOW_BITS)
+#define BASE_ROW_SIZE		((1 << BASE_WINDOW_BITS) - 1)
+
+#include "ecc-table.h"
+
+/* Copies row[digit - 1] into result touching every entry of the row, or
+ * clears result if digit is 0.
+ */
+static void base_table_select(struct ecc_point_proj *result,
+				const struct ecc_point *row, unsigned int digit)
+{
+	int i, j;
+
+	vli_clear(result->x);
+	vli_clear(result->y);
+	vli_clear(result->z);
+	result->z[0] = 1;
+
+	for (j = 0; j < BASE_ROW_SIZE; j++) {
+		uint64_t diff = (unsigned int) (j + 1) ^ digit;
+		uint64_t mask = 0 - ((diff - 1) >> 63);
+
+		for (i = 0; i < NUM_ECC_DIGITS; i++) {
+			result->x[i] |= row[j].x[i] & mask;
+			result->y[i] |= row[j].y[i] & mask;
+		}
+	}
+}
+
+/* Computes result = scalar * G for 0 < scalar < n. */
+static void ecc_point_mult_base(struct ecc_point *result,
+						const uint64_t *scalar)
+{
+	struct ecc_point_proj acc, sum, q;
+	uint64_t zinv[NUM_ECC_DIGITS];
+	int i;
+
+	/* Start from the point at infinity (0 : 1 : 0) */
+	vli_clear(acc.x);
+	vli_clear(acc.y);
+	vli_clear(acc.z);
+	acc.y[0] = 1;
+
+	for (i = 0; i < BASE_WINDOWS; i++) {
+		unsigned int digit;
+
+		digit = (scalar[i / 16] >> (BASE_WINDOW_BITS * (i % 16))) &
+							BASE_ROW_SIZE;
+
+		base_table_select(&q, base_table[i], digit);
+		ecc_point_add_proj(&sum, &acc, &q);
+
+		/* A zero digit adds nothing, discard the sum in that case */
+		vli_select(acc.x, sum.x, acc.x, (digit + BASE_ROW_SIZE) >> 4);
+		vli_select(acc.y, sum.y, acc.y, (digit + BASE_ROW_SIZE) >> 4);
+		vli_select(acc.z, sum.z, acc.z, (digit + BASE_ROW_SIZE) >> 4);
+	}
+
+	vli_mod_inv(zinv, acc.z);
+	vli_mod_mult_fast(result->x, acc.x, zinv);
+	vli_mod_mult_fast(result->y, acc.y, zinv);
+}
+
 static bool ecc_valid_point(const struct ecc_point *point)
 {
 	uint64_t tmp1[NUM_ECC_DIGITS];
@@ -853,7 +1014,7 @@ bool ecc_make_public_key(const uint8_t private_key[32], uint8_t public_key[64])
 	if (vli_cmp(curve_n, priv) != 1)
 		return false;
 
-	ecc_point_mult(&pk, &curve_g, priv, NULL, vli_num_bits(priv));
+	ecc_point_mult_base(&pk, priv);
 
 	if (ecc_point_is_zero(&pk))
 		return false;
@@ -881,7 +1042,7 @@ bool ecc_make_key(uint8_t public_key[64], uint8_t private_key[32])
 		if (vli_cmp(curve_n, priv) != 1)
 			continue;
 
-		ecc_point_mult(&pk, &curve_g, priv, NULL, vli_num_bits(priv));
+		ecc_point_mult_base(&pk, priv);
 	} while (ecc_point_is_zero(&pk));
 
 	ecc_native2bytes(priv, private_key);
@@ -920,7 +1081,7 @@ bool ecdh_shared_secret(const uint8_t public_key[64],
 
 	ecc_bytes2native(private_key, priv);
 
-	ecc_point_mult(&product, &pk, priv, rand, vli_num_bits(priv));
+	ecc_point_mult(&product, &pk, priv, rand);
 
 	ecc_native2bytes(product.x, secret);
 
@@ -104,6 +104,14 @@ struct bt_gatt_client {
 
 	struct bt_gatt_request *discovery_req;
 	unsigned int mtu_req_id;
+
+	/*
+	 * Number of services whose characteristics and descriptors may be
+	 * discovered concurrently when more than one ATT channel is available,
+	 * along with the requests those discoveries have outstanding.
+	 */
+	unsigned int discovery_parallel;
+	struct queue *discovery_reqs;
 };
 
 struct request {
@@ -348,6 +356,11 @@ struct discovery_op {
 	struct queue *pending_chrcs;
 	struct queue *ext_prop_desc;
 	struct gatt_db_attribute *cur_svc;
+	struct queue *svcs;		/* Services to discover in parallel */
+	struct queue *svcs_started;
+	unsigned int svcs_active;
+	bool svcs_failed;
+	uint8_t svcs_ecode;
 	struct gatt_db_attribute *hash;
 	uint8_t server_feat;
 	bool success;
@@ -362,6 +375,33 @@ struct discovery_op {
 	discovery_op_fail_func_t failure_func;
 };
 
+struct chrc {
+	uint16_t start_handle;
+	uint16_t end_handle;
+	uint16_t value_handle;
+	uint8_t properties;
+	bt_uuid_t uuid;
+};
+
+/* Service being discovered in parallel with others */
+struct discovery_svc {
+	struct discovery_op *op;
+	uint16_t start;
+	uint16_t end;
+	struct queue *chrcs;
+	struct queue *ext_prop_desc;
+	struct bt_gatt_request *req;
+};
+
+static void discovery_svc_free(void *data)
+{
+	struct discovery_svc *svc = data;
+
+	queue_destroy(svc->chrcs, free);
+	queue_destroy(svc->ext_prop_desc, NULL);
+	free(svc);
+}
+
 static void discovery_op_free(struct discovery_op *op)
 {
 	if (op->db_id > 0)
@@ -371,6 +411,8 @@ static void discovery_op_free(struct discovery_op *op)
 	queue_destroy(op->pending_svcs, NULL);
 	queue_destroy(op->pending_chrcs, free);
 	queue_destroy(op->ext_prop_desc, NULL);
+	queue_destroy(op->svcs, discovery_svc_free);
+	queue_destroy(op->svcs_started, discovery_svc_free);
 	free(op);
 }
 
@@ -449,6 +491,8 @@ static struct discovery_op *discovery_op_create(struct bt_gatt_client *client,
 	op->pending_svcs = queue_new();
 	op->pending_chrcs = queue_new();
 	op->ext_prop_desc = queue_new();
+	op->svcs = queue_new();
+	op->svcs_started = queue_new();
 	op->client = client;
 	op->complete_func = complete_func;
 	op->failure_func = failure_func;
@@ -512,11 +556,9 @@ static void discover_chrcs_cb(bool success, uint8_t att_ecode,
 						struct bt_gatt_result *result,
 						void *user_data);
 
-static void discover_incl_cb(bool success, uint8_t att_ecode,
-				struct bt_gatt_result *result, void *user_data)
+static bool discovery_parse_includes(struct bt_gatt_client *client,
+					struct bt_gatt_result *result)
 {
-	struct discovery_op *op = user_data;
-	struct bt_gatt_client *client = op->client;
 	struct bt_gatt_iter iter;
 	struct gatt_db_attribute *attr;
 	uint16_t handle, start, end;
@@ -524,23 +566,13 @@ static void discover_incl_cb(bool success, uint8_t att_ecode,
 	bt_uuid_t uuid;
 	char uuid_str[MAX_LEN_UUID_STR];
 	unsigned int includes_count, i;
-	struct handle_range *range;
-
-	discovery_req_clear(client);
-
-	if (!success) {
-		if (att_ecode == BT_ATT_ERROR_ATTRIBUTE_NOT_FOUND)
-			goto next;
-
-		goto failed;
-	}
 
 	if (!result || !bt_gatt_iter_init(&iter, result))
-		goto failed;
+		return false;
 
 	includes_count = bt_gatt_result_included_count(result);
 	if (includes_count == 0)
-		goto failed;
+		return false;
 
 	util_debug(client->debug_callback, client->debug_data,
 						"Included services found: %u",
@@ -563,7 +595,7 @@ static void discover_incl_cb(bool success, uint8_t att_ecode,
 		if (!attr) {
 			util_debug(client->debug_callback, client->debug_data,
 				"Unable to find attribute at 0x%04x", start);
-			goto failed;
+			return false;
 		}
 
 		attr = gatt_db_insert_included(client->db, handle, attr);
@@ -571,7 +603,7 @@ static void discover_incl_cb(bool success, uint8_t att_ecode,
 			util_debug(client->debug_callback, client->debug_data,
 				"Unable to add include attribute at 0x%04x",
 				handle);
-			goto failed;
+			return false;
 		}
 
 		/*
@@ -584,10 +616,32 @@ static void discover_incl_cb(bool success, uint8_t att_ecode,
 			util_debug(client->debug_callback, client->debug_data,
 				"Invalid attribute 0x%04x expect it at 0x%04x",
 				gatt_db_attribute_get_handle(attr), handle);
-			goto failed;
+			return false;
 		}
 	}
 
+	return true;
+}
+
+static void discover_incl_cb(bool success, uint8_t att_ecode,
+				struct bt_gatt_result *result, void *user_data)
+{
+	struct discovery_op *op = user_data;
+	struct bt_gatt_client *client = op->client;
+	struct handle_range *range;
+
+	discovery_req_clear(client);
+
+	if (!success) {
+		if (att_ecode == BT_ATT_ERROR_ATTRIBUTE_NOT_FOUND)
+			goto next;
+
+		goto failed;
+	}
+
+	if (!discovery_parse_includes(client, result))
+		goto failed;
+
 next:
 	range = queue_pop_head(op->discov_ranges);
 	if (!range)
@@ -610,30 +664,99 @@ failed:
 	discovery_op_complete(op, false, att_ecode);
 }
 
-struct chrc {
-	uint16_t start_handle;
-	uint16_t end_handle;
-	uint16_t value_handle;
-	uint8_t properties;
-	bt_uuid_t uuid;
-};
-
 static void discover_descs_cb(bool success, uint8_t att_ecode,
 						struct bt_gatt_result *result,
 						void *user_data);
 
+/*
+ * Insert a discovered characteristic into its service, setting discover if
+ * its descriptors still have to be discovered.
+ */
+static bool discovery_insert_chrc(struct bt_gatt_client *client,
+					struct gatt_db_attribute *svc,
+					struct chrc *chrc_data, bool *discover)
+{
+	struct gatt_db_attribute *attr;
+	uint16_t desc_start;
+	uint16_t start, end;
+
+	*discover = false;
+
+	attr = gatt_db_insert_characteristic(client->db,
+						chrc_data->value_handle,
+						&chrc_data->uuid, 0,
+						chrc_data->properties,
+						NULL, NULL, NULL);
+
+	if (!attr) {
+		util_debug(client->debug_callback, client->debug_data,
+				"Failed to insert characteristic at 0x%04x",
+				chrc_data->value_handle);
+
+		/* Some devices have been seen reporting orphaned
+		 * characteristics.  In order to favor interoperability
+		 * we skip over characteristics in error
+		 */
+		return true;
+	}
+
+	if (gatt_db_attribute_get_handle(attr) != chrc_data->value_handle)
+		return false;
+
+	gatt_db_attribute_get_service_handles(svc, &start, &end);
+
+	/*
+	 * Adjust end_handle in case the next chrc is not within the
+	 * same service.
+	 */
+	if (chrc_data->end_handle > end)
+		chrc_data->end_handle = end;
+
+	/*
+	 * check for descriptors presence, before initializing the
+	 * desc_handle and avoid integer overflow during desc_handle
+	 * initialization.
+	 */
+	if (chrc_data->value_handle >= chrc_data->end_handle)
+		return true;
+
+	desc_start = chrc_data->value_handle + 1;
+
+	if (desc_start == chrc_data->end_handle &&
+		(chrc_data->properties & BT_GATT_CHRC_PROP_NOTIFY ||
+		 chrc_data->properties & BT_GATT_CHRC_PROP_INDICATE)) {
+		bt_uuid_t ccc_uuid;
+
+		/* If there is only one descriptor that must be the CCC
+		 * in case either notify or indicate are supported.
+		 */
+		bt_uuid16_create(&ccc_uuid, GATT_CLIENT_CHARAC_CFG_UUID);
+		attr = gatt_db_insert_descriptor(client->db, desc_start,
+							&ccc_uuid, 0, NULL,
+							NULL, NULL);
+		if (attr)
+			return true;
+	}
+
+	/* Check if the start range is within characteristic range */
+	if (desc_start > chrc_data->end_handle)
+		return true;
+
+	*discover = true;
+
+	return true;
+}
+
 static bool discover_descs(struct discovery_op *op, bool *discovering)
 {
 	struct bt_gatt_client *client = op->client;
-	struct gatt_db_attribute *attr;
 	struct chrc *chrc_data;
-	uint16_t desc_start;
 
 	*discovering = false;
 
 	while ((chrc_data = queue_pop_head(op->pending_chrcs))) {
 		struct gatt_db_attribute *svc;
-		uint16_t start, end;
+		bool discover;
 
 		/* Adjust current service */
 		svc = gatt_db_get_service(client->db, chrc_data->value_handle);
@@ -648,81 +771,21 @@ static bool discover_descs(struct discovery_op *op, bool *discovering)
 			op->cur_svc = svc;
 		}
 
-		attr = gatt_db_insert_characteristic(client->db,
-							chrc_data->value_handle,
-							&chrc_data->uuid, 0,
-							chrc_data->properties,
-							NULL, NULL, NULL);
-
-		if (!attr) {
-			util_debug(client->debug_callback, client->debug_data,
-				"Failed to insert characteristic at 0x%04x",
-				chrc_data->value_handle);
-
-			/* Some devices have been seen reporting orphaned
-			 * characteristics.  In order to favor interoperability
-			 * we skip over characteristics in error
-			 */
-			free(chrc_data);
-			continue;
-		}
-
-		if (gatt_db_attribute_get_handle(attr) !=
-							chrc_data->value_handle)
+		if (!discovery_insert_chrc(client, svc, chrc_data, &discover))
 			goto failed;
 
-		gatt_db_attribute_get_service_handles(svc, &start, &end);
-
-		/*
-		 * Adjust end_handle in case the next chrc is not within the
-		 * same service.
-		 */
-		if (chrc_data->end_handle > end)
-			chrc_data->end_handle = end;
-
-		/*
-		 * check for descriptors presence, before initializing the
-		 * desc_handle and avoid integer overflow during desc_handle
-		 * initialization.
-		 */
-		if (chrc_data->value_handle >= chrc_data->end_handle) {
-			free(chrc_data);
-			continue;
-		}
-
-		desc_start = chrc_data->value_handle + 1;
-
-		if (desc_start == chrc_data->end_handle &&
-			(chrc_data->properties & BT_GATT_CHRC_PROP_NOTIFY ||
-			 chrc_data->properties & BT_GATT_CHRC_PROP_INDICATE)) {
-			bt_uuid_t ccc_uuid;
-
-			/* If there is only one descriptor that must be the CCC
-			 * in case either notify or indicate are supported.
-			 */
-			bt_uuid16_create(&ccc_uuid,
-					GATT_CLIENT_CHARAC_CFG_UUID);
-			attr = gatt_db_insert_descriptor(client->db, desc_start,
-							&ccc_uuid, 0, NULL,
-							NULL, NULL);
-			if (attr) {
-				free(chrc_data);
-				continue;
-			}
-		}
-
-		/* Check if the start range is within characteristic range */
-		if (desc_start > chrc_data->end_handle) {
+		if (!discover) {
 			free(chrc_data);
 			continue;
 		}
 
 		client->discovery_req = bt_gatt_discover_descriptors(
-							client->att, desc_start,
-							chrc_data->end_handle,
-							discover_descs_cb,
-							discovery_op_ref(op),
-							discovery_op_unref);
+						client->att,
+						chrc_data->value_handle + 1,
+						chrc_data->end_handle,
+						discover_descs_cb,
+						discovery_op_ref(op),
+						discovery_op_unref);
 		if (client->discovery_req) {
 			*discovering = true;
 			goto done;
@@ -822,12 +885,10 @@ done:
 	discovery_op_complete(op, success, att_ecode);
 }
 
-static void discover_descs_cb(bool success, uint8_t att_ecode,
-						struct bt_gatt_result *result,
-						void *user_data)
+static bool discovery_parse_descs(struct bt_gatt_client *client,
+					struct bt_gatt_result *result,
+					struct queue *ext_prop_desc)
 {
-	struct discovery_op *op = user_data;
-	struct bt_gatt_client *client = op->client;
 	struct bt_gatt_iter iter;
 	struct gatt_db_attribute *attr;
 	uint16_t handle;
@@ -835,26 +896,14 @@ static void discover_descs_cb(bool success, uint8_t att_ecode,
 	bt_uuid_t uuid;
 	char uuid_str[MAX_LEN_UUID_STR];
 	unsigned int desc_count;
-	bool discovering;
 	bt_uuid_t ext_prop_uuid;
 
-	discovery_req_clear(client);
-
-	if (!success) {
-		if (att_ecode == BT_ATT_ERROR_ATTRIBUTE_NOT_FOUND) {
-			success = true;
-			goto next;
-		}
-
-		goto done;
-	}
-
 	if (!result || !bt_gatt_iter_init(&iter, result))
-		goto failed;
+		return false;
 
 	desc_count = bt_gatt_result_descriptor_count(result);
 	if (desc_count == 0)
-		goto failed;
+		return false;
 
 	util_debug(client->debug_callback, client->debug_data,
 					"Descriptors found: %u", desc_count);
@@ -882,16 +931,41 @@ static void discover_descs_cb(bool success, uint8_t att_ecode,
 			util_debug(client->debug_callback, client->debug_data,
 				"Failed to insert descriptor at 0x%04x",
 				handle);
-			goto failed;
+			return false;
 		}
 
 		if (gatt_db_attribute_get_handle(attr) != handle)
-			goto failed;
+			return false;
 
 		if (!bt_uuid_cmp(&ext_prop_uuid, &uuid))
-			queue_push_tail(op->ext_prop_desc, attr);
+			queue_push_tail(ext_prop_desc, attr);
 	}
 
+	return true;
+}
+
+static void discover_descs_cb(bool success, uint8_t att_ecode,
+						struct bt_gatt_result *result,
+						void *user_data)
+{
+	struct discovery_op *op = user_data;
+	struct bt_gatt_client *client = op->client;
+	bool discovering;
+
+	discovery_req_clear(client);
+
+	if (!success) {
+		if (att_ecode == BT_ATT_ERROR_ATTRIBUTE_NOT_FOUND) {
+			success = true;
+			goto next;
+		}
+
+		goto done;
+	}
+
+	if (!discovery_parse_descs(client, result, op->ext_prop_desc))
+		goto failed;
+
 	/* If we got extended prop descriptor, lets read it right away */
 	if (read_ext_prop_desc(op))
 		return;
@@ -915,12 +989,10 @@ done:
 	discovery_op_complete(op, success, att_ecode);
 }
 
-static void discover_chrcs_cb(bool success, uint8_t att_ecode,
-						struct bt_gatt_result *result,
-						void *user_data)
+static bool discovery_parse_chrcs(struct bt_gatt_client *client,
+					struct bt_gatt_result *result,
+					struct queue *chrcs)
 {
-	struct discovery_op *op = user_data;
-	struct bt_gatt_client *client = op->client;
 	struct bt_gatt_iter iter;
 	struct chrc *chrc_data;
 	uint16_t start, end, value;
@@ -929,28 +1001,16 @@ static void discover_chrcs_cb(bool success, uint8_t att_ecode,
 	bt_uuid_t uuid;
 	char uuid_str[MAX_LEN_UUID_STR];
 	unsigned int chrc_count;
-	bool discovering;
-
-	discovery_req_clear(client);
-
-	if (!success) {
-		if (att_ecode == BT_ATT_ERROR_ATTRIBUTE_NOT_FOUND) {
-			success = true;
-			goto next;
-		}
-
-		goto done;
-	}
 
 	if (!result || !bt_gatt_iter_init(&iter, result))
-		goto failed;
+		return false;
 
 	chrc_count = bt_gatt_result_characteristic_count(result);
 	util_debug(client->debug_callback, client->debug_data,
 				"Characteristics found: %u", chrc_count);
 
 	if (chrc_count == 0)
-		goto failed;
+		return false;
 
 	while (bt_gatt_iter_next_characteristic(&iter, &start, &end, &value,
 						&properties, u128.data)) {
@@ -971,9 +1031,34 @@ static void discover_chrcs_cb(bool success, uint8_t att_ecode,
 		chrc_data->properties = properties;
 		chrc_data->uuid = uuid;
 
-		queue_push_tail(op->pending_chrcs, chrc_data);
+		queue_push_tail(chrcs, chrc_data);
+	}
+
+	return true;
+}
+
+static void discover_chrcs_cb(bool success, uint8_t att_ecode,
+						struct bt_gatt_result *result,
+						void *user_data)
+{
+	struct discovery_op *op = user_data;
+	struct bt_gatt_client *client = op->client;
+	bool discovering;
+
+	discovery_req_clear(client);
+
+	if (!success) {
+		if (att_ecode == BT_ATT_ERROR_ATTRIBUTE_NOT_FOUND) {
+			success = true;
+			goto next;
+		}
+
+		goto done;
 	}
 
+	if (!discovery_parse_chrcs(client, result, op->pending_chrcs))
+		goto failed;
+
 next:
 	/*
 	 * Before attempting to process discovered characteristics make sure we
@@ -1066,6 +1151,317 @@ static void remove_discov_range(struct discovery_op *op, uint16_t start,
 	}
 }
 
+static void discovery_svc_add(struct discovery_op *op, uint16_t start,
+								uint16_t end)
+{
+	struct discovery_svc *svc;
+
+	if (op->client->discovery_parallel < 2)
+		return;
+
+	svc = new0(struct discovery_svc, 1);
+	svc->op = op;
+	svc->start = start;
+	svc->end = end;
+	svc->chrcs = queue_new();
+	svc->ext_prop_desc = queue_new();
+
+	queue_push_tail(op->svcs, svc);
+}
+
+static struct discovery_svc *discovery_svc_ref(struct discovery_svc *svc)
+{
+	discovery_op_ref(svc->op);
+
+	return svc;
+}
+
+static void discovery_svc_unref(void *data)
+{
+	struct discovery_svc *svc = data;
+
+	discovery_op_unref(svc->op);
+}
+
+static bool discovery_svc_set_req(struct discovery_svc *svc,
+						struct bt_gatt_request *req)
+{
+	struct bt_gatt_client *client = svc->op->client;
+
+	if (!req) {
+		util_debug(client->debug_callback, client->debug_data,
+				"Failed to start discovery of service 0x%04x",
+				svc->start);
+		discovery_op_unref(svc->op);
+		return false;
+	}
+
+	svc->req = req;
+	queue_push_tail(client->discovery_reqs, req);
+
+	return true;
+}
+
+static void discovery_svc_req_clear(struct discovery_svc *svc)
+{
+	struct bt_gatt_client *client = svc->op->client;
+
+	if (!svc->req)
+		return;
+
+	queue_remove(client->discovery_reqs, svc->req);
+	bt_gatt_request_unref(svc->req);
+	svc->req = NULL;
+}
+
+static void discovery_svcs_next(struct discovery_op *op);
+
+static void discovery_svc_done(struct discovery_svc *svc, bool success,
+							uint8_t att_ecode)
+{
+	struct discovery_op *op = svc->op;
+	struct gatt_db_attribute *attr;
+
+	op->svcs_active--;
+
+	if (!success) {
+		if (!op->svcs_failed) {
+			op->svcs_failed = true;
+			op->svcs_ecode = att_ecode;
+		}
+	} else {
+		attr = gatt_db_get_service(op->client->db, svc->start);
+		if (attr) {
+			queue_remove(op->pending_svcs, attr);
+
+			/* Done with the service */
+			gatt_db_service_set_active(attr, true);
+		}
+	}
+
+	discovery_svcs_next(op);
+}
+
+static void discover_svc_descs_cb(bool success, uint8_t att_ecode,
+						struct bt_gatt_result *result,
+						void *user_data);
+
+/* Insert characteristics in handle order, discovering their descriptors */
+static void discovery_svc_next_chrc(struct discovery_svc *svc)
+{
+	struct bt_gatt_client *client = svc->op->client;
+	struct chrc *chrc_data;
+
+	while ((chrc_data = queue_pop_head(svc->chrcs))) {
+		struct gatt_db_attribute *attr;
+		bool discover;
+
+		attr = gatt_db_get_service(client->db, chrc_data->value_handle);
+		if (!attr || !discovery_insert_chrc(client, attr, chrc_data,
+								&discover)) {
+			free(chrc_data);
+			discovery_svc_done(svc, false, 0);
+			return;
+		}
+
+		if (!discover) {
+			free(chrc_data);
+			continue;
+		}
+
+		if (!discovery_svc_set_req(svc, bt_gatt_discover_descriptors(
+						client->att,
+						chrc_data->value_handle + 1,
+						chrc_data->end_handle,
+						discover_svc_descs_cb,
+						discovery_svc_ref(svc),
+						discovery_svc_unref)))
+			discovery_svc_done(svc, false, 0);
+
+		free(chrc_data);
+		return;
+	}
+
+	discovery_svc_done(svc, true, 0);
+}
+
+static void svc_ext_prop_read_cb(bool success, uint8_t att_ecode,
+					const uint8_t *value, uint16_t length,
+					void *user_data);
+
+static bool discovery_svc_read_ext_prop(struct discovery_svc *svc)
+{
+	struct bt_gatt_client *client = svc->op->client;
+	struct gatt_db_attribute *attr;
+
+	attr = queue_peek_head(svc->ext_prop_desc);
+	if (!attr)
+		return false;
+
+	if (!bt_gatt_client_read_value(client,
+					gatt_db_attribute_get_handle(attr),
+					svc_ext_prop_read_cb,
+					discovery_svc_ref(svc),
+					discovery_svc_unref)) {
+		discovery_op_unref(svc->op);
+		return false;
+	}
+
+	return true;
+}
+
+static void svc_ext_prop_read_cb(bool success, uint8_t att_ecode,
+					const uint8_t *value, uint16_t length,
+					void *user_data)
+{
+	struct discovery_svc *svc = user_data;
+	struct bt_gatt_client *client = svc->op->client;
+	struct gatt_db_attribute *desc_attr;
+
+	if (!success) {
+		discovery_svc_done(svc, false, att_ecode);
+		return;
+	}
+
+	desc_attr = queue_pop_head(svc->ext_prop_desc);
+	if (!desc_attr || !gatt_db_attribute_write(desc_attr, 0, value,
+						length, 0, NULL,
+						ext_prop_write_cb, client)) {
+		discovery_svc_done(svc, false, att_ecode);
+		return;
+	}
+
+	/* Any other descriptor to read? */
+	if (discovery_svc_read_ext_prop(svc))
+		return;
+
+	discovery_svc_next_chrc(svc);
+}
+
+static void discover_svc_descs_cb(bool success, uint8_t att_ecode,
+						struct bt_gatt_result *result,
+						void *user_data)
+{
+	struct discovery_svc *svc = user_data;
+	struct bt_gatt_client *client = svc->op->client;
+
+	discovery_svc_req_clear(svc);
+
+	if (!success) {
+		if (att_ecode == BT_ATT_ERROR_ATTRIBUTE_NOT_FOUND)
+			goto next;
+
+		discovery_svc_done(svc, false, att_ecode);
+		return;
+	}
+
+	if (!discovery_parse_descs(client, result, svc->ext_prop_desc)) {
+		discovery_svc_done(svc, false, att_ecode);
+		return;
+	}
+
+	/* If we got extended prop descriptor, lets read it right away */
+	if (discovery_svc_read_ext_prop(svc))
+		return;
+
+next:
+	discovery_svc_next_chrc(svc);
+}
+
+static void discover_svc_chrcs_cb(bool success, uint8_t att_ecode,
+						struct bt_gatt_result *result,
+						void *user_data)
+{
+	struct discovery_svc *svc = user_data;
+	struct bt_gatt_client *client = svc->op->client;
+
+	discovery_svc_req_clear(svc);
+
+	if (!success) {
+		if (att_ecode == BT_ATT_ERROR_ATTRIBUTE_NOT_FOUND)
+			goto next;
+
+		discovery_svc_done(svc, false, att_ecode);
+		return;
+	}
+
+	if (!discovery_parse_chrcs(client, result, svc->chrcs)) {
+		discovery_svc_done(svc, false, att_ecode);
+		return;
+	}
+
+next:
+	discovery_svc_next_chrc(svc);
+}
+
+static void discover_svc_incl_cb(bool success, uint8_t att_ecode,
+						struct bt_gatt_result *result,
+						void *user_data)
+{
+	struct discovery_svc *svc = user_data;
+	struct bt_gatt_client *client = svc->op->client;
+
+	discovery_svc_req_clear(svc);
+
+	if (!success) {
+		if (att_ecode == BT_ATT_ERROR_ATTRIBUTE_NOT_FOUND)
+			goto next;
+
+		discovery_svc_done(svc, false, att_ecode);
+		return;
+	}
+
+	if (!discovery_parse_includes(client, result)) {
+		discovery_svc_done(svc, false, att_ecode);
+		return;
+	}
+
+next:
+	if (!discovery_svc_set_req(svc, bt_gatt_discover_characteristics(
+							client->att,
+							svc->start, svc->end,
+							discover_svc_chrcs_cb,
+							discovery_svc_ref(svc),
+							discovery_svc_unref)))
+		discovery_svc_done(svc, false, 0);
+}
+
+/*
+ * Each service is discovered on its own, in handle order, so requests for
+ * different services can be outstanding on different ATT channels at once.
+ */
+static void discovery_svcs_next(struct discovery_op *op)
+{
+	struct bt_gatt_client *client = op->client;
+	struct discovery_svc *svc;
+
+	while (!op->svcs_failed &&
+			op->svcs_active < client->discovery_parallel) {
+		svc = queue_pop_head(op->svcs);
+		if (!svc)
+			break;
+
+		queue_push_tail(op->svcs_started, svc);
+
+		if (!discovery_svc_set_req(svc,
+				bt_gatt_discover_included_services(client->att,
+							svc->start, svc->end,
+							discover_svc_incl_cb,
+							discovery_svc_ref(svc),
+							discovery_svc_unref))) {
+			op->svcs_failed = true;
+			break;
+		}
+
+		op->svcs_active++;
+	}
+
+	if (op->svcs_active)
+		return;
+
+	discovery_op_complete(op, !op->svcs_failed, op->svcs_ecode);
+}
+
 static void discovery_found_service(struct discovery_op *op,
 					struct gatt_db_attribute *attr,
 					uint16_t start, uint16_t end)
@@ -1075,8 +1471,10 @@ static void discovery_found_service(struct discovery_op *op,
 		/* Skip if there are no attributes */
 		if (end == start)
 			gatt_db_service_set_active(attr, true);
-		else
+		else {
 			queue_push_tail(op->pending_svcs, attr);
+			discovery_svc_add(op, start, end);
+		}
 
 		if (start < op->svc_first)
 			op->svc_first = start;
@@ -1182,6 +1580,11 @@ next:
 	if (queue_isempty(op->pending_svcs) || queue_isempty(op->discov_ranges))
 		goto done;
 
+	if (!queue_isempty(op->svcs) && bt_att_get_channels(client->att) > 1) {
+		discovery_svcs_next(op);
+		return;
+	}
+
 	if (op->svc_first > 0x0001)
 		remove_discov_range(op, 1, op->svc_first - 1);
 	if (op->svc_last < 0xffff)
@@ -2224,6 +2627,7 @@ static void bt_gatt_client_free(struct bt_gatt_client *client)
 	queue_destroy(client->svc_chngd_queue, free);
 	queue_destroy(client->long_write_queue, request_unref);
 	queue_destroy(client->pending_requests, request_unref);
+	queue_destroy(client->discovery_reqs, NULL);
 
 	if (client->parent) {
 		queue_remove(client->parent->clones, client);
@@ -2269,6 +2673,7 @@ static struct bt_gatt_client *gatt_client_new(struct gatt_db *db,
 	client->notify_list = queue_new();
 	client->notify_chrcs = queue_new();
 	client->pending_requests = queue_new();
+	client->discovery_reqs = queue_new();
 
 	client->nfy_id = bt_att_register(att, BT_ATT_OP_HANDLE_NFY,
 						notify_cb, client, NULL);
@@ -2436,6 +2841,17 @@ bool bt_gatt_client_set_debug(struct bt_gatt_client *client,
 	return true;
 }
 
+bool bt_gatt_client_set_parallel_discovery(struct bt_gatt_client *client,
+							unsigned int services)
+{
+	if (!client)
+		return false;
+
+	client->discovery_parallel = services;
+
+	return true;
+}
+
 uint16_t bt_gatt_client_get_mtu(struct bt_gatt_client *client)
 {
 	if (!client || !client->att)
@@ -2561,6 +2977,14 @@ static void cancel_pending(void *data)
 	cancel_request(data);
 }
 
+static void cancel_discovery_req(void *data)
+{
+	struct bt_gatt_request *req = data;
+
+	bt_gatt_request_cancel(req);
+	bt_gatt_request_unref(req);
+}
+
 bool bt_gatt_client_cancel_all(struct bt_gatt_client *client)
 {
 	if (!client || !client->att)
@@ -2574,6 +2998,9 @@ bool bt_gatt_client_cancel_all(struct bt_gatt_client *client)
 		client->discovery_req = NULL;
 	}
 
+	queue_remove_all(client->discovery_reqs, NULL, NULL,
+						cancel_discovery_req);
+
 	if (client->mtu_req_id)
 		bt_att_cancel(client->att, client->mtu_req_id);
 
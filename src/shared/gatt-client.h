@@ -59,6 +59,8 @@ bool bt_gatt_client_set_debug(struct bt_gatt_client *client,
 					bt_gatt_client_debug_func_t callback,
 					void *user_data,
 					bt_gatt_client_destroy_func_t destroy);
+bool bt_gatt_client_set_parallel_discovery(struct bt_gatt_client *client,
+							unsigned int services);
 
 uint16_t bt_gatt_client_get_mtu(struct bt_gatt_client *client);
 struct bt_att *bt_gatt_client_get_att(struct bt_gatt_client *client);
@@ -14,6 +14,7 @@
 
 #include <stdbool.h>
 #include <errno.h>
+#include <time.h>
 
 #include "lib/bluetooth.h"
 #include "lib/uuid.h"
@@ -32,6 +33,7 @@
 #define MAX_INCLUDED_VALUE_LEN 6
 #define ATTRIBUTE_TIMEOUT 5000
 #define HASH_UPDATE_TIMEOUT 100
+#define TYPE_INDEX_SIZE 64
 
 static const bt_uuid_t primary_service_uuid = { .type = BT_UUID16,
 					.value.u16 = GATT_PRIM_SVC_UUID };
@@ -49,9 +51,20 @@ struct gatt_db {
 	struct bt_crypto *crypto;
 	uint8_t hash[16];
 	unsigned int hash_id;
+	struct iovec *hash_iov;
+	unsigned int hash_iov_size;
+	struct gatt_db_hash_stats hash_stats;
 	uint16_t next_handle;
 	struct queue *services;
 
+	/* Services sorted by handle range, used for handle lookups */
+	struct gatt_db_service **index;
+	unsigned int index_len;
+	unsigned int index_size;
+
+	/* Attributes grouped by type in handle order, used for discovery */
+	struct queue *types[TYPE_INDEX_SIZE];
+
 	struct queue *notify_list;
 	unsigned int next_notify_id;
 
@@ -59,6 +72,13 @@ struct gatt_db {
 	void *authorize_data;
 };
 
+struct attribute_type {
+	uint128_t uuid;
+	struct gatt_db_attribute **attribs;
+	unsigned int len;
+	unsigned int size;
+};
+
 struct notify {
 	unsigned int id;
 	gatt_db_attribute_cb_t service_added;
@@ -119,6 +139,10 @@ struct gatt_db_service {
 	bool claimed;
 	uint16_t num_handles;
 	struct gatt_db_attribute **attributes;
+
+	/* Cached Database Hash input, NULL when it needs to be regenerated */
+	uint8_t *hash_data;
+	size_t hash_len;
 };
 
 static void set_attribute_data(struct gatt_db_attribute *attribute,
@@ -225,6 +249,144 @@ failed:
 	return NULL;
 }
 
+static void type_to_uint128(const bt_uuid_t *type, uint128_t *u128)
+{
+	bt_uuid_t uuid;
+
+	bt_uuid_to_uuid128(type, &uuid);
+	*u128 = uuid.value.u128;
+}
+
+static unsigned int type_hash(const uint128_t *u128)
+{
+	unsigned int i, hash = 5381;
+
+	for (i = 0; i < sizeof(u128->data); i++)
+		hash = hash * 33 + u128->data[i];
+
+	return hash % TYPE_INDEX_SIZE;
+}
+
+static bool match_type(const void *data, const void *user_data)
+{
+	const struct attribute_type *type = data;
+	const uint128_t *u128 = user_data;
+
+	return !memcmp(&type->uuid, u128, sizeof(*u128));
+}
+
+static struct attribute_type *type_index_find(struct gatt_db *db,
+						const bt_uuid_t *uuid)
+{
+	uint128_t u128;
+
+	type_to_uint128(uuid, &u128);
+
+	return queue_find(db->types[type_hash(&u128)], match_type, &u128);
+}
+
+/* Returns the position of the first attribute with handle >= handle */
+static unsigned int type_index_lookup(const struct attribute_type *type,
+							uint16_t handle)
+{
+	unsigned int low = 0, high = type->len;
+
+	while (low < high) {
+		unsigned int mid = low + (high - low) / 2;
+
+		if (type->attribs[mid]->handle < handle)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return low;
+}
+
+static void type_index_add(struct gatt_db *db,
+					struct gatt_db_attribute *attrib)
+{
+	struct attribute_type *type;
+	unsigned int pos, hash;
+	uint128_t u128;
+
+	type_to_uint128(&attrib->uuid, &u128);
+	hash = type_hash(&u128);
+
+	if (!db->types[hash])
+		db->types[hash] = queue_new();
+
+	type = queue_find(db->types[hash], match_type, &u128);
+	if (!type) {
+		type = new0(struct attribute_type, 1);
+		type->uuid = u128;
+		queue_push_tail(db->types[hash], type);
+	}
+
+	if (type->len == type->size) {
+		type->size = type->size ? type->size * 2 : 8;
+		type->attribs = realloc(type->attribs,
+					type->size * sizeof(*type->attribs));
+	}
+
+	pos = type_index_lookup(type, attrib->handle);
+
+	memmove(&type->attribs[pos + 1], &type->attribs[pos],
+				(type->len - pos) * sizeof(*type->attribs));
+	type->attribs[pos] = attrib;
+	type->len++;
+}
+
+static void attribute_type_free(void *data)
+{
+	struct attribute_type *type = data;
+
+	free(type->attribs);
+	free(type);
+}
+
+static void type_index_remove(struct gatt_db *db,
+					struct gatt_db_attribute *attrib)
+{
+	struct attribute_type *type;
+	unsigned int pos;
+
+	type = type_index_find(db, &attrib->uuid);
+	if (!type)
+		return;
+
+	for (pos = type_index_lookup(type, attrib->handle); pos < type->len;
+									pos++) {
+		if (type->attribs[pos] == attrib)
+			break;
+
+		if (type->attribs[pos]->handle != attrib->handle)
+			return;
+	}
+
+	if (pos == type->len)
+		return;
+
+	type->len--;
+	memmove(&type->attribs[pos], &type->attribs[pos + 1],
+				(type->len - pos) * sizeof(*type->attribs));
+
+	if (!type->len) {
+		queue_remove(db->types[type_hash(&type->uuid)], type);
+		attribute_type_free(type);
+	}
+}
+
+static void type_index_clear(struct gatt_db *db)
+{
+	int i;
+
+	for (i = 0; i < TYPE_INDEX_SIZE; i++) {
+		queue_destroy(db->types[i], attribute_type_free);
+		db->types[i] = NULL;
+	}
+}
+
 struct gatt_db *gatt_db_ref(struct gatt_db *db)
 {
 	if (!db)
@@ -282,85 +444,133 @@ static void handle_notify(void *data, void *user_data)
 		notify->service_removed(notify_data->attr, notify->user_data);
 }
 
-struct hash_data {
-	struct iovec *iov;
-	uint16_t i;
-};
-
-static void gen_hash_m(struct gatt_db_attribute *attr, void *user_data)
+static size_t attribute_hash_len(const struct gatt_db_attribute *attr)
 {
-	struct hash_data *hash = user_data;
-	uint8_t *data;
-	size_t len;
-
 	if (bt_uuid_len(&attr->uuid) != 2)
-		return;
+		return 0;
 
 	switch (attr->uuid.value.u16) {
 	case GATT_PRIM_SVC_UUID:
 	case GATT_SND_SVC_UUID:
 	case GATT_INCLUDE_UUID:
 	case GATT_CHARAC_UUID:
-		/* Allocate space for handle + type + value */
-		len = 2 + 2 + attr->value_len;
-		data = malloc(2 + 2 + attr->value_len);
-		put_le16(attr->handle, data);
-		bt_uuid_to_le(&attr->uuid, data + 2);
-		memcpy(data + 4, attr->value, attr->value_len);
-		break;
+		/* handle + type + value */
+		return 2 + 2 + attr->value_len;
 	case GATT_CHARAC_USER_DESC_UUID:
 	case GATT_CLIENT_CHARAC_CFG_UUID:
 	case GATT_SERVER_CHARAC_CFG_UUID:
 	case GATT_CHARAC_FMT_UUID:
 	case GATT_CHARAC_AGREG_FMT_UUID:
-		/* Allocate space for handle + type  */
-		len = 2 + 2;
-		data = malloc(2 + 2 + attr->value_len);
-		put_le16(attr->handle, data);
-		bt_uuid_to_le(&attr->uuid, data + 2);
-		break;
+		/* handle + type */
+		return 2 + 2;
 	default:
-		return;
+		return 0;
+	}
+}
+
+static void service_gen_hash(struct gatt_db_service *service)
+{
+	size_t len = 0;
+	uint8_t *data;
+	int i;
+
+	for (i = 0; i < service->num_handles; i++) {
+		if (service->attributes[i])
+			len += attribute_hash_len(service->attributes[i]);
 	}
 
-	hash->iov[hash->i].iov_base = data;
-	hash->iov[hash->i].iov_len = len;
+	free(service->hash_data);
+	service->hash_data = malloc(len);
+	service->hash_len = len;
+
+	data = service->hash_data;
 
-	hash->i++;
+	for (i = 0; i < service->num_handles; i++) {
+		struct gatt_db_attribute *attr = service->attributes[i];
 
-	return;
+		if (!attr)
+			continue;
+
+		len = attribute_hash_len(attr);
+		if (!len)
+			continue;
+
+		put_le16(attr->handle, data);
+		bt_uuid_to_le(&attr->uuid, data + 2);
+		if (len > 4)
+			memcpy(data + 4, attr->value, len - 4);
+		data += len;
+	}
 }
 
-static void service_gen_hash_m(struct gatt_db_attribute *attr, void *user_data)
+static uint64_t hash_time_usec(void)
 {
-	gatt_db_service_foreach(attr, NULL, gen_hash_m, user_data);
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
 }
 
 static bool db_hash_update(void *user_data)
 {
 	struct gatt_db *db = user_data;
-	struct hash_data hash;
-	uint16_t i;
+	uint64_t start, elapsed;
+	unsigned int i, n;
 
 	db->hash_id = 0;
 
 	if (!db->next_handle)
 		return false;
 
-	hash.iov = new0(struct iovec, db->next_handle);
-	hash.i = 0;
+	start = hash_time_usec();
+
+	/* The iovec array is only reallocated when the database grows */
+	if (db->hash_iov_size < db->index_len) {
+		free(db->hash_iov);
+		db->hash_iov = new0(struct iovec, db->index_len);
+		db->hash_iov_size = db->index_len;
+	}
+
+	for (i = 0, n = 0; i < db->index_len; i++) {
+		struct gatt_db_service *service = db->index[i];
+
+		if (!service->active)
+			continue;
+
+		/* Only services which have changed need to be serialized */
+		if (!service->hash_data) {
+			service_gen_hash(service);
+			db->hash_stats.services_hashed++;
+		}
+
+		db->hash_iov[n].iov_base = service->hash_data;
+		db->hash_iov[n].iov_len = service->hash_len;
+		n++;
+	}
 
-	gatt_db_foreach_service(db, NULL, service_gen_hash_m, &hash);
-	bt_crypto_gatt_hash(db->crypto, hash.iov, db->next_handle, db->hash);
+	bt_crypto_gatt_hash(db->crypto, db->hash_iov, n, db->hash);
 
-	for (i = 0; i < hash.i; i++)
-		free(hash.iov[i].iov_base);
+	elapsed = hash_time_usec() - start;
 
-	free(hash.iov);
+	db->hash_stats.updates++;
+	db->hash_stats.total_time += elapsed;
+	db->hash_stats.max_time = MAX(db->hash_stats.max_time, elapsed);
 
 	return false;
 }
 
+bool gatt_db_get_hash_stats(struct gatt_db *db,
+					struct gatt_db_hash_stats *stats)
+{
+	if (!db || !stats)
+		return false;
+
+	*stats = db->hash_stats;
+
+	return true;
+}
+
 static void handle_attribute_notify(void *data, void *user_data)
 {
 	struct attribute_notify *notify = data;
@@ -411,18 +621,105 @@ static void notify_service_changed(struct gatt_db *db,
 	gatt_db_unref(db);
 }
 
+static void gatt_db_service_get_handles(const struct gatt_db_service *service,
+							uint16_t *start_handle,
+							uint16_t *end_handle)
+{
+	if (start_handle)
+		*start_handle = service->attributes[0]->handle;
+
+	if (end_handle)
+		*end_handle = service->attributes[0]->handle +
+						service->num_handles - 1;
+}
+
+/*
+ * Returns the position of the first service in the index whose end handle is
+ * greater or equal than handle. Since services never overlap both start and
+ * end handles are in ascending order so a binary search can be used.
+ */
+static unsigned int index_lookup(struct gatt_db *db, uint16_t handle)
+{
+	unsigned int low = 0, high = db->index_len;
+
+	while (low < high) {
+		unsigned int mid = low + (high - low) / 2;
+		uint16_t end;
+
+		gatt_db_service_get_handles(db->index[mid], NULL, &end);
+
+		if (end < handle)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return low;
+}
+
+static bool index_insert(struct gatt_db *db, struct gatt_db_service *service)
+{
+	unsigned int pos;
+
+	if (db->index_len == db->index_size) {
+		struct gatt_db_service **index;
+		unsigned int size;
+
+		size = db->index_size ? db->index_size * 2 : 16;
+
+		index = realloc(db->index, size * sizeof(*index));
+		if (!index)
+			return false;
+
+		db->index = index;
+		db->index_size = size;
+	}
+
+	pos = index_lookup(db, service->attributes[0]->handle);
+
+	memmove(&db->index[pos + 1], &db->index[pos],
+				(db->index_len - pos) * sizeof(*db->index));
+	db->index[pos] = service;
+	db->index_len++;
+
+	return true;
+}
+
+static void index_remove(struct gatt_db *db, struct gatt_db_service *service)
+{
+	unsigned int pos;
+
+	if (!db || !db->index_len)
+		return;
+
+	pos = index_lookup(db, service->attributes[0]->handle);
+	if (pos >= db->index_len || db->index[pos] != service)
+		return;
+
+	db->index_len--;
+	memmove(&db->index[pos], &db->index[pos + 1],
+				(db->index_len - pos) * sizeof(*db->index));
+}
+
 static void gatt_db_service_destroy(void *data)
 {
 	struct gatt_db_service *service = data;
 	int i;
 
+	index_remove(service->db, service);
+
 	if (service->active)
 		notify_service_changed(service->db, service, false);
 
-	for (i = 0; i < service->num_handles; i++)
+	for (i = 0; i < service->num_handles; i++) {
+		if (service->db && service->attributes[i])
+			type_index_remove(service->db, service->attributes[i]);
+
 		attribute_destroy(service->attributes[i]);
+	}
 
 	free(service->attributes);
+	free(service->hash_data);
 	free(service);
 }
 
@@ -443,7 +740,14 @@ static void gatt_db_destroy(struct gatt_db *db)
 	if (db->hash_id)
 		timeout_remove(db->hash_id);
 
+	/* Drop the indexes upfront as all services are going away */
+	free(db->index);
+	db->index = NULL;
+	db->index_len = 0;
+	type_index_clear(db);
+
 	queue_destroy(db->services, gatt_db_service_destroy);
+	free(db->hash_iov);
 	free(db);
 }
 
@@ -561,18 +865,6 @@ bool gatt_db_clear(struct gatt_db *db)
 	return gatt_db_clear_range(db, 1, UINT16_MAX);
 }
 
-static void gatt_db_service_get_handles(const struct gatt_db_service *service,
-							uint16_t *start_handle,
-							uint16_t *end_handle)
-{
-	if (start_handle)
-		*start_handle = service->attributes[0]->handle;
-
-	if (end_handle)
-		*end_handle = service->attributes[0]->handle +
-						service->num_handles - 1;
-}
-
 struct clear_range {
 	uint16_t start, end;
 };
@@ -644,31 +936,24 @@ static struct gatt_db_service *find_insert_loc(struct gatt_db *db,
 						uint16_t start, uint16_t end,
 						struct gatt_db_service **after)
 {
-	const struct queue_entry *services_entry;
 	struct gatt_db_service *service;
-	uint16_t cur_start, cur_end;
+	unsigned int pos;
+	uint16_t cur_start;
 
-	*after = NULL;
+	pos = index_lookup(db, start);
 
-	services_entry = queue_get_entries(db->services);
+	*after = pos ? db->index[pos - 1] : NULL;
 
-	while (services_entry) {
-		service = services_entry->data;
-
-		gatt_db_service_get_handles(service, &cur_start, &cur_end);
-
-		if (start >= cur_start && start <= cur_end)
-			return service;
+	if (pos == db->index_len)
+		return NULL;
 
-		if (end >= cur_start && end <= cur_end)
-			return service;
+	service = db->index[pos];
 
-		if (end < cur_start)
-			return NULL;
+	gatt_db_service_get_handles(service, &cur_start, NULL);
 
-		*after = service;
-		services_entry = services_entry->next;
-	}
+	/* Check if the range overlaps with the service found */
+	if (end >= cur_start)
+		return service;
 
 	return NULL;
 }
@@ -720,6 +1005,15 @@ struct gatt_db_attribute *gatt_db_insert_service(struct gatt_db *db,
 	if (!service)
 		return NULL;
 
+	service->attributes[0]->handle = handle;
+	service->num_handles = num_handles;
+
+	if (!index_insert(db, service))
+		goto fail;
+
+	service->db = db;
+	type_index_add(db, service->attributes[0]);
+
 	if (after) {
 		if (!queue_push_after(db->services, after, service))
 			goto fail;
@@ -727,10 +1021,6 @@ struct gatt_db_attribute *gatt_db_insert_service(struct gatt_db *db,
 		goto fail;
 	}
 
-	service->db = db;
-	service->attributes[0]->handle = handle;
-	service->num_handles = num_handles;
-
 	/* Fast-forward next_handle if the new service was added to the end */
 	db->next_handle = MAX(handle + num_handles, db->next_handle);
 
@@ -808,6 +1098,16 @@ bool gatt_db_set_authorize(struct gatt_db *db, gatt_db_authorize_cb_t cb,
 	return true;
 }
 
+static void service_attribute_added(struct gatt_db_service *service,
+					struct gatt_db_attribute *attrib)
+{
+	type_index_add(service->db, attrib);
+
+	/* Service contents changed so its hash input must be regenerated */
+	free(service->hash_data);
+	service->hash_data = NULL;
+}
+
 static uint16_t get_attribute_index(struct gatt_db_service *service,
 							int end_offset)
 {
@@ -891,6 +1191,9 @@ service_insert_characteristic(struct gatt_db_service *service,
 	set_attribute_data(service->attributes[i], read_func, write_func,
 							permissions, user_data);
 
+	service_attribute_added(service, service->attributes[i - 1]);
+	service_attribute_added(service, service->attributes[i]);
+
 	return service->attributes[i];
 }
 
@@ -982,6 +1285,8 @@ service_insert_descriptor(struct gatt_db_service *service,
 	set_attribute_data(service->attributes[i], read_func, write_func,
 							permissions, user_data);
 
+	service_attribute_added(service, service->attributes[i]);
+
 	return service->attributes[i];
 }
 
@@ -1094,6 +1399,8 @@ service_insert_included(struct gatt_db_service *service, uint16_t handle,
 	set_attribute_data(service->attributes[index], NULL, NULL,
 					BT_ATT_PERM_READ, NULL);
 
+	service_attribute_added(service, service->attributes[index]);
+
 	return service->attributes[index];
 }
 
@@ -1177,11 +1484,49 @@ bool gatt_db_service_get_claimed(struct gatt_db_attribute *attrib)
 	return attrib->service->claimed;
 }
 
+/*
+ * Iterates over the active attributes of a given type within the handle range
+ * using the type index, so only attributes of the requested type are visited.
+ */
+static void foreach_type_in_range(struct gatt_db *db, const bt_uuid_t *uuid,
+						gatt_db_attribute_cb_t func,
+						void *user_data,
+						uint16_t start_handle,
+						uint16_t end_handle)
+{
+	struct attribute_type *type;
+	unsigned int pos;
+
+	if (!db || !func || start_handle > end_handle)
+		return;
+
+	type = type_index_find(db, uuid);
+	if (!type)
+		return;
+
+	for (pos = type_index_lookup(type, start_handle); pos < type->len;
+									pos++) {
+		struct gatt_db_attribute *attribute = type->attribs[pos];
+
+		if (attribute->handle > end_handle)
+			break;
+
+		if (!attribute->service->active)
+			continue;
+
+		func(attribute, user_data);
+	}
+}
+
 static void read_by_group_type(struct gatt_db_attribute *attribute,
 						void *user_data)
 {
 	struct queue *queue = user_data;
 
+	/* Only service declarations can be used as grouping attributes */
+	if (attribute != attribute->service->attributes[0])
+		return;
+
 	queue_push_tail(queue, attribute);
 }
 
@@ -1190,7 +1535,7 @@ void gatt_db_read_by_group_type(struct gatt_db *db, uint16_t start_handle,
 							const bt_uuid_t type,
 							struct queue *queue)
 {
-	gatt_db_foreach_service_in_range(db, &type, read_by_group_type, queue,
+	foreach_type_in_range(db, &type, read_by_group_type, queue,
 						start_handle, end_handle);
 }
 
@@ -1233,7 +1578,7 @@ unsigned int gatt_db_find_by_type(struct gatt_db *db, uint16_t start_handle,
 	data.func = func;
 	data.user_data = user_data;
 
-	gatt_db_foreach_in_range(db, type, find_by_type, &data,
+	foreach_type_in_range(db, type, find_by_type, &data,
 						start_handle, end_handle);
 
 	return data.num_of_res;
@@ -1250,12 +1595,14 @@ unsigned int gatt_db_find_by_type_value(struct gatt_db *db,
 {
 	struct find_by_type_value_data data;
 
+	memset(&data, 0, sizeof(data));
+
 	data.func = func;
 	data.user_data = user_data;
 	data.value = value;
 	data.value_len = value_len;
 
-	gatt_db_foreach_in_range(db, type, find_by_type, &data,
+	foreach_type_in_range(db, type, find_by_type, &data,
 						start_handle, end_handle);
 
 	return data.num_of_res;
@@ -1273,7 +1620,7 @@ void gatt_db_read_by_type(struct gatt_db *db, uint16_t start_handle,
 						const bt_uuid_t type,
 						struct queue *queue)
 {
-	gatt_db_foreach_in_range(db, &type, read_by_type, queue,
+	foreach_type_in_range(db, &type, read_by_type, queue,
 						start_handle, end_handle);
 }
 
@@ -1497,15 +1844,24 @@ void gatt_db_service_foreach_incl(struct gatt_db_attribute *attrib,
 								user_data);
 }
 
-static bool find_service_for_handle(const void *data, const void *user_data)
+static struct gatt_db_service *find_service_for_handle(struct gatt_db *db,
+							uint16_t handle)
 {
-	const struct gatt_db_service *service = data;
-	uint16_t handle = PTR_TO_UINT(user_data);
-	uint16_t start, end;
+	struct gatt_db_service *service;
+	unsigned int pos;
+	uint16_t start;
+
+	pos = index_lookup(db, handle);
+	if (pos == db->index_len)
+		return NULL;
+
+	service = db->index[pos];
 
-	gatt_db_service_get_handles(service, &start, &end);
+	gatt_db_service_get_handles(service, &start, NULL);
+	if (handle < start)
+		return NULL;
 
-	return (start <= handle) && (handle <= end);
+	return service;
 }
 
 struct gatt_db_attribute *gatt_db_get_service(struct gatt_db *db,
@@ -1516,8 +1872,7 @@ struct gatt_db_attribute *gatt_db_get_service(struct gatt_db *db,
 	if (!db || !handle)
 		return NULL;
 
-	service = queue_find(db->services, find_service_for_handle,
-						UINT_TO_PTR(handle));
+	service = find_service_for_handle(db, handle);
 	if (!service)
 		return NULL;
 
@@ -1527,16 +1882,50 @@ struct gatt_db_attribute *gatt_db_get_service(struct gatt_db *db,
 struct gatt_db_attribute *gatt_db_get_attribute(struct gatt_db *db,
 							uint16_t handle)
 {
-	struct gatt_db_attribute *attrib;
 	struct gatt_db_service *service;
-	int i;
+	struct gatt_db_attribute *attrib;
+	int i, low, high;
 
-	attrib = gatt_db_get_service(db, handle);
-	if (!attrib)
+	if (!db || !handle)
 		return NULL;
 
-	service = attrib->service;
+	service = find_service_for_handle(db, handle);
+	if (!service)
+		return NULL;
+
+	/* Fast path: attributes are usually allocated contiguously */
+	i = handle - service->attributes[0]->handle;
+	attrib = service->attributes[i];
+	if (attrib && attrib->handle == handle)
+		return attrib;
+
+	/*
+	 * Attributes are stored in ascending handle order but there may be
+	 * gaps (e.g. a partially discovered remote database) so fallback to a
+	 * binary search over the allocated attributes.
+	 */
+	low = 0;
+	high = get_attribute_index(service, 0);
+	if (!high)
+		high = service->num_handles;
+
+	while (low < high) {
+		int mid = low + (high - low) / 2;
+
+		attrib = service->attributes[mid];
+		if (!attrib)
+			break;
+
+		if (attrib->handle == handle)
+			return attrib;
+
+		if (attrib->handle < handle)
+			low = mid + 1;
+		else
+			high = mid;
+	}
 
+	/* Attributes inserted out of order, do a full search */
 	for (i = 0; i < service->num_handles; i++) {
 		if (!service->attributes[i])
 			continue;
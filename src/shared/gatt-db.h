@@ -31,6 +31,16 @@ bool gatt_db_clear_range(struct gatt_db *db, uint16_t start_handle,
 bool gatt_db_hash_support(struct gatt_db *db);
 uint8_t *gatt_db_get_hash(struct gatt_db *db);
 
+struct gatt_db_hash_stats {
+	unsigned int updates;		/* Number of hash calculations */
+	unsigned int services_hashed;	/* Services (re)serialized */
+	uint64_t total_time;		/* Time spent hashing in usec */
+	uint64_t max_time;		/* Longest hash calculation in usec */
+};
+
+bool gatt_db_get_hash_stats(struct gatt_db *db,
+					struct gatt_db_hash_stats *stats);
+
 struct gatt_db_attribute *gatt_db_insert_service(struct gatt_db *db,
 							uint16_t handle,
 							const bt_uuid_t *uuid,
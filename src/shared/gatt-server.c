@@ -39,8 +39,12 @@
  */
 #define DEFAULT_MAX_PREP_QUEUE_LEN 30
 
+/* Default window for coalescing notifications, in milliseconds */
 #define NFY_MULT_TIMEOUT 10
 
+/* Handle and length preceding each value in a multiple notification */
+#define NFY_MULT_HDR_LEN 4
+
 struct async_read_op {
 	struct bt_att_chan *chan;
 	struct bt_gatt_server *server;
@@ -81,6 +85,7 @@ struct nfy_mult_data {
 	uint8_t *pdu;
 	uint16_t offset;
 	uint16_t len;
+	unsigned int count;
 };
 
 struct bt_gatt_server {
@@ -119,8 +124,12 @@ struct bt_gatt_server {
 	void *authorize_data;
 
 	struct nfy_mult_data *nfy_mult;
+	unsigned int nfy_window;
+	struct bt_gatt_server_notify_stats nfy_stats;
 };
 
+static void notify_multiple_flush(struct bt_gatt_server *server);
+
 static void bt_gatt_server_free(struct bt_gatt_server *server)
 {
 	if (server->debug_destroy)
@@ -148,6 +157,12 @@ static void bt_gatt_server_free(struct bt_gatt_server *server)
 
 	queue_destroy(server->prep_queue, prep_write_data_destroy);
 
+	if (server->nfy_mult) {
+		notify_multiple_flush(server);
+		free(server->nfy_mult->pdu);
+		free(server->nfy_mult);
+	}
+
 	gatt_db_unref(server->db);
 	bt_att_unref(server->att);
 	free(server);
@@ -1663,6 +1678,7 @@ struct bt_gatt_server *bt_gatt_server_new(struct gatt_db *db,
 	server->max_prep_queue_len = DEFAULT_MAX_PREP_QUEUE_LEN;
 	server->prep_queue = queue_new();
 	server->min_enc_size = min_enc_size;
+	server->nfy_window = NFY_MULT_TIMEOUT;
 
 	if (!gatt_server_register_att_handlers(server)) {
 		bt_gatt_server_free(server);
@@ -1727,71 +1743,166 @@ bool bt_gatt_server_set_debug(struct bt_gatt_server *server,
 	return true;
 }
 
+static bool send_notification(struct bt_gatt_server *server, uint16_t handle,
+					const uint8_t *value, uint16_t length)
+{
+	uint8_t hdr[2];
+	struct iovec iov[2];
+
+	put_le16(handle, hdr);
+
+	/* The value is sent from the caller buffer, truncated to fit */
+	iov[0].iov_base = hdr;
+	iov[0].iov_len = sizeof(hdr);
+	iov[1].iov_base = (void *) value;
+	iov[1].iov_len = MIN(bt_att_get_mtu(server->att) - 3, length);
+
+	if (!bt_att_sendv(server->att, BT_ATT_OP_HANDLE_NFY, iov, 2,
+							NULL, NULL, NULL))
+		return false;
+
+	server->nfy_stats.pdus++;
+	server->nfy_stats.octets += 3 + iov[1].iov_len;
+
+	return true;
+}
+
+static void notify_multiple_flush(struct bt_gatt_server *server)
+{
+	struct nfy_mult_data *data = server->nfy_mult;
+
+	if (data->id) {
+		timeout_remove(data->id);
+		data->id = 0;
+	}
+
+	switch (data->count) {
+	case 0:
+		break;
+	case 1:
+		/* A single value is cheaper as a regular notification */
+		send_notification(server, get_le16(data->pdu),
+					data->pdu + NFY_MULT_HDR_LEN,
+					get_le16(data->pdu + 2));
+		break;
+	default:
+		if (!bt_att_send(server->att, BT_ATT_OP_HANDLE_NFY_MULT,
+					data->pdu, data->offset, NULL, NULL,
+					NULL))
+			break;
+
+		server->nfy_stats.pdus++;
+		server->nfy_stats.multiple_pdus++;
+		server->nfy_stats.octets += 1 + data->offset;
+		break;
+	}
+
+	data->offset = 0;
+	data->count = 0;
+}
+
 static bool notify_multiple(void *user_data)
 {
 	struct bt_gatt_server *server = user_data;
 
-	bt_att_send(server->att, BT_ATT_OP_HANDLE_NFY_MULT,
-			server->nfy_mult->pdu, server->nfy_mult->offset, NULL,
-			NULL, NULL);
-
-	free(server->nfy_mult->pdu);
-	free(server->nfy_mult);
-	server->nfy_mult = NULL;
+	server->nfy_mult->id = 0;
+	notify_multiple_flush(server);
 
 	return false;
 }
 
+static bool notify_multiple_add(struct bt_gatt_server *server,
+					uint16_t handle, const uint8_t *value,
+					uint16_t length)
+{
+	struct nfy_mult_data *data = server->nfy_mult;
+	uint16_t len = bt_att_get_mtu(server->att) - 1;
+
+	if (!data) {
+		data = new0(struct nfy_mult_data, 1);
+		server->nfy_mult = data;
+	}
+
+	/* The MTU may have grown since the buffer was allocated */
+	if (data->len < len) {
+		uint8_t *pdu = realloc(data->pdu, len);
+
+		if (!pdu)
+			return false;
+
+		data->pdu = pdu;
+		data->len = len;
+	}
+
+	if (data->offset + NFY_MULT_HDR_LEN + length > data->len)
+		notify_multiple_flush(server);
+
+	put_le16(handle, data->pdu + data->offset);
+	put_le16(length, data->pdu + data->offset + 2);
+	memcpy(data->pdu + data->offset + NFY_MULT_HDR_LEN, value, length);
+	data->offset += NFY_MULT_HDR_LEN + length;
+	data->count++;
+
+	/* Send right away once no other value would fit */
+	if (data->offset + NFY_MULT_HDR_LEN > data->len) {
+		notify_multiple_flush(server);
+		return true;
+	}
+
+	if (!data->id)
+		data->id = timeout_add(server->nfy_window, notify_multiple,
+								server, NULL);
+
+	return true;
+}
+
 bool bt_gatt_server_send_notification(struct bt_gatt_server *server,
 					uint16_t handle, const uint8_t *value,
 					uint16_t length, bool multiple)
 {
-	struct nfy_mult_data *data = NULL;
-	bool result;
-
 	if (!server || (length && !value))
 		return false;
 
-	if (multiple)
-		data = server->nfy_mult;
+	server->nfy_stats.notifications++;
 
-	if (!data) {
-		data = new0(struct nfy_mult_data, 1);
-		data->len = bt_att_get_mtu(server->att) - 1;
-		data->pdu = malloc(data->len);
-	}
+	/*
+	 * Values too long to be carried whole in a Multiple Handle Value
+	 * Notification are truncated like any other notification.
+	 */
+	if (multiple && server->nfy_window &&
+			NFY_MULT_HDR_LEN + length < bt_att_get_mtu(server->att))
+		return notify_multiple_add(server, handle, value, length);
 
-	put_le16(handle, data->pdu + data->offset);
-	data->offset += 2;
+	/* Keep notifications in the order they were handed in */
+	if (server->nfy_mult)
+		notify_multiple_flush(server);
 
-	length = MIN(data->len - data->offset, length);
+	return send_notification(server, handle, value, length);
+}
 
-	if (multiple) {
-		put_le16(length, data->pdu + data->offset);
-		data->offset += 2;
-	}
+bool bt_gatt_server_set_notify_window(struct bt_gatt_server *server,
+							unsigned int msec)
+{
+	if (!server)
+		return false;
 
-	memcpy(data->pdu + data->offset, value, length);
-	data->offset += length;
+	server->nfy_window = msec;
 
-	if (multiple) {
-		if (!server->nfy_mult)
-			server->nfy_mult = data;
+	if (!msec && server->nfy_mult)
+		notify_multiple_flush(server);
 
-		if (!server->nfy_mult->id)
-			server->nfy_mult->id = timeout_add(NFY_MULT_TIMEOUT,
-						   notify_multiple, server,
-						   NULL);
+	return true;
+}
 
-		return true;
-	}
+bool bt_gatt_server_get_notify_stats(struct bt_gatt_server *server,
+				struct bt_gatt_server_notify_stats *stats)
+{
+	if (!server || !stats)
+		return false;
 
-	result = !!bt_att_send(server->att, BT_ATT_OP_HANDLE_NFY,
-				data->pdu, data->offset, NULL, NULL, NULL);
-	free(data->pdu);
-	free(data);
+	*stats = server->nfy_stats;
 
-	return result;
+	return true;
 }
 
 struct ind_data {
@@ -1834,6 +1945,10 @@ bool bt_gatt_server_send_indication(struct bt_gatt_server *server,
 	if (!server || (length && !value))
 		return false;
 
+	/* Don't let the indication overtake notifications still batched */
+	if (server->nfy_mult)
+		notify_multiple_flush(server);
+
 	pdu_len = MIN(bt_att_get_mtu(server->att) - 1, length + 2);
 	pdu = malloc(pdu_len);
 	if (!pdu)
@@ -41,6 +41,18 @@ bool bt_gatt_server_send_notification(struct bt_gatt_server *server,
 					uint16_t handle, const uint8_t *value,
 					uint16_t length, bool multiple);
 
+struct bt_gatt_server_notify_stats {
+	unsigned int notifications;
+	unsigned int pdus;
+	unsigned int multiple_pdus;
+	unsigned long long octets;
+};
+
+bool bt_gatt_server_set_notify_window(struct bt_gatt_server *server,
+							unsigned int msec);
+bool bt_gatt_server_get_notify_stats(struct bt_gatt_server *server,
+				struct bt_gatt_server_notify_stats *stats);
+
 bool bt_gatt_server_send_indication(struct bt_gatt_server *server,
 					uint16_t handle, const uint8_t *value,
 					uint16_t length,
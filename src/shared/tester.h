@@ -17,6 +17,9 @@ int tester_run(void);
 
 bool tester_use_quiet(void);
 bool tester_use_debug(void);
+bool tester_use_benchmark(void);
+
+uint64_t tester_now_usec(void);
 
 void tester_print(const char *format, ...)
 				__attribute__((format(printf, 1, 2)));
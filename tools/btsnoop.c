@@ -15,117 +15,62 @@
 
 #define _GNU_SOURCE
 #include <stdio.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <unistd.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
 #include <getopt.h>
-#include <endian.h>
-#include <arpa/inet.h>
-#include <sys/stat.h>
 
 #include "src/shared/btsnoop.h"
 
-struct btsnoop_hdr {
-	uint8_t		id[8];		/* Identification Pattern */
-	uint32_t	version;	/* Version Number = 1 */
-	uint32_t	type;		/* Datalink Type */
-} __attribute__ ((packed));
-#define BTSNOOP_HDR_SIZE (sizeof(struct btsnoop_hdr))
-
-struct btsnoop_pkt {
-	uint32_t	size;		/* Original Length */
-	uint32_t	len;		/* Included Length */
-	uint32_t	flags;		/* Packet Flags */
-	uint32_t	drops;		/* Cumulative Drops */
-	uint64_t	ts;		/* Timestamp microseconds */
-	uint8_t		data[0];	/* Packet Data */
-} __attribute__ ((packed));
-#define BTSNOOP_PKT_SIZE (sizeof(struct btsnoop_pkt))
-
-static const uint8_t btsnoop_id[] = { 0x62, 0x74, 0x73, 0x6e,
-				      0x6f, 0x6f, 0x70, 0x00 };
-
-static const uint32_t btsnoop_version = 1;
-
-static int create_btsnoop(const char *path)
+static struct btsnoop *open_btsnoop(const char *path, uint32_t format)
 {
-	struct btsnoop_hdr hdr;
-	ssize_t written;
-	int fd;
+	struct btsnoop *btsnoop;
+	uint32_t type;
 
-	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
-				S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
-	if (fd < 0) {
-		perror("failed to output file");
-		return -1;
+	btsnoop = btsnoop_open(path, BTSNOOP_FLAG_MMAP);
+	if (!btsnoop) {
+		fprintf(stderr, "failed to open input file %s\n", path);
+		return NULL;
 	}
 
-	memcpy(hdr.id, btsnoop_id, sizeof(btsnoop_id));
-	hdr.version = htobe32(btsnoop_version);
-	hdr.type = htobe32(2001);
-
-	written = write(fd, &hdr, BTSNOOP_HDR_SIZE);
-	if (written < 0) {
-		perror("failed to write output header");
-		close(fd);
-		return -1;
+	type = btsnoop_get_format(btsnoop);
+	if (type != format) {
+		fprintf(stderr, "unsupported link data type %u\n", type);
+		btsnoop_unref(btsnoop);
+		return NULL;
 	}
 
-	return fd;
+	return btsnoop;
 }
 
-static int open_btsnoop(const char *path, uint32_t *type)
-{
-	struct btsnoop_hdr hdr;
-	ssize_t len;
-	int fd;
-
-	fd = open(path, O_RDONLY | O_CLOEXEC);
-	if (fd < 0) {
-		perror("failed to open input file");
-		return -1;
-	}
-
-	len = read(fd, &hdr, BTSNOOP_HDR_SIZE);
-	if (len < 0 || len != BTSNOOP_HDR_SIZE) {
-		perror("failed to read input header");
-		close(fd);
-		return -1;
-	}
+#define MAX_MERGE 8
 
-	if (memcmp(hdr.id, btsnoop_id, sizeof(btsnoop_id))) {
-		fprintf(stderr, "not a valid btsnoop header\n");
-		close(fd);
-		return -1;
-	}
+struct merge_input {
+	struct btsnoop *btsnoop;
+	struct timeval tv;
+	uint16_t opcode;
+	const void *data;
+	uint16_t size;
+};
 
-	if (be32toh(hdr.version) != btsnoop_version) {
-		fprintf(stderr, "invalid btsnoop version\n");
-		close(fd);
-		return -1;
-	}
+static void merge_next(struct merge_input *input)
+{
+	uint16_t index;
 
-	if (type)
-		*type = be32toh(hdr.type);
+	if (btsnoop_next_hci(input->btsnoop, &input->tv, &index,
+				&input->opcode, &input->data, &input->size))
+		return;
 
-	return fd;
+	btsnoop_unref(input->btsnoop);
+	input->btsnoop = NULL;
 }
 
-#define MAX_MERGE 8
-
 static void command_merge(const char *output, int argc, char *argv[])
 {
-	struct btsnoop_pkt input_pkt[MAX_MERGE];
-	unsigned char buf[2048];
-	int output_fd, input_fd[MAX_MERGE], num_input = 0;
-	int i, select_input;
-	ssize_t len, written;
-	uint32_t toread, flags;
-	uint16_t index, opcode;
+	struct merge_input input[MAX_MERGE];
+	struct btsnoop *output_file;
+	int i, num_input = 0;
 
 	if (argc > MAX_MERGE) {
 		fprintf(stderr, "only up to %d files allowed\n", MAX_MERGE);
@@ -133,21 +78,13 @@ static void command_merge(const char *output, int argc, char *argv[])
 	}
 
 	for (i = 0; i < argc; i++) {
-		uint32_t type;
-		int fd;
+		struct btsnoop *btsnoop;
 
-		fd = open_btsnoop(argv[i], &type);
-		if (fd < 0)
+		btsnoop = open_btsnoop(argv[i], BTSNOOP_FORMAT_UART);
+		if (!btsnoop)
 			break;
 
-		if (type != 1002) {
-			fprintf(stderr, "unsupported link data type %u\n",
-									type);
-			close(fd);
-			break;
-		}
-
-		input_fd[num_input++] = fd;
+		input[num_input++].btsnoop = btsnoop;
 	}
 
 	if (num_input != argc) {
@@ -155,347 +92,244 @@ static void command_merge(const char *output, int argc, char *argv[])
 		goto close_input;
 	}
 
-	output_fd = create_btsnoop(output);
-	if (output_fd < 0)
+	output_file = btsnoop_create(output, 0, 0, BTSNOOP_FORMAT_MONITOR);
+	if (!output_file) {
+		perror("failed to output file");
 		goto close_input;
-
-	for (i = 0; i < num_input; i++) {
-		len = read(input_fd[i], &input_pkt[i], BTSNOOP_PKT_SIZE);
-		if (len < 0 || len != BTSNOOP_PKT_SIZE) {
-			close(input_fd[i]);
-			input_fd[i] = -1;
-		}
 	}
 
-next_packet:
-	select_input = -1;
+	for (i = 0; i < num_input; i++)
+		merge_next(&input[i]);
 
-	for (i = 0; i < num_input; i++) {
-		uint64_t ts;
+	while (1) {
+		struct merge_input *next = NULL;
+		uint16_t index = 0;
 
-		if (input_fd[i] < 0)
-			continue;
+		for (i = 0; i < num_input; i++) {
+			if (!input[i].btsnoop)
+				continue;
 
-		if (select_input < 0) {
-			select_input = i;
-			continue;
+			if (!next || timercmp(&input[i].tv, &next->tv, <)) {
+				next = &input[i];
+				index = i;
+			}
 		}
 
-		ts = be64toh(input_pkt[i].ts);
-
-		if (ts < be64toh(input_pkt[select_input].ts))
-			select_input = i;
-	}
-
-	if (select_input < 0)
-		goto close_output;
-
-	toread = be32toh(input_pkt[select_input].size);
-	flags = be32toh(input_pkt[select_input].flags);
-
-	len = read(input_fd[select_input], buf, toread);
-	if (len < 0 || len != (ssize_t) toread) {
-		close(input_fd[select_input]);
-		input_fd[select_input] = -1;
-		goto next_packet;
-	}
-
-	written = htobe32(toread - 1);
-	input_pkt[select_input].size = written;
-	input_pkt[select_input].len = written;
-
-	switch (buf[0]) {
-	case 0x01:
-		opcode = BTSNOOP_OPCODE_COMMAND_PKT;
-		break;
-	case 0x02:
-		if (flags & 0x01)
-			opcode = BTSNOOP_OPCODE_ACL_RX_PKT;
-		else
-			opcode = BTSNOOP_OPCODE_ACL_TX_PKT;
-		break;
-	case 0x03:
-		if (flags & 0x01)
-			opcode = BTSNOOP_OPCODE_SCO_RX_PKT;
-		else
-			opcode = BTSNOOP_OPCODE_SCO_TX_PKT;
-		break;
-	case 0x04:
-		opcode = BTSNOOP_OPCODE_EVENT_PKT;
-		break;
-	default:
-		goto skip_write;
-	}
-
-	index = select_input;
-	input_pkt[select_input].flags = htobe32((index << 16) | opcode);
-
-	written = write(output_fd, &input_pkt[select_input], BTSNOOP_PKT_SIZE);
-	if (written != BTSNOOP_PKT_SIZE) {
-		fprintf(stderr, "write of packet header failed\n");
-		goto close_output;
-	}
+		if (!next)
+			break;
 
-	written = write(output_fd, buf + 1, toread - 1);
-	if (written != (ssize_t) toread - 1) {
-		fprintf(stderr, "write of packet data failed\n");
-		goto close_output;
-	}
+		/* Packets are only valid until the next read of their input */
+		if (next->opcode != 0xffff &&
+				!btsnoop_write_hci(output_file, &next->tv, index,
+							next->opcode, 0,
+							next->data, next->size)) {
+			fprintf(stderr, "write of packet failed\n");
+			break;
+		}
 
-skip_write:
-	len = read(input_fd[select_input],
-				&input_pkt[select_input], BTSNOOP_PKT_SIZE);
-	if (len < 0 || len != BTSNOOP_PKT_SIZE) {
-		close(input_fd[select_input]);
-		input_fd[select_input] = -1;
+		merge_next(next);
 	}
 
-	goto next_packet;
-
-close_output:
-	close(output_fd);
+	btsnoop_unref(output_file);
 
 close_input:
 	for (i = 0; i < num_input; i++)
-		close(input_fd[i]);
+		btsnoop_unref(input[i].btsnoop);
 }
 
 static void command_extract_eir(const char *input)
 {
-	struct btsnoop_pkt pkt;
-	unsigned char buf[2048];
-	ssize_t len;
-	uint32_t type, toread, flags;
-	uint16_t opcode;
-	int fd, count = 0;
-
-	fd = open_btsnoop(input, &type);
-	if (fd < 0)
+	struct btsnoop *btsnoop;
+	struct timeval tv;
+	uint16_t index, opcode, size;
+	const void *data;
+	int count = 0;
+
+	btsnoop = open_btsnoop(input, BTSNOOP_FORMAT_MONITOR);
+	if (!btsnoop)
 		return;
 
-	if (type != 2001) {
-		fprintf(stderr, "unsupported link data type %u\n", type);
-		close(fd);
-		return;
-	}
+	while (btsnoop_next_hci(btsnoop, &tv, &index, &opcode, &data, &size)) {
+		const uint8_t *buf = data;
 
-next_packet:
-	len = read(fd, &pkt, BTSNOOP_PKT_SIZE);
-	if (len < 0 || len != BTSNOOP_PKT_SIZE)
-		goto close_input;
+		switch (opcode) {
+		case BTSNOOP_OPCODE_EVENT_PKT:
+			/* extended inquiry result event */
+			if (size > 17 && buf[0] == 0x2f) {
+				const uint8_t *eir_ptr;
+				uint8_t eir_len, i;
 
-	toread = be32toh(pkt.size);
-	flags = be32toh(pkt.flags);
+				eir_len = buf[1] - 15;
+				eir_ptr = buf + 17;
 
-	opcode = flags & 0x00ff;
-
-	len = read(fd, buf, toread);
-	if (len < 0 || len != (ssize_t) toread) {
-		fprintf(stderr, "failed to read packet data\n");
-		goto close_input;
-	}
-
-	switch (opcode) {
-	case BTSNOOP_OPCODE_EVENT_PKT:
-		/* extended inquiry result event */
-		if (buf[0] == 0x2f) {
-			uint8_t *eir_ptr, eir_len, i;
-
-			eir_len = buf[1] - 15;
-			eir_ptr = buf + 17;
-
-			if (eir_len < 1 || eir_len > 240)
-				break;
+				if (eir_len < 1 || eir_len > 240 ||
+							17 + eir_len > size)
+					break;
 
-			printf("\t[Extended Inquiry Data with %u bytes]\n",
-								eir_len);
-			printf("\t\t");
-			for (i = 0; i < eir_len; i++) {
-				printf("0x%02x", eir_ptr[i]);
-				if (((i + 1) % 8) == 0) {
-					if (i < eir_len - 1)
-						printf(",\n\t\t");
-				} else {
-					if (i < eir_len - 1)
-						printf(", ");
+				printf("\t[Extended Inquiry Data with %u bytes]\n",
+									eir_len);
+				printf("\t\t");
+				for (i = 0; i < eir_len; i++) {
+					printf("0x%02x", eir_ptr[i]);
+					if (((i + 1) % 8) == 0) {
+						if (i < eir_len - 1)
+							printf(",\n\t\t");
+					} else {
+						if (i < eir_len - 1)
+							printf(", ");
+					}
 				}
-			}
-			printf("\n");
+				printf("\n");
 
-			count++;
+				count++;
+			}
+			break;
 		}
-		break;
 	}
 
-	goto next_packet;
-
-close_input:
-	close(fd);
+	btsnoop_unref(btsnoop);
 }
 
 static void command_extract_ad(const char *input)
 {
-	struct btsnoop_pkt pkt;
-	unsigned char buf[2048];
-	ssize_t len;
-	uint32_t type, toread, flags;
-	uint16_t opcode;
-	int fd, count = 0;
-
-	fd = open_btsnoop(input, &type);
-	if (fd < 0)
-		return;
-
-	if (type != 2001) {
-		fprintf(stderr, "unsupported link data type %u\n", type);
-		close(fd);
+	struct btsnoop *btsnoop;
+	struct timeval tv;
+	uint16_t index, opcode, size;
+	const void *data;
+	int count = 0;
+
+	btsnoop = open_btsnoop(input, BTSNOOP_FORMAT_MONITOR);
+	if (!btsnoop)
 		return;
-	}
-
-next_packet:
-	len = read(fd, &pkt, BTSNOOP_PKT_SIZE);
-	if (len < 0 || len != BTSNOOP_PKT_SIZE)
-		goto close_input;
-
-	toread = be32toh(pkt.size);
-	flags = be32toh(pkt.flags);
 
-	opcode = flags & 0x00ff;
+	while (btsnoop_next_hci(btsnoop, &tv, &index, &opcode, &data, &size)) {
+		const uint8_t *buf = data;
 
-	len = read(fd, buf, toread);
-	if (len < 0 || len != (ssize_t) toread) {
-		fprintf(stderr, "failed to read packet data\n");
-		goto close_input;
-	}
+		switch (opcode) {
+		case BTSNOOP_OPCODE_EVENT_PKT:
+			/* advertising report */
+			if (size > 13 && buf[0] == 0x3e && buf[2] == 0x02) {
+				const uint8_t *ad_ptr;
+				uint8_t ad_len, i;
 
-	switch (opcode) {
-	case BTSNOOP_OPCODE_EVENT_PKT:
-		/* advertising report */
-		if (buf[0] == 0x3e && buf[2] == 0x02) {
-			uint8_t *ad_ptr, ad_len, i;
+				ad_len = buf[12];
+				ad_ptr = buf + 13;
 
-			ad_len = buf[12];
-			ad_ptr = buf + 13;
-
-			if (ad_len < 1 || ad_len > 40)
-				break;
+				if (ad_len < 1 || ad_len > 40 ||
+							13 + ad_len > size)
+					break;
 
-			printf("\t[Advertising Data with %u bytes]\n", ad_len);
-			printf("\t\t");
-			for (i = 0; i < ad_len; i++) {
-				printf("0x%02x", ad_ptr[i]);
-				if (((i + 1) % 8) == 0) {
-					if (i < ad_len - 1)
-						printf(",\n\t\t");
-				} else {
-					if (i < ad_len - 1)
-						printf(", ");
+				printf("\t[Advertising Data with %u bytes]\n",
+									ad_len);
+				printf("\t\t");
+				for (i = 0; i < ad_len; i++) {
+					printf("0x%02x", ad_ptr[i]);
+					if (((i + 1) % 8) == 0) {
+						if (i < ad_len - 1)
+							printf(",\n\t\t");
+					} else {
+						if (i < ad_len - 1)
+							printf(", ");
+					}
 				}
-			}
-			printf("\n");
+				printf("\n");
 
-			count++;
+				count++;
+			}
+			break;
 		}
-		break;
 	}
 
-	goto next_packet;
-
-close_input:
-	close(fd);
+	btsnoop_unref(btsnoop);
 }
-static const uint8_t conn_complete[] = { 0x04, 0x03, 0x0B, 0x00 };
-static const uint8_t disc_complete[] = { 0x04, 0x05, 0x04, 0x00 };
+
+/* Event code, parameter length and success status */
+static const uint8_t conn_complete[] = { 0x03, 0x0B, 0x00 };
+static const uint8_t disc_complete[] = { 0x05, 0x04, 0x00 };
 
 static void command_extract_sdp(const char *input)
 {
-	struct btsnoop_pkt pkt;
-	unsigned char buf[2048];
-	ssize_t len;
-	uint32_t type, toread;
+	struct btsnoop *btsnoop;
+	struct timeval tv;
+	uint16_t index, opcode, size;
+	const void *data;
 	uint16_t current_cid = 0x0000;
 	uint8_t pdu_buf[512];
 	uint16_t pdu_len = 0;
 	bool pdu_first = false;
-	int fd, count = 0;
+	int count = 0;
 
-	fd = open_btsnoop(input, &type);
-	if (fd < 0)
+	btsnoop = open_btsnoop(input, BTSNOOP_FORMAT_UART);
+	if (!btsnoop)
 		return;
 
-	if (type != 1002) {
-		fprintf(stderr, "unsupported link data type %u\n", type);
-		close(fd);
-		return;
-	}
+	while (btsnoop_next_hci(btsnoop, &tv, &index, &opcode, &data, &size)) {
+		const uint8_t *buf = data;
 
-next_packet:
-	len = read(fd, &pkt, BTSNOOP_PKT_SIZE);
-	if (len < 0 || len != BTSNOOP_PKT_SIZE)
-		goto close_input;
-
-	toread = be32toh(pkt.size);
-
-	len = read(fd, buf, toread);
-	if (len < 0 || len != (ssize_t) toread) {
-		fprintf(stderr, "failed to read packet data\n");
-		goto close_input;
-	}
+		switch (opcode) {
+		case BTSNOOP_OPCODE_ACL_TX_PKT:
+		case BTSNOOP_OPCODE_ACL_RX_PKT:
+			if (size < 4)
+				break;
 
-	if (buf[0] == 0x02) {
-		uint8_t acl_flags;
-
-		/* first 4 bytes are handle and data len */
-		acl_flags = buf[2] >> 4;
-
-		/* use only packet with ACL start flag */
-		if (acl_flags & 0x02) {
-			if (current_cid == 0x0040 && pdu_len > 0) {
-				int i;
-				if (!pdu_first)
-					printf(",\n");
-				printf("\t\traw_pdu(");
-				for (i = 0; i < pdu_len; i++) {
-					printf("0x%02x", pdu_buf[i]);
-					if (((i + 1) % 8) == 0) {
-						if (i < pdu_len - 1)
-							printf(",\n\t\t\t");
-					} else {
-						if (i < pdu_len - 1)
-							printf(", ");
+			/* first 4 bytes are handle and data len, use only
+			 * packets with ACL start flag
+			 */
+			if ((buf[1] >> 4) & 0x02) {
+				if (current_cid == 0x0040 && pdu_len > 0) {
+					int i;
+					if (!pdu_first)
+						printf(",\n");
+					printf("\t\traw_pdu(");
+					for (i = 0; i < pdu_len; i++) {
+						printf("0x%02x", pdu_buf[i]);
+						if (((i + 1) % 8) == 0) {
+							if (i < pdu_len - 1)
+								printf(",\n\t\t\t");
+						} else {
+							if (i < pdu_len - 1)
+								printf(", ");
+						}
 					}
+					printf(")");
+					pdu_first = false;
 				}
-				printf(")");
-				pdu_first = false;
-			}
 
-			/* next 4 bytes are data len and cid */
-			current_cid = buf[8] << 8 | buf[7];
-			memcpy(pdu_buf, buf + 9, len - 9);
-			pdu_len = len - 9;
-		} else if (acl_flags & 0x01) {
-			memcpy(pdu_buf + pdu_len, buf + 5, len - 5);
-			pdu_len += len - 5;
-		}
-	}
+				pdu_len = 0;
 
-	if ((size_t) len > sizeof(conn_complete)) {
-		if (memcmp(buf, conn_complete, sizeof(conn_complete)) == 0) {
-			printf("\tdefine_test(\"/test/%u\",\n", ++count);
-			pdu_first = true;
-		}
-	}
+				if (size < 8 || size > sizeof(pdu_buf) + 8)
+					break;
 
-	if ((size_t) len > sizeof(disc_complete)) {
-		if (memcmp(buf, disc_complete, sizeof(disc_complete)) == 0) {
-			printf(");\n");
+				/* next 4 bytes are data len and cid */
+				current_cid = buf[7] << 8 | buf[6];
+				memcpy(pdu_buf, buf + 8, size - 8);
+				pdu_len = size - 8;
+			} else if ((buf[1] >> 4) & 0x01) {
+				if (pdu_len + size > sizeof(pdu_buf) + 4)
+					break;
+
+				memcpy(pdu_buf + pdu_len, buf + 4, size - 4);
+				pdu_len += size - 4;
+			}
+			break;
+
+		case BTSNOOP_OPCODE_EVENT_PKT:
+			if (size > sizeof(conn_complete) &&
+					!memcmp(buf, conn_complete,
+						sizeof(conn_complete))) {
+				printf("\tdefine_test(\"/test/%u\",\n", ++count);
+				pdu_first = true;
+			}
+
+			if (size > sizeof(disc_complete) &&
+					!memcmp(buf, disc_complete,
+						sizeof(disc_complete)))
+				printf(");\n");
+			break;
 		}
 	}
 
-	goto next_packet;
-
-close_input:
-	close(fd);
+	btsnoop_unref(btsnoop);
 }
 
 static void usage(void)
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: BSD-2-Clause
+#
+# Copyright (C) 2026  agent <agent@local>
+#
+# Generates src/shared/ecc-table.h, the fixed-base table used by
+# ecc_point_mult_base(), from the P-256 base point:
+#
+#   tools/gen-ecc-table.py > src/shared/ecc-table.h
+
+P = 0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+A = P - 3
+G = (0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+     0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5)
+
+WINDOW_BITS = 4
+WINDOWS = 256 // WINDOW_BITS
+ROW_SIZE = (1 << WINDOW_BITS) - 1
+
+
+def point_add(p, q):
+    if p is None:
+        return q
+    if q is None:
+        return p
+
+    if p[0] == q[0]:
+        if (p[1] + q[1]) % P == 0:
+            return None
+        m = (3 * p[0] * p[0] + A) * pow(2 * p[1], P - 2, P)
+    else:
+        m = (q[1] - p[1]) * pow(q[0] - p[0], P - 2, P)
+
+    x = (m * m - p[0] - q[0]) % P
+    y = (m * (p[0] - x) - p[1]) % P
+
+    return (x, y)
+
+
+def digits(v):
+    return ['0x%016Xull' % ((v >> (64 * i)) & (2 ** 64 - 1))
+            for i in range(4)]
+
+
+def print_point(point):
+    x = digits(point[0])
+    y = digits(point[1])
+
+    print('\t\t{ { %s, %s,' % (x[0], x[1]))
+    print('\t\t    %s, %s },' % (x[2], x[3]))
+    print('\t\t  { %s, %s,' % (y[0], y[1]))
+    print('\t\t    %s, %s } },' % (y[2], y[3]))
+
+
+print('/* SPDX-License-Identifier: BSD-2-Clause */')
+print('/*')
+print(' * Copyright (C) 2026  agent <agent@local>')
+print(' *')
+print(' */')
+print()
+print('/* Fixed-base table for ecc_point_mult_base(). Entry [i][j] is the '
+      'affine')
+print(' * point (j + 1) * 16^i * G, with coordinates as little endian 64-bit '
+      'digits.')
+print(' * Generated by tools/gen-ecc-table.py, do not edit.')
+print(' */')
+print('static const struct ecc_point '
+      'base_table[BASE_WINDOWS][BASE_ROW_SIZE] = {')
+
+base = G
+
+for i in range(WINDOWS):
+    print('\t{\t/* 16^%d * G */' % i)
+
+    point = None
+
+    for j in range(ROW_SIZE):
+        point = point_add(point, base)
+        print_point(point)
+
+    print('\t},')
+
+    # 16^(i + 1) * G is the last entry of the row plus one more 16^i * G
+    base = point_add(point, base)
+
+print('};')
@@ -0,0 +1,312 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <glib.h>
+
+#include "src/shared/ad.h"
+#include "src/shared/queue.h"
+#include "src/shared/util.h"
+#include "src/shared/tester.h"
+
+#define NUM_MONITORS 200
+#define NUM_REPORTS 2000
+#define BENCH_ROUNDS 20
+#define REPORT_MAX_LEN 64
+
+struct match_data {
+	struct queue *matched;
+};
+
+static void collect_match(void *data, void *user_data)
+{
+	struct match_data *match = user_data;
+
+	queue_push_tail(match->matched, data);
+}
+
+static void pattern_free(void *data)
+{
+	free(data);
+}
+
+static struct queue *new_patterns(uint8_t type, uint8_t offset,
+					const uint8_t *data, uint8_t len)
+{
+	struct queue *patterns = queue_new();
+
+	queue_push_tail(patterns, bt_ad_pattern_new(type, offset, len, data));
+
+	return patterns;
+}
+
+static void test_matcher(gconstpointer data)
+{
+	static const uint8_t name[] = { 'b', 'l', 'u', 'e', 'z' };
+	static const uint8_t uuid[] = { 0x0d, 0x18 };
+	static const uint8_t adv[] = {
+			0x02, 0x01, 0x06,
+			0x03, 0x02, 0x0d, 0x18,
+			0x06, 0x09, 'b', 'l', 'u', 'e', 'z',
+			0x06, 0xff, 0x4c, 0x00, 0x02, 0x15, 0x00 };
+	/* Only the last Complete Local Name is kept */
+	static const uint8_t adv_repeated[] = {
+			0x06, 0x09, 'b', 'l', 'u', 'e', 'z',
+			0x03, 0x09, 'b', 'l' };
+	/* Repeating a field with the same value is invalid */
+	static const uint8_t adv_invalid[] = {
+			0x03, 0x02, 0x0d, 0x18,
+			0x03, 0x02, 0x0d, 0x18 };
+	const uint8_t msd[] = { 0x4c, 0x00, 0x02, 0x15, 0x00 };
+	struct queue *name_patterns, *uuid_patterns, *msd_patterns;
+	struct queue *or_patterns;
+	struct bt_ad_matcher *matcher;
+	struct match_data match;
+
+	name_patterns = new_patterns(BT_AD_NAME_COMPLETE, 0, name,
+								sizeof(name));
+	uuid_patterns = new_patterns(BT_AD_UUID16_SOME, 0, uuid,
+								sizeof(uuid));
+	msd_patterns = new_patterns(BT_AD_MANUFACTURER_DATA, 0, msd,
+								sizeof(msd));
+
+	or_patterns = new_patterns(BT_AD_MANUFACTURER_DATA, 0, msd,
+								sizeof(msd));
+	queue_push_tail(or_patterns, bt_ad_pattern_new(BT_AD_NAME_COMPLETE, 1,
+								3, name + 1));
+
+	matcher = bt_ad_matcher_new();
+	g_assert(matcher);
+
+	g_assert(!bt_ad_matcher_add(matcher, NULL, NULL));
+	g_assert(bt_ad_matcher_add(matcher, name_patterns, name_patterns));
+	g_assert(bt_ad_matcher_add(matcher, msd_patterns, msd_patterns));
+	g_assert(bt_ad_matcher_add(matcher, uuid_patterns, uuid_patterns));
+	g_assert(bt_ad_matcher_add(matcher, or_patterns, or_patterns));
+
+	match.matched = queue_new();
+
+	/* Matched once each, in the order they were added */
+	g_assert(bt_ad_matcher_match(matcher, adv, sizeof(adv), collect_match,
+								&match));
+	g_assert_cmpuint(queue_length(match.matched), ==, 4);
+	g_assert(queue_pop_head(match.matched) == name_patterns);
+	g_assert(queue_pop_head(match.matched) == msd_patterns);
+	g_assert(queue_pop_head(match.matched) == uuid_patterns);
+	g_assert(queue_pop_head(match.matched) == or_patterns);
+
+	g_assert(!bt_ad_matcher_match(matcher, adv_repeated,
+					sizeof(adv_repeated), collect_match,
+					&match));
+	g_assert(queue_isempty(match.matched));
+
+	g_assert(!bt_ad_matcher_match(matcher, adv_invalid,
+					sizeof(adv_invalid), collect_match,
+					&match));
+	g_assert(!bt_ad_matcher_match(matcher, adv, 0, collect_match, &match));
+	g_assert(queue_isempty(match.matched));
+
+	queue_destroy(match.matched, NULL);
+	bt_ad_matcher_free(matcher);
+
+	queue_destroy(name_patterns, pattern_free);
+	queue_destroy(uuid_patterns, pattern_free);
+	queue_destroy(msd_patterns, pattern_free);
+	queue_destroy(or_patterns, pattern_free);
+
+	tester_test_passed();
+}
+
+static const uint8_t random_types[] = {
+	BT_AD_UUID16_SOME, BT_AD_NAME_SHORT, BT_AD_NAME_COMPLETE,
+	BT_AD_SERVICE_DATA16, BT_AD_MANUFACTURER_DATA,
+};
+
+static struct queue *monitors[NUM_MONITORS];
+static uint8_t reports[NUM_REPORTS][REPORT_MAX_LEN];
+static size_t lens[NUM_REPORTS];
+
+static struct queue *random_patterns(void)
+{
+	struct queue *patterns = queue_new();
+	int i, num = 1 + rand() % 3;
+
+	for (i = 0; i < num; i++) {
+		uint8_t data[4];
+		size_t j, len = 1 + rand() % sizeof(data);
+
+		/* Keep the alphabet small so reports do match some monitors */
+		for (j = 0; j < len; j++)
+			data[j] = rand() % 4;
+
+		queue_push_tail(patterns, bt_ad_pattern_new(
+				random_types[rand() % sizeof(random_types)],
+				rand() % 3, len, data));
+	}
+
+	return patterns;
+}
+
+static size_t random_report(uint8_t *report)
+{
+	size_t len = 0;
+	unsigned int i;
+
+	for (i = 0; i < sizeof(random_types); i++) {
+		size_t j, field_len = 2 + rand() % 6;
+
+		report[len++] = field_len + 1;
+		report[len++] = random_types[i];
+
+		for (j = 0; j < field_len; j++)
+			report[len++] = rand() % 4;
+	}
+
+	return len;
+}
+
+/* Fills monitors and reports with the same random set on every call */
+static struct bt_ad_matcher *random_matcher_new(unsigned int *num_patterns)
+{
+	struct bt_ad_matcher *matcher;
+	int i;
+
+	srand(0);
+
+	matcher = bt_ad_matcher_new();
+	*num_patterns = 0;
+
+	for (i = 0; i < NUM_MONITORS; i++) {
+		monitors[i] = random_patterns();
+		*num_patterns += queue_length(monitors[i]);
+		g_assert(bt_ad_matcher_add(matcher, monitors[i], monitors[i]));
+	}
+
+	for (i = 0; i < NUM_REPORTS; i++)
+		lens[i] = random_report(reports[i]);
+
+	return matcher;
+}
+
+static void random_matcher_free(struct bt_ad_matcher *matcher)
+{
+	int i;
+
+	bt_ad_matcher_free(matcher);
+
+	for (i = 0; i < NUM_MONITORS; i++)
+		queue_destroy(monitors[i], pattern_free);
+}
+
+/* Both must agree on which monitors match every report */
+static void test_cross_check(gconstpointer data)
+{
+	struct bt_ad_matcher *matcher;
+	unsigned int num_patterns;
+	int i, j;
+
+	matcher = random_matcher_new(&num_patterns);
+
+	for (i = 0; i < NUM_REPORTS; i++) {
+		struct match_data match = { .matched = queue_new() };
+
+		bt_ad_matcher_match(matcher, reports[i], lens[i],
+						collect_match, &match);
+
+		for (j = 0; j < NUM_MONITORS; j++) {
+			if (!bt_ad_pattern_match_data(reports[i], lens[i],
+								monitors[j]))
+				continue;
+
+			g_assert(queue_pop_head(match.matched) == monitors[j]);
+		}
+
+		g_assert(queue_isempty(match.matched));
+		queue_destroy(match.matched, NULL);
+	}
+
+	random_matcher_free(matcher);
+
+	tester_test_passed();
+}
+
+static void count_match(void *data, void *user_data)
+{
+	unsigned int *count = user_data;
+
+	(*count)++;
+}
+
+static void test_benchmark(gconstpointer data)
+{
+	struct bt_ad_matcher *matcher;
+	unsigned int linear_count = 0, compiled_count = 0, num_patterns;
+	uint64_t start, linear, compiled;
+	int num_reports = NUM_REPORTS * BENCH_ROUNDS;
+	int i, j, round;
+
+	matcher = random_matcher_new(&num_patterns);
+
+	start = tester_now_usec();
+
+	for (round = 0; round < BENCH_ROUNDS; round++) {
+		for (i = 0; i < NUM_REPORTS; i++) {
+			for (j = 0; j < NUM_MONITORS; j++)
+				linear_count += !!bt_ad_pattern_match_data(
+							reports[i], lens[i],
+							monitors[j]);
+		}
+	}
+
+	linear = tester_now_usec() - start + 1;
+
+	start = tester_now_usec();
+
+	for (round = 0; round < BENCH_ROUNDS; round++) {
+		for (i = 0; i < NUM_REPORTS; i++)
+			bt_ad_matcher_match(matcher, reports[i], lens[i],
+						count_match, &compiled_count);
+	}
+
+	compiled = tester_now_usec() - start + 1;
+
+	g_assert_cmpuint(linear_count, ==, compiled_count);
+
+	tester_print("%d reports against %u patterns in %d monitors: "
+				"linear %" PRIu64 " reports/sec, "
+				"compiled %" PRIu64 " reports/sec",
+				num_reports, num_patterns, NUM_MONITORS,
+				num_reports * UINT64_C(1000000) / linear,
+				num_reports * UINT64_C(1000000) / compiled);
+
+	random_matcher_free(matcher);
+
+	tester_test_passed();
+}
+
+int main(int argc, char *argv[])
+{
+	tester_init(&argc, &argv);
+
+	tester_add("/ad/matcher", NULL, NULL, test_matcher, NULL);
+	tester_add("/ad/matcher/cross-check", NULL, NULL, test_cross_check,
+									NULL);
+
+	if (tester_use_benchmark())
+		tester_add("/ad/benchmark", NULL, NULL, test_benchmark, NULL);
+
+	return tester_run();
+}
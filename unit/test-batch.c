@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/socket.h>
+
+#include <glib.h>
+
+#include "src/shared/util.h"
+#include "src/shared/io.h"
+#include "src/shared/timeout.h"
+#include "src/shared/batch.h"
+#include "src/shared/tester.h"
+
+#define BATCH_MTU		4096
+#define BATCH_INTERVAL		20
+#define RECORD_LEN		100
+
+struct context {
+	struct batch *batch;
+	struct io *io;
+	int fd;
+	unsigned int records;
+	unsigned int received;
+	unsigned int timeout_id;
+};
+
+static struct context *create_context(void)
+{
+	struct context *context = g_new0(struct context, 1);
+	int sv[2];
+
+	g_assert(!socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK |
+						SOCK_CLOEXEC, 0, sv));
+
+	context->batch = batch_new(sv[0], BATCH_MTU, BATCH_INTERVAL);
+	g_assert(context->batch);
+
+	context->fd = sv[1];
+
+	return context;
+}
+
+static void destroy_context(struct context *context)
+{
+	timeout_remove(context->timeout_id);
+	io_destroy(context->io);
+	batch_free(context->batch);
+
+	if (context->fd >= 0)
+		close(context->fd);
+
+	g_free(context);
+}
+
+/* Appends records until one no longer fits, forcing the batch out */
+static unsigned int fill_batch(struct context *context)
+{
+	uint8_t record[RECORD_LEN];
+	struct iovec iov;
+	unsigned int i, count = BATCH_MTU / RECORD_LEN + 1;
+
+	iov.iov_base = record;
+	iov.iov_len = sizeof(record);
+
+	for (i = 0; i < count; i++) {
+		memset(record, context->records++, sizeof(record));
+		g_assert(batch_append(context->batch, &iov, 1));
+	}
+
+	return count;
+}
+
+static void check_records(struct context *context, const uint8_t *buf,
+								ssize_t len)
+{
+	ssize_t i;
+
+	g_assert(len > 0);
+	g_assert_cmpint(len % RECORD_LEN, ==, 0);
+
+	for (i = 0; i < len; i += RECORD_LEN) {
+		g_assert_cmpint(buf[i], ==, context->received & 0xff);
+		g_assert_cmpint(buf[i + RECORD_LEN - 1], ==,
+						context->received & 0xff);
+		context->received++;
+	}
+}
+
+static bool full_read(struct io *io, void *user_data)
+{
+	struct context *context = user_data;
+	uint8_t buf[BATCH_MTU];
+	ssize_t len;
+
+	len = read(context->fd, buf, sizeof(buf));
+	check_records(context, buf, len);
+
+	/* Only the record that did not fit is left for the interval */
+	g_assert_cmpint(len, ==, RECORD_LEN);
+	g_assert_cmpuint(context->received, ==, context->records);
+	g_assert_cmpuint(batch_get_dropped(context->batch), ==, 0);
+
+	destroy_context(context);
+	tester_test_passed();
+
+	return false;
+}
+
+static void test_full(const void *user_data)
+{
+	struct context *context = create_context();
+	uint8_t buf[BATCH_MTU];
+	ssize_t len;
+
+	fill_batch(context);
+
+	/* The full batch is sent right away */
+	len = read(context->fd, buf, sizeof(buf));
+	check_records(context, buf, len);
+	g_assert_cmpint(len, ==, BATCH_MTU / RECORD_LEN * RECORD_LEN);
+
+	/* The rest only once the interval expires */
+	g_assert_cmpint(read(context->fd, buf, sizeof(buf)), <, 0);
+	g_assert_cmpint(errno, ==, EAGAIN);
+
+	context->io = io_new(context->fd);
+	io_set_read_handler(context->io, full_read, context, NULL);
+}
+
+static bool hangup_done(void *user_data)
+{
+	struct context *context = user_data;
+
+	context->timeout_id = 0;
+
+	/* Nothing may have fired for the batch freed on hangup */
+	g_assert(!context->batch);
+
+	destroy_context(context);
+	tester_test_passed();
+
+	return false;
+}
+
+static void hangup_disconnect(void *user_data)
+{
+	struct context *context = user_data;
+
+	batch_free(context->batch);
+	context->batch = NULL;
+
+	context->timeout_id = timeout_add(BATCH_INTERVAL * 3, hangup_done,
+								context, NULL);
+}
+
+/*
+ * The batch is freed from its disconnect handler while the flush of a
+ * partial batch is pending, which is how bluetoothd releases the reports
+ * of a client closing its end.
+ */
+static void test_hangup(const void *user_data)
+{
+	struct context *context = create_context();
+
+	batch_set_disconnect_handler(context->batch, hangup_disconnect,
+								context, NULL);
+
+	fill_batch(context);
+
+	close(context->fd);
+	context->fd = -1;
+}
+
+int main(int argc, char *argv[])
+{
+	tester_init(&argc, &argv);
+
+	tester_add("/batch/full", NULL, NULL, test_full, NULL);
+	tester_add("/batch/hangup", NULL, NULL, test_hangup, NULL);
+
+	return tester_run();
+}
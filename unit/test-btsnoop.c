@@ -0,0 +1,515 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <endian.h>
+#include <inttypes.h>
+
+#include <glib.h>
+
+#include "src/shared/btsnoop.h"
+#include "src/shared/tester.h"
+
+#define TRACE_PACKETS		1000
+
+/* Size of the mixed trace in KiB, benchmarks take BTSNOOP_BENCH_MB */
+#define BENCH_DEFAULT_KB	256
+
+static const bool timed = true;
+
+struct trace_test {
+	unsigned long flags;
+	bool zero_copy;
+};
+
+static const struct trace_test copy_buffered = {
+	.flags = 0,
+	.zero_copy = false,
+};
+
+static const struct trace_test copy_mapped = {
+	.flags = BTSNOOP_FLAG_MMAP,
+	.zero_copy = false,
+};
+
+static const struct trace_test next_buffered = {
+	.flags = 0,
+	.zero_copy = true,
+};
+
+static const struct trace_test next_mapped = {
+	.flags = BTSNOOP_FLAG_MMAP,
+	.zero_copy = true,
+};
+
+static char *trace_path(void)
+{
+	char *path = strdup("/tmp/test-btsnoop-XXXXXX");
+	int fd;
+
+	fd = mkstemp(path);
+	if (fd < 0) {
+		free(path);
+		return NULL;
+	}
+
+	close(fd);
+
+	return path;
+}
+
+static uint16_t pkt_size(unsigned int i)
+{
+	return (i * 97) % (BTSNOOP_MAX_PACKET_SIZE + 1);
+}
+
+static void pkt_fill(uint8_t *buf, unsigned int i, uint16_t size)
+{
+	uint16_t n;
+
+	for (n = 0; n < size; n++)
+		buf[n] = i + n;
+}
+
+static uint16_t pkt_opcode(unsigned int i)
+{
+	return BTSNOOP_OPCODE_COMMAND_PKT + i % 6;
+}
+
+static bool trace_read(struct btsnoop *btsnoop, const struct trace_test *test,
+					struct timeval *tv, uint16_t *index,
+					uint16_t *opcode, const void **data,
+					uint16_t *size)
+{
+	static uint8_t buf[BTSNOOP_MAX_PACKET_SIZE];
+
+	if (test->zero_copy)
+		return btsnoop_next_hci(btsnoop, tv, index, opcode, data, size);
+
+	*data = buf;
+
+	return btsnoop_read_hci(btsnoop, tv, index, opcode, buf, size);
+}
+
+static void write_monitor_trace(const char *path, unsigned int count)
+{
+	struct btsnoop *btsnoop;
+	uint8_t buf[BTSNOOP_MAX_PACKET_SIZE];
+	unsigned int i;
+
+	btsnoop = btsnoop_create(path, 0, 0, BTSNOOP_FORMAT_MONITOR);
+
+	for (i = 0; i < count; i++) {
+		struct timeval tv = { .tv_sec = 1000000000 + i,
+						.tv_usec = i % 1000000 };
+
+		pkt_fill(buf, i, pkt_size(i));
+		btsnoop_write_hci(btsnoop, &tv, i % 3, pkt_opcode(i), 0, buf,
+								pkt_size(i));
+	}
+
+	btsnoop_unref(btsnoop);
+}
+
+static void test_monitor(const void *data)
+{
+	const struct trace_test *test = data;
+	uint8_t expect[BTSNOOP_MAX_PACKET_SIZE];
+	struct btsnoop *btsnoop;
+	struct timeval tv;
+	uint16_t index, opcode, size;
+	const void *pkt;
+	unsigned int i = 0;
+	char *path;
+
+	path = trace_path();
+	write_monitor_trace(path, TRACE_PACKETS);
+
+	btsnoop = btsnoop_open(path, test->flags);
+	g_assert(btsnoop);
+	g_assert(btsnoop_get_format(btsnoop) == BTSNOOP_FORMAT_MONITOR);
+
+	while (trace_read(btsnoop, test, &tv, &index, &opcode, &pkt, &size)) {
+		g_assert(tv.tv_sec == 1000000000 + i);
+		g_assert(tv.tv_usec == (suseconds_t) (i % 1000000));
+		g_assert(index == i % 3);
+		g_assert(opcode == pkt_opcode(i));
+		g_assert(size == pkt_size(i));
+
+		pkt_fill(expect, i, size);
+		g_assert(!memcmp(pkt, expect, size));
+
+		i++;
+	}
+
+	g_assert(i == TRACE_PACKETS);
+
+	btsnoop_unref(btsnoop);
+	unlink(path);
+	free(path);
+
+	tester_test_passed();
+}
+
+static void test_uart(const void *data)
+{
+	const struct trace_test *test = data;
+	static const uint8_t cmd[] = { 0x01, 0x03, 0x0c, 0x00 };
+	static const uint8_t evt[] = { 0x04, 0x0e, 0x04, 0x01, 0x03, 0x0c,
+									0x00 };
+	static const uint8_t acl[] = { 0x02, 0x01, 0x20, 0x01, 0x00, 0xaa };
+	struct timeval tv = { .tv_sec = 1000000000 };
+	struct btsnoop *btsnoop;
+	uint16_t index, opcode, size;
+	const void *pkt;
+	char *path;
+
+	path = trace_path();
+
+	btsnoop = btsnoop_create(path, 0, 0, BTSNOOP_FORMAT_UART);
+	btsnoop_write(btsnoop, &tv, 0x02, 0, cmd, sizeof(cmd));
+	btsnoop_write(btsnoop, &tv, 0x03, 0, evt, sizeof(evt));
+	btsnoop_write(btsnoop, &tv, 0x01, 0, acl, sizeof(acl));
+	btsnoop_unref(btsnoop);
+
+	btsnoop = btsnoop_open(path, test->flags);
+	g_assert(btsnoop);
+
+	/* The packet type indicator is not part of the returned data */
+	g_assert(trace_read(btsnoop, test, &tv, &index, &opcode, &pkt, &size));
+	g_assert(opcode == BTSNOOP_OPCODE_COMMAND_PKT);
+	g_assert(size == sizeof(cmd) - 1 && !memcmp(pkt, cmd + 1, size));
+
+	g_assert(trace_read(btsnoop, test, &tv, &index, &opcode, &pkt, &size));
+	g_assert(opcode == BTSNOOP_OPCODE_EVENT_PKT);
+	g_assert(size == sizeof(evt) - 1 && !memcmp(pkt, evt + 1, size));
+
+	g_assert(trace_read(btsnoop, test, &tv, &index, &opcode, &pkt, &size));
+	g_assert(opcode == BTSNOOP_OPCODE_ACL_RX_PKT);
+	g_assert(size == sizeof(acl) - 1 && !memcmp(pkt, acl + 1, size));
+
+	g_assert(!trace_read(btsnoop, test, &tv, &index, &opcode, &pkt,
+									&size));
+
+	btsnoop_unref(btsnoop);
+	unlink(path);
+	free(path);
+
+	tester_test_passed();
+}
+
+static void test_pklg(const void *data)
+{
+	const struct trace_test *test = data;
+	static const uint8_t evt[] = { 0x0e, 0x04, 0x01, 0x03, 0x0c, 0x00 };
+	static const uint8_t note[] = { 'h', 'e', 'l', 'l', 'o' };
+	const uint8_t *payload[] = { evt, note };
+	size_t len[] = { sizeof(evt), sizeof(note) };
+	uint8_t type[] = { 0x01, 0xfc };
+	struct btsnoop *btsnoop;
+	struct timeval tv;
+	uint16_t index, opcode, size;
+	const void *pkt;
+	unsigned int i;
+	char *path;
+	int fd;
+
+	path = trace_path();
+
+	fd = open(path, O_WRONLY | O_TRUNC);
+	g_assert(fd >= 0);
+
+	/* Version 1 of the Apple Packet Logger format is big endian */
+	for (i = 0; i < 2; i++) {
+		uint8_t hdr[13];
+		uint32_t pkt_len = htobe32(9 + len[i]);
+		uint64_t ts = htobe64(((uint64_t) 1234 << 32) | (i * 1000));
+
+		memcpy(hdr, &pkt_len, 4);
+		memcpy(hdr + 4, &ts, 8);
+		hdr[12] = type[i];
+
+		g_assert(write(fd, hdr, sizeof(hdr)) == sizeof(hdr));
+		g_assert(write(fd, payload[i], len[i]) == (ssize_t) len[i]);
+	}
+
+	close(fd);
+
+	g_assert(!btsnoop_open(path, test->flags));
+
+	btsnoop = btsnoop_open(path, test->flags | BTSNOOP_FLAG_PKLG_SUPPORT);
+	g_assert(btsnoop);
+	g_assert(btsnoop_get_format(btsnoop) == BTSNOOP_FORMAT_MONITOR);
+
+	g_assert(trace_read(btsnoop, test, &tv, &index, &opcode, &pkt, &size));
+	g_assert(index == 0x0000 && opcode == BTSNOOP_OPCODE_EVENT_PKT);
+	g_assert(tv.tv_sec == 1234 && tv.tv_usec == 0);
+	g_assert(size == sizeof(evt) && !memcmp(pkt, evt, size));
+
+	g_assert(trace_read(btsnoop, test, &tv, &index, &opcode, &pkt, &size));
+	g_assert(index == 0xffff && opcode == BTSNOOP_OPCODE_SYSTEM_NOTE);
+	g_assert(tv.tv_sec == 1234 && tv.tv_usec == 1000);
+	g_assert(size == sizeof(note) && !memcmp(pkt, note, size));
+
+	g_assert(!trace_read(btsnoop, test, &tv, &index, &opcode, &pkt,
+									&size));
+
+	btsnoop_unref(btsnoop);
+	unlink(path);
+	free(path);
+
+	tester_test_passed();
+}
+
+static void test_truncated(const void *data)
+{
+	const struct trace_test *test = data;
+	struct btsnoop *btsnoop;
+	struct timeval tv;
+	uint16_t index, opcode, size;
+	const void *pkt;
+	unsigned int i = 0;
+	off_t end;
+	char *path;
+
+	path = trace_path();
+
+	/* Packets 0 to 2 are complete, the payload of 3 is cut short */
+	write_monitor_trace(path, 4);
+	end = 16 + 3 * 24 + pkt_size(0) + pkt_size(1) + pkt_size(2) + 24;
+	g_assert(truncate(path, end + pkt_size(3) / 2) == 0);
+
+	btsnoop = btsnoop_open(path, test->flags);
+	g_assert(btsnoop);
+
+	while (trace_read(btsnoop, test, &tv, &index, &opcode, &pkt, &size))
+		i++;
+
+	g_assert(i == 3);
+
+	btsnoop_unref(btsnoop);
+	unlink(path);
+	free(path);
+
+	tester_test_passed();
+}
+
+/* Reads the trace the way btsnoop_read_hci() used to, two reads a packet */
+static unsigned long bench_read_syscalls(const char *path, uint64_t *sum)
+{
+	uint8_t buf[BTSNOOP_MAX_PACKET_SIZE];
+	uint8_t pkt[24];
+	unsigned long count = 0;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	g_assert(fd >= 0);
+	g_assert(read(fd, pkt, 16) == 16);
+
+	while (read(fd, pkt, sizeof(pkt)) == sizeof(pkt)) {
+		uint32_t len;
+
+		memcpy(&len, pkt, 4);
+		len = be32toh(len);
+
+		if (read(fd, buf, len) != (ssize_t) len)
+			break;
+
+		*sum += len ? buf[len - 1] : 0;
+		count++;
+	}
+
+	close(fd);
+
+	return count;
+}
+
+static unsigned long bench_read_hci(const char *path, unsigned long flags,
+								uint64_t *sum)
+{
+	uint8_t buf[BTSNOOP_MAX_PACKET_SIZE];
+	struct btsnoop *btsnoop;
+	struct timeval tv;
+	uint16_t index, opcode, size;
+	unsigned long count = 0;
+
+	btsnoop = btsnoop_open(path, flags);
+	g_assert(btsnoop);
+
+	while (btsnoop_read_hci(btsnoop, &tv, &index, &opcode, buf, &size)) {
+		*sum += size ? buf[size - 1] : 0;
+		count++;
+	}
+
+	btsnoop_unref(btsnoop);
+
+	return count;
+}
+
+static unsigned long bench_next_hci(const char *path, unsigned long flags,
+								uint64_t *sum)
+{
+	struct btsnoop *btsnoop;
+	struct timeval tv;
+	uint16_t index, opcode, size;
+	const void *data;
+	unsigned long count = 0;
+
+	btsnoop = btsnoop_open(path, flags);
+	g_assert(btsnoop);
+
+	while (btsnoop_next_hci(btsnoop, &tv, &index, &opcode, &data, &size)) {
+		*sum += size ? ((const uint8_t *) data)[size - 1] : 0;
+		count++;
+	}
+
+	btsnoop_unref(btsnoop);
+
+	return count;
+}
+
+static void bench_report(const void *data, const char *name, uint64_t usec,
+					off_t bytes, unsigned long count)
+{
+	/* Only benchmark runs report timings */
+	if (!data)
+		return;
+
+	usec++;
+
+	tester_print("  %-20s %8" PRIu64 " ms %8" PRIu64 " MiB/s "
+			"%10" PRIu64 " packets/s", name, usec / 1000,
+			(uint64_t) bytes * 1000000 / usec / (1024 * 1024),
+			(uint64_t) count * 1000000 / usec);
+}
+
+/*
+ * Synthetic HCI traffic with the size mix of a busy LE controller: mostly
+ * short events and ACL fragments with the odd full sized packet. Every
+ * reader must return the same packets. When benchmarking, set
+ * BTSNOOP_BENCH_MB=1024 to run it on a 1 GiB trace.
+ */
+static void test_readers(const void *data)
+{
+	static const uint16_t sizes[] = { 6, 14, 27, 40, 255, 31, 12, 1021 };
+	struct btsnoop *btsnoop;
+	uint8_t buf[BTSNOOP_MAX_PACKET_SIZE];
+	const char *env;
+	char *path;
+	off_t bytes = 16, target;
+	unsigned long count = 0, got;
+	uint64_t start, expect = 0, sum;
+	unsigned int i;
+
+	env = data ? getenv("BTSNOOP_BENCH_MB") : NULL;
+	target = env ? (off_t) atoi(env) * 1024 * 1024 :
+					(off_t) BENCH_DEFAULT_KB * 1024;
+
+	path = trace_path();
+
+	for (i = 0; i < sizeof(buf); i++)
+		buf[i] = i * 7;
+
+	btsnoop = btsnoop_create(path, 0, 0, BTSNOOP_FORMAT_MONITOR);
+
+	while (bytes < target) {
+		struct timeval tv = { .tv_sec = 1000000000 + count / 1000,
+					.tv_usec = count % 1000 };
+		uint16_t size = sizes[count % 8];
+
+		g_assert(btsnoop_write_hci(btsnoop, &tv, 0, pkt_opcode(count),
+							0, buf, size));
+
+		expect += buf[size - 1];
+		bytes += 24 + size;
+		count++;
+	}
+
+	btsnoop_unref(btsnoop);
+
+	if (data)
+		tester_print("%lu packets, %" PRIu64 " KiB", count,
+					(uint64_t) bytes / 1024);
+
+	sum = 0;
+	start = tester_now_usec();
+	got = bench_read_syscalls(path, &sum);
+	bench_report(data, "read() per field", tester_now_usec() - start,
+								bytes, got);
+	g_assert(got == count && sum == expect);
+
+	sum = 0;
+	start = tester_now_usec();
+	got = bench_read_hci(path, 0, &sum);
+	bench_report(data, "buffered copy", tester_now_usec() - start,
+								bytes, got);
+	g_assert(got == count && sum == expect);
+
+	sum = 0;
+	start = tester_now_usec();
+	got = bench_next_hci(path, 0, &sum);
+	bench_report(data, "buffered zero copy", tester_now_usec() - start,
+								bytes, got);
+	g_assert(got == count && sum == expect);
+
+	sum = 0;
+	start = tester_now_usec();
+	got = bench_next_hci(path, BTSNOOP_FLAG_MMAP, &sum);
+	bench_report(data, "mapped zero copy", tester_now_usec() - start,
+								bytes, got);
+	g_assert(got == count && sum == expect);
+
+	unlink(path);
+	free(path);
+
+	tester_test_passed();
+}
+
+int main(int argc, char *argv[])
+{
+	tester_init(&argc, &argv);
+
+	tester_add("/btsnoop/monitor/copy", &copy_buffered, NULL,
+							test_monitor, NULL);
+	tester_add("/btsnoop/monitor/copy-mmap", &copy_mapped, NULL,
+							test_monitor, NULL);
+	tester_add("/btsnoop/monitor/next", &next_buffered, NULL,
+							test_monitor, NULL);
+	tester_add("/btsnoop/monitor/next-mmap", &next_mapped, NULL,
+							test_monitor, NULL);
+	tester_add("/btsnoop/uart/next", &next_buffered, NULL,
+							test_uart, NULL);
+	tester_add("/btsnoop/uart/next-mmap", &next_mapped, NULL,
+							test_uart, NULL);
+	tester_add("/btsnoop/pklg/next", &next_buffered, NULL,
+							test_pklg, NULL);
+	tester_add("/btsnoop/pklg/next-mmap", &next_mapped, NULL,
+							test_pklg, NULL);
+	tester_add("/btsnoop/truncated/next", &next_buffered, NULL,
+							test_truncated, NULL);
+	tester_add("/btsnoop/truncated/next-mmap", &next_mapped, NULL,
+							test_truncated, NULL);
+	tester_add("/btsnoop/readers", NULL, NULL, test_readers, NULL);
+
+	if (tester_use_benchmark())
+		tester_add("/btsnoop/benchmark", &timed, NULL, test_readers,
+									NULL);
+
+	return tester_run();
+}
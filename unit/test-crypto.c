@@ -17,9 +17,16 @@
 #include "src/shared/tester.h"
 
 #include <string.h>
+#include <inttypes.h>
 #include <glib.h>
 
+#define BENCH_OPS 20000
+#define RPA_NUM_IRKS 1000
+#define RPA_NUM_ADDRS 100
+
 static struct bt_crypto *crypto;
+static struct bt_crypto *crypto_kernel;
+static struct bt_crypto *crypto_user;
 
 static void print_debug(const char *str, void *user_data)
 {
@@ -311,14 +318,200 @@ static void test_verify_sign(gconstpointer data)
 	tester_test_passed();
 }
 
+static void setup_user(gconstpointer data)
+{
+	crypto = crypto_user;
+
+	tester_setup_complete();
+}
+
+static void test_backends(gconstpointer data)
+{
+	uint8_t k[16], r[16], u[32], v[32], m[64];
+	uint8_t res_k[16], res_u[16], mac_k[16], mac_u[16];
+	uint32_t val_k, val_u;
+	struct iovec iov[3];
+	int i;
+
+	if (!crypto_kernel) {
+		tester_debug("Kernel crypto not available, skipping");
+		tester_test_passed();
+		return;
+	}
+
+	for (i = 0; i < 100; i++) {
+		g_assert(bt_crypto_random_bytes(crypto_user, k, sizeof(k)));
+		g_assert(bt_crypto_random_bytes(crypto_user, r, sizeof(r)));
+		g_assert(bt_crypto_random_bytes(crypto_user, u, sizeof(u)));
+		g_assert(bt_crypto_random_bytes(crypto_user, v, sizeof(v)));
+		g_assert(bt_crypto_random_bytes(crypto_user, m, sizeof(m)));
+
+		g_assert(bt_crypto_e(crypto_kernel, k, r, res_k));
+		g_assert(bt_crypto_e(crypto_user, k, r, res_u));
+		g_assert(!memcmp(res_k, res_u, 16));
+
+		g_assert(bt_crypto_ah(crypto_kernel, k, r, res_k));
+		g_assert(bt_crypto_ah(crypto_user, k, r, res_u));
+		g_assert(!memcmp(res_k, res_u, 3));
+
+		g_assert(bt_crypto_f4(crypto_kernel, u, v, k, i, res_k));
+		g_assert(bt_crypto_f4(crypto_user, u, v, k, i, res_u));
+		g_assert(!memcmp(res_k, res_u, 16));
+
+		g_assert(bt_crypto_f5(crypto_kernel, u, k, r, m, m + 7,
+							mac_k, res_k));
+		g_assert(bt_crypto_f5(crypto_user, u, k, r, m, m + 7,
+							mac_u, res_u));
+		g_assert(!memcmp(mac_k, mac_u, 16));
+		g_assert(!memcmp(res_k, res_u, 16));
+
+		g_assert(bt_crypto_g2(crypto_kernel, u, v, k, r, &val_k));
+		g_assert(bt_crypto_g2(crypto_user, u, v, k, r, &val_u));
+		g_assert(val_k == val_u);
+
+		g_assert(bt_crypto_sign_att(crypto_kernel, k, m, i % 64, i,
+								res_k));
+		g_assert(bt_crypto_sign_att(crypto_user, k, m, i % 64, i,
+								res_u));
+		g_assert(!memcmp(res_k, res_u, 12));
+
+		/* Split the message at arbitrary boundaries */
+		iov[0].iov_base = m;
+		iov[0].iov_len = i % 17;
+		iov[1].iov_base = m + iov[0].iov_len;
+		iov[1].iov_len = i % 31;
+		iov[2].iov_base = u;
+		iov[2].iov_len = i % 33;
+
+		g_assert(bt_crypto_gatt_hash(crypto_kernel, iov, 3, res_k));
+		g_assert(bt_crypto_gatt_hash(crypto_user, iov, 3, res_u));
+		g_assert(!memcmp(res_k, res_u, 16));
+	}
+
+	tester_test_passed();
+}
+
+static void bench_backend(const char *name, struct bt_crypto *bench)
+{
+	const uint8_t k[16] = { 0x01 }, r[3] = { 0x02 };
+	uint8_t m[32] = { 0x03 }, res[16];
+	uint64_t start, ah, sign;
+	int i;
+
+	start = tester_now_usec();
+
+	for (i = 0; i < BENCH_OPS; i++)
+		g_assert(bt_crypto_ah(bench, k, r, res));
+
+	ah = tester_now_usec() - start + 1;
+
+	start = tester_now_usec();
+
+	for (i = 0; i < BENCH_OPS; i++)
+		g_assert(bt_crypto_sign_att(bench, k, m, sizeof(m), i, res));
+
+	sign = tester_now_usec() - start + 1;
+
+	tester_print("%s: ah %" PRIu64 " ops/sec, sign_att %" PRIu64
+				" ops/sec", name,
+				(uint64_t) BENCH_OPS * 1000000 / ah,
+				(uint64_t) BENCH_OPS * 1000000 / sign);
+}
+
+static void test_benchmark(gconstpointer data)
+{
+	if (crypto_kernel)
+		bench_backend("kernel", crypto_kernel);
+
+	bench_backend("user", crypto_user);
+
+	tester_test_passed();
+}
+
+static void make_rpa(const uint8_t irk[16], uint8_t addr[6])
+{
+	g_assert(bt_crypto_random_bytes(crypto_user, addr + 3, 3));
+
+	addr[5] &= 0x3f;
+	addr[5] |= 0x40;
+
+	g_assert(bt_crypto_ah(crypto_user, irk, addr + 3, addr));
+}
+
+static void test_rpa_resolver(gconstpointer data)
+{
+	static uint8_t irks[RPA_NUM_IRKS][16];
+	struct bt_crypto_rpa_resolver *resolver;
+	uint8_t addrs[RPA_NUM_ADDRS][6], hash[3];
+	uint64_t start, linear, batched;
+	int i, j;
+
+	resolver = bt_crypto_rpa_resolver_new();
+
+	for (i = 0; i < RPA_NUM_IRKS; i++) {
+		g_assert(bt_crypto_random_bytes(crypto_user, irks[i], 16));
+		g_assert(bt_crypto_rpa_resolver_add(resolver, irks[i],
+								irks[i]));
+	}
+
+	/* Use the last IRKs so every lookup has to go through the list */
+	for (i = 0; i < RPA_NUM_ADDRS; i++)
+		make_rpa(irks[RPA_NUM_IRKS - 1 - i % 10], addrs[i]);
+
+	start = tester_now_usec();
+
+	for (i = 0; i < RPA_NUM_ADDRS; i++) {
+		for (j = 0; j < RPA_NUM_IRKS; j++) {
+			g_assert(bt_crypto_ah(crypto, irks[j], addrs[i] + 3,
+								hash));
+			if (!memcmp(hash, addrs[i], 3))
+				break;
+		}
+
+		g_assert(j == RPA_NUM_IRKS - 1 - i % 10);
+	}
+
+	linear = tester_now_usec() - start;
+
+	start = tester_now_usec();
+
+	for (i = 0; i < RPA_NUM_ADDRS; i++)
+		g_assert(bt_crypto_rpa_resolve(resolver, addrs[i]) ==
+					irks[RPA_NUM_IRKS - 1 - i % 10]);
+
+	batched = tester_now_usec() - start;
+
+	/* Cached results */
+	for (i = 0; i < RPA_NUM_ADDRS; i++)
+		g_assert(bt_crypto_rpa_resolve(resolver, addrs[i]) ==
+					irks[RPA_NUM_IRKS - 1 - i % 10]);
+
+	/* Flip the hash so the address does not resolve anymore */
+	addrs[0][0] ^= 0xff;
+	g_assert(!bt_crypto_rpa_resolve(resolver, addrs[0]));
+	g_assert(!bt_crypto_rpa_resolve(resolver, addrs[0]));
+
+	if (tester_use_benchmark())
+		tester_print("%d RPAs against %d IRKs: linear %" PRIu64
+				" us, batched %" PRIu64 " us", RPA_NUM_ADDRS,
+				RPA_NUM_IRKS, linear, batched);
+
+	bt_crypto_rpa_resolver_free(resolver);
+
+	tester_test_passed();
+}
+
 int main(int argc, char *argv[])
 {
 	int exit_status;
 
-	crypto = bt_crypto_new();
-	if (!crypto)
+	crypto_kernel = bt_crypto_new_backend(BT_CRYPTO_BACKEND_KERNEL);
+	crypto_user = bt_crypto_new_backend(BT_CRYPTO_BACKEND_USER);
+	if (!crypto_user)
 		return 0;
 
+	crypto = crypto_kernel ? crypto_kernel : crypto_user;
+
 	tester_init(&argc, &argv);
 
 	tester_add("/crypto/h6", NULL, NULL, test_h6, NULL);
@@ -338,9 +531,39 @@ int main(int argc, char *argv[])
 	tester_add("/crypto/verify_sign_too_short", &verify_sign_too_short_data,
 						NULL, test_verify_sign, NULL);
 
+	tester_add("/crypto/user/h6", NULL, setup_user, test_h6, NULL);
+
+	tester_add("/crypto/user/sign_att_1", &test_data_1, setup_user,
+							test_sign, NULL);
+	tester_add("/crypto/user/sign_att_2", &test_data_2, setup_user,
+							test_sign, NULL);
+	tester_add("/crypto/user/sign_att_3", &test_data_3, setup_user,
+							test_sign, NULL);
+	tester_add("/crypto/user/sign_att_4", &test_data_4, setup_user,
+							test_sign, NULL);
+	tester_add("/crypto/user/sign_att_5", &test_data_5, setup_user,
+							test_sign, NULL);
+
+	tester_add("/crypto/user/gatt_hash", NULL, setup_user, test_gatt_hash,
+									NULL);
+
+	tester_add("/crypto/user/verify_sign_pass", &verify_sign_pass_data,
+					setup_user, test_verify_sign, NULL);
+	tester_add("/crypto/user/verify_sign_bad_sign",
+					&verify_sign_bad_sign_data,
+					setup_user, test_verify_sign, NULL);
+
+	tester_add("/crypto/backends", NULL, NULL, test_backends, NULL);
+	tester_add("/crypto/rpa_resolver", NULL, NULL, test_rpa_resolver, NULL);
+
+	if (tester_use_benchmark())
+		tester_add("/crypto/benchmark", NULL, NULL, test_benchmark,
+									NULL);
+
 	exit_status = tester_run();
 
-	bt_crypto_unref(crypto);
+	bt_crypto_unref(crypto_kernel);
+	bt_crypto_unref(crypto_user);
 
 	return exit_status;
 }
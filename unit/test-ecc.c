@@ -16,6 +16,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <inttypes.h>
 
 #include "src/shared/ecc.h"
 #include "src/shared/util.h"
@@ -228,6 +229,53 @@ static void test_sample_3(const void *data)
 	tester_test_passed();
 }
 
+static void test_sample_4(const void *data)
+{
+	/* n - 2, for which the ladder used to add a point to its inverse */
+	uint8_t priv_a[32] = {	0x4f, 0x25, 0x63, 0xfc, 0xc2, 0xca, 0xb9, 0xf3,
+				0x84, 0x9e, 0x17, 0xa7, 0xad, 0xfa, 0xe6, 0xbc,
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+				0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	};
+	uint8_t priv_b[32] = {	0xbd, 0x1a, 0x3c, 0xcd, 0xa6, 0xb8, 0x99, 0x58,
+				0x99, 0xb7, 0x40, 0xeb, 0x7b, 0x60, 0xff, 0x4a,
+				0x50, 0x3f, 0x10, 0xd2, 0xe3, 0xb3, 0xc9, 0x74,
+				0x38, 0x5f, 0xc5, 0xa3, 0xd4, 0xf6, 0x49, 0x3f,
+	};
+	uint8_t pub_a[64] = {	0x78, 0x99, 0x66, 0x47, 0xfc, 0x48, 0x0b, 0xa6,
+				0x35, 0x1b, 0xf2, 0x77, 0xe2, 0x69, 0x89, 0xc0,
+				0xc3, 0x1a, 0xb5, 0x04, 0x03, 0x38, 0x52, 0x8a,
+				0x7e, 0x4f, 0x03, 0x8d, 0x18, 0x7b, 0xf2, 0x7c,
+
+				0x2e, 0x8c, 0x87, 0xdd, 0x62, 0x48, 0xfb, 0x61,
+				0xd6, 0x7d, 0x16, 0xc3, 0x1a, 0x52, 0x82, 0x45,
+				0x24, 0xcf, 0x8b, 0x60, 0x39, 0x65, 0xc2, 0xd6,
+				0xc0, 0x2f, 0x71, 0x24, 0xee, 0xaa, 0x88, 0xf8,
+	};
+	uint8_t pub_b[64] = {	0xe6, 0x9d, 0x35, 0x0e, 0x48, 0x01, 0x03, 0xcc,
+				0xdb, 0xfd, 0xf4, 0xac, 0x11, 0x91, 0xf4, 0xef,
+				0xb9, 0xa5, 0xf9, 0xe9, 0xa7, 0x83, 0x2c, 0x5e,
+				0x2c, 0xbe, 0x97, 0xf2, 0xd2, 0x03, 0xb0, 0x20,
+
+				0x8b, 0xd2, 0x89, 0x15, 0xd0, 0x8e, 0x1c, 0x74,
+				0x24, 0x30, 0xed, 0x8f, 0xc2, 0x45, 0x63, 0x76,
+				0x5c, 0x15, 0x52, 0x5a, 0xbf, 0x9a, 0x32, 0x63,
+				0x6d, 0xeb, 0x2a, 0x65, 0x49, 0x9c, 0x80, 0xdc,
+	};
+	uint8_t dhkey[32] = {	0xee, 0x3c, 0x26, 0x94, 0x09, 0x00, 0xb9, 0x89,
+				0x54, 0xe1, 0xce, 0x48, 0xf8, 0x76, 0xf0, 0x44,
+				0xd0, 0xaf, 0x3f, 0x4c, 0x36, 0xdd, 0x9f, 0x17,
+				0xb0, 0x37, 0xbc, 0x3a, 0x22, 0xc2, 0x53, 0x63,
+	};
+	int fails;
+
+	fails = test_sample(priv_a, priv_b, pub_a, pub_b, dhkey);
+
+	g_assert(fails == 0);
+
+	tester_test_passed();
+}
+
 static void test_invalid_pub(const void *data)
 {
 	uint8_t priv_a[32] = {	0xbd, 0x1a, 0x3c, 0xcd, 0xa6, 0xb8, 0x99, 0x58,
@@ -261,6 +309,241 @@ static void test_invalid_pub(const void *data)
 	tester_test_passed();
 }
 
+struct pubkey_vector {
+	const char *name;
+	uint8_t priv[32];
+	uint8_t pub[64];
+};
+
+/* Keys are little endian, as everywhere else in this API */
+static const struct pubkey_vector pubkey_vectors[] = {
+	{
+		.name = "1 * G",
+		.priv = { 0x01 },
+		.pub = {
+			0x96, 0xc2, 0x98, 0xd8, 0x45, 0x39, 0xa1, 0xf4,
+			0xa0, 0x33, 0xeb, 0x2d, 0x81, 0x7d, 0x03, 0x77,
+			0xf2, 0x40, 0xa4, 0x63, 0xe5, 0xe6, 0xbc, 0xf8,
+			0x47, 0x42, 0x2c, 0xe1, 0xf2, 0xd1, 0x17, 0x6b,
+
+			0xf5, 0x51, 0xbf, 0x37, 0x68, 0x40, 0xb6, 0xcb,
+			0xce, 0x5e, 0x31, 0x6b, 0x57, 0x33, 0xce, 0x2b,
+			0x16, 0x9e, 0x0f, 0x7c, 0x4a, 0xeb, 0xe7, 0x8e,
+			0x9b, 0x7f, 0x1a, 0xfe, 0xe2, 0x42, 0xe3, 0x4f,
+		},
+	},
+	{
+		.name = "2 * G",
+		.priv = { 0x02 },
+		.pub = {
+			0x78, 0x99, 0x66, 0x47, 0xfc, 0x48, 0x0b, 0xa6,
+			0x35, 0x1b, 0xf2, 0x77, 0xe2, 0x69, 0x89, 0xc0,
+			0xc3, 0x1a, 0xb5, 0x04, 0x03, 0x38, 0x52, 0x8a,
+			0x7e, 0x4f, 0x03, 0x8d, 0x18, 0x7b, 0xf2, 0x7c,
+
+			0xd1, 0x73, 0x78, 0x22, 0x9d, 0xb7, 0x04, 0x9e,
+			0x29, 0x82, 0xe9, 0x3c, 0xe6, 0xad, 0x7d, 0xba,
+			0xdb, 0x30, 0x74, 0x9f, 0xc6, 0x9a, 0x3d, 0x29,
+			0x40, 0xd0, 0x8e, 0xdb, 0x10, 0x55, 0x77, 0x07,
+		},
+	},
+	{
+		.name = "(n - 2) * G",
+		.priv = {
+			0x4f, 0x25, 0x63, 0xfc, 0xc2, 0xca, 0xb9, 0xf3,
+			0x84, 0x9e, 0x17, 0xa7, 0xad, 0xfa, 0xe6, 0xbc,
+			0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+			0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+		},
+		.pub = {
+			0x78, 0x99, 0x66, 0x47, 0xfc, 0x48, 0x0b, 0xa6,
+			0x35, 0x1b, 0xf2, 0x77, 0xe2, 0x69, 0x89, 0xc0,
+			0xc3, 0x1a, 0xb5, 0x04, 0x03, 0x38, 0x52, 0x8a,
+			0x7e, 0x4f, 0x03, 0x8d, 0x18, 0x7b, 0xf2, 0x7c,
+
+			0x2e, 0x8c, 0x87, 0xdd, 0x62, 0x48, 0xfb, 0x61,
+			0xd6, 0x7d, 0x16, 0xc3, 0x1a, 0x52, 0x82, 0x45,
+			0x24, 0xcf, 0x8b, 0x60, 0x39, 0x65, 0xc2, 0xd6,
+			0xc0, 0x2f, 0x71, 0x24, 0xee, 0xaa, 0x88, 0xf8,
+		},
+	},
+	{
+		.name = "(n - 1) * G",
+		.priv = {
+			0x50, 0x25, 0x63, 0xfc, 0xc2, 0xca, 0xb9, 0xf3,
+			0x84, 0x9e, 0x17, 0xa7, 0xad, 0xfa, 0xe6, 0xbc,
+			0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+			0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+		},
+		.pub = {
+			0x96, 0xc2, 0x98, 0xd8, 0x45, 0x39, 0xa1, 0xf4,
+			0xa0, 0x33, 0xeb, 0x2d, 0x81, 0x7d, 0x03, 0x77,
+			0xf2, 0x40, 0xa4, 0x63, 0xe5, 0xe6, 0xbc, 0xf8,
+			0x47, 0x42, 0x2c, 0xe1, 0xf2, 0xd1, 0x17, 0x6b,
+
+			0x0a, 0xae, 0x40, 0xc8, 0x97, 0xbf, 0x49, 0x34,
+			0x31, 0xa1, 0xce, 0x94, 0xa9, 0xcc, 0x31, 0xd4,
+			0xe9, 0x61, 0xf0, 0x83, 0xb5, 0x14, 0x18, 0x71,
+			0x65, 0x80, 0xe5, 0x01, 0x1c, 0xbd, 0x1c, 0xb0,
+		},
+	},
+	{
+		.name = "Debug key",
+		.priv = {
+			0xbd, 0x1a, 0x3c, 0xcd, 0xa6, 0xb8, 0x99, 0x58,
+			0x99, 0xb7, 0x40, 0xeb, 0x7b, 0x60, 0xff, 0x4a,
+			0x50, 0x3f, 0x10, 0xd2, 0xe3, 0xb3, 0xc9, 0x74,
+			0x38, 0x5f, 0xc5, 0xa3, 0xd4, 0xf6, 0x49, 0x3f,
+		},
+		.pub = {
+			0xe6, 0x9d, 0x35, 0x0e, 0x48, 0x01, 0x03, 0xcc,
+			0xdb, 0xfd, 0xf4, 0xac, 0x11, 0x91, 0xf4, 0xef,
+			0xb9, 0xa5, 0xf9, 0xe9, 0xa7, 0x83, 0x2c, 0x5e,
+			0x2c, 0xbe, 0x97, 0xf2, 0xd2, 0x03, 0xb0, 0x20,
+
+			0x8b, 0xd2, 0x89, 0x15, 0xd0, 0x8e, 0x1c, 0x74,
+			0x24, 0x30, 0xed, 0x8f, 0xc2, 0x45, 0x63, 0x76,
+			0x5c, 0x15, 0x52, 0x5a, 0xbf, 0x9a, 0x32, 0x63,
+			0x6d, 0xeb, 0x2a, 0x65, 0x49, 0x9c, 0x80, 0xdc,
+		},
+	},
+};
+
+static void test_public_key(const void *data)
+{
+	uint8_t pub[64];
+	unsigned int i;
+
+	for (i = 0; i < sizeof(pubkey_vectors) / sizeof(pubkey_vectors[0]);
+									i++) {
+		const struct pubkey_vector *v = &pubkey_vectors[i];
+
+		tester_debug("%s", v->name);
+
+		g_assert(ecc_make_public_key(v->priv, pub));
+
+		if (memcmp(pub, v->pub, sizeof(pub))) {
+			print_buf("Expected ", (uint8_t *) v->pub, 64);
+			print_buf("Got      ", pub, 64);
+			g_assert_not_reached();
+		}
+
+		g_assert(ecc_valid_public_key(pub));
+	}
+
+	tester_test_passed();
+}
+
+static const unsigned int table_windows[] = { 0, 1, 2, 31, 62, 63 };
+static const unsigned int table_digits[] = { 1, 2, 8, 15 };
+
+/* Checks that a private key gives the point the ladder finds from G */
+static void check_base_mult(const uint8_t priv[32])
+{
+	const uint8_t *g = pubkey_vectors[0].pub;
+	uint8_t pub[64], x[32];
+
+	g_assert(ecc_make_public_key(priv, pub));
+	g_assert(ecc_valid_public_key(pub));
+
+	/* The co-Z ladder cannot compute 1 * G, which is G itself */
+	if (!ecdh_shared_secret(g, priv, x)) {
+		g_assert(!memcmp(pub, g, sizeof(pub)));
+		return;
+	}
+
+	if (memcmp(pub, x, sizeof(x))) {
+		print_buf("Expected ", x, 32);
+		print_buf("Got      ", pub, 32);
+		g_assert_not_reached();
+	}
+}
+
+/*
+ * Recomputes entries of the fixed-base table generated by
+ * tools/gen-ecc-table.py from the base point. A private key with a single
+ * non-zero digit d in window i gives entry d * 16^i * G as is, and its x
+ * coordinate must match the one of the ladder. The sign of y is checked by
+ * also adding G, or 16 * G for the first window, since a negated entry would
+ * give (k - 1) * G instead of (k + 1) * G.
+ */
+static void test_base_table(const void *data)
+{
+	uint8_t priv[32];
+	unsigned int i, j;
+
+	for (i = 0; i < G_N_ELEMENTS(table_windows); i++) {
+		unsigned int window = table_windows[i];
+
+		for (j = 0; j < G_N_ELEMENTS(table_digits); j++) {
+			tester_debug("%u * 16^%u * G", table_digits[j],
+								window);
+
+			memset(priv, 0, sizeof(priv));
+			priv[window / 2] = table_digits[j] << (4 * (window % 2));
+
+			check_base_mult(priv);
+
+			priv[0] |= window ? 0x01 : 0x10;
+
+			check_base_mult(priv);
+		}
+	}
+
+	tester_test_passed();
+}
+
+static void test_invalid_priv(const void *data)
+{
+	/* 0 and n are both outside of [1, n - 1] */
+	uint8_t zero[32] = { };
+	uint8_t n[32] = {	0x51, 0x25, 0x63, 0xfc, 0xc2, 0xca, 0xb9, 0xf3,
+				0x84, 0x9e, 0x17, 0xa7, 0xad, 0xfa, 0xe6, 0xbc,
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+				0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	};
+	uint8_t pub[64];
+
+	g_assert(!ecc_make_public_key(zero, pub));
+	g_assert(!ecc_make_public_key(n, pub));
+
+	tester_test_passed();
+}
+
+#define BENCH_OPS 500
+
+static void test_benchmark(const void *data)
+{
+	uint8_t public1[64], public2[64];
+	uint8_t private1[32], private2[32];
+	uint8_t shared[32];
+	uint64_t start, keygen, ecdh;
+	int i;
+
+	g_assert(ecc_make_key(public1, private1));
+	g_assert(ecc_make_key(public2, private2));
+
+	start = tester_now_usec();
+
+	for (i = 0; i < BENCH_OPS; i++)
+		g_assert(ecc_make_public_key(private1, public1));
+
+	keygen = tester_now_usec() - start + 1;
+
+	start = tester_now_usec();
+
+	for (i = 0; i < BENCH_OPS; i++)
+		g_assert(ecdh_shared_secret(public2, private1, shared));
+
+	ecdh = tester_now_usec() - start + 1;
+
+	tester_print("public key %" PRIu64 " ops/sec, shared secret %" PRIu64
+				" ops/sec", BENCH_OPS * 1000000 / keygen,
+				BENCH_OPS * 1000000 / ecdh);
+
+	tester_test_passed();
+}
+
 int main(int argc, char *argv[])
 {
 	tester_init(&argc, &argv);
@@ -270,8 +553,16 @@ int main(int argc, char *argv[])
 	tester_add("/ecdh/sample/1", NULL, NULL, test_sample_1, NULL);
 	tester_add("/ecdh/sample/2", NULL, NULL, test_sample_2, NULL);
 	tester_add("/ecdh/sample/3", NULL, NULL, test_sample_3, NULL);
+	tester_add("/ecdh/sample/4", NULL, NULL, test_sample_4, NULL);
 
 	tester_add("/ecdh/invalid", NULL, NULL, test_invalid_pub, NULL);
 
+	tester_add("/ecc/public_key", NULL, NULL, test_public_key, NULL);
+	tester_add("/ecc/base_table", NULL, NULL, test_base_table, NULL);
+	tester_add("/ecc/invalid_priv", NULL, NULL, test_invalid_priv, NULL);
+
+	if (tester_use_benchmark())
+		tester_add("/ecc/benchmark", NULL, NULL, test_benchmark, NULL);
+
 	return tester_run();
 }
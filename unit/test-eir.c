@@ -539,6 +539,45 @@ static void print_debug(const char *str, void *user_data)
 	tester_debug("%s%s", prefix, str);
 }
 
+struct view_uuid_data {
+	const struct test_data *test;
+	int n;
+};
+
+static void view_uuid(const char *uuid, void *user_data)
+{
+	struct view_uuid_data *data = user_data;
+
+	g_assert(data->test->uuid);
+	g_assert(data->test->uuid[data->n]);
+	g_assert_cmpstr(data->test->uuid[data->n], ==, uuid);
+	data->n++;
+}
+
+static void test_view(const struct test_data *test)
+{
+	struct eir_view view;
+	struct view_uuid_data data = { .test = test };
+
+	eir_view_parse(&view, test->eir_data, test->eir_size);
+
+	g_assert_cmpint(view.flags, ==, test->flags);
+
+	if (test->name) {
+		g_assert_cmpstr(view.name, ==, test->name);
+		g_assert(view.has_name);
+		g_assert(view.name_complete == test->name_complete);
+	} else {
+		g_assert(!view.has_name);
+	}
+
+	g_assert(view.tx_power == test->tx_power);
+
+	eir_view_foreach_uuid(&view, view_uuid, &data);
+	g_assert_cmpint(data.n, ==, view.num_uuids);
+	g_assert(!test->uuid || !test->uuid[data.n]);
+}
+
 static void test_parsing(gconstpointer data)
 {
 	const struct test_data *test = data;
@@ -601,6 +640,8 @@ static void test_parsing(gconstpointer data)
 
 	eir_data_free(&eir);
 
+	test_view(test);
+
 	tester_test_passed();
 }
 
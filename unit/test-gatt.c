@@ -2268,6 +2268,23 @@ static const struct test_step test_notification_server_1 = {
 	.length = 0x03,
 };
 
+static void test_server_notification_multiple(struct context *context)
+{
+	const struct test_step *step = context->data->step;
+
+	bt_gatt_server_send_notification(context->server, step->handle,
+					step->value, step->length, true);
+	bt_gatt_server_send_notification(context->server, step->handle,
+					step->value, step->length, true);
+}
+
+static const struct test_step test_notification_server_2 = {
+	.handle = 0x0003,
+	.func = test_server_notification_multiple,
+	.value = read_data_1,
+	.length = 0x03,
+};
+
 static uint8_t indication_received;
 
 static void test_indication_cb(void *user_data)
@@ -2332,6 +2349,830 @@ static const struct test_step test_indication_server_1 = {
 	.length = 0x03,
 };
 
+int __real_getsockopt(int fd, int level, int optname, void *optval,
+							socklen_t *optlen);
+
+/*
+ * bt_att_attach_fd() only takes L2CAP channels, so the MTU query it does on
+ * the socketpairs standing in for them is answered with the default LE MTU.
+ * The test is linked with -Wl,--wrap=getsockopt.
+ */
+int __wrap_getsockopt(int fd, int level, int optname, void *optval,
+							socklen_t *optlen)
+{
+	int domain = 0;
+	socklen_t len = sizeof(domain);
+
+	if (level == SOL_BLUETOOTH && optname == BT_SNDMTU &&
+			!__real_getsockopt(fd, SOL_SOCKET, SO_DOMAIN, &domain,
+								&len) &&
+			domain == AF_UNIX) {
+		*(uint16_t *) optval = BT_ATT_DEFAULT_LE_MTU;
+		*optlen = sizeof(uint16_t);
+		return 0;
+	}
+
+	return __real_getsockopt(fd, level, optname, optval, optlen);
+}
+
+#define ATT_CHANNELS		3
+#define ATT_BIG_CHAN		(ATT_CHANNELS - 1)
+#define ATT_BIG_MTU		64
+#define ATT_HELD_HANDLE		0x0001
+#define ATT_WRITE_HANDLE	0x0002
+#define ATT_PIN_HANDLE		0x0003
+#define ATT_PIN_COUNT		3
+#define ATT_NFY_COUNT		3
+
+struct att_chans {
+	struct bt_att *server_att;
+	struct bt_att *client_att;
+	struct bt_att_chan *server_chans[ATT_CHANNELS];
+	struct bt_att_chan *client_chans[ATT_CHANNELS];
+	void (*ready)(struct att_chans *chans);
+	bool started;
+	struct bt_att_chan *held;
+	unsigned int received;
+	unsigned int responses;
+	uint8_t opcodes[ATT_NFY_COUNT + 2];
+	bool confirmed;
+};
+
+static struct att_chans att_chans;
+
+static void att_chans_collect(struct bt_att_chan *chan,
+				const struct bt_att_chan_stats *stats,
+				void *user_data)
+{
+	struct bt_att_chan **chans = user_data;
+	unsigned int i;
+
+	for (i = 0; i < ATT_CHANNELS; i++) {
+		if (!chans[i])
+			chans[i] = chan;
+
+		if (chans[i] == chan)
+			break;
+	}
+
+	if (att_chans.started || !att_chans.server_chans[ATT_CHANNELS - 1] ||
+				!att_chans.client_chans[ATT_CHANNELS - 1])
+		return;
+
+	att_chans.started = true;
+	att_chans.ready(&att_chans);
+}
+
+/*
+ * Connects two ATT instances over several socketpairs. Channels are only
+ * reachable through the stats callback, which lists them newest first so
+ * the same index on both sides is the same socketpair and the last one is
+ * the channel the instances were created with.
+ */
+static void att_chans_start(void (*ready)(struct att_chans *chans),
+								uint16_t mtu)
+{
+	unsigned int i;
+	int sv[2];
+
+	memset(&att_chans, 0, sizeof(att_chans));
+	att_chans.ready = ready;
+
+	for (i = 0; i < ATT_CHANNELS; i++) {
+		g_assert(!socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0,
+									sv));
+
+		if (!i) {
+			att_chans.server_att = bt_att_new(sv[0], false);
+			att_chans.client_att = bt_att_new(sv[1], false);
+			g_assert(att_chans.server_att && att_chans.client_att);
+
+			bt_att_set_close_on_unref(att_chans.server_att, true);
+			bt_att_set_close_on_unref(att_chans.client_att, true);
+			continue;
+		}
+
+		g_assert(!bt_att_attach_fd(att_chans.server_att, sv[0]));
+		g_assert(!bt_att_attach_fd(att_chans.client_att, sv[1]));
+	}
+
+	g_assert(bt_att_set_mtu(att_chans.server_att, mtu));
+	g_assert(bt_att_set_mtu(att_chans.client_att, mtu));
+
+	g_assert(bt_att_set_stats(att_chans.server_att, 1, att_chans_collect,
+					att_chans.server_chans, NULL));
+	g_assert(bt_att_set_stats(att_chans.client_att, 1, att_chans_collect,
+					att_chans.client_chans, NULL));
+}
+
+static void att_chans_done(void)
+{
+	bt_att_unref(att_chans.client_att);
+	bt_att_unref(att_chans.server_att);
+
+	tester_test_passed();
+}
+
+static void att_chans_check_stats(struct bt_att_chan *chan, uint64_t requests,
+					uint64_t tx_pdus, uint64_t tx_octets,
+					uint64_t rx_pdus, uint64_t rx_octets)
+{
+	struct bt_att_chan_stats stats;
+
+	g_assert(bt_att_chan_get_stats(chan, &stats));
+	g_assert_cmpuint(stats.requests, ==, requests);
+	g_assert_cmpuint(stats.tx_pdus, ==, tx_pdus);
+	g_assert_cmpuint(stats.tx_octets, ==, tx_octets);
+	g_assert_cmpuint(stats.rx_pdus, ==, rx_pdus);
+	g_assert_cmpuint(stats.rx_octets, ==, rx_octets);
+}
+
+static void att_pin_check(struct att_chans *chans)
+{
+	unsigned int i;
+
+	if (chans->received < ATT_PIN_COUNT * 2 ||
+					chans->responses < ATT_PIN_COUNT)
+		return;
+
+	/*
+	 * Read Request is 3 octets and Write Command 7 octets, each Read
+	 * Response 3 octets. Nothing may have used the other channels.
+	 */
+	for (i = 0; i < ATT_CHANNELS; i++) {
+		if (i != 1) {
+			att_chans_check_stats(chans->client_chans[i], 0, 0, 0,
+									0, 0);
+			att_chans_check_stats(chans->server_chans[i], 0, 0, 0,
+									0, 0);
+			continue;
+		}
+
+		att_chans_check_stats(chans->client_chans[i], ATT_PIN_COUNT,
+					ATT_PIN_COUNT * 2, ATT_PIN_COUNT * 10,
+					ATT_PIN_COUNT, ATT_PIN_COUNT * 3);
+		att_chans_check_stats(chans->server_chans[i], 0,
+					ATT_PIN_COUNT, ATT_PIN_COUNT * 3,
+					ATT_PIN_COUNT * 2, ATT_PIN_COUNT * 10);
+	}
+
+	att_chans_done();
+}
+
+static void att_pin_server(struct bt_att_chan *chan, uint8_t opcode,
+					const void *pdu, uint16_t length,
+					void *user_data)
+{
+	struct att_chans *chans = user_data;
+	const uint8_t value[] = { 0x01, 0x02 };
+
+	g_assert(chan == chans->server_chans[1]);
+	g_assert_cmpuint(length, >=, 2);
+	g_assert_cmpuint(get_le16(pdu), ==, ATT_PIN_HANDLE);
+
+	if (opcode == BT_ATT_OP_READ_REQ)
+		bt_att_chan_send_rsp(chan, BT_ATT_OP_READ_RSP, value,
+							sizeof(value));
+
+	chans->received++;
+	att_pin_check(chans);
+}
+
+static void att_pin_rsp(uint8_t opcode, const void *pdu, uint16_t length,
+							void *user_data)
+{
+	struct att_chans *chans = user_data;
+
+	g_assert_cmpuint(opcode, ==, BT_ATT_OP_READ_RSP);
+
+	chans->responses++;
+	att_pin_check(chans);
+}
+
+static void att_pin_ready(struct att_chans *chans)
+{
+	uint8_t read[2], write[6] = { 0, 0, 0x01, 0x02, 0x03, 0x04 };
+	unsigned int i;
+
+	bt_att_register(chans->server_att, BT_ATT_OP_READ_REQ, att_pin_server,
+								chans, NULL);
+	bt_att_register(chans->server_att, BT_ATT_OP_WRITE_CMD,
+					att_pin_server, chans, NULL);
+
+	g_assert(bt_att_pin_handle(chans->client_att, ATT_PIN_HANDLE,
+						chans->client_chans[1]));
+
+	put_le16(ATT_PIN_HANDLE, read);
+	put_le16(ATT_PIN_HANDLE, write);
+
+	for (i = 0; i < ATT_PIN_COUNT; i++) {
+		g_assert(bt_att_send(chans->client_att, BT_ATT_OP_READ_REQ,
+					read, sizeof(read), att_pin_rsp,
+					chans, NULL));
+		g_assert(bt_att_send(chans->client_att, BT_ATT_OP_WRITE_CMD,
+					write, sizeof(write), NULL, NULL,
+					NULL));
+	}
+}
+
+/*
+ * Requests and commands for a pinned handle all go over the channel it is
+ * pinned to and the channel counters account for every PDU and octet.
+ */
+static void test_att_pin(const void *user_data)
+{
+	att_chans_start(att_pin_ready, BT_ATT_DEFAULT_LE_MTU);
+}
+
+static void att_first_fit_server(struct bt_att_chan *chan, uint8_t opcode,
+					const void *pdu, uint16_t length,
+					void *user_data)
+{
+	struct att_chans *chans = user_data;
+	const uint8_t value[] = { 0x01, 0x02 };
+
+	if (opcode == BT_ATT_OP_WRITE_REQ) {
+		/* Only sent once the held read is answered */
+		g_assert(!chans->held);
+		g_assert(chan == chans->server_chans[ATT_BIG_CHAN]);
+		bt_att_chan_send_rsp(chan, BT_ATT_OP_WRITE_RSP, NULL, 0);
+		return;
+	}
+
+	if (get_le16(pdu) == ATT_HELD_HANDLE) {
+		g_assert(chan == chans->server_chans[ATT_BIG_CHAN]);
+		chans->held = chan;
+		return;
+	}
+
+	g_assert(chan != chans->server_chans[ATT_BIG_CHAN]);
+	bt_att_chan_send_rsp(chan, BT_ATT_OP_READ_RSP, value, sizeof(value));
+}
+
+static void att_first_fit_rsp(uint8_t opcode, const void *pdu,
+					uint16_t length, void *user_data)
+{
+	struct att_chans *chans = user_data;
+	const uint8_t value[] = { 0x01, 0x02 };
+
+	if (opcode == BT_ATT_OP_WRITE_RSP) {
+		g_assert_cmpuint(chans->responses, ==, 3);
+		att_chans_done();
+		return;
+	}
+
+	g_assert_cmpuint(opcode, ==, BT_ATT_OP_READ_RSP);
+
+	/* Release the held read once both small reads got through */
+	if (++chans->responses == 2) {
+		g_assert(chans->held);
+		bt_att_chan_send_rsp(chans->held, BT_ATT_OP_READ_RSP, value,
+							sizeof(value));
+		chans->held = NULL;
+	}
+}
+
+static void att_first_fit_ready(struct att_chans *chans)
+{
+	uint8_t read[2], write[2 + ATT_BIG_MTU - 3];
+	unsigned int i;
+
+	bt_att_register(chans->server_att, BT_ATT_OP_READ_REQ,
+					att_first_fit_server, chans, NULL);
+	bt_att_register(chans->server_att, BT_ATT_OP_WRITE_REQ,
+					att_first_fit_server, chans, NULL);
+
+	/* Keep the only channel able to carry the write busy */
+	g_assert(bt_att_pin_handle(chans->client_att, ATT_HELD_HANDLE,
+					chans->client_chans[ATT_BIG_CHAN]));
+
+	put_le16(ATT_HELD_HANDLE, read);
+	g_assert(bt_att_send(chans->client_att, BT_ATT_OP_READ_REQ, read,
+					sizeof(read), att_first_fit_rsp,
+					chans, NULL));
+
+	memset(write, 0xaa, sizeof(write));
+	put_le16(ATT_WRITE_HANDLE, write);
+	g_assert(bt_att_send(chans->client_att, BT_ATT_OP_WRITE_REQ, write,
+					sizeof(write), att_first_fit_rsp,
+					chans, NULL));
+
+	put_le16(ATT_PIN_HANDLE, read);
+
+	for (i = 0; i < 2; i++)
+		g_assert(bt_att_send(chans->client_att, BT_ATT_OP_READ_REQ,
+					read, sizeof(read), att_first_fit_rsp,
+					chans, NULL));
+}
+
+/*
+ * A write only the bigger MTU channel can carry waits behind a read held by
+ * the server on that channel, the smaller reads queued after it must not.
+ */
+static void test_att_first_fit(const void *user_data)
+{
+	att_chans_start(att_first_fit_ready, ATT_BIG_MTU);
+}
+
+static void att_ind_check(struct att_chans *chans)
+{
+	unsigned int i;
+
+	if (!chans->confirmed || chans->received < G_N_ELEMENTS(chans->opcodes))
+		return;
+
+	/* Only what was queued on the channel itself may go before it */
+	g_assert_cmpuint(chans->opcodes[0], ==, BT_ATT_OP_HANDLE_NFY);
+	g_assert_cmpuint(chans->opcodes[1], ==, BT_ATT_OP_HANDLE_IND);
+
+	for (i = 2; i < G_N_ELEMENTS(chans->opcodes); i++)
+		g_assert_cmpuint(chans->opcodes[i], ==, BT_ATT_OP_HANDLE_NFY);
+
+	att_chans_done();
+}
+
+static void att_ind_client(struct bt_att_chan *chan, uint8_t opcode,
+					const void *pdu, uint16_t length,
+					void *user_data)
+{
+	struct att_chans *chans = user_data;
+
+	g_assert(chan == chans->client_chans[0]);
+	g_assert_cmpuint(chans->received, <, G_N_ELEMENTS(chans->opcodes));
+
+	chans->opcodes[chans->received++] = opcode;
+
+	if (opcode == BT_ATT_OP_HANDLE_IND)
+		bt_att_chan_send(chan, BT_ATT_OP_HANDLE_CONF, NULL, 0, NULL,
+								NULL, NULL);
+
+	att_ind_check(chans);
+}
+
+static void att_ind_conf(uint8_t opcode, const void *pdu, uint16_t length,
+							void *user_data)
+{
+	struct att_chans *chans = user_data;
+
+	g_assert_cmpuint(opcode, ==, BT_ATT_OP_HANDLE_CONF);
+
+	chans->confirmed = true;
+	att_ind_check(chans);
+}
+
+static void att_ind_ready(struct att_chans *chans)
+{
+	uint8_t pdu[4] = { 0, 0, 0x01, 0x02 };
+	unsigned int i;
+
+	bt_att_register(chans->client_att, BT_ATT_OP_HANDLE_NFY,
+					att_ind_client, chans, NULL);
+	bt_att_register(chans->client_att, BT_ATT_OP_HANDLE_IND,
+					att_ind_client, chans, NULL);
+
+	g_assert(bt_att_pin_handle(chans->server_att, ATT_PIN_HANDLE,
+						chans->server_chans[0]));
+
+	put_le16(ATT_PIN_HANDLE, pdu);
+
+	/* Make the channel busy so the rest has to be queued */
+	bt_att_chan_send(chans->server_chans[0], BT_ATT_OP_HANDLE_NFY, pdu,
+						sizeof(pdu), NULL, NULL, NULL);
+
+	for (i = 0; i < ATT_NFY_COUNT; i++)
+		g_assert(bt_att_send(chans->server_att, BT_ATT_OP_HANDLE_NFY,
+					pdu, sizeof(pdu), NULL, NULL, NULL));
+
+	g_assert(bt_att_send(chans->server_att, BT_ATT_OP_HANDLE_IND, pdu,
+					sizeof(pdu), att_ind_conf, chans,
+					NULL));
+}
+
+/*
+ * An indication queued behind notifications is written first since the
+ * peer cannot confirm it before having received it.
+ */
+static void test_att_indication_order(const void *user_data)
+{
+	att_chans_start(att_ind_ready, BT_ATT_DEFAULT_LE_MTU);
+}
+
+#define BENCH_NUM_SERVICES	500
+#define BENCH_NUM_CHRCS		4
+#define BENCH_ROUNDS		20
+
+static const bool timed = true;
+
+static struct gatt_db *make_bench_db(unsigned int num_services,
+						unsigned int num_chrcs)
+{
+	struct gatt_db *db = gatt_db_new();
+	unsigned int i, j;
+
+	for (i = 0; i < num_services; i++) {
+		struct gatt_db_attribute *svc, *chrc;
+		bt_uuid_t uuid;
+
+		bt_uuid16_create(&uuid, 0x1800 + (i % 0x100));
+		svc = gatt_db_add_service(db, &uuid, true, 1 + num_chrcs * 3);
+		g_assert(svc != NULL);
+
+		for (j = 0; j < num_chrcs; j++) {
+			bt_uuid16_create(&uuid, 0x2a00 + j);
+			chrc = gatt_db_service_add_characteristic(svc, &uuid,
+						BT_ATT_PERM_READ,
+						BT_GATT_CHRC_PROP_READ |
+						BT_GATT_CHRC_PROP_NOTIFY,
+						NULL, NULL, NULL);
+			g_assert(chrc != NULL);
+
+			bt_uuid16_create(&uuid, GATT_CLIENT_CHARAC_CFG_UUID);
+			g_assert(gatt_db_service_add_descriptor(svc, &uuid,
+						BT_ATT_PERM_READ |
+						BT_ATT_PERM_WRITE,
+						NULL, NULL, NULL) != NULL);
+		}
+
+		gatt_db_service_set_active(svc, true);
+	}
+
+	return db;
+}
+
+struct bench_lookup {
+	uint16_t handle;
+	struct gatt_db_attribute *attr;
+};
+
+static void bench_lookup_attr(struct gatt_db_attribute *attr, void *user_data)
+{
+	struct bench_lookup *lookup = user_data;
+
+	if (gatt_db_attribute_get_handle(attr) == lookup->handle)
+		lookup->attr = attr;
+}
+
+static void bench_lookup_svc(struct gatt_db_attribute *attr, void *user_data)
+{
+	struct bench_lookup *lookup = user_data;
+	uint16_t start, end;
+
+	if (lookup->attr)
+		return;
+
+	gatt_db_attribute_get_service_handles(attr, &start, &end);
+	if (lookup->handle < start || lookup->handle > end)
+		return;
+
+	gatt_db_service_foreach(attr, NULL, bench_lookup_attr, lookup);
+}
+
+/* Reference linear lookup walking every service, as done by a list scan */
+static struct gatt_db_attribute *bench_linear_lookup(struct gatt_db *db,
+							uint16_t handle)
+{
+	struct bench_lookup lookup = { .handle = handle };
+
+	gatt_db_foreach_service(db, NULL, bench_lookup_svc, &lookup);
+
+	return lookup.attr;
+}
+
+/*
+ * Checks indexed lookups against a linear walk of the database, repeating
+ * them for timing when benchmarking.
+ */
+static void test_db_lookup(const void *user_data)
+{
+	struct gatt_db *db;
+	uint64_t start, linear, indexed;
+	uint16_t last, handle;
+	unsigned int i, ops = 0, rounds = user_data ? BENCH_ROUNDS : 1;
+
+	db = make_bench_db(BENCH_NUM_SERVICES, BENCH_NUM_CHRCS);
+	last = BENCH_NUM_SERVICES * (1 + BENCH_NUM_CHRCS * 3);
+
+	start = tester_now_usec();
+
+	for (handle = 1; handle <= last; handle++)
+		g_assert(bench_linear_lookup(db, handle) != NULL);
+
+	linear = tester_now_usec() - start;
+
+	start = tester_now_usec();
+
+	for (i = 0; i < rounds; i++) {
+		for (handle = 1; handle <= last; handle++, ops++) {
+			struct gatt_db_attribute *attr;
+
+			attr = gatt_db_get_attribute(db, handle);
+			g_assert(attr != NULL);
+			g_assert(gatt_db_attribute_get_handle(attr) == handle);
+		}
+	}
+
+	indexed = tester_now_usec() - start;
+
+	g_assert(gatt_db_get_attribute(db, last + 1) == NULL);
+
+	if (user_data)
+		tester_print("%u attributes: linear %.3f us/lookup, "
+					"indexed %.3f us/lookup", last,
+					(double) linear / last,
+					(double) indexed / ops);
+
+	/* Remove every other service and check lookups stay consistent */
+	for (handle = 1; handle <= last; handle += 2 * (1 + BENCH_NUM_CHRCS * 3))
+		g_assert(gatt_db_remove_service(db,
+					gatt_db_get_attribute(db, handle)));
+
+	for (handle = 1; handle <= last; handle++) {
+		uint16_t svc = (handle - 1) / (1 + BENCH_NUM_CHRCS * 3);
+
+		if (svc % 2)
+			g_assert(gatt_db_get_attribute(db, handle) != NULL);
+		else
+			g_assert(gatt_db_get_attribute(db, handle) == NULL);
+	}
+
+	g_assert(gatt_db_clear_range(db, 1, last / 2));
+	g_assert(gatt_db_get_service(db, 1 + BENCH_NUM_CHRCS * 3) == NULL);
+	g_assert(gatt_db_get_service(db, last) != NULL);
+
+	gatt_db_unref(db);
+
+	tester_test_passed();
+}
+
+#define BENCH_DISC_SERVICES	154
+#define BENCH_DISC_PER_PDU	4
+
+static void bench_push_attr(struct gatt_db_attribute *attr, void *user_data)
+{
+	queue_push_tail(user_data, attr);
+}
+
+static void bench_count_attr(struct gatt_db_attribute *attr, void *user_data)
+{
+	unsigned int *count = user_data;
+
+	(*count)++;
+}
+
+/*
+ * Emulates a Read By Type discovery where each response PDU only fits a few
+ * attributes, returning the number of attributes found.
+ */
+static unsigned int bench_discover(struct gatt_db *db, const bt_uuid_t *type,
+								bool indexed)
+{
+	struct queue *q = queue_new();
+	unsigned int count = 0;
+	uint16_t start = 0x0001;
+
+	while (true) {
+		struct gatt_db_attribute *attr;
+		unsigned int i;
+
+		if (indexed)
+			gatt_db_read_by_type(db, start, 0xffff, *type, q);
+		else
+			gatt_db_foreach_in_range(db, type, bench_push_attr, q,
+								start, 0xffff);
+
+		if (queue_isempty(q))
+			break;
+
+		for (i = 0; i < BENCH_DISC_PER_PDU &&
+					(attr = queue_pop_head(q)); i++) {
+			start = gatt_db_attribute_get_handle(attr) + 1;
+			count++;
+		}
+
+		queue_remove_all(q, NULL, NULL, NULL);
+
+		if (!start)
+			break;
+	}
+
+	queue_destroy(q, NULL);
+
+	return count;
+}
+
+static void test_db_discovery(const void *user_data)
+{
+	struct gatt_db *db;
+	const uint8_t svc_value[] = { 0x01, 0x18 };
+	bt_uuid_t chrc, ccc, prim;
+	uint64_t start, linear, indexed;
+	unsigned int count;
+
+	db = make_bench_db(BENCH_DISC_SERVICES, BENCH_NUM_CHRCS);
+
+	bt_uuid16_create(&chrc, GATT_CHARAC_UUID);
+	bt_uuid16_create(&ccc, GATT_CLIENT_CHARAC_CFG_UUID);
+	bt_uuid16_create(&prim, GATT_PRIM_SVC_UUID);
+
+	start = tester_now_usec();
+
+	count = bench_discover(db, &chrc, false);
+	g_assert(count == BENCH_DISC_SERVICES * BENCH_NUM_CHRCS);
+
+	linear = tester_now_usec() - start;
+
+	start = tester_now_usec();
+
+	count = bench_discover(db, &chrc, true);
+	g_assert(count == BENCH_DISC_SERVICES * BENCH_NUM_CHRCS);
+
+	indexed = tester_now_usec() - start;
+
+	g_assert(bench_discover(db, &ccc, true) ==
+					BENCH_DISC_SERVICES * BENCH_NUM_CHRCS);
+	g_assert(gatt_db_find_by_type_value(db, 0x0001, 0xffff, &prim,
+						svc_value, sizeof(svc_value),
+						bench_count_attr, &count) == 1);
+
+	if (user_data)
+		tester_print("%u attributes: Read By Type discovery linear %"
+				PRIu64 " us, indexed %" PRIu64 " us",
+				BENCH_DISC_SERVICES * (1 + BENCH_NUM_CHRCS * 3),
+				linear, indexed);
+
+	gatt_db_unref(db);
+
+	tester_test_passed();
+}
+
+#define BENCH_RTT_SERVICES	64
+#define BENCH_RTT_CHANNELS	4
+
+struct bench_rtt {
+	unsigned int parallel;
+	struct gatt_db *server_db;
+	struct gatt_db *client_db;
+	struct bt_att *server_att;
+	struct bt_att *client_att;
+	struct bt_gatt_server *server;
+	struct bt_gatt_client *client;
+	struct bt_att_chan *chans[BENCH_RTT_CHANNELS];
+	unsigned int total;
+	unsigned int round_trips;
+};
+
+static struct bench_rtt bench_rtt[2];
+
+/* Everything the server writes during discovery is a response */
+static uint64_t bench_rtt_responses(struct bench_rtt *rtt)
+{
+	struct bt_att_chan_stats stats;
+	uint64_t responses = 0;
+	unsigned int i;
+
+	for (i = 0; i < BENCH_RTT_CHANNELS && rtt->chans[i]; i++) {
+		g_assert(bt_att_chan_get_stats(rtt->chans[i], &stats));
+		responses += stats.tx_pdus;
+	}
+
+	return responses;
+}
+
+static void bench_rtt_request(struct bt_att_chan *chan, uint8_t opcode,
+					const void *pdu, uint16_t length,
+					void *user_data)
+{
+	struct bench_rtt *rtt = user_data;
+	unsigned int i;
+
+	for (i = 0; i < BENCH_RTT_CHANNELS; i++) {
+		if (!rtt->chans[i])
+			rtt->chans[i] = chan;
+
+		if (rtt->chans[i] == chan)
+			break;
+	}
+
+	/*
+	 * A request arriving while every earlier one has been answered
+	 * starts a new round trip, the ones arriving before that share it.
+	 */
+	if (rtt->total == bench_rtt_responses(rtt))
+		rtt->round_trips++;
+
+	rtt->total++;
+}
+
+static void bench_count_svc(struct gatt_db_attribute *attr, void *user_data)
+{
+	gatt_db_service_foreach(attr, NULL, bench_count_attr, user_data);
+}
+
+static unsigned int bench_db_attrs(struct gatt_db *db)
+{
+	unsigned int count = 0;
+
+	gatt_db_foreach_service(db, NULL, bench_count_svc, &count);
+
+	return count;
+}
+
+static void bench_rtt_free(struct bench_rtt *rtt)
+{
+	bt_gatt_client_unref(rtt->client);
+	bt_gatt_server_unref(rtt->server);
+	bt_att_unref(rtt->client_att);
+	bt_att_unref(rtt->server_att);
+	gatt_db_unref(rtt->client_db);
+	gatt_db_unref(rtt->server_db);
+}
+
+static void bench_rtt_start(struct bench_rtt *rtt);
+
+static void bench_rtt_ready(bool success, uint8_t att_ecode, void *user_data)
+{
+	struct bench_rtt *rtt = user_data;
+
+	g_assert(success);
+	g_assert_cmpuint(bench_db_attrs(rtt->client_db), ==,
+					bench_db_attrs(rtt->server_db));
+
+	if (rtt == &bench_rtt[0]) {
+		bench_rtt_start(&bench_rtt[1]);
+		return;
+	}
+
+	tester_debug("%u attributes over %u channels: sequential %u requests "
+				"%u round trips, parallel %u requests "
+				"%u round trips",
+				bench_db_attrs(rtt->server_db),
+				BENCH_RTT_CHANNELS, bench_rtt[0].total,
+				bench_rtt[0].round_trips, rtt->total,
+				rtt->round_trips);
+
+	g_assert_cmpuint(rtt->round_trips, <, bench_rtt[0].round_trips);
+
+	bench_rtt_free(&bench_rtt[0]);
+	bench_rtt_free(&bench_rtt[1]);
+
+	tester_test_passed();
+}
+
+static void bench_rtt_start(struct bench_rtt *rtt)
+{
+	unsigned int i;
+	int sv[2];
+
+	rtt->server_db = make_bench_db(BENCH_RTT_SERVICES, BENCH_NUM_CHRCS);
+	rtt->client_db = gatt_db_new();
+
+	for (i = 0; i < BENCH_RTT_CHANNELS; i++) {
+		g_assert(!socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0,
+									sv));
+
+		if (!i) {
+			rtt->server_att = bt_att_new(sv[0], false);
+			rtt->client_att = bt_att_new(sv[1], false);
+			g_assert(rtt->server_att && rtt->client_att);
+
+			bt_att_set_close_on_unref(rtt->server_att, true);
+			bt_att_set_close_on_unref(rtt->client_att, true);
+			continue;
+		}
+
+		g_assert(!bt_att_attach_fd(rtt->server_att, sv[0]));
+		g_assert(!bt_att_attach_fd(rtt->client_att, sv[1]));
+	}
+
+	rtt->server = bt_gatt_server_new(rtt->server_db, rtt->server_att,
+							BT_ATT_DEFAULT_LE_MTU, 0);
+	g_assert(rtt->server);
+
+	bt_att_register(rtt->server_att, BT_ATT_ALL_REQUESTS,
+					bench_rtt_request, rtt, NULL);
+
+	rtt->client = bt_gatt_client_new(rtt->client_db, rtt->client_att,
+							BT_ATT_DEFAULT_LE_MTU, 0);
+	g_assert(rtt->client);
+
+	bt_gatt_client_set_parallel_discovery(rtt->client, rtt->parallel);
+	bt_gatt_client_ready_register(rtt->client, bench_rtt_ready, rtt,
+									NULL);
+}
+
+/*
+ * Discovers a large database over multiple ATT channels, first one request
+ * at a time and then with services discovered in parallel.
+ */
+static void test_client_parallel_discovery(const void *user_data)
+{
+	memset(bench_rtt, 0, sizeof(bench_rtt));
+
+	bench_rtt[1].parallel = BENCH_RTT_CHANNELS;
+
+	bench_rtt_start(&bench_rtt[0]);
+}
+
 int main(int argc, char *argv[])
 {
 	struct gatt_db *service_db_1, *service_db_2, *service_db_3;
@@ -3254,6 +4095,15 @@ int main(int argc, char *argv[])
 			raw_pdu(),
 			raw_pdu(0x1B, 0x03, 0x00, 0x01, 0x02, 0x03));
 
+	define_test_server("/notification/server/multiple", test_server,
+			ts_small_db, &test_notification_server_2,
+			raw_pdu(0x03, 0x00, 0x02),
+			raw_pdu(0x12, 0x04, 0x00, 0x01, 0x00),
+			raw_pdu(0x13),
+			raw_pdu(),
+			raw_pdu(0x23, 0x03, 0x00, 0x03, 0x00, 0x01, 0x02, 0x03,
+					0x03, 0x00, 0x03, 0x00, 0x01, 0x02, 0x03));
+
 	define_test_server("/TP/GAI/SR/BV-01-C", test_server, ts_small_db,
 			&test_indication_server_1,
 			raw_pdu(0x03, 0x00, 0x02),
@@ -4472,5 +5322,23 @@ int main(int argc, char *argv[])
 			raw_pdu(0xff, 0x00),
 			raw_pdu());
 
+	tester_add("/att/eatt/pin", NULL, NULL, test_att_pin, NULL);
+	tester_add("/att/eatt/first-fit", NULL, NULL, test_att_first_fit,
+									NULL);
+	tester_add("/att/eatt/indication-order", NULL, NULL,
+					test_att_indication_order, NULL);
+
+	tester_add("/gatt-db/lookup", NULL, NULL, test_db_lookup, NULL);
+	tester_add("/gatt-db/discovery", NULL, NULL, test_db_discovery, NULL);
+	tester_add("/gatt-client/parallel-discovery", NULL, NULL,
+					test_client_parallel_discovery, NULL);
+
+	if (tester_use_benchmark()) {
+		tester_add("/benchmark/gatt-db/lookup", &timed, NULL,
+						test_db_lookup, NULL);
+		tester_add("/benchmark/gatt-db/discovery", &timed, NULL,
+						test_db_discovery, NULL);
+	}
+
 	return tester_run();
 }
@@ -0,0 +1,385 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <ell/ell.h>
+
+#include "mesh/net-cache.h"
+
+#define EXITIF(cond, ...) do {						\
+		if (cond) {						\
+			l_error(__VA_ARGS__);				\
+			exit(1);					\
+		}							\
+	} while (0)
+
+/* Linear reference model, used to cross-check the hashed implementation */
+struct ref_entry {
+	uint64_t key;
+	uint32_t tag;
+};
+
+struct ref_cache {
+	struct ref_entry *entries;
+	unsigned int size;
+	unsigned int len;
+	bool lru;
+};
+
+static bool ref_check_add(struct ref_cache *ref, uint64_t key, uint32_t tag)
+{
+	struct ref_entry entry = { .key = key, .tag = tag };
+	unsigned int i;
+	bool found = false;
+
+	for (i = 0; i < ref->len; i++) {
+		if (ref->entries[i].key == key && ref->entries[i].tag == tag) {
+			found = true;
+			break;
+		}
+	}
+
+	if (found && !ref->lru)
+		return true;
+
+	if (!found && ref->len < ref->size)
+		i = ref->len++;
+	else if (!found)
+		i = ref->len - 1;
+
+	/* Newest first */
+	memmove(&ref->entries[1], &ref->entries[0], i * sizeof(entry));
+	ref->entries[0] = entry;
+
+	return found;
+}
+
+static void test_basic(void)
+{
+	struct net_cache *cache;
+	unsigned int i;
+
+	l_info("[Basic]");
+
+	EXITIF(net_cache_new(0, true), "Zero sized cache created");
+
+	cache = net_cache_new(4, true);
+	EXITIF(net_cache_get_size(cache) != 4, "Bad size");
+
+	for (i = 0; i < 4; i++)
+		EXITIF(net_cache_check_add(cache, i, 0), "%u not new", i);
+
+	for (i = 0; i < 4; i++)
+		EXITIF(!net_cache_check_add(cache, i, 0), "%u not cached", i);
+
+	/* Same key with a different tag is a different entry */
+	EXITIF(net_cache_check_add(cache, 0, 1), "Tag ignored");
+
+	/* Key 0 was used least recently and got replaced */
+	EXITIF(net_cache_check_add(cache, 0, 0), "Oldest entry not replaced");
+	EXITIF(!net_cache_check_add(cache, 0, 1), "New entry missing");
+
+	net_cache_clear(cache);
+
+	for (i = 0; i < 4; i++)
+		EXITIF(net_cache_check_add(cache, i, 0), "%u survived clear",
+									i);
+
+	/* A hit moves the entry to the front */
+	EXITIF(!net_cache_check_add(cache, 0, 0), "0 not cached");
+	EXITIF(net_cache_check_add(cache, 100, 0), "100 not new");
+	EXITIF(!net_cache_check_add(cache, 0, 0), "0 evicted");
+	EXITIF(net_cache_check_add(cache, 1, 0), "1 still cached");
+
+	net_cache_free(cache);
+
+	/* Without LRU a hit leaves the order alone */
+	cache = net_cache_new(4, false);
+
+	for (i = 0; i < 4; i++)
+		EXITIF(net_cache_check_add(cache, i, 0), "%u not new", i);
+
+	EXITIF(!net_cache_check_add(cache, 0, 0), "0 not cached");
+	EXITIF(net_cache_check_add(cache, 100, 0), "100 not new");
+	EXITIF(net_cache_check_add(cache, 0, 0), "0 still cached");
+	EXITIF(!net_cache_check_add(cache, 2, 0), "2 evicted");
+
+	net_cache_free(cache);
+}
+
+static void test_model(unsigned int size, unsigned int key_space,
+						unsigned int ops, bool lru)
+{
+	struct net_cache *cache = net_cache_new(size, lru);
+	struct ref_cache ref = {
+		.entries = l_new(struct ref_entry, size),
+		.size = size,
+		.lru = lru,
+	};
+	unsigned int i, hits = 0;
+
+	l_info("[Model] %s size %u, %u keys, %u operations",
+				lru ? "LRU" : "FIFO", size, key_space, ops);
+
+	srand(size);
+
+	for (i = 0; i < ops; i++) {
+		unsigned int r = rand() % key_space;
+		uint64_t key = (uint64_t) r * 0x10001;
+		uint32_t tag = r & 3;
+		bool expect, got;
+
+		expect = ref_check_add(&ref, key, tag);
+		got = net_cache_check_add(cache, key, tag);
+
+		EXITIF(expect != got, "Mismatch at %u: key %u expected %d",
+								i, r, expect);
+
+		hits += got;
+	}
+
+	l_info("  %u hits", hits);
+
+	l_free(ref.entries);
+	net_cache_free(cache);
+}
+
+/* Old l_queue based implementation, kept for comparison */
+struct queue_msg {
+	uint16_t src;
+	uint32_t seq;
+	uint32_t mic;
+};
+
+static bool match_queue_msg(const void *a, const void *b)
+{
+	const struct queue_msg *msg = a;
+	const struct queue_msg *tst = b;
+
+	return msg->seq == tst->seq && msg->mic == tst->mic &&
+							msg->src == tst->src;
+}
+
+static bool queue_msg_in_cache(struct l_queue *cache, unsigned int size,
+				uint16_t src, uint32_t seq, uint32_t mic)
+{
+	struct queue_msg tst = { .src = src, .seq = seq, .mic = mic };
+	struct queue_msg *msg;
+
+	msg = l_queue_remove_if(cache, match_queue_msg, &tst);
+	if (msg) {
+		l_queue_push_head(cache, msg);
+		return true;
+	}
+
+	msg = l_new(struct queue_msg, 1);
+	*msg = tst;
+	l_queue_push_head(cache, msg);
+
+	if (l_queue_length(cache) > size)
+		l_free(l_queue_pop_tail(cache));
+
+	return false;
+}
+
+static bool match_queue_hash(const void *a, const void *b)
+{
+	return *(const uint64_t *) a == *(const uint64_t *) b;
+}
+
+static bool queue_check_fast(struct l_queue *cache, unsigned int size,
+								uint64_t hash)
+{
+	uint64_t *entry;
+
+	if (l_queue_find(cache, match_queue_hash, &hash))
+		return false;
+
+	if (l_queue_length(cache) >= size)
+		entry = l_queue_pop_head(cache);
+	else
+		entry = l_malloc(sizeof(hash));
+
+	*entry = hash;
+	l_queue_push_tail(cache, entry);
+
+	return true;
+}
+
+#define BENCH_PDUS		200000
+#define BENCH_REPEATS		3
+#define BENCH_SOURCES		256
+#define BENCH_RX_CACHE		8
+#define BENCH_WINDOW		16
+
+struct bench_pdu {
+	uint64_t hash;
+	uint32_t seq;
+	uint32_t mic;
+	uint16_t src;
+};
+
+/*
+ * Synthetic relay traffic: each network PDU is heard BENCH_REPEATS times,
+ * the first repeat being the same advertisement (caught by the Rx cache)
+ * and the others retransmissions by neighbouring relays.
+ */
+static struct bench_pdu *bench_traffic(unsigned int *count)
+{
+	unsigned int n = BENCH_PDUS * BENCH_REPEATS;
+	struct bench_pdu *pdus = l_new(struct bench_pdu, n);
+	uint32_t seq[BENCH_SOURCES] = { 0 };
+	unsigned int i, j;
+
+	srand(1);
+
+	for (i = 0; i < BENCH_PDUS; i++) {
+		uint16_t src = 1 + rand() % BENCH_SOURCES;
+		uint32_t mic = rand();
+
+		for (j = 0; j < BENCH_REPEATS; j++) {
+			struct bench_pdu *pdu = &pdus[i * BENCH_REPEATS + j];
+
+			pdu->src = src;
+			pdu->seq = seq[src - 1];
+			pdu->mic = mic;
+
+			/* Relays re-obfuscate with a new TTL, so only the
+			 * first copy shares the raw header.
+			 */
+			pdu->hash = ((uint64_t) mic << 32) | (j > 1 ? j : 0);
+		}
+
+		seq[src - 1]++;
+	}
+
+	/* Interleave retransmissions with nearby traffic by shuffling
+	 * blocks of BENCH_WINDOW receptions.
+	 */
+	for (i = 0; i < n; i++) {
+		unsigned int base = i - i % BENCH_WINDOW;
+		struct bench_pdu tmp;
+
+		j = base + rand() % BENCH_WINDOW;
+		if (j >= n)
+			continue;
+
+		tmp = pdus[i];
+		pdus[i] = pdus[j];
+		pdus[j] = tmp;
+	}
+
+	*count = n;
+
+	return pdus;
+}
+
+static void test_relay_benchmark(unsigned int msg_cache_size)
+{
+	struct bench_pdu *pdus;
+	struct net_cache *rx_cache, *msg_cache;
+	struct l_queue *rx_queue, *msg_queue;
+	uint64_t start, hashed, queued;
+	unsigned int count, i, relayed_hashed = 0, relayed_queued = 0;
+
+	l_info("[Relay benchmark] message cache size %u", msg_cache_size);
+
+	pdus = bench_traffic(&count);
+
+	rx_cache = net_cache_new(BENCH_RX_CACHE, false);
+	msg_cache = net_cache_new(msg_cache_size, true);
+
+	start = l_time_now();
+
+	for (i = 0; i < count; i++) {
+		const struct bench_pdu *pdu = &pdus[i];
+
+		if (net_cache_check_add(rx_cache, pdu->hash, 0))
+			continue;
+
+		if (!net_cache_check_add(msg_cache,
+					((uint64_t) pdu->src << 32) | pdu->seq,
+					pdu->mic))
+			relayed_hashed++;
+	}
+
+	hashed = l_time_now() - start + 1;
+
+	rx_queue = l_queue_new();
+	msg_queue = l_queue_new();
+
+	start = l_time_now();
+
+	for (i = 0; i < count; i++) {
+		const struct bench_pdu *pdu = &pdus[i];
+
+		if (!queue_check_fast(rx_queue, BENCH_RX_CACHE, pdu->hash))
+			continue;
+
+		if (!queue_msg_in_cache(msg_queue, msg_cache_size, pdu->src,
+							pdu->seq, pdu->mic))
+			relayed_queued++;
+	}
+
+	queued = l_time_now() - start + 1;
+
+	l_info("  %u PDUs, %u relayed: hashed %" PRIu64 " PDUs/sec, "
+			"queue %" PRIu64 " PDUs/sec", count, relayed_hashed,
+			(uint64_t) count * 1000000 / hashed,
+			(uint64_t) count * 1000000 / queued);
+
+	/* Every PDU is forwarded exactly once by both implementations */
+	EXITIF(relayed_hashed != BENCH_PDUS, "Relayed %u of %u",
+						relayed_hashed, BENCH_PDUS);
+	EXITIF(relayed_queued != BENCH_PDUS, "Queue relayed %u of %u",
+						relayed_queued, BENCH_PDUS);
+
+	l_queue_destroy(msg_queue, l_free);
+	l_queue_destroy(rx_queue, l_free);
+	net_cache_free(msg_cache);
+	net_cache_free(rx_cache);
+	l_free(pdus);
+}
+
+int main(int argc, char *argv[])
+{
+	bool benchmark = argc > 1 && (!strcmp(argv[1], "-b") ||
+					!strcmp(argv[1], "--benchmark"));
+
+	l_log_set_stderr();
+
+	test_basic();
+
+	test_model(1, 4, 1000, true);
+	test_model(8, 16, 200000, true);
+	test_model(70, 100, 200000, true);
+	test_model(70, 1000, 200000, true);
+	test_model(1000, 1500, 200000, true);
+
+	test_model(1, 4, 1000, false);
+	test_model(8, 16, 200000, false);
+	test_model(70, 1000, 200000, false);
+
+	/* Throughput comparison with the old queues, only on request */
+	if (benchmark) {
+		test_relay_benchmark(70);
+		test_relay_benchmark(1024);
+	}
+
+	return 0;
+}
@@ -0,0 +1,389 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ *  Copyright (C) 2026  agent <agent@local>
+ *
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+
+#include <ell/ell.h>
+
+#include "mesh/mesh-defs.h"
+#include "mesh/rpl-journal.h"
+
+#define EXITIF(cond, ...) do {						\
+		if (cond) {						\
+			l_error(__VA_ARGS__);				\
+			exit(1);					\
+		}							\
+	} while (0)
+
+#define HDR_LEN		8
+#define REC_LEN		8
+#define NO_SEQ		0xffffffff
+
+/* Expected journal contents, indexed by source address */
+static uint32_t model[VIRTUAL_ADDRESS_LOW];
+static uint32_t loaded[VIRTUAL_ADDRESS_LOW];
+static uint16_t last_src;
+static bool ordered;
+
+static char tmp_dir[64];
+static char path[PATH_MAX];
+
+static void load_entry(uint16_t src, uint32_t seq, void *user_data)
+{
+	unsigned int *count = user_data;
+
+	EXITIF(!IS_UNICAST(src), "Bad source %4.4x", src);
+	EXITIF(loaded[src] != NO_SEQ, "Source %4.4x reported twice", src);
+
+	if (last_src >= src)
+		ordered = false;
+
+	last_src = src;
+	loaded[src] = seq;
+	(*count)++;
+}
+
+static struct rpl_journal *reopen_file(struct rpl_journal *journal,
+					const char *name, const char *label)
+{
+	unsigned int count = 0;
+
+	rpl_journal_close(journal);
+
+	memset(loaded, 0xff, sizeof(loaded));
+	last_src = 0;
+	ordered = true;
+
+	journal = rpl_journal_open(name, load_entry, &count);
+	EXITIF(!journal, "%s: open failed", label);
+	EXITIF(!ordered, "%s: entries out of order", label);
+	EXITIF(memcmp(loaded, model, sizeof(model)), "%s: bad contents",
+									label);
+
+	return journal;
+}
+
+static struct rpl_journal *reopen(struct rpl_journal *journal,
+							const char *label)
+{
+	return reopen_file(journal, path, label);
+}
+
+static void model_reset(void)
+{
+	memset(model, 0xff, sizeof(model));
+	unlink(path);
+}
+
+static off_t file_size(const char *name)
+{
+	struct stat st;
+
+	EXITIF(stat(name, &st) < 0, "stat %s failed", name);
+
+	return st.st_size;
+}
+
+static void file_append(const char *name, const void *data, size_t len)
+{
+	int fd = open(name, O_WRONLY | O_APPEND);
+
+	EXITIF(fd < 0 || write(fd, data, len) != (ssize_t) len,
+						"Failed to append to %s", name);
+	close(fd);
+}
+
+static void file_poke(const char *name, off_t off, uint8_t val)
+{
+	int fd = open(name, O_WRONLY);
+
+	EXITIF(fd < 0 || pwrite(fd, &val, 1, off) != 1,
+						"Failed to modify %s", name);
+	close(fd);
+}
+
+static void put(struct rpl_journal *journal, uint16_t src, uint32_t seq)
+{
+	EXITIF(!rpl_journal_put(journal, src, seq), "Put %4.4x failed", src);
+	model[src] = seq;
+}
+
+static void del(struct rpl_journal *journal, uint16_t src)
+{
+	EXITIF(!rpl_journal_del(journal, src), "Del %4.4x failed", src);
+	model[src] = NO_SEQ;
+}
+
+static void test_basic(void)
+{
+	struct rpl_journal *journal;
+	unsigned int i;
+
+	l_info("[Basic]");
+
+	model_reset();
+
+	journal = rpl_journal_open(path, NULL, NULL);
+	EXITIF(!journal, "Create failed");
+	EXITIF(file_size(path) != HDR_LEN, "Header not written");
+
+	EXITIF(rpl_journal_put(journal, UNASSIGNED_ADDRESS, 1),
+						"Unassigned address accepted");
+	EXITIF(rpl_journal_put(journal, VIRTUAL_ADDRESS_LOW, 1),
+						"Virtual address accepted");
+	EXITIF(rpl_journal_put(journal, 1, SEQ_MASK + 1), "Bad seq accepted");
+
+	put(journal, 0x0001, 5);
+	put(journal, 0x7fff, SEQ_MASK);
+	put(journal, 0x0100, 1);
+	put(journal, 0x0100, 2);
+	put(journal, 0x0200, 7);
+	del(journal, 0x0200);
+	del(journal, 0x0300);
+
+	journal = reopen(journal, "Basic");
+
+	/* Later records win, also after a removal */
+	put(journal, 0x0200, 3);
+	put(journal, 0x0001, 4);
+
+	journal = reopen(journal, "Basic reopen");
+
+	/* Batched flushing */
+	rpl_journal_sync(journal);
+	for (i = 1; i < 32; i++) {
+		put(journal, i, i);
+		EXITIF(rpl_journal_pending(journal) != i, "%u not pending", i);
+	}
+
+	put(journal, 32, 32);
+	EXITIF(rpl_journal_pending(journal), "Full batch not flushed");
+
+	put(journal, 33, 33);
+	EXITIF(!rpl_journal_sync(journal) || rpl_journal_pending(journal),
+							"Sync failed");
+
+	rpl_journal_close(journal);
+}
+
+static void test_torn_tail(void)
+{
+	static const uint8_t partial[5] = { 0x01, 0x00, 0x09, 0x00, 0x00 };
+	static const uint8_t zeros[64];
+	struct rpl_journal *journal;
+	off_t size;
+
+	l_info("[Torn tail]");
+
+	model_reset();
+
+	journal = rpl_journal_open(path, NULL, NULL);
+	put(journal, 0x0001, 1);
+	put(journal, 0x0002, 2);
+	rpl_journal_close(journal);
+
+	size = file_size(path);
+
+	/* Interrupted record write */
+	file_append(path, partial, sizeof(partial));
+	journal = reopen(NULL, "Partial record");
+	EXITIF(file_size(path) != size, "Partial record not dropped");
+
+	/* Appends still land on a record boundary */
+	put(journal, 0x0003, 3);
+	journal = reopen(journal, "Append after repair");
+
+	/* Space allocated but never written before a power loss */
+	rpl_journal_close(journal);
+	size = file_size(path);
+	file_append(path, zeros, sizeof(zeros));
+	journal = reopen(NULL, "Zero filled tail");
+	EXITIF(file_size(path) != size, "Zero filled tail not dropped");
+
+	rpl_journal_close(journal);
+}
+
+static void test_corruption(void)
+{
+	struct rpl_journal *journal;
+
+	l_info("[Corruption]");
+
+	model_reset();
+
+	journal = rpl_journal_open(path, NULL, NULL);
+	put(journal, 0x0001, 1);
+	put(journal, 0x0002, 2);
+	put(journal, 0x0003, 3);
+	rpl_journal_close(journal);
+
+	/* Nothing after a damaged record can be trusted */
+	file_poke(path, HDR_LEN + REC_LEN + 2, 0xaa);
+	model[0x0002] = NO_SEQ;
+	model[0x0003] = NO_SEQ;
+
+	journal = reopen(NULL, "Damaged record");
+	EXITIF(file_size(path) != HDR_LEN + REC_LEN, "Damaged tail kept");
+	EXITIF(rpl_journal_records(journal) != 1, "Bad record count");
+
+	/* An unknown header resets the journal */
+	rpl_journal_close(journal);
+	file_poke(path, 0, 'X');
+	memset(model, 0xff, sizeof(model));
+
+	journal = reopen(NULL, "Damaged header");
+	EXITIF(file_size(path) != HDR_LEN, "Damaged header kept");
+
+	rpl_journal_close(journal);
+}
+
+static void test_compaction(void)
+{
+	struct rpl_journal *journal;
+	char tmp_path[PATH_MAX + 4];
+	unsigned int i;
+
+	l_info("[Compaction]");
+
+	model_reset();
+
+	journal = rpl_journal_open(path, NULL, NULL);
+
+	for (i = 0; i < 5000; i++) {
+		if (i % 7 == 6)
+			del(journal, 1 + i % 20);
+		else
+			put(journal, 1 + i % 20, i);
+
+		EXITIF(rpl_journal_records(journal) > 1024,
+						"Not compacted at %u", i);
+	}
+
+	journal = reopen(journal, "Compacted");
+
+	EXITIF(!rpl_journal_compact(journal), "Explicit compaction failed");
+	EXITIF(rpl_journal_records(journal) > 20, "%u records left",
+					rpl_journal_records(journal));
+	EXITIF(file_size(path) != HDR_LEN +
+			(off_t) rpl_journal_records(journal) * REC_LEN,
+						"Size does not match records");
+
+	journal = reopen(journal, "Compacted reopen");
+	rpl_journal_close(journal);
+
+	/* A compaction interrupted before the rename leaves the journal */
+	snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+	close(open(tmp_path, O_WRONLY | O_CREAT, 0600));
+	file_append(tmp_path, "MRPL\1\0\0\0garbage", 15);
+
+	journal = reopen(NULL, "Interrupted compaction");
+	EXITIF(!access(tmp_path, F_OK), "Compaction leftover not removed");
+
+	rpl_journal_close(journal);
+}
+
+/*
+ * Simulates power loss at every octet offset: whatever prefix of the log
+ * reached the disk, the journal must open to exactly the state after the
+ * last complete record.
+ */
+static void test_crash_points(void)
+{
+	struct rpl_journal *journal;
+	char copy[PATH_MAX + 5];
+	uint8_t *data;
+	uint32_t ops[40][2];
+	off_t size, cut;
+	unsigned int i;
+	int fd;
+
+	l_info("[Crash points]");
+
+	model_reset();
+	srand(1);
+
+	journal = rpl_journal_open(path, NULL, NULL);
+
+	for (i = 0; i < L_ARRAY_SIZE(ops); i++) {
+		ops[i][0] = 1 + rand() % 16;
+		ops[i][1] = rand() % 8 ? (uint32_t) (rand() & SEQ_MASK) :
+									NO_SEQ;
+
+		if (ops[i][1] == NO_SEQ)
+			del(journal, ops[i][0]);
+		else
+			put(journal, ops[i][0], ops[i][1]);
+	}
+
+	rpl_journal_close(journal);
+
+	size = file_size(path);
+	data = l_malloc(size);
+	fd = open(path, O_RDONLY);
+	EXITIF(fd < 0 || read(fd, data, size) != size, "Read failed");
+	close(fd);
+
+	snprintf(copy, sizeof(copy), "%s.copy", path);
+
+	for (cut = HDR_LEN; cut <= size; cut++) {
+		unsigned int complete = (cut - HDR_LEN) / REC_LEN;
+
+		fd = open(copy, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+		EXITIF(fd < 0 || write(fd, data, cut) != cut, "Write failed");
+		close(fd);
+
+		memset(model, 0xff, sizeof(model));
+		for (i = 0; i < complete; i++)
+			model[ops[i][0]] = ops[i][1];
+
+		journal = reopen_file(NULL, copy, "Crash point");
+
+		EXITIF(rpl_journal_records(journal) != complete,
+					"Cut at %u: %u records", (unsigned int) cut,
+					rpl_journal_records(journal));
+
+		rpl_journal_close(journal);
+	}
+
+	unlink(copy);
+	l_free(data);
+}
+
+int main(int argc, char *argv[])
+{
+	l_log_set_stderr();
+
+	snprintf(tmp_dir, sizeof(tmp_dir), "/tmp/mesh-rpl-XXXXXX");
+	EXITIF(!mkdtemp(tmp_dir), "Failed to create %s", tmp_dir);
+	snprintf(path, sizeof(path), "%s/00000000.journal", tmp_dir);
+
+	test_basic();
+	test_torn_tail();
+	test_corruption();
+	test_compaction();
+	test_crash_points();
+
+	unlink(path);
+	rmdir(tmp_dir);
+
+	return 0;
+}